@@ -99,6 +99,7 @@ namespace LucreApp
             gameObjectLabel += label + std::string(", entity: ") + std::to_string(static_cast<int>(entity));
             ImGui::SliderInt(gameObjectLabel.c_str(), &m_SelectedModel, 0, m_MaxModels);
         }
+        ImGui::Text("registry contention: %llu", static_cast<unsigned long long>(registry.GetContentionCount()));
 
         if (m_SelectedModel != m_SelectedModelPrevious)
         {
@@ -0,0 +1,183 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include <algorithm>
+
+#include "core.h"
+#include "engine.h"
+#include "gui/Common/UI/layoutBenchmark.h"
+#include "renderer/skeletalAnimation/skeletalAnimationBenchmark.h"
+#include "scene/transformHierarchyBenchmark.h"
+
+#include "benchmark.h"
+#include "lucre.h"
+#include "UI/UI.h"
+
+namespace LucreApp
+{
+    void Benchmark::Statistic::Add(float milliseconds)
+    {
+        m_Sum += milliseconds;
+        m_Max = std::max(m_Max, milliseconds);
+        ++m_Count;
+    }
+
+    Benchmark::Benchmark(GameState& gameState, Renderer* renderer, uint framesPerScene)
+        : m_GameState{gameState}, m_Renderer{renderer}, m_FramesPerScene{framesPerScene}, m_LoadStart{Clock::now()}
+    {
+        LOG_APP_INFO("benchmark: {0} frames per scene", m_FramesPerScene);
+    }
+
+    void Benchmark::BeginFrame() { m_FrameStart = Clock::now(); }
+
+    void Benchmark::EndFrame()
+    {
+        float frameMilliseconds = std::chrono::duration<float, std::milli>(Clock::now() - m_FrameStart).count();
+        GameState::State state = m_GameState.GetState();
+        bool isLevel = static_cast<int>(state) > static_cast<int>(GameState::State::CUTSCENE);
+
+        switch (m_Phase)
+        {
+            case Phase::LOADING:
+            {
+                if (m_Scenes.empty())
+                {
+                    // the level after the splash screen comes first, it was loaded during the splash screen
+                    if (!isLevel)
+                    {
+                        break;
+                    }
+                    m_Scenes.push_back(state);
+                    for (int scene = static_cast<int>(GameState::State::MAIN);
+                         scene < static_cast<int>(GameState::State::MAX_STATES); ++scene)
+                    {
+                        if (static_cast<GameState::State>(scene) != state)
+                        {
+                            m_Scenes.push_back(static_cast<GameState::State>(scene));
+                        }
+                    }
+                }
+
+                GameState::State scene = m_Scenes[m_SceneIndex];
+                if (!m_Loaded && m_GameState.IsLoaded(scene))
+                {
+                    m_Loaded = true;
+                    SceneResult result{};
+                    result.m_Scene = scene;
+                    result.m_LoadMilliseconds =
+                        std::chrono::duration<float, std::milli>(Clock::now() - m_LoadStart).count();
+                    m_Results.push_back(result);
+                }
+                if (m_Loaded && (state == scene))
+                {
+                    m_Phase = Phase::WARMUP;
+                    m_FrameCounter = 0;
+                }
+                break;
+            }
+            case Phase::WARMUP:
+            {
+                if (++m_FrameCounter == WARMUP_FRAMES)
+                {
+                    m_Phase = Phase::MEASURING;
+                    m_FrameCounter = 0;
+                }
+                break;
+            }
+            case Phase::MEASURING:
+            {
+                SceneResult& result = m_Results.back();
+                auto const& recordTimes = m_Renderer->GetRecordTimes();
+                if (m_PhaseNames.empty())
+                {
+                    for (auto const& recordTime : recordTimes)
+                    {
+                        m_PhaseNames.push_back(recordTime.m_Name);
+                    }
+                }
+                result.m_Phases.resize(m_PhaseNames.size());
+                result.m_Frame.Add(frameMilliseconds);
+                for (uint index = 0; index < std::min(recordTimes.size(), result.m_Phases.size()); ++index)
+                {
+                    result.m_Phases[index].Add(recordTimes[index].m_Milliseconds);
+                }
+
+                if (++m_FrameCounter == m_FramesPerScene)
+                {
+                    result.m_CameraCulling = m_Renderer->GetCullingStatistics(FrustumCuller::CAMERA);
+                    if (Scene* scene = m_GameState.GetScene(result.m_Scene))
+                    {
+                        RunSkeletalAnimationBenchmark(scene->GetRegistry(), m_GameState.StateToString(result.m_Scene));
+                    }
+                    ++m_SceneIndex;
+                    if (m_SceneIndex == m_Scenes.size())
+                    {
+                        m_Phase = Phase::FINISHED;
+                        Report();
+                        if (UI::g_ScreenManager)
+                        {
+                            SCREEN_UI::RunLayoutBenchmark(*UI::g_ScreenManager->getUIContext());
+                        }
+                        RunTransformHierarchyBenchmark();
+                        Engine::m_Engine->Shutdown();
+                    }
+                    else
+                    {
+                        RequestScene();
+                    }
+                }
+                break;
+            }
+            case Phase::FINISHED:
+            {
+                break;
+            }
+        }
+    }
+
+    // switch levels like the stress test in Lucre::Start() does, through the cut scene
+    void Benchmark::RequestScene()
+    {
+        m_Phase = Phase::LOADING;
+        m_Loaded = false;
+        m_LoadStart = Clock::now();
+        SceneChangedEvent event(m_Scenes[m_SceneIndex]);
+        Lucre::m_Application->OnAppEvent(event);
+    }
+
+    void Benchmark::Report() const
+    {
+        LOG_APP_INFO("benchmark: {0} frames per scene, {1} warm-up frames not measured", m_FramesPerScene, WARMUP_FRAMES);
+        for (auto const& result : m_Results)
+        {
+            LOG_APP_INFO("{0}: load {1:.1f} ms, frame avg {2:.3f} ms max {3:.3f} ms, camera pass {4} drawn {5} culled",
+                         m_GameState.StateToString(result.m_Scene), result.m_LoadMilliseconds, result.m_Frame.Average(),
+                         result.m_Frame.m_Max, result.m_CameraCulling.m_Drawn, result.m_CameraCulling.m_Culled);
+            for (uint index = 0; index < result.m_Phases.size(); ++index)
+            {
+                LOG_APP_INFO("    {0}: avg {1:.3f} ms max {2:.3f} ms", m_PhaseNames[index], result.m_Phases[index].Average(),
+                             result.m_Phases[index].m_Max);
+            }
+        }
+    }
+} // namespace LucreApp
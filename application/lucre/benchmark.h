@@ -0,0 +1,106 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "engine.h"
+#include "renderer/renderer.h"
+
+#include "gameState.h"
+
+namespace LucreApp
+{
+    // Runs all game levels for a number of frames and logs the CPU time per frame and per phase,
+    // started with "--benchmark <frames>" (headless, see RendererAPI::HEADLESS).
+    // BeginFrame() and EndFrame() enclose the frame of the application, EndFrame() switches the levels.
+    // The key lookup of the animated characters of each level is benchmarked after its frames
+    // (see RunSkeletalAnimationBenchmark()).
+    // Finally, the layout of a large synthetic view tree and the transform update of a large synthetic scene graph
+    // are benchmarked (see SCREEN_UI::RunLayoutBenchmark() and RunTransformHierarchyBenchmark()).
+    class Benchmark
+    {
+
+    public:
+        Benchmark(GameState& gameState, Renderer* renderer, uint framesPerScene);
+
+        void BeginFrame();
+        void EndFrame();
+
+    private:
+        using Clock = std::chrono::high_resolution_clock;
+
+        // frames after a level was entered that are not measured (tile streaming, first animation update)
+        static constexpr uint WARMUP_FRAMES = 10;
+
+        enum class Phase
+        {
+            LOADING,
+            WARMUP,
+            MEASURING,
+            FINISHED
+        };
+
+        struct Statistic
+        {
+            void Add(float milliseconds);
+            float Average() const { return m_Count ? m_Sum / m_Count : 0.0f; }
+
+            float m_Sum{0.0f};
+            float m_Max{0.0f};
+            uint m_Count{0};
+        };
+
+        struct SceneResult
+        {
+            GameState::State m_Scene;
+            float m_LoadMilliseconds{0.0f};
+            Statistic m_Frame;
+            std::vector<Statistic> m_Phases; // in the order of Renderer::GetRecordTimes()
+            FrustumCuller::Statistics m_CameraCulling{};
+        };
+
+    private:
+        void RequestScene();
+        void Report() const;
+
+    private:
+        GameState& m_GameState;
+        Renderer* m_Renderer;
+        uint m_FramesPerScene;
+
+        std::vector<GameState::State> m_Scenes;
+        std::vector<SceneResult> m_Results;
+        std::vector<char const*> m_PhaseNames;
+        uint m_SceneIndex{0};
+        uint m_FrameCounter{0};
+        bool m_Loaded{false};
+        Phase m_Phase{Phase::LOADING};
+
+        Clock::time_point m_LoadStart;
+        Clock::time_point m_FrameStart;
+    };
+} // namespace LucreApp
@@ -288,7 +288,7 @@ namespace LucreApp
                     GetScene(state)->Start();
                     SetLoaded(state);
                 };
-                ThreadPool& threadPool = Engine::m_Engine->m_PoolPrimary;
+                ThreadPool& threadPool = Engine::m_Engine->m_PoolSecondary;
                 std::future<void> future = threadPool.SubmitTask(lambda);
                 break;
             }
@@ -303,7 +303,7 @@ namespace LucreApp
                     GetScene(state)->Start();
                     SetLoaded(state);
                 };
-                ThreadPool& threadPool = Engine::m_Engine->m_PoolPrimary;
+                ThreadPool& threadPool = Engine::m_Engine->m_PoolSecondary;
                 std::future<void> future = threadPool.SubmitTask(lambda);
                 break;
             }
@@ -318,7 +318,7 @@ namespace LucreApp
                     GetScene(state)->Start();
                     SetLoaded(state);
                 };
-                ThreadPool& threadPool = Engine::m_Engine->m_PoolPrimary;
+                ThreadPool& threadPool = Engine::m_Engine->m_PoolSecondary;
                 std::future<void> future = threadPool.SubmitTask(lambda);
                 break;
             }
@@ -333,7 +333,7 @@ namespace LucreApp
                     GetScene(state)->Start();
                     SetLoaded(state);
                 };
-                ThreadPool& threadPool = Engine::m_Engine->m_PoolPrimary;
+                ThreadPool& threadPool = Engine::m_Engine->m_PoolSecondary;
                 std::future<void> future = threadPool.SubmitTask(lambda);
                 break;
             }
@@ -349,7 +349,7 @@ namespace LucreApp
                     GetScene(state)->Start();
                     SetLoaded(state);
                 };
-                ThreadPool& threadPool = Engine::m_Engine->m_PoolPrimary;
+                ThreadPool& threadPool = Engine::m_Engine->m_PoolSecondary;
                 std::future<void> future = threadPool.SubmitTask(lambda);
                 break;
             }
@@ -365,7 +365,7 @@ namespace LucreApp
                     GetScene(state)->Start();
                     SetLoaded(state);
                 };
-                ThreadPool& threadPool = Engine::m_Engine->m_PoolPrimary;
+                ThreadPool& threadPool = Engine::m_Engine->m_PoolSecondary;
                 std::future<void> future = threadPool.SubmitTask(lambda);
                 break;
             }
@@ -381,7 +381,7 @@ namespace LucreApp
                     GetScene(state)->Start();
                     SetLoaded(state);
                 };
-                ThreadPool& threadPool = Engine::m_Engine->m_PoolPrimary;
+                ThreadPool& threadPool = Engine::m_Engine->m_PoolSecondary;
                 std::future<void> future = threadPool.SubmitTask(lambda);
                 break;
             }
@@ -397,7 +397,7 @@ namespace LucreApp
                     GetScene(state)->Start();
                     SetLoaded(state);
                 };
-                ThreadPool& threadPool = Engine::m_Engine->m_PoolPrimary;
+                ThreadPool& threadPool = Engine::m_Engine->m_PoolSecondary;
                 std::future<void> future = threadPool.SubmitTask(lambda);
                 break;
             }
@@ -412,7 +412,7 @@ namespace LucreApp
                     GetScene(state)->Start();
                     SetLoaded(state);
                 };
-                ThreadPool& threadPool = Engine::m_Engine->m_PoolPrimary;
+                ThreadPool& threadPool = Engine::m_Engine->m_PoolSecondary;
                 std::future<void> future = threadPool.SubmitTask(lambda);
                 break;
             }
@@ -78,6 +78,12 @@ namespace LucreApp
         auto position = glm::vec3(0.0f, 0.0f, 1.0f);
         auto direction = glm::vec3(0.0f, 0.0f, -1.0f);
         camera.SetViewDirection(position, direction);
+
+        uint benchmarkFrames = Engine::m_Engine->GetBenchmarkFrames();
+        if (benchmarkFrames)
+        {
+            m_Benchmark = std::make_unique<Benchmark>(m_GameState, m_Renderer, benchmarkFrames);
+        }
 // #define STRESS_TEST
 #ifdef STRESS_TEST
         { // stress test scene changing
@@ -124,7 +130,8 @@ namespace LucreApp
                 }
                 return true;
             };
-            m_StressTestFuture = Engine::m_Engine->m_PoolPrimary.SubmitTask(stressTest);
+            // runs until shutdown, a frame-critical job would block a thread that a frame waits for
+            m_StressTestFuture = Engine::m_Engine->m_PoolSecondary.SubmitTask(stressTest);
         }
 #endif
         return true;
@@ -134,13 +141,17 @@ namespace LucreApp
     {
         m_GameState.Stop();
 #ifdef STRESS_TEST
-        m_StressTestFuture.get();
+        Engine::m_Engine->m_PoolSecondary.GetResult(m_StressTestFuture);
 #endif
     }
 
     void Lucre::OnUpdate(const Timestep& timestep)
     {
         m_CurrentScene = m_GameState.OnUpdate();
+        if (m_Benchmark)
+        {
+            m_Benchmark->BeginFrame();
+        }
         m_CurrentScene->OnUpdate(timestep);
 
         // update/render layer stack
@@ -158,6 +169,13 @@ namespace LucreApp
         }
 
         m_Renderer->EndScene();
+
+        // sync point of the pipelined frame loop, the next frame has been simulated
+        m_CurrentScene->FinishSimulation();
+        if (m_Benchmark)
+        {
+            m_Benchmark->EndFrame();
+        }
     }
 
     void Lucre::OnResize()
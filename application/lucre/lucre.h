@@ -36,6 +36,7 @@
 #include "appSettings.h"
 #include "gameState.h"
 #include "appEvent.h"
+#include "benchmark.h"
 #include "UI/UIControllerIcon.h"
 #include "UI/UI.h"
 
@@ -92,5 +93,6 @@ namespace LucreApp
         bool m_DebugWindowIsRunning;
 
         std::future<bool> m_StressTestFuture;
+        std::unique_ptr<Benchmark> m_Benchmark; // "--benchmark <frames>"
     };
 } // namespace LucreApp
@@ -20,19 +20,18 @@
    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <algorithm>
+
 #include "simdjson.h"
 #include "auxiliary/file.h"
 #include "auxiliary/random.h"
 #include "particleSystem/snow.h"
-#include "renderer/instanceBuffer.h"
-#include "renderer/builder/fastgltfBuilder.h"
 
 using namespace simdjson;
 
 namespace GfxRenderEngine
 {
-    Snow::Snow(Scene& scene, std::string const& jsonFile)
-        : m_Scene{scene}, m_Registry{scene.GetRegistry()}, m_Dictionary{scene.GetDictionary()}
+    Snow::Snow(std::string const& jsonFile)
     {
         // load JSON particle system description
         ParseSysDescription(jsonFile);
@@ -42,84 +41,69 @@ namespace GfxRenderEngine
             return;
         }
 
-        // load model with m_PoolSize instances
-        std::vector<entt::entity> snowflakeFirstInstances;
-        {
-            auto& dictionaryPrefix = m_SysDescription.m_DictionaryPrefix.value();
-            auto& model = m_SysDescription.m_Model.value();
-            auto& sceneGraph = m_Scene.GetSceneGraph();
-            auto& numberOfInstances = m_SysDescription.m_PoolSize.value();
-
-            // create group node
-            auto entity = m_Registry.Create();
-            auto name = dictionaryPrefix + "::" + model + "::root";
-            int groupNode = sceneGraph.CreateNode(SceneGraph::ROOT_NODE, entity, name, m_Dictionary);
-            TransformComponent transform{};
-            m_Registry.emplace<TransformComponent>(entity, transform);
-
-            FastgltfBuilder builder(model, m_Scene, groupNode);
-            builder.SetDictionaryPrefix(dictionaryPrefix);
-            m_Initialized = builder.Load(numberOfInstances, snowflakeFirstInstances, NO_SCENE_GRAPH);
-        }
-
-        if (!m_Initialized || !snowflakeFirstInstances.size())
+        // all snowflakes are drawn with one instanced draw call of a shared quad
+        m_Initialized = m_Spritesheet.AddSpritesheetRow(m_SysDescription.m_Sprite.value(), 1 /* frames */);
+        if (!m_Initialized)
         {
-            LOG_CORE_CRITICAL("Snow::Snow failed to initialize! (load model)");
+            LOG_CORE_CRITICAL("Snow::Snow failed to initialize! (load sprite)");
             return;
         }
+        auto poolSize = m_SysDescription.m_PoolSize.value();
+        m_ParticleSystem = std::make_shared<ParticleSystem>(poolSize, &m_Spritesheet, 1.0f /* amplification */);
 
-        // set up particles
+        // fill the volume
+        auto& vertex1 = m_SysDescription.m_Vertex1.value();
+        auto& vertex2 = m_SysDescription.m_Vertex2.value();
+        auto volumeHeight = (vertex2.y - vertex1.y) / 2.0f;
+        for (uint index = 0; index < poolSize; ++index)
         {
-            m_ParticlePool.resize(m_SysDescription.m_PoolSize.value());
-            auto prefix = std::string(m_SysDescription.m_DictionaryPrefix.value()) + "::";
-            auto& vertex1 = m_SysDescription.m_Vertex1.value();
-            auto& vertex2 = m_SysDescription.m_Vertex2.value();
-            auto volumeSize = (vertex2 - vertex1) / 2.0f;
-            auto& snowflake = snowflakeFirstInstances[0];
-
-            if (snowflake != entt::null)
-            {
-                auto& instances = m_Registry.get<InstanceTag>(snowflake).m_Instances;
-                uint index{0};
-                for (auto& particle : m_ParticlePool)
-                {
-                    particle.m_RotationSpeed = {0.0f, 0.0f, EngineCore::RandomPlusMinusOne()};
-                    particle.m_Velocity = {0.0f, -1.0f + EngineCore::RandomPlusMinusOne(), 0.0f};
-
-                    auto& transform = m_Registry.get<TransformComponent>(instances[index]);
-                    particle.m_Transform = &transform;
-                    transform.SetRotation(
-                        {glm::half_pi<float>(), 0.0f, glm::pi<float>() * EngineCore::RandomPlusMinusOne()});
-                    transform.SetTranslation(
-                        {(vertex1.x + volumeSize.x) + (volumeSize.x * EngineCore::RandomPlusMinusOne()),
-                         (vertex1.y + volumeSize.y) + (volumeSize.y * EngineCore::RandomPlusMinusOne()),
-                         (vertex1.z + volumeSize.z) + (volumeSize.z * EngineCore::RandomPlusMinusOne())});
-                    transform.SetScale(0.014f);
-                    ++index;
-                }
-            }
+            Emit((vertex1.y + volumeHeight) + (volumeHeight * EngineCore::RandomPlusMinusOne()));
         }
     }
 
-    void Snow::OnUpdate(Timestep timestep, TransformComponent& cameraTransform)
+    // a snowflake falls from height to the bottom of the volume, where its life ends
+    void Snow::Emit(float height)
     {
-        ZoneScopedNC("Snow::OnUpdate", 0x00ff00);
         auto& vertex1 = m_SysDescription.m_Vertex1.value();
         auto& vertex2 = m_SysDescription.m_Vertex2.value();
-        for (auto& particle : m_ParticlePool)
+        auto volumeSize = (vertex2 - vertex1) / 2.0f;
+
+        ParticleSystem::Specification spec{};
+        spec.m_Position = {(vertex1.x + volumeSize.x) + (volumeSize.x * EngineCore::RandomPlusMinusOne()), height,
+                           (vertex1.z + volumeSize.z) + (volumeSize.z * EngineCore::RandomPlusMinusOne())};
+        spec.m_Velocity = {0.0f, -1.0f + EngineCore::RandomPlusMinusOne(), 0.0f};
+        spec.m_Rotation = {0.0f, 0.0f, glm::pi<float>() * EngineCore::RandomPlusMinusOne()};
+        spec.m_RotationSpeed = {0.0f, 0.0f, EngineCore::RandomPlusMinusOne()};
+        spec.m_StartColor = glm::vec4{1.0f};
+        spec.m_EndColor = glm::vec4{1.0f};
+        spec.m_StartSize = PARTICLE_SIZE;
+        spec.m_FinalSize = PARTICLE_SIZE;
+        float speed = std::max(-spec.m_Velocity.y, 0.01f);
+        spec.m_LifeTime = std::chrono::duration<float>((height - vertex1.y) / speed);
+
+        ParticleSystem::Specification variation{}; // the randomness is in spec
+        m_ParticleSystem->Emit(spec, variation);
+    }
+
+    void Snow::OnUpdate(Timestep timestep, TransformComponent& cameraTransform)
+    {
+        ZoneScopedNC("Snow::OnUpdate", 0x00ff00);
+        if (!m_Initialized)
         {
-            auto& transform = *particle.m_Transform;
-            float rotationSpeedZ = particle.m_RotationSpeed.z;
-            transform.AddRotation({0.0f, 0.0f, timestep * rotationSpeedZ});
-            transform.SetRotationY(cameraTransform.GetRotation().y);
+            return;
+        }
 
-            transform.AddTranslation(timestep * particle.m_Velocity);
-            if (transform.GetTranslation().y <= vertex1.y)
-            {
-                transform.AddTranslation({0.0f, vertex2.y + vertex1.y, 0.0f});
-            }
-            transform.SetMat4Global();
+        // respawn the snowflakes that reached the bottom at the top of the volume,
+        // before OnUpdate() so that their instance data is written this frame
+        auto& vertex2 = m_SysDescription.m_Vertex2.value();
+        uint respawnCount = m_ParticleSystem->GetCapacity() - m_ParticleSystem->GetAliveCount();
+        for (uint index = 0; index < respawnCount; ++index)
+        {
+            Emit(vertex2.y);
         }
+
+        m_ParticleSystem->SetRotationY(cameraTransform.GetRotation().y);
+        m_ParticleSystem->OnUpdate(timestep);
     }
 
     void Snow::ParseSysDescription(std::string const& jsonFile)
@@ -196,12 +180,12 @@ namespace GfxRenderEngine
                 std::string_view sceneAuthor = sceneObject.value().get_string();
                 LOG_CORE_INFO("author: {0}", sceneAuthor);
             }
-            else if (sceneObjectKey == "model")
+            else if (sceneObjectKey == "sprite")
             {
                 CORE_ASSERT((sceneObject.value().type() == ondemand::json_type::string), "type must be string");
-                std::string_view model = sceneObject.value().get_string();
-                m_SysDescription.m_Model = model;
-                LOG_CORE_INFO("author: {0}", model);
+                std::string_view sprite = sceneObject.value().get_string();
+                m_SysDescription.m_Sprite = sprite;
+                LOG_CORE_INFO("sprite: {0}", sprite);
             }
             else if (sceneObjectKey == "pool size")
             {
@@ -209,12 +193,6 @@ namespace GfxRenderEngine
                 int64 poolSize = sceneObject.value().get_int64();
                 m_SysDescription.m_PoolSize = poolSize;
             }
-            else if (sceneObjectKey == "prefix dictionary")
-            {
-                CORE_ASSERT((sceneObject.value().type() == ondemand::json_type::string), "type must be string");
-                std::string_view prefix = sceneObject.value().get_string();
-                m_SysDescription.m_DictionaryPrefix = prefix;
-            }
             else if (sceneObjectKey == "cubic volume vertex 0,0,0")
             {
                 CORE_ASSERT((sceneObject.value().type() == ondemand::json_type::array), "type must be array");
@@ -227,11 +205,10 @@ namespace GfxRenderEngine
             }
         }
         auto& descr = m_SysDescription;
-        m_Initialized = descr.m_Model.has_value() &&            //
-                        descr.m_PoolSize.has_value() &&         //
-                        descr.m_DictionaryPrefix.has_value() && //
-                        descr.m_Vertex1.has_value() &&          //
-                        descr.m_Vertex2.has_value();            //
+        m_Initialized = descr.m_Sprite.has_value() &&   //
+                        descr.m_PoolSize.has_value() && //
+                        descr.m_Vertex1.has_value() &&  //
+                        descr.m_Vertex2.has_value();    //
         CORE_ASSERT(m_Initialized, "JSON particle system description did not load properly");
     }
 } // namespace GfxRenderEngine
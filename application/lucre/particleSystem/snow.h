@@ -22,9 +22,12 @@
 
 #pragma once
 
+#include <memory>
+
 #include "engine.h"
-#include "scene/scene.h"
 #include "scene/components.h"
+#include "scene/particleSystem.h"
+#include "sprite/spritesheet.h"
 #include "auxiliary/timestep.h"
 
 namespace GfxRenderEngine
@@ -33,38 +36,33 @@ namespace GfxRenderEngine
     {
 
     public:
-        Snow(Scene& scene, std::string const& jsonFile);
+        Snow(std::string const& jsonFile);
+
+        Snow(Snow const&) = delete;
+        Snow& operator=(Snow const&) = delete;
+
         void OnUpdate(Timestep timestep, TransformComponent& cameraTransform);
+        ParticleSystem* GetParticleSystem() { return m_ParticleSystem.get(); }
 
     private:
         struct SysDescription
         {
             std::optional<uint> m_PoolSize{0};
-            std::optional<std::string> m_Model;
-            std::optional<std::string> m_DictionaryPrefix;
+            std::optional<std::string> m_Sprite;
             std::optional<glm::vec3> m_Vertex1; // 0,0,0 coordinate for cubic snow volume
             std::optional<glm::vec3> m_Vertex2; // 1,1,1 coordinate for cubic snow volume
         };
 
-        struct Particle
-        {
-            glm::vec3 m_Velocity;
-            glm::vec3 m_RotationSpeed;
-            TransformComponent* m_Transform;
-        };
-
     private:
-        static constexpr double SUPPORTED_FILE_FORMAT_VERSION = 1.2;
+        static constexpr double SUPPORTED_FILE_FORMAT_VERSION = 2.0;
+        static constexpr float PARTICLE_SIZE = 0.035f; // half the edge length of the quad
         void ParseSysDescription(std::string const& jsonFile);
+        void Emit(float height);
 
     private:
-        static constexpr bool NO_SCENE_GRAPH = false;
-        Scene& m_Scene;
-        Registry& m_Registry;
-        Dictionary& m_Dictionary;
         SysDescription m_SysDescription;
         bool m_Initialized{false};
-        uint m_PoolIndex{0};
-        std::vector<Particle> m_ParticlePool;
+        SpriteSheet m_Spritesheet;
+        std::shared_ptr<ParticleSystem> m_ParticleSystem;
     };
 } // namespace GfxRenderEngine
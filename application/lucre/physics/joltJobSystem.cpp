@@ -0,0 +1,86 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <thread>
+
+#include "physics/joltJobSystem.h"
+
+namespace GfxRenderEngine
+{
+    JoltJobSystem::JoltJobSystem(GfxRenderEngine::JobSystem& jobSystem, JPH::uint maxJobs, JPH::uint maxBarriers)
+        : m_JobSystem{jobSystem}
+    {
+        JobSystemWithBarrier::Init(maxBarriers);
+        m_Jobs.Init(maxJobs, maxJobs);
+    }
+
+    int JoltJobSystem::GetMaxConcurrency() const { return static_cast<int>(m_JobSystem.GetWorkerCount()) + 1; }
+
+    JPH::JobHandle JoltJobSystem::CreateJob(const char* name, JPH::ColorArg color, const JobFunction& jobFunction,
+                                            JPH::uint32 numDependencies)
+    {
+        // loop until a job is available in the free list
+        JPH::uint32 index;
+        for (;;)
+        {
+            index = m_Jobs.ConstructObject(name, color, this, jobFunction, numDependencies);
+            if (index != JPH::FixedSizeFreeList<Job>::cInvalidObjectIndex)
+            {
+                break;
+            }
+            JPH_ASSERT(false, "No jobs available!");
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        Job* job = &m_Jobs.Get(index);
+
+        // the handle keeps a reference, the job may complete before this function returns
+        JobHandle handle(job);
+        if (numDependencies == 0)
+        {
+            QueueJob(job);
+        }
+        return handle;
+    }
+
+    void JoltJobSystem::QueueJob(Job* job)
+    {
+        // physics jobs are on the critical path of the frame;
+        // a barrier may execute the job first, Execute() is a no-op then
+        job->AddRef();
+        m_JobSystem.Submit(GfxRenderEngine::JobSystem::Priority::FrameCritical,
+                           [job]()
+                           {
+                               job->Execute();
+                               job->Release();
+                           });
+    }
+
+    void JoltJobSystem::QueueJobs(Job** jobs, JPH::uint numJobs)
+    {
+        for (Job **job = jobs, **jobEnd = jobs + numJobs; job < jobEnd; ++job)
+        {
+            QueueJob(*job);
+        }
+    }
+
+    void JoltJobSystem::FreeJob(Job* job) { m_Jobs.DestructObject(job); }
+} // namespace GfxRenderEngine
@@ -0,0 +1,58 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Core/FixedSizeFreeList.h>
+#include <Jolt/Core/JobSystemWithBarrier.h>
+
+#include "auxiliary/jobSystem.h"
+
+namespace GfxRenderEngine
+{
+
+    // runs the jobs of Jolt Physics on the job system of the engine
+    // (instead of JPH::JobSystemThreadPool with its own set of threads);
+    // GfxRenderEngine::JobSystem must be qualified, the base class injects the name JPH::JobSystem
+    class JoltJobSystem final : public JPH::JobSystemWithBarrier
+    {
+
+    public:
+        JoltJobSystem(GfxRenderEngine::JobSystem& jobSystem, JPH::uint maxJobs, JPH::uint maxBarriers);
+        virtual ~JoltJobSystem() override = default;
+
+        // the thread calling PhysicsSystem::Update() also runs jobs while waiting for a barrier
+        virtual int GetMaxConcurrency() const override;
+        virtual JobHandle CreateJob(const char* name, JPH::ColorArg color, const JobFunction& jobFunction,
+                                    JPH::uint32 numDependencies = 0) override;
+
+    protected:
+        virtual void QueueJob(Job* job) override;
+        virtual void QueueJobs(Job** jobs, JPH::uint numJobs) override;
+        virtual void FreeJob(Job* job) override;
+
+    private:
+        GfxRenderEngine::JobSystem& m_JobSystem;
+        JPH::FixedSizeFreeList<Job> m_Jobs;
+    };
+} // namespace GfxRenderEngine
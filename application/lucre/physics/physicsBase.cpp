@@ -35,6 +35,7 @@
 #include "physics/physicsBase.h"
 #include "renderer/instanceBuffer.h"
 #include "renderer/model.h"
+#include "renderer/rendererAPI.h"
 #include "renderer/builder/fastgltfVertexLoader.h"
 
 namespace GfxRenderEngine
@@ -61,17 +62,21 @@ namespace GfxRenderEngine
         JPH::RegisterTypes();
 
         m_pTempAllocator = std::make_unique<JPH::TempAllocatorImpl>(10 * 1024 * 1024);
-        m_pJobSystem = std::make_unique<JPH::JobSystemThreadPool>(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers,
-                                                                  static_cast<int>(std::thread::hardware_concurrency()) - 1);
+        m_pJobSystem =
+            std::make_unique<JoltJobSystem>(Engine::m_Engine->m_JobSystem, JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers);
 
         m_PhysicsSystem.Init(cMaxBodies, cNumBodyMutexes, cMaxBodyPairs, cMaxContactConstraints, broad_phase_layer_interface,
                              object_vs_broadphase_layer_filter, object_vs_object_layer_filter);
-        // Create renderer
-        m_Renderer = std::make_unique<RendererVK>();
-        m_Renderer->Initialize();
+        // the Jolt debug renderer draws with Vulkan
+        if (RendererAPI::GetAPI() == RendererAPI::VULKAN)
+        {
+            // Create renderer
+            m_Renderer = std::make_unique<RendererVK>();
+            m_Renderer->Initialize();
 
-        // debug renderer
-        m_DebugRenderer = std::make_unique<DebugRendererImp>(m_Renderer.get(), nullptr /*m_Font.get()*/);
+            // debug renderer
+            m_DebugRenderer = std::make_unique<DebugRendererImp>(m_Renderer.get(), nullptr /*m_Font.get()*/);
+        }
 
         m_DrawSettings.mDrawShape = true;
         m_DrawSettings.mDrawBoundingBox = true;
@@ -32,7 +32,6 @@
 #include <Jolt/RegisterTypes.h>
 #include <Jolt/Core/Factory.h>
 #include <Jolt/Core/TempAllocator.h>
-#include <Jolt/Core/JobSystemThreadPool.h>
 #include <Jolt/Physics/PhysicsSettings.h>
 #include <Jolt/Physics/PhysicsSystem.h>
 #include <Jolt/Physics/Collision/Shape/BoxShape.h>
@@ -59,6 +58,7 @@
 #include "engine.h"
 #include "scene/scene.h"
 #include "physics/physics.h"
+#include "physics/joltJobSystem.h"
 #include "auxiliary/timestep.h"
 
 namespace GfxRenderEngine
@@ -276,10 +276,8 @@ namespace GfxRenderEngine
         // malloc / free.
         std::unique_ptr<JPH::TempAllocatorImpl> m_pTempAllocator;
 
-        // We need a job system that will execute physics jobs on multiple threads. Typically
-        // you would implement the JobSystem interface yourself and let Jolt Physics run on top
-        // of your own job scheduler. JobSystemThreadPool is an example implementation.
-        std::unique_ptr<JPH::JobSystemThreadPool> m_pJobSystem;
+        // physics jobs run on the job system of the engine, shared with the thread pools
+        std::unique_ptr<JoltJobSystem> m_pJobSystem;
 
         inline glm::mat4& ConvertToMat4(JPH::RMat44& jphMat) { return *reinterpret_cast<glm::mat4*>(&jphMat); }
         inline JPH::Vec3& ConvertToVec3(glm::vec3& vec3GLM) { return *reinterpret_cast<JPH::Vec3*>(&vec3GLM); }
@@ -48,7 +48,7 @@ namespace LucreApp
         m_IsRunning = true;
 
         m_Renderer = Engine::m_Engine->GetRenderer();
-        m_Renderer->UpdateTransformCache(*this, SceneGraph::ROOT_NODE, glm::mat4(1.0f), false);
+        m_Renderer->UpdateTransformCache(*this);
         ImGUI::m_AmbientLightIntensity = 0.177;
         m_Renderer->SetAmbientLightIntensity(ImGUI::m_AmbientLightIntensity);
 
@@ -221,7 +221,6 @@ namespace LucreApp
             m_CameraController->SetView(cameraTransform.GetMat4Global());
         }
 
-        AnimateHero(timestep);
         { // directional light / shadow maps
             enum ShadowRenderPass
             {
@@ -301,14 +300,18 @@ namespace LucreApp
         // draw new scene
         if (!m_Renderer->BeginFrame(&m_CameraController->GetCamera()))
         {
+            StartSimulation(timestep);
             return;
         }
-        m_Renderer->UpdateTransformCache(*this, SceneGraph::ROOT_NODE, glm::mat4(1.0f), false);
+        m_Renderer->UpdateTransformCache(*this);
+
+        // the render snapshot is complete, update the scene for the next frame
+        StartSimulation(timestep);
+
         m_Renderer->ShowDebugShadowMap(ImGUI::m_ShowDebugShadowMap);
         m_Renderer->SubmitShadows(m_Registry, m_DirectionalLights);
         m_Renderer->Renderpass3D(m_Registry);
 
-        RotateLights(timestep);
         ApplyDebugSettings();
 
         // opaque objects
@@ -329,6 +332,12 @@ namespace LucreApp
         m_Renderer->GUIRenderpass(&SCREEN_ScreenManager::m_CameraController->GetCamera());
     }
 
+    void BeachScene::OnSimulate(const Timestep& timestep)
+    {
+        AnimateHero(timestep);
+        RotateLights(timestep);
+    }
+
     void BeachScene::OnEvent(Event& event)
     {
         EventDispatcher dispatcher(event);
@@ -51,7 +51,7 @@ namespace LucreApp
         m_IsRunning = true;
 
         m_Renderer = Engine::m_Engine->GetRenderer();
-        m_Renderer->UpdateTransformCache(*this, SceneGraph::ROOT_NODE, glm::mat4(1.0f), false);
+        m_Renderer->UpdateTransformCache(*this);
         ImGUI::m_AmbientLightIntensity = 0.177;
         m_Renderer->SetAmbientLightIntensity(ImGUI::m_AmbientLightIntensity);
 
@@ -219,7 +219,6 @@ namespace LucreApp
             m_CameraControllers.GetActiveCameraController()->SetView(cameraTransform.GetMat4Global());
         }
 
-        AnimateHero(timestep);
         if (m_CharacterAnimation)
         {
             m_CharacterAnimation->OnUpdate(timestep);
@@ -244,15 +243,19 @@ namespace LucreApp
         // draw new scene
         if (!m_Renderer->BeginFrame(&m_CameraControllers.GetActiveCameraController()->GetCamera()))
         {
+            StartSimulation(timestep);
             return;
         }
-        m_Renderer->UpdateTransformCache(*this, SceneGraph::ROOT_NODE, glm::mat4(1.0f), false);
+        m_Renderer->UpdateTransformCache(*this);
         m_Renderer->UpdateAnimations(m_Registry, timestep);
+
+        // the render snapshot is complete, update the scene for the next frame
+        StartSimulation(timestep);
+
         m_Renderer->ShowDebugShadowMap(ImGUI::m_ShowDebugShadowMap);
         m_Renderer->SubmitShadows(m_Registry, m_DirectionalLights);
         m_Renderer->Renderpass3D(m_Registry);
 
-        RotateLights(timestep);
         ApplyDebugSettings();
 
         // opaque objects
@@ -273,6 +276,12 @@ namespace LucreApp
         m_Renderer->GUIRenderpass(&SCREEN_ScreenManager::m_CameraController->GetCamera());
     }
 
+    void DessertScene::OnSimulate(const Timestep& timestep)
+    {
+        AnimateHero(timestep);
+        RotateLights(timestep);
+    }
+
     void DessertScene::OnEvent(Event& event)
     {
         EventDispatcher dispatcher(event);
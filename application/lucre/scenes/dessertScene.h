@@ -50,6 +50,8 @@ namespace LucreApp
         virtual void Start() override;
         virtual void Stop() override;
         virtual void OnUpdate(const Timestep& timestep) override;
+        virtual bool SupportsPipelining() const override { return true; }
+        virtual void OnSimulate(const Timestep& timestep) override;
         virtual Camera& GetCamera() override;
         virtual void OnEvent(Event& event) override;
         virtual void OnResize() override;
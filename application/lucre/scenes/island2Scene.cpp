@@ -51,7 +51,7 @@ namespace LucreApp
         m_IsRunning = true;
 
         m_Renderer = Engine::m_Engine->GetRenderer();
-        m_Renderer->UpdateTransformCache(*this, SceneGraph::ROOT_NODE, glm::mat4(1.0f), false);
+        m_Renderer->UpdateTransformCache(*this);
         ImGUI::m_AmbientLightIntensity = 0.177;
         m_Renderer->SetAmbientLightIntensity(ImGUI::m_AmbientLightIntensity);
 
@@ -316,35 +316,6 @@ namespace LucreApp
 
     void Island2Scene::OnUpdate(const Timestep& timestep)
     {
-        if (m_RunLightAnimation)
-        {
-            auto animateLight = [&](int light, Duration delay)
-            {
-                TimePoint currenTime = Engine::m_Engine->GetTime();
-                if (!m_EasingAnimation[light].IsRunning() && (currenTime - m_SceneStartTime > delay))
-                {
-                    m_EasingAnimation[light].Start();
-                }
-                if (m_EasingAnimation[light].IsRunning())
-                {
-                    float speedXY[ANIMATE_X_Y] = {0.0f, 0.0f};
-                    m_EasingAnimation[light].Run(speedXY);
-                    auto& transform = m_Registry.get<TransformComponent>(m_MovingLights[light]);
-                    float speedFactor = timestep * 2.0f;
-                    transform.AddTranslation({speedXY[0] * speedFactor, speedXY[1] * speedFactor, 0.0f});
-                }
-            };
-            std::array<Duration, NUMBER_OF_MOVING_LIGHTS> startDelays{3s, 2s, 1s, 3s, 2s, 1s};
-            int light{0};
-            for (auto& startDelay : startDelays)
-            {
-                if (m_MovingLights[light] != entt::null)
-                {
-                    animateLight(light, startDelay);
-                }
-                ++light;
-            }
-        }
         if (Lucre::m_Application->KeyboardInputIsReleased())
         {
             int activeCameraIndex = m_CameraControllers.GetActiveCameraIndex();
@@ -361,13 +332,6 @@ namespace LucreApp
             m_CameraControllers.GetActiveCameraController()->SetView(cameraTransform.GetMat4Global());
         }
 
-        if (m_Water != entt::null)
-        {
-            auto& transform = m_Registry.get<TransformComponent>(m_Water);
-            transform.AddRotation({0.0f, 0.1f * timestep, 0.0f});
-        }
-
-        AnimateHero(timestep);
         if (m_CharacterAnimation)
         {
             m_CharacterAnimation->OnUpdate(timestep);
@@ -453,15 +417,19 @@ namespace LucreApp
         // draw new scene
         if (!m_Renderer->BeginFrame(&m_CameraControllers.GetActiveCameraController()->GetCamera()))
         {
+            StartSimulation(timestep);
             return;
         }
-        m_Renderer->UpdateTransformCache(*this, SceneGraph::ROOT_NODE, glm::mat4(1.0f), false);
+        m_Renderer->UpdateTransformCache(*this);
         m_Renderer->UpdateAnimations(m_Registry, timestep);
+
+        // the render snapshot is complete, update the scene for the next frame
+        StartSimulation(timestep);
+
         m_Renderer->ShowDebugShadowMap(ImGUI::m_ShowDebugShadowMap);
         m_Renderer->SubmitShadows(m_Registry, m_DirectionalLights);
         m_Renderer->Renderpass3D(m_Registry);
 
-        RotateLights(timestep);
         ApplyDebugSettings();
 
         // opaque objects
@@ -482,6 +450,48 @@ namespace LucreApp
         m_Renderer->GUIRenderpass(&SCREEN_ScreenManager::m_CameraController->GetCamera());
     }
 
+    void Island2Scene::OnSimulate(const Timestep& timestep)
+    {
+        if (m_RunLightAnimation)
+        {
+            auto animateLight = [&](int light, Duration delay)
+            {
+                TimePoint currenTime = Engine::m_Engine->GetTime();
+                if (!m_EasingAnimation[light].IsRunning() && (currenTime - m_SceneStartTime > delay))
+                {
+                    m_EasingAnimation[light].Start();
+                }
+                if (m_EasingAnimation[light].IsRunning())
+                {
+                    float speedXY[ANIMATE_X_Y] = {0.0f, 0.0f};
+                    m_EasingAnimation[light].Run(speedXY);
+                    auto& transform = m_Registry.get<TransformComponent>(m_MovingLights[light]);
+                    float speedFactor = timestep * 2.0f;
+                    transform.AddTranslation({speedXY[0] * speedFactor, speedXY[1] * speedFactor, 0.0f});
+                }
+            };
+            std::array<Duration, NUMBER_OF_MOVING_LIGHTS> startDelays{3s, 2s, 1s, 3s, 2s, 1s};
+            int light{0};
+            for (auto& startDelay : startDelays)
+            {
+                if (m_MovingLights[light] != entt::null)
+                {
+                    animateLight(light, startDelay);
+                }
+                ++light;
+            }
+        }
+
+        if (m_Water != entt::null)
+        {
+            auto& transform = m_Registry.get<TransformComponent>(m_Water);
+            transform.AddRotation({0.0f, 0.1f * timestep, 0.0f});
+        }
+
+        AnimateHero(timestep);
+        RotateLights(timestep);
+    }
+
     void Island2Scene::OnEvent(Event& event)
     {
         EventDispatcher dispatcher(event);
@@ -49,7 +49,7 @@ namespace LucreApp
         m_IsRunning = true;
 
         m_Renderer = Engine::m_Engine->GetRenderer();
-        m_Renderer->UpdateTransformCache(*this, SceneGraph::ROOT_NODE, glm::mat4(1.0f), false);
+        m_Renderer->UpdateTransformCache(*this);
         ImGUI::m_AmbientLightIntensity = 0.12;
         m_Renderer->SetAmbientLightIntensity(ImGUI::m_AmbientLightIntensity);
 
@@ -193,30 +193,7 @@ namespace LucreApp
 
     void MainScene::OnUpdate(const Timestep& timestep)
     {
-        {
-            m_HornAnimation.OnUpdate();
-            if (!m_HornAnimation.IsRunning())
-            {
-                m_HornAnimation.Start();
-            }
-
-            for (uint i = 0; i < m_HornAnimation.GetFrames(); ++i)
-            {
-                auto& currentMesh = m_Registry.get<MeshComponent>(m_Guybrush[i]);
-                currentMesh.m_Enabled = false;
-            }
-
-            uint currentFrame = m_HornAnimation.GetCurrentFrame();
-            auto& currentMesh = m_Registry.get<MeshComponent>(m_Guybrush[currentFrame]);
-            currentMesh.m_Enabled = true;
-        }
-
-        if (m_StartTimer)
-        {
-            m_StartTimer = false;
-            m_LaunchVolcanoTimer.Start();
-        }
-
+        // input is sampled on the main thread
         if (Lucre::m_Application->KeyboardInputIsReleased())
         {
             auto view = m_Registry.view<TransformComponent>();
@@ -225,22 +202,21 @@ namespace LucreApp
             m_KeyboardInputController->MoveInPlaneXZ(timestep, cameraTransform);
             m_CameraController->SetView(cameraTransform.GetMat4Global());
         }
+        ApplyDebugSettings();
 
         // draw new scene
         if (!m_Renderer->BeginFrame(&m_CameraController->GetCamera()))
         {
+            StartSimulation(timestep);
             return;
         }
-        m_Renderer->UpdateTransformCache(*this, SceneGraph::ROOT_NODE, glm::mat4(1.0f), false);
-        m_Renderer->SubmitShadows(m_Registry);
-        m_Renderer->Renderpass3D(m_Registry);
-
-        ApplyDebugSettings();
+        m_Renderer->UpdateTransformCache(*this);
 
-        RotateLights(timestep);
+        // the render snapshot is complete, update the scene for the next frame
+        StartSimulation(timestep);
 
-        SimulatePhysics(timestep);
-        UpdateBananas(timestep);
+        m_Renderer->SubmitShadows(m_Registry);
+        m_Renderer->Renderpass3D(m_Registry);
 
         // opaque objects
         m_Renderer->Submit(*this);
@@ -260,6 +236,39 @@ namespace LucreApp
         m_Renderer->GUIRenderpass(&SCREEN_ScreenManager::m_CameraController->GetCamera());
     }
 
+    void MainScene::OnSimulate(const Timestep& timestep)
+    {
+        {
+            m_HornAnimation.OnUpdate();
+            if (!m_HornAnimation.IsRunning())
+            {
+                m_HornAnimation.Start();
+            }
+
+            // the renderer reads the enabled flags, switch the sprites at the sync point
+            uint currentFrame = m_HornAnimation.GetCurrentFrame();
+            m_Registry.Defer(
+                [this, currentFrame](entt::registry& registry)
+                {
+                    for (uint i = 0; i < m_HornAnimation.GetFrames(); ++i)
+                    {
+                        registry.get<MeshComponent>(m_Guybrush[i]).m_Enabled = (i == currentFrame);
+                    }
+                });
+        }
+
+        if (m_StartTimer)
+        {
+            m_StartTimer = false;
+            m_LaunchVolcanoTimer.Start();
+        }
+
+        RotateLights(timestep);
+
+        SimulatePhysics(timestep);
+        UpdateBananas(timestep);
+    }
+
     void MainScene::OnEvent(Event& event)
     {
         EventDispatcher dispatcher(event);
@@ -50,7 +50,7 @@ namespace LucreApp
         m_IsRunning = true;
 
         m_Renderer = Engine::m_Engine->GetRenderer();
-        m_Renderer->UpdateTransformCache(*this, SceneGraph::ROOT_NODE, glm::mat4(1.0f), false);
+        m_Renderer->UpdateTransformCache(*this);
         ImGUI::m_AmbientLightIntensity = 0.177;
         m_Renderer->SetAmbientLightIntensity(ImGUI::m_AmbientLightIntensity);
 
@@ -365,7 +365,6 @@ namespace LucreApp
             m_CameraController->SetView(cameraTransform.GetMat4Global());
         }
 
-        AnimateHero(timestep);
         if (m_CharacterAnimation)
             m_CharacterAnimation->OnUpdate(timestep);
         SetLightView(m_Lightbulb0, m_LightView0);
@@ -380,15 +379,19 @@ namespace LucreApp
         // draw new scene
         if (!m_Renderer->BeginFrame(&m_CameraController->GetCamera()))
         {
+            StartSimulation(timestep);
             return;
         }
-        m_Renderer->UpdateTransformCache(*this, SceneGraph::ROOT_NODE, glm::mat4(1.0f), false);
+        m_Renderer->UpdateTransformCache(*this);
         m_Renderer->UpdateAnimations(m_Registry, timestep);
+
+        // the render snapshot is complete, update the scene for the next frame
+        StartSimulation(timestep);
+
         m_Renderer->ShowDebugShadowMap(ImGUI::m_ShowDebugShadowMap);
         m_Renderer->SubmitShadows(m_Registry, m_DirectionalLights);
         m_Renderer->Renderpass3D(m_Registry);
 
-        RotateLights(timestep);
         ApplyDebugSettings();
 
         // opaque objects
@@ -400,7 +403,7 @@ namespace LucreApp
 
         // transparent objects
         m_Renderer->NextSubpass();
-        m_Renderer->TransparencyPass(m_Registry, m_VolcanoSmoke.get());
+        m_Renderer->TransparencyPass(m_Registry, {m_VolcanoSmoke.get()});
 
         // post processing
         m_Renderer->PostProcessingRenderpass();
@@ -409,6 +412,12 @@ namespace LucreApp
         m_Renderer->GUIRenderpass(&SCREEN_ScreenManager::m_CameraController->GetCamera());
     }
 
+    void NightScene::OnSimulate(const Timestep& timestep)
+    {
+        AnimateHero(timestep);
+        RotateLights(timestep);
+    }
+
     void NightScene::OnEvent(Event& event)
     {
         EventDispatcher dispatcher(event);
@@ -43,7 +43,7 @@ namespace LucreApp
 {
 
     PBRScene::PBRScene(const std::string& filepath, const std::string& alternativeFilepath)
-        : Scene(filepath, alternativeFilepath), m_SceneLoaderJSON{*this}, m_CandleParticleSystem{*this, "candles.json"},
+        : Scene(filepath, alternativeFilepath), m_SceneLoaderJSON{*this}, m_CandleParticleSystem{"candles.json"},
           m_UseIBL{true}
     {
     }
@@ -55,7 +55,7 @@ namespace LucreApp
         m_IsRunning = true;
 
         m_Renderer = Engine::m_Engine->GetRenderer();
-        m_Renderer->UpdateTransformCache(*this, SceneGraph::ROOT_NODE, glm::mat4(1.0f), false);
+        m_Renderer->UpdateTransformCache(*this);
         ImGUI::m_AmbientLightIntensity = 0.177;
         m_Renderer->SetAmbientLightIntensity(ImGUI::m_AmbientLightIntensity);
 
@@ -443,7 +443,7 @@ namespace LucreApp
         { // set camera view
             int activeCameraIndex = m_CameraControllers.GetActiveCameraIndex();
             auto& cameraTransform = m_Registry.get<TransformComponent>(m_Camera[activeCameraIndex]);
-            m_Renderer->UpdateTransformCache(*this, SceneGraph::ROOT_NODE, glm::mat4(1.0f), false);
+            m_Renderer->UpdateTransformCache(*this);
             m_CameraControllers.GetActiveCameraController()->SetView(cameraTransform.GetMat4Global());
         }
 
@@ -530,7 +530,7 @@ namespace LucreApp
         {
             return;
         }
-        m_Renderer->UpdateTransformCache(*this, SceneGraph::ROOT_NODE, glm::mat4(1.0f), false);
+        m_Renderer->UpdateTransformCache(*this);
         m_Renderer->UpdateAnimations(m_Registry, timestep);
         m_Renderer->ShowDebugShadowMap(ImGUI::m_ShowDebugShadowMap);
         m_Renderer->SubmitShadows(m_Registry, m_DirectionalLights);
@@ -621,7 +621,7 @@ namespace LucreApp
 
             // transparent objects
             m_Renderer->NextSubpass();
-            m_Renderer->TransparencyPass(m_Registry);
+            m_Renderer->TransparencyPass(m_Registry, {m_CandleParticleSystem.GetParticleSystem()});
         }
 
         // physics debug visualization
@@ -43,7 +43,7 @@ namespace LucreApp
 {
 
     Reserved0Scene::Reserved0Scene(const std::string& filepath, const std::string& alternativeFilepath)
-        : Scene(filepath, alternativeFilepath), m_SceneLoaderJSON{*this}, m_CandleParticleSystem{*this, "candles.json"},
+        : Scene(filepath, alternativeFilepath), m_SceneLoaderJSON{*this}, m_CandleParticleSystem{"candles.json"},
           m_LaunchVolcanoTimer(1000)
     {
     }
@@ -55,7 +55,7 @@ namespace LucreApp
         m_IsRunning = true;
 
         m_Renderer = Engine::m_Engine->GetRenderer();
-        m_Renderer->UpdateTransformCache(*this, SceneGraph::ROOT_NODE, glm::mat4(1.0f), false);
+        m_Renderer->UpdateTransformCache(*this);
         ImGUI::m_AmbientLightIntensity = 0.177;
         m_Renderer->SetAmbientLightIntensity(ImGUI::m_AmbientLightIntensity);
 
@@ -553,13 +553,6 @@ namespace LucreApp
                                                    : Physics::VehicleType::CAR;
             SimulatePhysics(timestep, vehicleType);
         }
-        UpdateBananas(timestep);
-
-        if (m_StartTimer)
-        {
-            m_StartTimer = false;
-            m_LaunchVolcanoTimer.Start();
-        }
 
         if (m_CharacterAnimation)
         {
@@ -580,7 +573,7 @@ namespace LucreApp
         { // set camera view
             int activeCameraIndex = m_CameraControllers.GetActiveCameraIndex();
             auto& cameraTransform = m_Registry.get<TransformComponent>(m_Camera[activeCameraIndex]);
-            m_Renderer->UpdateTransformCache(*this, SceneGraph::ROOT_NODE, glm::mat4(1.0f), false);
+            m_Renderer->UpdateTransformCache(*this);
             m_CameraControllers.GetActiveCameraController()->SetView(cameraTransform.GetMat4Global());
         }
 
@@ -665,10 +658,15 @@ namespace LucreApp
         // draw new scene
         if (!m_Renderer->BeginFrame(&m_CameraControllers.GetActiveCameraController()->GetCamera()))
         {
+            StartSimulation(timestep);
             return;
         }
-        m_Renderer->UpdateTransformCache(*this, SceneGraph::ROOT_NODE, glm::mat4(1.0f), false);
+        m_Renderer->UpdateTransformCache(*this);
         m_Renderer->UpdateAnimations(m_Registry, timestep);
+
+        // the render snapshot is complete, update the scene for the next frame
+        StartSimulation(timestep);
+
         m_Renderer->ShowDebugShadowMap(ImGUI::m_ShowDebugShadowMap);
         m_Renderer->SubmitShadows(m_Registry, m_DirectionalLights);
 
@@ -743,7 +741,7 @@ namespace LucreApp
 
             // transparent objects
             m_Renderer->NextSubpass();
-            m_Renderer->TransparencyPass(m_Registry);
+            m_Renderer->TransparencyPass(m_Registry, {m_CandleParticleSystem.GetParticleSystem()});
         }
 
         // physics debug visualization
@@ -759,6 +757,18 @@ namespace LucreApp
         m_Renderer->GUIRenderpass(&SCREEN_ScreenManager::m_CameraController->GetCamera());
     }
 
+    void Reserved0Scene::OnSimulate(const Timestep& timestep)
+    {
+        if (m_StartTimer)
+        {
+            m_StartTimer = false;
+            m_LaunchVolcanoTimer.Start();
+        }
+
+        SimulateBox2D(timestep);
+        UpdateBananas(timestep);
+    }
+
     void Reserved0Scene::OnEvent(Event& event)
     {
         EventDispatcher dispatcher(event);
@@ -948,15 +958,18 @@ namespace LucreApp
 
     void Reserved0Scene::SimulatePhysics(const Timestep& timestep, Physics::VehicleType vehicleType)
     {
-        // box2D
+        // Jolt
+        m_GamepadInputController->MoveVehicle(timestep, m_VehicleControl);
+        m_Physics->OnUpdate(timestep, m_VehicleControl, vehicleType);
+    }
+
+    void Reserved0Scene::SimulateBox2D(const Timestep& timestep)
+    {
         float step = timestep;
 
         int velocityIterations = 6;
         int positionIterations = 2;
         m_World->Step(step, velocityIterations, positionIterations);
-        // Jolt
-        m_GamepadInputController->MoveVehicle(timestep, m_VehicleControl);
-        m_Physics->OnUpdate(timestep, m_VehicleControl, vehicleType);
     }
 
     void Reserved0Scene::UpdateBananas(const Timestep& timestep)
@@ -53,6 +53,8 @@ namespace LucreApp
         virtual void Stop() override;
 
         virtual void OnUpdate(const Timestep& timestep) override;
+        virtual bool SupportsPipelining() const override { return true; }
+        virtual void OnSimulate(const Timestep& timestep) override;
         virtual Camera& GetCamera() override;
         virtual void OnEvent(Event& event) override;
         virtual void OnResize() override;
@@ -70,6 +72,7 @@ namespace LucreApp
         void ResetBananas();
         void UpdateBananas(const Timestep& timestep);
         void SimulatePhysics(const Timestep& timestep, Physics::VehicleType vehicleType);
+        void SimulateBox2D(const Timestep& timestep);
         void SetLightView(const entt::entity lightbulb, const std::shared_ptr<Camera>& lightView);
         void SetDirectionalLight(const entt::entity directionalLight, const entt::entity lightbulb,
                                  const std::shared_ptr<Camera>& lightView, int renderpass);
@@ -238,12 +238,6 @@ namespace LucreApp
             m_CameraController->SetView(cameraTransform.GetMat4Global());
         }
 
-        if (m_Water != entt::null)
-        {
-            auto& transform = m_Registry.get<TransformComponent>(m_Water);
-            transform.AddRotation({0.0f, 0.1f * timestep, 0.0f});
-        }
-
         if (m_CharacterAnimation)
         {
             m_CharacterAnimation->OnUpdate(timestep);
@@ -328,10 +322,15 @@ namespace LucreApp
         // draw new scene
         if (!m_Renderer->BeginFrame(&m_CameraController->GetCamera()))
         {
+            StartSimulation(timestep);
             return;
         }
-        m_Renderer->UpdateTransformCache(*this, SceneGraph::ROOT_NODE, glm::mat4(1.0f), false);
+        m_Renderer->UpdateTransformCache(*this);
         m_Renderer->UpdateAnimations(m_Registry, timestep);
+
+        // the render snapshot is complete, update the scene for the next frame
+        StartSimulation(timestep);
+
         m_Renderer->ShowDebugShadowMap(ImGUI::m_ShowDebugShadowMap);
         m_Renderer->SubmitShadows(m_Registry, m_DirectionalLights);
         m_Renderer->Renderpass3D(m_Registry);
@@ -356,6 +355,15 @@ namespace LucreApp
         m_Renderer->GUIRenderpass(&SCREEN_ScreenManager::m_CameraController->GetCamera());
     }
 
+    void TerrainScene::OnSimulate(const Timestep& timestep)
+    {
+        if (m_Water != entt::null)
+        {
+            auto& transform = m_Registry.get<TransformComponent>(m_Water);
+            transform.AddRotation({0.0f, 0.1f * timestep, 0.0f});
+        }
+    }
+
     void TerrainScene::OnEvent(Event& event)
     {
         EventDispatcher dispatcher(event);
@@ -40,8 +40,12 @@ namespace LucreApp
 
     VolcanoScene::VolcanoScene(const std::string& filepath, const std::string& alternativeFilepath)
         : Scene(filepath, alternativeFilepath), m_SceneLoaderJSON{*this},
-          m_SnowParticleSystems{{*this, "snow1.json"}, {*this, "snow2.json"}, {*this, "snow3.json"}, {*this, "snow4.json"}}
+          m_SnowParticleSystems{{"snow1.json"}, {"snow2.json"}, {"snow3.json"}, {"snow4.json"}}
     {
+        for (auto& snowParticleSystem : m_SnowParticleSystems)
+        {
+            m_ParticleSystems.push_back(snowParticleSystem.GetParticleSystem());
+        }
     }
 
     VolcanoScene::~VolcanoScene() {}
@@ -248,16 +252,10 @@ namespace LucreApp
             }
             for (auto& future : m_Futures)
             {
-                future.get();
+                threadpool.GetResult(future);
             }
         }
 
-        if (m_Water != entt::null)
-        {
-            auto& transform = m_Registry.get<TransformComponent>(m_Water);
-            transform.AddRotation({0.0f, 0.02f * timestep, 0.0f});
-        }
-
         {
             auto& lightbulbTransform = m_Registry.get<TransformComponent>(m_Lightbulb0);
             float scaleX = lightbulbTransform.GetScale().x;
@@ -277,10 +275,15 @@ namespace LucreApp
         // draw new scene
         if (!m_Renderer->BeginFrame(&m_CameraController->GetCamera()))
         {
+            StartSimulation(timestep);
             return;
         }
-        m_Renderer->UpdateTransformCache(*this, SceneGraph::ROOT_NODE, glm::mat4(1.0f), false);
+        m_Renderer->UpdateTransformCache(*this);
         m_Renderer->UpdateAnimations(m_Registry, timestep);
+
+        // the render snapshot is complete, update the scene for the next frame
+        StartSimulation(timestep);
+
         m_Renderer->ShowDebugShadowMap(ImGUI::m_ShowDebugShadowMap);
         m_Renderer->SubmitShadows(m_Registry, m_DirectionalLights);
         m_Renderer->Renderpass3D(m_Registry);
@@ -296,7 +299,7 @@ namespace LucreApp
 
         // transparent objects
         m_Renderer->NextSubpass();
-        m_Renderer->TransparencyPass(m_Registry);
+        m_Renderer->TransparencyPass(m_Registry, m_ParticleSystems);
 
         // post processing
         m_Renderer->PostProcessingRenderpass();
@@ -305,6 +308,15 @@ namespace LucreApp
         m_Renderer->GUIRenderpass(&SCREEN_ScreenManager::m_CameraController->GetCamera());
     }
 
+    void VolcanoScene::OnSimulate(const Timestep& timestep)
+    {
+        if (m_Water != entt::null)
+        {
+            auto& transform = m_Registry.get<TransformComponent>(m_Water);
+            transform.AddRotation({0.0f, 0.02f * timestep, 0.0f});
+        }
+    }
+
     void VolcanoScene::OnEvent(Event& event)
     {
         EventDispatcher dispatcher(event);
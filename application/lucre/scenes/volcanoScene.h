@@ -50,6 +50,8 @@ namespace LucreApp
         virtual void Stop() override;
 
         virtual void OnUpdate(const Timestep& timestep) override;
+        virtual bool SupportsPipelining() const override { return true; }
+        virtual void OnSimulate(const Timestep& timestep) override;
         virtual Camera& GetCamera() override { return m_CameraController->GetCamera(); }
         virtual void OnEvent(Event& event) override;
         virtual void OnResize() override;
@@ -96,6 +98,7 @@ namespace LucreApp
         static constexpr uint NUM_SNOW_PARTICLE_SYSTEMS = 4;
         Snow m_SnowParticleSystems[NUM_SNOW_PARTICLE_SYSTEMS];
         std::array<std::future<bool>, NUM_SNOW_PARTICLE_SYSTEMS> m_Futures;
+        std::vector<ParticleSystem*> m_ParticleSystems; // one instanced draw call each
 
     private:
         struct Group2
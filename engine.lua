@@ -35,6 +35,7 @@ project "engine"
         "./",
         "engine",
         "engine/platform/Vulkan",
+        "engine/platform/Headless",
         "engine/JoltDebugRenderer",
         "vendor",
         "vendor/glfw/include",
@@ -142,12 +142,18 @@ namespace JPH
                 ZoneTransientN(variableName, std::string(std::to_string(futureCounter)).c_str(), true);
                 bool isOk = true;
                 std::string spirvFilename = std::string("bin-int/") + filename + std::string(".spv");
-                if (!EngineCore::FileExists(spirvFilename))
+                std::string name = std::string("engine/JoltDebugRenderer/Shaders/VK/") + filename;
+                // the shader cache recompiles only if the source or its includes changed,
+                // without sources, pre-built SPIR-V files are used as is
+                if (EngineCore::FileExists(name))
                 {
-                    std::string name = std::string("engine/JoltDebugRenderer/Shaders/VK/") + filename;
                     VK_Shader shader{name, spirvFilename};
                     isOk = shader.IsOk();
                 }
+                else
+                {
+                    isOk = EngineCore::FileExists(spirvFilename);
+                }
                 return isOk;
             };
             futures[futureCounter] = threadPool.SubmitTask(compileThread);
@@ -155,7 +161,7 @@ namespace JPH
         }
         for (auto& future : futures)
         {
-            future.get();
+            threadPool.GetResult(future);
         }
     }
 
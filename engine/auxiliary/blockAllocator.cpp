@@ -0,0 +1,271 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <bit>
+#include <algorithm>
+
+#include "auxiliary/blockAllocator.h"
+
+namespace GfxRenderEngine
+{
+    std::unique_ptr<BlockAllocator> BlockAllocator::Create(Strategy strategy, uint64_t size)
+    {
+        switch (strategy)
+        {
+            case Strategy::Buddy:
+                return std::make_unique<BuddyBlockAllocator>(size);
+            case Strategy::Linear:
+            default:
+                return std::make_unique<LinearBlockAllocator>(size);
+        }
+    }
+
+    uint64_t BlockAllocator::AlignUp(uint64_t value, uint64_t alignment)
+    {
+        if (alignment <= 1)
+        {
+            return value;
+        }
+        return ((value + alignment - 1) / alignment) * alignment;
+    }
+
+    float BlockAllocator::GetFragmentation() const
+    {
+        Stats stats = GetStats();
+        uint64_t freeMemory = stats.m_Size - stats.m_Used;
+        if ((freeMemory == 0) || (stats.m_FreeRangeCount <= 1))
+        {
+            return 0.0f;
+        }
+        return 1.0f - static_cast<float>(stats.m_LargestFreeRange) / static_cast<float>(freeMemory);
+    }
+
+    // --- linear ---
+
+    LinearBlockAllocator::LinearBlockAllocator(uint64_t size) : BlockAllocator(size) { m_FreeRanges[0] = size; }
+
+    uint64_t LinearBlockAllocator::Allocate(uint64_t size, uint64_t alignment)
+    {
+        if (size == 0)
+        {
+            return INVALID_OFFSET;
+        }
+
+        for (auto iterator = m_FreeRanges.begin(); iterator != m_FreeRanges.end(); ++iterator)
+        {
+            uint64_t rangeBegin = iterator->first;
+            uint64_t rangeSize = iterator->second;
+            uint64_t alignedOffset = AlignUp(rangeBegin, alignment);
+            uint64_t padding = alignedOffset - rangeBegin;
+            if (padding + size > rangeSize)
+            {
+                continue;
+            }
+
+            // padding stays with the allocation, the tail goes back to the free list
+            uint64_t consumed = padding + size;
+            m_FreeRanges.erase(iterator);
+            if (consumed < rangeSize)
+            {
+                m_FreeRanges[rangeBegin + consumed] = rangeSize - consumed;
+            }
+
+            m_Allocations[alignedOffset] = {rangeBegin, consumed};
+            m_Used += consumed;
+            return alignedOffset;
+        }
+        return INVALID_OFFSET;
+    }
+
+    void LinearBlockAllocator::InsertFreeRange(uint64_t begin, uint64_t size)
+    {
+        auto next = m_FreeRanges.lower_bound(begin);
+
+        // merge with successor
+        if ((next != m_FreeRanges.end()) && (begin + size == next->first))
+        {
+            size += next->second;
+            next = m_FreeRanges.erase(next);
+        }
+
+        // merge with predecessor
+        if (next != m_FreeRanges.begin())
+        {
+            auto previous = std::prev(next);
+            if (previous->first + previous->second == begin)
+            {
+                previous->second += size;
+                return;
+            }
+        }
+        m_FreeRanges[begin] = size;
+    }
+
+    void LinearBlockAllocator::Free(uint64_t offset)
+    {
+        auto iterator = m_Allocations.find(offset);
+        if (iterator == m_Allocations.end())
+        {
+            return;
+        }
+        Allocation const& allocation = iterator->second;
+        m_Used -= allocation.m_RangeSize;
+        InsertFreeRange(allocation.m_RangeBegin, allocation.m_RangeSize);
+        m_Allocations.erase(iterator);
+    }
+
+    BlockAllocator::Stats LinearBlockAllocator::GetStats() const
+    {
+        Stats stats{};
+        stats.m_Size = m_Size;
+        stats.m_Used = m_Used;
+        stats.m_AllocationCount = m_Allocations.size();
+        stats.m_FreeRangeCount = m_FreeRanges.size();
+        for (auto const& [begin, size] : m_FreeRanges)
+        {
+            stats.m_LargestFreeRange = std::max(stats.m_LargestFreeRange, size);
+        }
+        return stats;
+    }
+
+    std::vector<uint64_t> LinearBlockAllocator::GetAllocationOffsets() const
+    {
+        std::vector<uint64_t> offsets;
+        offsets.reserve(m_Allocations.size());
+        for (auto const& [offset, allocation] : m_Allocations)
+        {
+            offsets.push_back(offset);
+        }
+        return offsets;
+    }
+
+    // --- buddy ---
+
+    BuddyBlockAllocator::BuddyBlockAllocator(uint64_t size) : BlockAllocator(std::bit_floor(size))
+    {
+        m_Size = std::max(m_Size, MIN_NODE_SIZE);
+        m_MaxOrder = static_cast<uint32_t>(std::countr_zero(m_Size / MIN_NODE_SIZE));
+        m_FreeLists.resize(m_MaxOrder + 1);
+        m_FreeLists[m_MaxOrder].insert(0);
+    }
+
+    uint32_t BuddyBlockAllocator::OrderFor(uint64_t size) const
+    {
+        uint64_t nodeSize = std::bit_ceil(std::max(size, MIN_NODE_SIZE));
+        return static_cast<uint32_t>(std::countr_zero(nodeSize / MIN_NODE_SIZE));
+    }
+
+    uint64_t BuddyBlockAllocator::Allocate(uint64_t size, uint64_t alignment)
+    {
+        if ((size == 0) || (size > m_Size))
+        {
+            return INVALID_OFFSET;
+        }
+
+        // every node is aligned to its own size, so a node at least as large
+        // as the alignment satisfies it
+        uint32_t order = OrderFor(std::max(size, alignment));
+        if (order > m_MaxOrder)
+        {
+            return INVALID_OFFSET;
+        }
+
+        uint32_t available = order;
+        while ((available <= m_MaxOrder) && m_FreeLists[available].empty())
+        {
+            ++available;
+        }
+        if (available > m_MaxOrder)
+        {
+            return INVALID_OFFSET;
+        }
+
+        uint64_t offset = *m_FreeLists[available].begin();
+        m_FreeLists[available].erase(m_FreeLists[available].begin());
+
+        // split down to the requested order, keeping the lower half
+        while (available > order)
+        {
+            --available;
+            m_FreeLists[available].insert(offset + OrderSize(available));
+        }
+
+        m_Allocations[offset] = order;
+        m_Used += OrderSize(order);
+        return offset;
+    }
+
+    void BuddyBlockAllocator::Free(uint64_t offset)
+    {
+        auto iterator = m_Allocations.find(offset);
+        if (iterator == m_Allocations.end())
+        {
+            return;
+        }
+        uint32_t order = iterator->second;
+        m_Allocations.erase(iterator);
+        m_Used -= OrderSize(order);
+
+        while (order < m_MaxOrder)
+        {
+            uint64_t buddy = offset ^ OrderSize(order);
+            auto buddyIterator = m_FreeLists[order].find(buddy);
+            if (buddyIterator == m_FreeLists[order].end())
+            {
+                break;
+            }
+            m_FreeLists[order].erase(buddyIterator);
+            offset = std::min(offset, buddy);
+            ++order;
+        }
+        m_FreeLists[order].insert(offset);
+    }
+
+    BlockAllocator::Stats BuddyBlockAllocator::GetStats() const
+    {
+        Stats stats{};
+        stats.m_Size = m_Size;
+        stats.m_Used = m_Used;
+        stats.m_AllocationCount = m_Allocations.size();
+        for (uint32_t order = 0; order <= m_MaxOrder; ++order)
+        {
+            if (!m_FreeLists[order].empty())
+            {
+                stats.m_FreeRangeCount += m_FreeLists[order].size();
+                stats.m_LargestFreeRange = OrderSize(order);
+            }
+        }
+        return stats;
+    }
+
+    std::vector<uint64_t> BuddyBlockAllocator::GetAllocationOffsets() const
+    {
+        std::vector<uint64_t> offsets;
+        offsets.reserve(m_Allocations.size());
+        for (auto const& [offset, order] : m_Allocations)
+        {
+            offsets.push_back(offset);
+        }
+        std::sort(offsets.begin(), offsets.end());
+        return offsets;
+    }
+} // namespace GfxRenderEngine
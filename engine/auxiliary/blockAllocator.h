@@ -0,0 +1,137 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <map>
+#include <set>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+
+namespace GfxRenderEngine
+{
+    // Device-independent bookkeeping for one block of GPU memory.
+    // Offsets are relative to the start of the block; the caller owns the actual memory.
+    class BlockAllocator
+    {
+
+    public:
+        static constexpr uint64_t INVALID_OFFSET = ~0ull;
+
+        enum class Strategy
+        {
+            Linear, // offset-ordered free list, first fit, neighbours coalesce on free
+            Buddy   // power-of-two buddy system, O(log n) allocate and free
+        };
+
+        struct Stats
+        {
+            uint64_t m_Size{0};
+            uint64_t m_Used{0};
+            uint64_t m_AllocationCount{0};
+            uint64_t m_FreeRangeCount{0};
+            uint64_t m_LargestFreeRange{0};
+        };
+
+    public:
+        virtual ~BlockAllocator() = default;
+
+        static std::unique_ptr<BlockAllocator> Create(Strategy strategy, uint64_t size);
+
+        // returns the offset of the allocation or INVALID_OFFSET if it does not fit
+        virtual uint64_t Allocate(uint64_t size, uint64_t alignment) = 0;
+        virtual void Free(uint64_t offset) = 0;
+        virtual Stats GetStats() const = 0;
+        virtual Strategy GetStrategy() const = 0;
+        // offsets of all live allocations in ascending order, e.g. to relocate them
+        virtual std::vector<uint64_t> GetAllocationOffsets() const = 0;
+
+        uint64_t GetSize() const { return m_Size; }
+        bool IsEmpty() const { return GetStats().m_AllocationCount == 0; }
+
+        // 0.0: all free memory is contiguous, 1.0: free memory is maximally scattered
+        float GetFragmentation() const;
+
+    protected:
+        BlockAllocator(uint64_t size) : m_Size{size} {}
+        static uint64_t AlignUp(uint64_t value, uint64_t alignment);
+
+    protected:
+        uint64_t m_Size;
+    };
+
+    class LinearBlockAllocator : public BlockAllocator
+    {
+
+    public:
+        LinearBlockAllocator(uint64_t size);
+
+        virtual uint64_t Allocate(uint64_t size, uint64_t alignment) override;
+        virtual void Free(uint64_t offset) override;
+        virtual Stats GetStats() const override;
+        virtual Strategy GetStrategy() const override { return Strategy::Linear; }
+        virtual std::vector<uint64_t> GetAllocationOffsets() const override;
+
+    private:
+        struct Allocation
+        {
+            uint64_t m_RangeBegin; // start of the consumed range, including alignment padding
+            uint64_t m_RangeSize;
+        };
+
+        void InsertFreeRange(uint64_t begin, uint64_t size);
+
+    private:
+        std::map<uint64_t, uint64_t> m_FreeRanges;    // begin -> size
+        std::map<uint64_t, Allocation> m_Allocations; // aligned offset -> allocation
+        uint64_t m_Used{0};
+    };
+
+    class BuddyBlockAllocator : public BlockAllocator
+    {
+
+    public:
+        static constexpr uint64_t MIN_NODE_SIZE = 256;
+
+    public:
+        // size is rounded down to a power of two
+        BuddyBlockAllocator(uint64_t size);
+
+        virtual uint64_t Allocate(uint64_t size, uint64_t alignment) override;
+        virtual void Free(uint64_t offset) override;
+        virtual Stats GetStats() const override;
+        virtual Strategy GetStrategy() const override { return Strategy::Buddy; }
+        virtual std::vector<uint64_t> GetAllocationOffsets() const override;
+
+    private:
+        uint64_t OrderSize(uint32_t order) const { return MIN_NODE_SIZE << order; }
+        uint32_t OrderFor(uint64_t size) const;
+
+    private:
+        uint32_t m_MaxOrder{0};
+        std::vector<std::set<uint64_t>> m_FreeLists;          // per order
+        std::unordered_map<uint64_t, uint32_t> m_Allocations; // offset -> order
+        uint64_t m_Used{0};
+    };
+} // namespace GfxRenderEngine
@@ -23,6 +23,7 @@
 #pragma once
 
 #include <functional>
+#include <string_view>
 
 #include "engine.h"
 
@@ -33,4 +34,15 @@ namespace GfxRenderEngine
         seed ^= std::hash<Type>{}(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
         (HashCombine(seed, rest), ...);
     }
+
+    // 64-bit FNV-1a, stable across runs and platforms (for keys of on-disk caches)
+    inline uint64 HashFNV1a(std::string_view data, uint64 hash = 0xcbf29ce484222325ull)
+    {
+        for (char character : data)
+        {
+            hash ^= static_cast<uchar>(character);
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
 } // namespace GfxRenderEngine
@@ -22,7 +22,9 @@
 
 #if defined(PROFILING)
 
-#include <sstream>
+#include <cstring>
+#include <iomanip>
+#include <unordered_map>
 
 #include "core.h"
 #include "engine.h"
@@ -33,28 +35,122 @@ namespace GfxRenderEngine
 {
     namespace Instrumentation
     {
-        Timer::Timer(Profiler& profiler, const char* name) : m_Profiler{profiler}, m_Name(name)
+        namespace
+        {
+            // capture file: header, records, name table, footer
+            constexpr uint32_t CAPTURE_MAGIC = 0x31465250; // "PRF1"
+
+            struct CaptureFooter
+            {
+                uint64_t m_NameTableOffset;
+                uint32_t m_NameCount;
+                uint32_t m_Magic;
+            };
+
+            struct NameRegistry
+            {
+                std::mutex m_Mutex;
+                std::vector<std::string> m_Names;
+                std::unordered_map<std::string, uint32_t> m_IDs;
+            };
+
+            NameRegistry& GetNameRegistry()
+            {
+                static NameRegistry nameRegistry;
+                return nameRegistry;
+            }
+
+            std::atomic<uint32_t> g_Generation{0};
+
+            void WriteString(std::ofstream& file, std::string const& str)
+            {
+                uint32_t length = static_cast<uint32_t>(str.size());
+                file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+                file.write(str.data(), length);
+            }
+
+            bool ReadString(std::ifstream& file, std::string& str)
+            {
+                uint32_t length = 0;
+                if (!file.read(reinterpret_cast<char*>(&length), sizeof(length)))
+                {
+                    return false;
+                }
+                str.resize(length);
+                return static_cast<bool>(file.read(str.data(), length));
+            }
+
+            void WriteJsonString(std::ofstream& file, std::string const& str)
+            {
+                file << '"';
+                for (char character : str)
+                {
+                    if ((character == '"') || (character == '\\'))
+                    {
+                        file << '\\';
+                    }
+                    file << character;
+                }
+                file << '"';
+            }
+        } // namespace
+
+        ThreadBuffer::ThreadBuffer(uint32_t threadIndex)
+            : m_Records{std::make_unique<Record[]>(CAPACITY)}, m_ThreadIndex{threadIndex}
         {
-            m_Start = std::chrono::high_resolution_clock::now();
         }
 
-        Timer::~Timer()
+        bool ThreadBuffer::Push(Record const& record)
         {
-            m_End = std::chrono::high_resolution_clock::now();
+            size_t head = m_Head.load(std::memory_order_relaxed);
+            if (head - m_Tail.load(std::memory_order_acquire) == CAPACITY)
+            {
+                return false;
+            }
+            m_Records[head & (CAPACITY - 1)] = record;
+            m_Records[head & (CAPACITY - 1)].m_ThreadIndex = m_ThreadIndex;
+            m_Head.store(head + 1, std::memory_order_release);
+            return true;
+        }
 
-            auto start = std::chrono::duration<double, std::micro>{m_Start.time_since_epoch()};
-            auto elapsedMicroSeconds = std::chrono::time_point_cast<std::chrono::microseconds>(m_End).time_since_epoch() -
-                                       std::chrono::time_point_cast<std::chrono::microseconds>(m_Start).time_since_epoch();
-            m_Profiler.CreateEntry({m_Name, start, elapsedMicroSeconds, std::this_thread::get_id()});
+        size_t ThreadBuffer::Pop(Record* destination, size_t maxCount)
+        {
+            size_t tail = m_Tail.load(std::memory_order_relaxed);
+            size_t count = std::min(m_Head.load(std::memory_order_acquire) - tail, maxCount);
+            for (size_t index = 0; index < count; ++index)
+            {
+                destination[index] = m_Records[(tail + index) & (CAPACITY - 1)];
+            }
+            m_Tail.store(tail + count, std::memory_order_release);
+            return count;
+        }
+
+        Timer::Timer(Profiler& profiler, uint32_t nameID)
+            : m_Profiler{profiler}, m_NameID{nameID}, m_Active{profiler.IsCapturing()}
+        {
+            if (m_Active)
+            {
+                m_Start = std::chrono::steady_clock::now();
+            }
+        }
+
+        Timer::~Timer()
+        {
+            if (m_Active)
+            {
+                m_Profiler.Submit(m_NameID, m_Start, std::chrono::steady_clock::now());
+            }
         }
+
         Profiler::Profiler(const std::string& name, const std::string& filename)
+            : m_SessionName{name}, m_Generation{++g_Generation}
         {
             m_StartTime = std::chrono::steady_clock::now();
 
             // this function must be called
             // after the constructor of engine
             // and before engine.Start()
-            std::string filepath, homeDir;
+            std::string homeDir;
 #ifdef _MSC_VER
             homeDir = "";
 #else
@@ -63,73 +159,218 @@ namespace GfxRenderEngine
 #endif
             if (Engine::m_Engine)
             {
-                filepath = homeDir + Engine::m_Engine->GetConfigFilePath() + filename;
+                m_JsonPath = homeDir + Engine::m_Engine->GetConfigFilePath() + filename;
             }
             else
             {
-                filepath = filename;
+                m_JsonPath = filename;
             }
-            m_OutputStream.open(filepath);
+            m_CapturePath = m_JsonPath + ".capture";
+            m_CaptureFile.open(m_CapturePath, std::ios::binary | std::ios::trunc);
 
-            if (m_OutputStream.is_open())
+            if (m_CaptureFile.is_open())
             {
-                m_CurrentSession = new Session({name});
-                StartJsonFile();
+                m_CaptureFile.write(reinterpret_cast<const char*>(&CAPTURE_MAGIC), sizeof(CAPTURE_MAGIC));
+                WriteString(m_CaptureFile, m_SessionName);
+                m_WriterThread = std::thread([this]() { Writer(); });
+                StartCapture();
             }
             else
             {
-                LOG_CORE_CRITICAL("Profiler could not open output file '{0}'", filepath);
+                LOG_CORE_CRITICAL("Profiler could not open capture file '{0}'", m_CapturePath);
             }
         }
 
         Profiler::~Profiler()
         {
-            std::lock_guard lock(m_Mutex);
-            if (m_CurrentSession)
+            if (!m_CaptureFile.is_open())
+            {
+                return;
+            }
+            StopCapture();
+            {
+                std::lock_guard lock(m_WriterMutex);
+                m_Quit = true;
+            }
+            m_WriterCondition.notify_one();
+            m_WriterThread.join();
+
+            WriteNameTable();
+            m_CaptureFile.close();
+
+            if (m_Dropped)
             {
-                EndJsonFile();
-                m_OutputStream.close();
-                delete m_CurrentSession;
-                m_CurrentSession = nullptr;
+                LOG_CORE_WARN("Profiler: {0} records dropped, thread buffers were full", m_Dropped.load());
             }
+            ConvertToChromeTrace(m_CapturePath, m_JsonPath);
         }
 
-        void Profiler::CreateEntry(const Result& result)
+        void Profiler::StartCapture()
         {
-            if ((std::chrono::steady_clock::now() - m_StartTime) > 5min)
+            m_Capturing.store(true, std::memory_order_relaxed);
+            LOG_CORE_INFO("Profiler: capture started");
+        }
+
+        void Profiler::StopCapture()
+        {
+            m_Capturing.store(false, std::memory_order_relaxed);
+            LOG_CORE_INFO("Profiler: capture stopped");
+        }
+
+        void Profiler::ToggleCapture() { IsCapturing() ? StopCapture() : StartCapture(); }
+
+        void Profiler::Submit(uint32_t nameID, std::chrono::steady_clock::time_point start,
+                              std::chrono::steady_clock::time_point end)
+        {
+            ThreadBuffer* threadBuffer = GetThreadBuffer();
+            Record record{.m_Start = std::chrono::nanoseconds(start - m_StartTime).count(),
+                          .m_Duration = std::chrono::nanoseconds(end - start).count(),
+                          .m_NameID = nameID,
+                          .m_ThreadIndex = 0};
+            if (!threadBuffer->Push(record))
             {
-                return;
+                m_Dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        uint32_t Profiler::InternName(const char* name)
+        {
+            NameRegistry& nameRegistry = GetNameRegistry();
+            std::lock_guard lock(nameRegistry.m_Mutex);
+            auto [iterator, inserted] =
+                nameRegistry.m_IDs.try_emplace(name, static_cast<uint32_t>(nameRegistry.m_Names.size()));
+            if (inserted)
+            {
+                nameRegistry.m_Names.push_back(name);
+            }
+            return iterator->second;
+        }
+
+        // the buffer of a thread is registered on its first record and owned by the profiler,
+        // so that records of finished threads can still be written
+        ThreadBuffer* Profiler::GetThreadBuffer()
+        {
+            thread_local uint32_t generation = 0;
+            thread_local ThreadBuffer* threadBuffer = nullptr;
+            if (generation != m_Generation)
+            {
+                std::lock_guard lock(m_BuffersMutex);
+                m_Buffers.push_back(std::make_unique<ThreadBuffer>(static_cast<uint32_t>(m_Buffers.size())));
+                threadBuffer = m_Buffers.back().get();
+                generation = m_Generation;
+            }
+            return threadBuffer;
+        }
+
+        void Profiler::Writer()
+        {
+            std::vector<Record> chunk(ThreadBuffer::CAPACITY);
+            bool quit = false;
+            while (!quit)
+            {
+                {
+                    std::unique_lock lock(m_WriterMutex);
+                    m_WriterCondition.wait_for(lock, WRITER_INTERVAL, [this]() { return m_Quit; });
+                    quit = m_Quit;
+                }
+                Drain(chunk);
             }
-            std::stringstream outputFile;
+        }
 
-            outputFile << std::setprecision(3) << std::fixed;
-            outputFile << ",\n    {";
-            outputFile << "\"cat\":\"function\",";
-            outputFile << "\"dur\":" << result.m_ElapsedTime.count() << ',';
-            outputFile << "\"name\":\"" << result.m_Name << "\",";
-            outputFile << "\"ph\":\"X\",";
-            outputFile << "\"pid\":0,";
-            outputFile << "\"tid\":" << std::hash<std::thread::id>()(result.m_ThreadID) << ",";
-            outputFile << "\"ts\":" << result.m_Start.count();
-            outputFile << "}";
-            std::lock_guard lock(m_Mutex);
-            if (m_CurrentSession)
+        void Profiler::Drain(std::vector<Record>& chunk)
+        {
+            std::lock_guard lock(m_BuffersMutex);
+            for (auto& threadBuffer : m_Buffers)
             {
-                m_OutputStream << outputFile.str();
-                m_OutputStream.flush();
+                size_t count;
+                while ((count = threadBuffer->Pop(chunk.data(), chunk.size())))
+                {
+                    m_CaptureFile.write(reinterpret_cast<const char*>(chunk.data()), count * sizeof(Record));
+                }
             }
         }
 
-        void Profiler::StartJsonFile()
+        void Profiler::WriteNameTable()
         {
-            m_OutputStream << "{\"otherData\": {},\"traceEvents\":[{}";
-            m_OutputStream.flush();
+            NameRegistry& nameRegistry = GetNameRegistry();
+            std::lock_guard lock(nameRegistry.m_Mutex);
+
+            CaptureFooter footer{.m_NameTableOffset = static_cast<uint64_t>(m_CaptureFile.tellp()),
+                                 .m_NameCount = static_cast<uint32_t>(nameRegistry.m_Names.size()),
+                                 .m_Magic = CAPTURE_MAGIC};
+            for (auto& name : nameRegistry.m_Names)
+            {
+                WriteString(m_CaptureFile, name);
+            }
+            m_CaptureFile.write(reinterpret_cast<const char*>(&footer), sizeof(footer));
         }
 
-        void Profiler::EndJsonFile()
+        bool Profiler::ConvertToChromeTrace(std::string const& capturePath, std::string const& jsonPath)
         {
-            m_OutputStream << "]}";
-            m_OutputStream.flush();
+            std::ifstream captureFile(capturePath, std::ios::binary | std::ios::ate);
+            if (!captureFile.is_open())
+            {
+                LOG_CORE_CRITICAL("Profiler could not open capture file '{0}'", capturePath);
+                return false;
+            }
+
+            // footer and name table
+            CaptureFooter footer{};
+            int64_t fileSize = captureFile.tellg();
+            captureFile.seekg(fileSize - static_cast<int64_t>(sizeof(footer)));
+            captureFile.read(reinterpret_cast<char*>(&footer), sizeof(footer));
+            if (!captureFile || (footer.m_Magic != CAPTURE_MAGIC))
+            {
+                LOG_CORE_CRITICAL("Profiler: '{0}' is not a complete capture file", capturePath);
+                return false;
+            }
+            std::vector<std::string> names(footer.m_NameCount);
+            captureFile.seekg(footer.m_NameTableOffset);
+            for (auto& name : names)
+            {
+                ReadString(captureFile, name);
+            }
+
+            // header
+            uint32_t magic = 0;
+            std::string sessionName;
+            captureFile.seekg(0);
+            captureFile.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+            ReadString(captureFile, sessionName);
+            if (!captureFile || (magic != CAPTURE_MAGIC))
+            {
+                LOG_CORE_CRITICAL("Profiler: '{0}' has an invalid header", capturePath);
+                return false;
+            }
+
+            std::ofstream jsonFile(jsonPath);
+            if (!jsonFile.is_open())
+            {
+                LOG_CORE_CRITICAL("Profiler could not open output file '{0}'", jsonPath);
+                return false;
+            }
+            jsonFile << std::setprecision(3) << std::fixed;
+            jsonFile << "{\"otherData\": {\"session\":";
+            WriteJsonString(jsonFile, sessionName);
+            jsonFile << "},\"traceEvents\":[{}";
+
+            Record record{};
+            while ((static_cast<uint64_t>(captureFile.tellg()) + sizeof(Record) <= footer.m_NameTableOffset) &&
+                   captureFile.read(reinterpret_cast<char*>(&record), sizeof(Record)))
+            {
+                jsonFile << ",\n    {";
+                jsonFile << "\"cat\":\"function\",";
+                jsonFile << "\"dur\":" << record.m_Duration / 1000.0 << ',';
+                jsonFile << "\"name\":";
+                WriteJsonString(jsonFile, record.m_NameID < names.size() ? names[record.m_NameID] : "unknown");
+                jsonFile << ",\"ph\":\"X\",";
+                jsonFile << "\"pid\":0,";
+                jsonFile << "\"tid\":" << record.m_ThreadIndex << ",";
+                jsonFile << "\"ts\":" << record.m_Start / 1000.0;
+                jsonFile << "}";
+            }
+            jsonFile << "]}";
+            return true;
         }
 
     } // namespace Instrumentation
@@ -27,11 +27,16 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <fstream>
-#include <iostream>
-#include <thread>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace GfxRenderEngine
 {
@@ -44,7 +49,10 @@ namespace GfxRenderEngine
 #define FUNC_SIGNATURE __PRETTY_FUNCTION__
 #endif
 
-#define PROFILE_SCOPE_LINE2(name, line) Instrumentation::Timer timer##line(*g_Profiler, name)
+// the name of a scope is interned once per call site
+#define PROFILE_SCOPE_LINE2(name, line)                                                      \
+    static const uint32_t profileNameID##line = Instrumentation::Profiler::InternName(name); \
+    Instrumentation::Timer timer##line(*g_Profiler, profileNameID##line)
 #define PROFILE_SCOPE_LINE(name, line) PROFILE_SCOPE_LINE2(name, line)
 #define PROFILE_SCOPE(name) PROFILE_SCOPE_LINE(name, __LINE__)
 #define PROFILE_FUNCTION() PROFILE_SCOPE(FUNC_SIGNATURE)
@@ -52,19 +60,37 @@ namespace GfxRenderEngine
     namespace Instrumentation
     {
 
-        struct Result
+        // fixed-size binary record, times in nanoseconds since the start of the profiler
+        struct Record
         {
-            std::string m_Name;
-            std::chrono::duration<double, std::micro> m_Start;
-            std::chrono::microseconds m_ElapsedTime;
-            std::thread::id m_ThreadID;
+            int64_t m_Start;
+            int64_t m_Duration;
+            uint32_t m_NameID;
+            uint32_t m_ThreadIndex;
         };
 
-        struct Session
+        // lock-free ring buffer, single producer (the owning thread), single consumer (the writer thread)
+        class ThreadBuffer
         {
-            std::string m_Name;
+        public:
+            static constexpr size_t CAPACITY = 1 << 14; // power of two
+
+        public:
+            ThreadBuffer(uint32_t threadIndex);
+
+            bool Push(Record const& record); // returns false when the buffer is full
+            size_t Pop(Record* destination, size_t maxCount);
+
+        private:
+            std::unique_ptr<Record[]> m_Records;
+            uint32_t m_ThreadIndex;
+            alignas(64) std::atomic<size_t> m_Head{0}; // written by the producer
+            alignas(64) std::atomic<size_t> m_Tail{0}; // written by the consumer
         };
 
+        // Scopes are recorded into per-thread ring buffers, a background thread streams them
+        // in chunks to a binary capture file. At shutdown the capture is converted to the
+        // Chrome trace format (chrome://tracing or ui.perfetto.dev).
         class Profiler
         {
         public:
@@ -73,30 +99,58 @@ namespace GfxRenderEngine
             Profiler(const Profiler&) = delete;
             Profiler(Profiler&&) = delete;
 
-            void CreateEntry(const Result& result);
+            void StartCapture();
+            void StopCapture();
+            void ToggleCapture();
+            bool IsCapturing() const { return m_Capturing.load(std::memory_order_relaxed); }
+
+            void Submit(uint32_t nameID, std::chrono::steady_clock::time_point start,
+                        std::chrono::steady_clock::time_point end);
+
+            static uint32_t InternName(const char* name);
+
+            // can also be used offline on a kept capture file
+            static bool ConvertToChromeTrace(std::string const& capturePath, std::string const& jsonPath);
 
         private:
-            void StartJsonFile();
-            void EndJsonFile();
+            ThreadBuffer* GetThreadBuffer();
+            void Writer();
+            void Drain(std::vector<Record>& chunk);
+            void WriteNameTable();
 
         private:
-            std::mutex m_Mutex;
-            Session* m_CurrentSession;
-            std::ofstream m_OutputStream;
-            std::chrono::time_point<std::chrono::steady_clock> m_StartTime;
+            static constexpr auto WRITER_INTERVAL = std::chrono::milliseconds(10);
+
+            std::string m_SessionName;
+            std::string m_JsonPath;
+            std::string m_CapturePath;
+            std::ofstream m_CaptureFile;
+            std::chrono::steady_clock::time_point m_StartTime;
+            uint32_t m_Generation;
+            std::atomic<bool> m_Capturing{false};
+            std::atomic<uint64_t> m_Dropped{0};
+
+            std::mutex m_BuffersMutex;
+            std::vector<std::unique_ptr<ThreadBuffer>> m_Buffers;
+
+            std::mutex m_WriterMutex;
+            std::condition_variable m_WriterCondition;
+            bool m_Quit{false};
+            std::thread m_WriterThread;
         };
 
         class Timer
         {
 
         public:
-            Timer(Profiler& Profiler, const char* name);
+            Timer(Profiler& profiler, uint32_t nameID);
             ~Timer();
 
         private:
             Profiler& m_Profiler;
-            const char* m_Name;
-            std::chrono::time_point<std::chrono::high_resolution_clock> m_Start, m_End;
+            uint32_t m_NameID;
+            bool m_Active;
+            std::chrono::steady_clock::time_point m_Start;
         };
     } // namespace Instrumentation
 
@@ -0,0 +1,310 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "core.h"
+#include "auxiliary/jobSystem.h"
+
+namespace GfxRenderEngine
+{
+    namespace
+    {
+        // identifies the worker a thread belongs to
+        thread_local JobSystem const* t_JobSystem = nullptr;
+        thread_local uint32_t t_WorkerIndex = 0;
+    } // namespace
+
+    JobSystem::JobSystem(uint32_t numWorkers)
+        : m_MainThreadID{std::this_thread::get_id()}, m_StartTime{std::chrono::steady_clock::now()}
+    {
+        numWorkers = std::max(numWorkers, 1u);
+        // with a single worker, streaming jobs would never run
+        m_NumFrameCriticalWorkers = (numWorkers > NUM_FRAME_CRITICAL_WORKERS) ? NUM_FRAME_CRITICAL_WORKERS : 0;
+        m_Workers.reserve(numWorkers);
+        for (uint32_t workerIndex = 0; workerIndex < numWorkers; ++workerIndex)
+        {
+            m_Workers.push_back(std::make_unique<Worker>());
+            m_Workers.back()->m_FrameCriticalOnly = (workerIndex < m_NumFrameCriticalWorkers);
+        }
+        // start threads after all workers exist, they steal from each other
+        for (uint32_t workerIndex = 0; workerIndex < numWorkers; ++workerIndex)
+        {
+            m_Workers[workerIndex]->m_Thread = std::thread([this, workerIndex]() { WorkerMain(workerIndex); });
+        }
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            std::lock_guard lock(m_SleepMutex);
+            m_Quit = true;
+        }
+        m_SleepCondition.notify_all();
+        m_FrameCriticalSleepCondition.notify_all();
+        for (auto& worker : m_Workers)
+        {
+            worker->m_Thread.join();
+        }
+
+        for (uint32_t workerIndex = 0; auto& statistics : GetWorkerStatistics())
+        {
+            LOG_CORE_INFO("JobSystem: worker {0}{1} executed {2} jobs ({3} stolen), utilisation {4:.1f}%", workerIndex,
+                          m_Workers[workerIndex]->m_FrameCriticalOnly ? " (frame-critical)" : "",
+                          statistics.m_JobsExecuted, statistics.m_JobsStolen, statistics.m_Utilisation * 100.0f);
+            ++workerIndex;
+        }
+    }
+
+    void JobSystem::Submit(Priority priority, Job&& job)
+    {
+        // workers push onto their own deque, other threads distribute round robin;
+        // streaming jobs go to workers that run them
+        uint32_t workerIndex;
+        if (IsWorkerThread() && (priority <= GetLowestPriority(t_WorkerIndex)))
+        {
+            workerIndex = t_WorkerIndex;
+        }
+        else if (priority == Priority::Streaming)
+        {
+            uint32_t numStreamingWorkers = GetWorkerCount() - m_NumFrameCriticalWorkers;
+            workerIndex = m_NumFrameCriticalWorkers +
+                          m_NextWorker.fetch_add(1, std::memory_order_relaxed) % numStreamingWorkers;
+        }
+        else
+        {
+            workerIndex = m_NextWorker.fetch_add(1, std::memory_order_relaxed) % GetWorkerCount();
+        }
+        {
+            Worker& worker = *m_Workers[workerIndex];
+            std::lock_guard lock(worker.m_Mutex);
+            worker.m_Queues[static_cast<int>(priority)].push_back(std::move(job));
+            m_QueuedJobs[static_cast<int>(priority)].fetch_add(1, std::memory_order_seq_cst);
+        }
+        {
+            // pairs with the predicate check of a worker going to sleep
+            std::lock_guard lock(m_SleepMutex);
+        }
+        m_SleepCondition.notify_one();
+        if ((priority == Priority::FrameCritical) && m_NumFrameCriticalWorkers)
+        {
+            m_FrameCriticalSleepCondition.notify_one();
+        }
+        if (m_Waiters.load(std::memory_order_seq_cst))
+        {
+            m_WaitCondition.notify_all();
+        }
+    }
+
+    void JobSystem::RunJobsUntil(std::function<bool()> const& isDone)
+    {
+        uint32_t workerIndex;
+        if (IsWorkerThread())
+        {
+            workerIndex = t_WorkerIndex;
+        }
+        else if (std::this_thread::get_id() == m_MainThreadID)
+        {
+            workerIndex = NO_WORKER;
+        }
+        else
+        {
+            return;
+        }
+
+        Priority lowestPriority = GetLowestPriority(workerIndex);
+        while (!isDone())
+        {
+            if (TryRunJob(workerIndex, lowestPriority))
+            {
+                continue;
+            }
+            // nothing to run: sleep until a job was queued or finished
+            std::unique_lock lock(m_SleepMutex);
+            m_Waiters.fetch_add(1, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            m_WaitCondition.wait(lock, [&]() { return isDone() || HasQueuedJobs(lowestPriority); });
+            m_Waiters.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    std::vector<std::thread::id> JobSystem::GetThreadIDs() const
+    {
+        std::vector<std::thread::id> threadIDs;
+        threadIDs.reserve(m_Workers.size());
+        for (auto& worker : m_Workers)
+        {
+            threadIDs.push_back(worker->m_Thread.get_id());
+        }
+        return threadIDs;
+    }
+
+    std::vector<JobSystem::WorkerStatistics> JobSystem::GetWorkerStatistics() const
+    {
+        auto lifetime = std::chrono::steady_clock::now() - m_StartTime;
+        std::vector<WorkerStatistics> workerStatistics;
+        workerStatistics.reserve(m_Workers.size());
+        for (auto& worker : m_Workers)
+        {
+            std::chrono::nanoseconds busyTime{worker->m_BusyNanoseconds.load(std::memory_order_relaxed)};
+            workerStatistics.push_back({.m_JobsExecuted = worker->m_JobsExecuted.load(std::memory_order_relaxed),
+                                        .m_JobsStolen = worker->m_JobsStolen.load(std::memory_order_relaxed),
+                                        .m_BusyTime = busyTime,
+                                        .m_Utilisation = static_cast<float>(busyTime.count()) /
+                                                         static_cast<float>(std::max(lifetime.count(), int64_t{1}))});
+        }
+        return workerStatistics;
+    }
+
+    bool JobSystem::IsWorkerThread() const { return t_JobSystem == this; }
+
+    void JobSystem::WorkerMain(uint32_t workerIndex)
+    {
+        t_JobSystem = this;
+        t_WorkerIndex = workerIndex;
+
+        Priority lowestPriority = GetLowestPriority(workerIndex);
+        std::condition_variable& sleepCondition =
+            m_Workers[workerIndex]->m_FrameCriticalOnly ? m_FrameCriticalSleepCondition : m_SleepCondition;
+        while (true)
+        {
+            if (TryRunJob(workerIndex, lowestPriority))
+            {
+                continue;
+            }
+            std::unique_lock lock(m_SleepMutex);
+            if (m_Quit) // own queues are drained
+            {
+                break;
+            }
+            sleepCondition.wait(lock, [&]() { return m_Quit || HasQueuedJobs(lowestPriority); });
+        }
+    }
+
+    bool JobSystem::TryRunJob(uint32_t workerIndex, Priority lowestPriority)
+    {
+        Job job;
+        bool found = false;
+        for (int priority = 0; (priority <= static_cast<int>(lowestPriority)) && !found; ++priority)
+        {
+            found = TryPop(workerIndex, static_cast<Priority>(priority), job) ||
+                    TrySteal(workerIndex, static_cast<Priority>(priority), job);
+        }
+        if (!found)
+        {
+            return false;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        job();
+        if (workerIndex != NO_WORKER)
+        {
+            Worker& worker = *m_Workers[workerIndex];
+            auto busyTime = std::chrono::nanoseconds(std::chrono::steady_clock::now() - start);
+            worker.m_BusyNanoseconds.fetch_add(busyTime.count(), std::memory_order_relaxed);
+            worker.m_JobsExecuted.fetch_add(1, std::memory_order_relaxed);
+        }
+        NotifyWaiters();
+        return true;
+    }
+
+    bool JobSystem::TryPop(uint32_t workerIndex, Priority priority, Job& job)
+    {
+        if (workerIndex == NO_WORKER)
+        {
+            return false;
+        }
+        Worker& worker = *m_Workers[workerIndex];
+        std::lock_guard lock(worker.m_Mutex);
+        auto& queue = worker.m_Queues[static_cast<int>(priority)];
+        if (queue.empty())
+        {
+            return false;
+        }
+        job = std::move(queue.back());
+        queue.pop_back();
+        m_QueuedJobs[static_cast<int>(priority)].fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool JobSystem::TrySteal(uint32_t workerIndex, Priority priority, Job& job)
+    {
+        if (!m_QueuedJobs[static_cast<int>(priority)].load(std::memory_order_relaxed))
+        {
+            return false;
+        }
+        // the locks are only held to push or pop a job, waiting for them avoids missing a queued job
+        uint32_t numWorkers = GetWorkerCount();
+        uint32_t firstVictim = (workerIndex == NO_WORKER) ? 0 : workerIndex + 1;
+        uint32_t numVictims = (workerIndex == NO_WORKER) ? numWorkers : numWorkers - 1;
+        for (uint32_t offset = 0; offset < numVictims; ++offset)
+        {
+            Worker& victim = *m_Workers[(firstVictim + offset) % numWorkers];
+            std::lock_guard lock(victim.m_Mutex);
+            auto& queue = victim.m_Queues[static_cast<int>(priority)];
+            if (queue.empty())
+            {
+                continue;
+            }
+            job = std::move(queue.front());
+            queue.pop_front();
+            m_QueuedJobs[static_cast<int>(priority)].fetch_sub(1, std::memory_order_relaxed);
+            if (workerIndex != NO_WORKER)
+            {
+                m_Workers[workerIndex]->m_JobsStolen.fetch_add(1, std::memory_order_relaxed);
+            }
+            return true;
+        }
+        return false;
+    }
+
+    bool JobSystem::HasQueuedJobs(Priority lowestPriority) const
+    {
+        for (int priority = 0; priority <= static_cast<int>(lowestPriority); ++priority)
+        {
+            if (m_QueuedJobs[priority].load(std::memory_order_seq_cst) > 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    JobSystem::Priority JobSystem::GetLowestPriority(uint32_t workerIndex) const
+    {
+        // the main thread must not get stuck in a streaming job while a frame waits for it
+        bool frameCriticalOnly = (workerIndex == NO_WORKER) || m_Workers[workerIndex]->m_FrameCriticalOnly;
+        return frameCriticalOnly ? Priority::FrameCritical : Priority::Streaming;
+    }
+
+    void JobSystem::NotifyWaiters()
+    {
+        // a finished job may have completed the future of a thread in RunJobsUntil(),
+        // pairs with the fence between registering as a waiter and checking the predicate
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_Waiters.load(std::memory_order_seq_cst))
+        {
+            {
+                std::lock_guard lock(m_SleepMutex);
+            }
+            m_WaitCondition.notify_all();
+        }
+    }
+} // namespace GfxRenderEngine
@@ -0,0 +1,137 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace GfxRenderEngine
+{
+
+    // Work-stealing job scheduler, one worker per hardware thread (minus the main thread).
+    // All multithreading of the engine runs on it: the ThreadPool facades (m_PoolPrimary,
+    // m_PoolSecondary) and the physics (JoltJobSystem).
+    //
+    // Every worker owns a deque per priority class: it pops its own jobs LIFO and steals
+    // from other workers FIFO. Frame-critical jobs of all workers are served before any
+    // streaming job is started.
+    //
+    // Running jobs are never preempted, so one worker only takes frame-critical jobs: a frame
+    // never waits for a long asset decode to finish. The main thread (the thread that created
+    // the job system) runs frame-critical jobs while it waits for a result.
+    class JobSystem
+    {
+    public:
+        enum class Priority
+        {
+            FrameCritical = 0,
+            Streaming,
+            NumPriorities
+        };
+
+        using Job = std::function<void()>;
+
+        struct WorkerStatistics
+        {
+            uint64_t m_JobsExecuted;
+            uint64_t m_JobsStolen;
+            std::chrono::nanoseconds m_BusyTime;
+            float m_Utilisation; // busy time / lifetime of the job system
+        };
+
+    public:
+        JobSystem(uint32_t numWorkers = std::max(std::thread::hardware_concurrency(), 2u) - 1);
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        void Submit(Priority priority, Job&& job);
+
+        // a worker thread that has to wait for another job executes jobs in the meantime,
+        // so that nested waits cannot starve the scheduler; the main thread executes frame-critical
+        // jobs only; other threads return immediately; sleeps while there is nothing to run
+        void RunJobsUntil(std::function<bool()> const& isDone);
+
+        uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_Workers.size()); }
+        std::vector<std::thread::id> GetThreadIDs() const;
+        std::vector<WorkerStatistics> GetWorkerStatistics() const;
+        bool IsWorkerThread() const;
+
+    private:
+        static constexpr int NUM_PRIORITIES = static_cast<int>(Priority::NumPriorities);
+        // workers that never start a streaming job (if there is more than one worker)
+        static constexpr uint32_t NUM_FRAME_CRITICAL_WORKERS = 1;
+        // the calling thread is not a worker
+        static constexpr uint32_t NO_WORKER = ~0u;
+
+        struct Worker
+        {
+            std::mutex m_Mutex;
+            std::deque<Job> m_Queues[NUM_PRIORITIES];
+            std::thread m_Thread;
+            bool m_FrameCriticalOnly{false};
+
+            std::atomic<uint64_t> m_JobsExecuted{0};
+            std::atomic<uint64_t> m_JobsStolen{0};
+            std::atomic<int64_t> m_BusyNanoseconds{0};
+        };
+
+    private:
+        void WorkerMain(uint32_t workerIndex);
+        // lowestPriority: FrameCritical or Streaming, workerIndex may be NO_WORKER
+        bool TryRunJob(uint32_t workerIndex, Priority lowestPriority);
+        bool TryPop(uint32_t workerIndex, Priority priority, Job& job);
+        bool TrySteal(uint32_t workerIndex, Priority priority, Job& job);
+        bool HasQueuedJobs(Priority lowestPriority) const;
+        Priority GetLowestPriority(uint32_t workerIndex) const;
+        void NotifyWaiters();
+
+    private:
+        std::vector<std::unique_ptr<Worker>> m_Workers;
+        uint32_t m_NumFrameCriticalWorkers{0}; // worker 0 to m_NumFrameCriticalWorkers - 1
+        std::thread::id m_MainThreadID;
+        std::chrono::steady_clock::time_point m_StartTime;
+        std::atomic<uint32_t> m_NextWorker{0};
+
+        // jobs in the deques of all workers, changed under the lock of the deque
+        std::atomic<int64_t> m_QueuedJobs[NUM_PRIORITIES]{};
+
+        // sleeping workers and threads waiting in RunJobsUntil()
+        std::mutex m_SleepMutex;
+        std::condition_variable m_SleepCondition;              // all workers that take streaming jobs
+        std::condition_variable m_FrameCriticalSleepCondition; // frame-critical workers
+        std::condition_variable m_WaitCondition;               // RunJobsUntil(): new job or a job finished
+        std::atomic<uint32_t> m_Waiters{0};
+        bool m_Quit{false};
+    };
+} // namespace GfxRenderEngine
@@ -0,0 +1,125 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "auxiliary/memoryMappedFile.h"
+
+namespace GfxRenderEngine
+{
+    MemoryMappedFile::~MemoryMappedFile() { Close(); }
+
+    bool MemoryMappedFile::Open(std::string const& filename)
+    {
+        Close();
+#ifdef _WIN32
+        HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return Fail("could not open " + filename);
+        }
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || (fileSize.QuadPart == 0))
+        {
+            CloseHandle(file);
+            return Fail("could not get size of " + filename);
+        }
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping)
+        {
+            CloseHandle(file);
+            return Fail("could not map " + filename);
+        }
+        void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!data)
+        {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return Fail("could not map " + filename);
+        }
+        m_FileHandle = file;
+        m_MappingHandle = mapping;
+        m_Data = static_cast<uchar const*>(data);
+        m_Size = static_cast<size_t>(fileSize.QuadPart);
+#else
+        int fileDescriptor = open(filename.c_str(), O_RDONLY);
+        if (fileDescriptor < 0)
+        {
+            return Fail("could not open " + filename);
+        }
+        struct stat fileStatus;
+        if ((fstat(fileDescriptor, &fileStatus) != 0) || (fileStatus.st_size == 0))
+        {
+            close(fileDescriptor);
+            return Fail("could not get size of " + filename);
+        }
+        size_t fileSize = static_cast<size_t>(fileStatus.st_size);
+        void* data = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        // the mapping stays valid after the file descriptor is closed
+        close(fileDescriptor);
+        if (data == MAP_FAILED)
+        {
+            return Fail("could not map " + filename);
+        }
+        // callers copy the whole file right away
+        madvise(data, fileSize, MADV_WILLNEED);
+        m_Data = static_cast<uchar const*>(data);
+        m_Size = fileSize;
+#endif
+        return true;
+    }
+
+    void MemoryMappedFile::Close()
+    {
+        if (m_Data)
+        {
+#ifdef _WIN32
+            UnmapViewOfFile(m_Data);
+            CloseHandle(static_cast<HANDLE>(m_MappingHandle));
+            CloseHandle(static_cast<HANDLE>(m_FileHandle));
+            m_MappingHandle = nullptr;
+            m_FileHandle = nullptr;
+#else
+            munmap(const_cast<uchar*>(m_Data), m_Size);
+#endif
+        }
+        m_Data = nullptr;
+        m_Size = 0;
+        m_Error.clear();
+    }
+
+    bool MemoryMappedFile::Fail(std::string const& error)
+    {
+        m_Error = error;
+        return false;
+    }
+} // namespace GfxRenderEngine
@@ -0,0 +1,61 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <string>
+
+#include "engine.h"
+
+namespace GfxRenderEngine
+{
+    // MemoryMappedFile: read-only mapping of a whole file, unmapped when closed or destroyed
+    class MemoryMappedFile
+    {
+    public:
+        MemoryMappedFile() = default;
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        bool Open(std::string const& filename);
+        void Close();
+
+        bool IsOpen() const { return m_Data != nullptr; }
+        uchar const* Data() const { return m_Data; }
+        size_t Size() const { return m_Size; }
+        std::string const& GetError() const { return m_Error; }
+
+    private:
+        bool Fail(std::string const& error);
+
+    private:
+        uchar const* m_Data{nullptr};
+        size_t m_Size{0};
+#ifdef _WIN32
+        void* m_FileHandle{nullptr};
+        void* m_MappingHandle{nullptr};
+#endif
+        std::string m_Error;
+    };
+} // namespace GfxRenderEngine
@@ -25,11 +25,20 @@
 namespace GfxRenderEngine
 {
 
-    ThreadPool::ThreadPool() {}
-
-    ThreadPool::ThreadPool(const BS::concurrency_t numThreads) : m_Pool{numThreads} {}
-
-    void ThreadPool::Wait() { m_Pool.wait(); }
-    [[nodiscard]] BS::concurrency_t ThreadPool::Size() const { return m_Pool.get_thread_count(); }
+    ThreadPool::ThreadPool(JobSystem& jobSystem, JobSystem::Priority priority)
+        : m_JobSystem{jobSystem}, m_Priority{priority}
+    {
+    }
+
+    void ThreadPool::Wait()
+    {
+        uint32_t tasksInFlight;
+        while ((tasksInFlight = m_TasksInFlight.load(std::memory_order_acquire)))
+        {
+            m_TasksInFlight.wait(tasksInFlight);
+        }
+    }
+
+    [[nodiscard]] uint32_t ThreadPool::Size() const { return m_JobSystem.GetWorkerCount(); }
 
 } // namespace GfxRenderEngine
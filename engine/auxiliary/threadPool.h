@@ -21,33 +21,60 @@
    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
-#include <iostream>
-#include <mutex>
-#include "BS_thread_pool/BS_thread_pool.hpp"
+#include <atomic>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "auxiliary/jobSystem.h"
 
 namespace GfxRenderEngine
 {
 
+    // submits tasks of one priority class to the job system of the engine
     class ThreadPool
     {
 
     public:
-        ThreadPool();
-        ThreadPool(const BS::concurrency_t numThreads);
+        ThreadPool(JobSystem& jobSystem, JobSystem::Priority priority);
 
+        // waits for all tasks submitted through this pool
         void Wait();
-        [[nodiscard]] BS::concurrency_t Size() const;
+        [[nodiscard]] uint32_t Size() const;
 
         template <typename FunctionType, typename ReturnType = std::invoke_result_t<std::decay_t<FunctionType>>>
         [[nodiscard]] std::future<ReturnType> SubmitTask(FunctionType&& task)
         {
-            std::lock_guard<std::mutex> guard(m_Mutex);
-            return m_Pool.submit_task(task);
+            auto packagedTask = std::make_shared<std::packaged_task<ReturnType()>>(std::forward<FunctionType>(task));
+            std::future<ReturnType> future = packagedTask->get_future();
+            m_TasksInFlight.fetch_add(1, std::memory_order_relaxed);
+            m_JobSystem.Submit(m_Priority,
+                               [this, packagedTask]()
+                               {
+                                   (*packagedTask)();
+                                   if (m_TasksInFlight.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                                   {
+                                       m_TasksInFlight.notify_all();
+                                   }
+                               });
+            return future;
         }
-        [[nodiscard]] std::vector<std::thread::id> GetThreadIDs() const { return m_Pool.get_thread_ids(); }
+
+        // use instead of future.get() inside of tasks and on the main thread: the calling
+        // thread executes other jobs while the result is not ready (see JobSystem::RunJobsUntil())
+        template <typename ReturnType> ReturnType GetResult(std::future<ReturnType>& future)
+        {
+            m_JobSystem.RunJobsUntil([&future]()
+                                     { return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready; });
+            return future.get();
+        }
+
+        [[nodiscard]] std::vector<std::thread::id> GetThreadIDs() const { return m_JobSystem.GetThreadIDs(); }
 
     private:
-        BS::thread_pool m_Pool;
-        std::mutex m_Mutex;
+        JobSystem& m_JobSystem;
+        JobSystem::Priority m_Priority;
+        std::atomic<uint32_t> m_TasksInFlight{0};
     };
 } // namespace GfxRenderEngine
@@ -31,6 +31,7 @@
 #include "events/applicationEvent.h"
 #include "events/mouseEvent.h"
 #include "events/keyEvent.h"
+#include "renderer/rendererAPI.h"
 #include "scene/nativeScript.h"
 
 namespace GfxRenderEngine
@@ -119,6 +120,12 @@ namespace GfxRenderEngine
 
     void Engine::Quit()
     {
+        // a headless run must not overwrite the settings of the user
+        if (RendererAPI::GetAPI() == RendererAPI::HEADLESS)
+        {
+            return;
+        }
+
         // save settings
         m_CoreSettings.m_EngineVersion = ENGINE_VERSION;
         m_CoreSettings.m_EnableFullscreen = IsFullscreen();
@@ -235,6 +242,11 @@ namespace GfxRenderEngine
                         LOG_CORE_INFO("toggle fullscreen at frame {0}", GetRenderer()->GetFrameCounter());
                         ToggleFullscreen();
                         break;
+#if defined(PROFILING)
+                    case ENGINE_KEY_F9:
+                        g_Profiler->ToggleCapture();
+                        break;
+#endif
                 }
                 return false;
             });
@@ -336,6 +348,9 @@ namespace GfxRenderEngine
         auto currentScene = application->GetScene();
         auto& registry = currentScene->GetRegistry();
 
+        // sync point: apply structural changes that were queued during the frame
+        registry.Sync();
+
         auto view = registry.view<ScriptComponent>();
         for (auto entity : view)
         {
@@ -365,8 +380,8 @@ namespace GfxRenderEngine
     void Engine::WaitIdle() const { m_GraphicsContext->WaitIdle(); }
     void Engine::ResetDescriptorPools()
     {
+        // m_PoolPrimary and m_PoolSecondary share the workers of m_JobSystem
         m_GraphicsContext->ResetDescriptorPool(m_PoolPrimary);
-        m_GraphicsContext->ResetDescriptorPool(m_PoolSecondary);
     }
 
     std::shared_ptr<Model> Engine::LoadModel(const Builder& builder) { return m_GraphicsContext->LoadModel(builder); }
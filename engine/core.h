@@ -121,12 +121,17 @@ namespace GfxRenderEngine
         Timestep GetTimestep() const { return m_Timestep; }
         void ToggleFullscreen();
 
+        // frames per scene for the benchmark of the application, 0: no benchmark
+        void SetBenchmarkFrames(uint frames) { m_BenchmarkFrames = frames; }
+        uint GetBenchmarkFrames() const { return m_BenchmarkFrames; }
+
     public:
         static Engine* m_Engine;
         static SettingsManager m_SettingsManager;
         CoreSettings m_CoreSettings{&m_SettingsManager};
-        ThreadPool m_PoolPrimary;
-        ThreadPool m_PoolSecondary;
+        JobSystem m_JobSystem;
+        ThreadPool m_PoolPrimary{m_JobSystem, JobSystem::Priority::FrameCritical};
+        ThreadPool m_PoolSecondary{m_JobSystem, JobSystem::Priority::Streaming};
 
     private:
         static void SignalHandler(int signal);
@@ -148,6 +153,7 @@ namespace GfxRenderEngine
         Chrono::TimePoint m_StartTime;
 
         bool m_Running, m_Paused, m_GraphicsContextInitialized;
+        uint m_BenchmarkFrames{0};
         std::vector<std::unique_ptr<Event>> m_EventQueue;
     };
 } // namespace GfxRenderEngine
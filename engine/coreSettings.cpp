@@ -31,6 +31,7 @@ namespace GfxRenderEngine
     RendererAPI::API CoreSettings::m_RendererAPI;
     bool CoreSettings::m_EnableFullscreen;
     bool CoreSettings::m_EnableSystemSounds;
+    bool CoreSettings::m_EnablePipelinedFrameLoop;
     std::string CoreSettings::m_BlacklistedDevice;
     int CoreSettings::m_UITheme;
 
@@ -40,6 +41,7 @@ namespace GfxRenderEngine
         m_RendererAPI = RendererAPI::VULKAN;
         m_EnableFullscreen = false;
         m_EnableSystemSounds = true;
+        m_EnablePipelinedFrameLoop = false;
         m_BlacklistedDevice = "empty";
         m_UITheme = THEME_RETRO;
     }
@@ -50,6 +52,7 @@ namespace GfxRenderEngine
         m_SettingsManager->PushSetting<RendererAPI::API>("RendererAPI", &m_RendererAPI);
         m_SettingsManager->PushSetting<bool>("EnableFullscreen", &m_EnableFullscreen);
         m_SettingsManager->PushSetting<bool>("EnableSystemSounds", &m_EnableSystemSounds);
+        m_SettingsManager->PushSetting<bool>("EnablePipelinedFrameLoop", &m_EnablePipelinedFrameLoop);
         m_SettingsManager->PushSetting<std::string>("BlacklstedDevice", &m_BlacklistedDevice);
         m_SettingsManager->PushSetting<int>("UITheme", &m_UITheme);
     }
@@ -60,6 +63,7 @@ namespace GfxRenderEngine
         LOG_CORE_INFO("CoreSettings: key '{0}', value is {1}", "RendererAPI", m_RendererAPI);
         LOG_CORE_INFO("CoreSettings: key '{0}', value is {1}", "EnableFullscreen", m_EnableFullscreen);
         LOG_CORE_INFO("CoreSettings: key '{0}', value is {1}", "EnableSystemSounds", m_EnableSystemSounds);
+        LOG_CORE_INFO("CoreSettings: key '{0}', value is {1}", "EnablePipelinedFrameLoop", m_EnablePipelinedFrameLoop);
         LOG_CORE_INFO("CoreSettings: key '{0}', value is {1}", "BlacklistedDevice", m_BlacklistedDevice);
         LOG_CORE_INFO("CoreSettings: key '{0}', value is {1}", "UITheme", m_UITheme);
     }
@@ -44,6 +44,7 @@ namespace GfxRenderEngine
         static RendererAPI::API m_RendererAPI;
         static bool m_EnableFullscreen;
         static bool m_EnableSystemSounds;
+        static bool m_EnablePipelinedFrameLoop;
         static std::string m_BlacklistedDevice;
         static int m_UITheme;
 
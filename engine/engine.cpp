@@ -20,12 +20,15 @@
    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <algorithm>
 #include <chrono>
+#include <cstdlib>
 #include <thread>
 
 #include "core.h"
 #include "engine.h"
 #include "application.h"
+#include "renderer/rendererAPI.h"
 
 using Profiler = GfxRenderEngine::Instrumentation::Profiler;
 // global logger for the engine and application
@@ -41,9 +44,27 @@ int engine(int argc, char* argv[])
     std::unique_ptr<GfxRenderEngine::Engine> engine;
     std::unique_ptr<GfxRenderEngine::Application> application;
 
+    // "--headless": no window and no GPU
+    // "--benchmark <frames>": headless, the application runs its benchmark with this many frames per scene
+    uint benchmarkFrames = 0;
+    for (int index = 1; index < argc; ++index)
+    {
+        std::string_view argument(argv[index]);
+        if (argument == "--headless")
+        {
+            GfxRenderEngine::RendererAPI::SetAPI(GfxRenderEngine::RendererAPI::HEADLESS);
+        }
+        else if ((argument == "--benchmark") && (index + 1 < argc))
+        {
+            GfxRenderEngine::RendererAPI::SetAPI(GfxRenderEngine::RendererAPI::HEADLESS);
+            benchmarkFrames = std::max(std::atoi(argv[++index]), 1);
+        }
+    }
+
     {
         PROFILE_SCOPE("engine startup");
         engine = std::make_unique<GfxRenderEngine::Engine>("./");
+        engine->SetBenchmarkFrames(benchmarkFrames);
 
         if (!engine->Start())
         {
@@ -52,6 +52,7 @@ namespace GfxRenderEngine
         Bounds() : x(0), y(0), w(0), h(0) {}
         Bounds(float x_, float y_, float w_, float h_) : x(x_), y(y_), w(w_), h(h_) {}
 
+        bool operator==(const Bounds& other) const { return x == other.x && y == other.y && w == other.w && h == other.h; }
         bool Contains(float px, float py) const { return (px >= x && py >= y && px < x + w && py < y + h); }
 
         bool Intersects(const Bounds& other) const
@@ -24,8 +24,10 @@
    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include <algorithm>
+#include <cstring>
 
 #include "core.h"
+#include "auxiliary/hash.h"
 #include "gui/common.h"
 #include "gui/Common/UI/screen.h"
 #include "gui/Render/textureAtlas.h"
@@ -188,6 +190,45 @@ namespace GfxRenderEngine
         return w;
     }
 
+    size_t SCREEN_DrawBuffer::GetTextExtentKey(const SCREEN_AtlasFont* font, std::string_view text, float wrapWidth,
+                                               int wrap) const
+    {
+        size_t key = std::hash<std::string_view>{}(text);
+        HashCombine(key, font, fontscalex, fontscaley, wrapWidth, wrap);
+        return key;
+    }
+
+    bool SCREEN_DrawBuffer::FindTextExtent(size_t key, const SCREEN_AtlasFont* font, std::string_view text,
+                                           float wrapWidth, int wrap, float* w, float* h) const
+    {
+        auto iterator = m_TextExtents.find(key);
+        if (iterator == m_TextExtents.end())
+        {
+            return false;
+        }
+        TextExtent const& extent = iterator->second;
+        if ((extent.m_Font != font) || (extent.m_ScaleX != fontscalex) || (extent.m_ScaleY != fontscaley) ||
+            (extent.m_WrapWidth != wrapWidth) || (extent.m_Wrap != wrap) || (extent.m_Text != text))
+        {
+            return false;
+        }
+        if (w)
+            *w = extent.m_Width;
+        if (h)
+            *h = extent.m_Height;
+        return true;
+    }
+
+    void SCREEN_DrawBuffer::StoreTextExtent(size_t key, const SCREEN_AtlasFont* font, std::string_view text,
+                                            float wrapWidth, int wrap, float w, float h)
+    {
+        if (m_TextExtents.size() >= MAX_TEXT_EXTENTS)
+        {
+            m_TextExtents.clear();
+        }
+        m_TextExtents[key] = {std::string(text), font, fontscalex, fontscaley, wrapWidth, wrap, w, h};
+    }
+
     void SCREEN_DrawBuffer::MeasureTextCount(FontID font, const char* text, int count, float* w, float* h)
     {
         const SCREEN_AtlasFont* atlasfont = ui_atlas.getFont(font);
@@ -198,6 +239,14 @@ namespace GfxRenderEngine
             return;
         }
 
+        // count is an upper limit, the loop below stops at the terminating zero
+        std::string_view measured(text, strnlen(text, std::max(count, 0)));
+        size_t key = GetTextExtentKey(atlasfont, measured, 0.0f, 0);
+        if (FindTextExtent(key, atlasfont, measured, 0.0f, 0, w, h))
+        {
+            return;
+        }
+
         unsigned int cval;
         float wacc = 0;
         float maxX = 0.0f;
@@ -240,10 +289,13 @@ namespace GfxRenderEngine
                 wacc += c->wx * fontscalex;
             }
         }
+        float width = std::max(wacc, maxX);
+        float height = atlasfont->height * fontscaley * lines;
+        StoreTextExtent(key, atlasfont, measured, 0.0f, 0, width, height);
         if (w)
-            *w = std::max(wacc, maxX);
+            *w = width;
         if (h)
-            *h = atlasfont->height * fontscaley * lines;
+            *h = height;
     }
 
     void SCREEN_DrawBuffer::MeasureTextRect(FontID font_id, const char* text, int count, const Bounds& bounds, float* w,
@@ -267,8 +319,17 @@ namespace GfxRenderEngine
                 *h = 0.0f;
                 return;
             }
+            // wrapping is the expensive part
+            size_t key = GetTextExtentKey(font, toMeasure, bounds.w, wrap);
+            if (FindTextExtent(key, font, toMeasure, bounds.w, wrap, w, h))
+            {
+                return;
+            }
             SCREEN_AtlasWordWrapper wrapper(*font, fontscalex, toMeasure.c_str(), bounds.w, wrap);
-            toMeasure = wrapper.Wrapped();
+            std::string wrapped = wrapper.Wrapped();
+            MeasureTextCount(font_id, wrapped.c_str(), (int)wrapped.length(), w, h);
+            StoreTextExtent(key, font, toMeasure, bounds.w, wrap, *w, *h);
+            return;
         }
         MeasureTextCount(font_id, toMeasure.c_str(), (int)toMeasure.length(), w, h);
     }
@@ -25,6 +25,10 @@
 
 #pragma once
 
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
 #include "core.h"
 #include "sprite/spritesheet.h"
 #include "gui/Render/textureAtlas.h"
@@ -114,7 +118,31 @@ namespace GfxRenderEngine
         float fontscaley;
         Renderer* m_Renderer;
 
+    private:
+        // Views measure the same strings whenever they are measured, the extents are cached
+        // per font, font scale and wrap width. Collisions of the hash key replace the entry.
+        struct TextExtent
+        {
+            std::string m_Text;
+            const SCREEN_AtlasFont* m_Font;
+            float m_ScaleX;
+            float m_ScaleY;
+            float m_WrapWidth;
+            int m_Wrap;
+            float m_Width;
+            float m_Height;
+        };
+        static constexpr size_t MAX_TEXT_EXTENTS = 4096;
+
     private:
         glm::vec4 ConvertColor(Color color);
+        size_t GetTextExtentKey(const SCREEN_AtlasFont* font, std::string_view text, float wrapWidth, int wrap) const;
+        bool FindTextExtent(size_t key, const SCREEN_AtlasFont* font, std::string_view text, float wrapWidth, int wrap,
+                            float* w, float* h) const;
+        void StoreTextExtent(size_t key, const SCREEN_AtlasFont* font, std::string_view text, float wrapWidth, int wrap,
+                             float w, float h);
+
+    private:
+        std::unordered_map<size_t, TextExtent> m_TextExtents;
     };
 } // namespace GfxRenderEngine
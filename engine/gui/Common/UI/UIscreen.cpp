@@ -535,9 +535,15 @@ namespace GfxRenderEngine
         dc.SetFontStyle(dc.theme->uiFont);
 
         float ignore;
+        float previousPadding = textPadding_.right;
         dc.MeasureText(dc.theme->uiFont, 1.0f, 1.0f, valueText_.c_str(), &textPadding_.right, &ignore,
                        ALIGN_RIGHT | ALIGN_VCENTER);
         textPadding_.right += paddingX;
+        if (textPadding_.right != previousPadding)
+        {
+            // the padding is part of the measured size
+            InvalidateMeasure();
+        }
 
         Choice::Draw(dc);
         if (CoreSettings::m_UITheme == THEME_RETRO)
@@ -625,8 +631,14 @@ namespace GfxRenderEngine
         }
 
         float ignore;
+        float previousPadding = textPadding_.right;
         dc.MeasureText(dc.theme->uiFont, 1.0f, 1.0f, temp, &textPadding_.right, &ignore, ALIGN_RIGHT | ALIGN_VCENTER);
         textPadding_.right += paddingX;
+        if (textPadding_.right != previousPadding)
+        {
+            // the padding is part of the measured size
+            InvalidateMeasure();
+        }
 
         Choice::Draw(dc);
         dc.DrawText(temp, bounds_.x2() - paddingX, bounds_.centerY(), style.fgColor, ALIGN_RIGHT | ALIGN_VCENTER);
@@ -0,0 +1,111 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "core.h"
+#include "gui/Common/UI/context.h"
+#include "gui/Common/UI/layoutBenchmark.h"
+#include "gui/Common/UI/root.h"
+#include "gui/Common/UI/viewGroup.h"
+
+namespace GfxRenderEngine
+{
+    namespace SCREEN_UI
+    {
+        namespace
+        {
+            using Clock = std::chrono::high_resolution_clock;
+
+            // marks every view of a tree, like a tree that was just created
+            void InvalidateAll(View* view)
+            {
+                view->InvalidateMeasure();
+                if (view->IsViewGroup())
+                {
+                    ViewGroup* viewGroup = static_cast<ViewGroup*>(view);
+                    for (int index = 0; index < viewGroup->GetNumSubviews(); ++index)
+                    {
+                        InvalidateAll(viewGroup->GetViewByIndex(index));
+                    }
+                }
+            }
+
+            // average time of one LayoutViewHierarchy() call in ms, prepare runs before each iteration
+            template <typename Function>
+            float TimeLayout(const SCREEN_UIContext& dc, ViewGroup* root, uint iterations, Function&& prepare)
+            {
+                Clock::duration duration{0};
+                for (uint iteration = 0; iteration < iterations; ++iteration)
+                {
+                    prepare(iteration);
+                    auto start = Clock::now();
+                    LayoutViewHierarchy(dc, root, true);
+                    duration += Clock::now() - start;
+                }
+                return std::chrono::duration<float, std::milli>(duration).count() / iterations;
+            }
+        } // namespace
+
+        void RunLayoutBenchmark(const SCREEN_UIContext& dc, uint rows, uint iterations)
+        {
+            iterations = std::max(iterations, 1u);
+            std::unique_ptr<bool[]> toggles(new bool[rows]());
+
+            auto root = std::make_unique<LinearLayout>(ORIENT_VERTICAL);
+            ScrollView* scrollView = root->Add(new ScrollView(ORIENT_VERTICAL, new LinearLayoutParams(1.0f)));
+            LinearLayout* list = scrollView->Add(new LinearLayout(ORIENT_VERTICAL));
+            TextView* lastText = nullptr;
+            for (uint row = 0; row < rows; ++row)
+            {
+                auto lineLayoutParams = new LinearLayoutParams(FILL_PARENT, WRAP_CONTENT);
+                LinearLayout* line = list->Add(new LinearLayout(ORIENT_HORIZONTAL, lineLayoutParams));
+                std::string number = std::to_string(row);
+                lastText = line->Add(new TextView("setting " + number, new LinearLayoutParams(1.0f)));
+                line->Add(new Choice("choice " + number, new LinearLayoutParams(200.0f, WRAP_CONTENT)));
+                line->Add(
+                    new CheckBox(&toggles[row], "option " + number, "", new LinearLayoutParams(300.0f, WRAP_CONTENT)));
+            }
+
+            // the first layout measures all text, the second one picks up the sizes of the first layout
+            auto start = Clock::now();
+            LayoutViewHierarchy(dc, root.get(), true);
+            float firstLayout = std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+            LayoutViewHierarchy(dc, root.get(), true);
+
+            float fullLayout = TimeLayout(dc, root.get(), iterations, [&](uint) { InvalidateAll(root.get()); });
+            float idleLayout = TimeLayout(dc, root.get(), iterations, [](uint) {});
+            float changedLayout = TimeLayout(dc, root.get(), iterations,
+                                             [&](uint iteration)
+                                             { lastText->SetText("changed " + std::to_string(iteration)); });
+
+            LOG_CORE_INFO("layout benchmark: {0} views, first layout {1:.3f} ms", rows * 4 + 3, firstLayout);
+            LOG_CORE_INFO("layout benchmark: full {0:.3f} ms, idle {1:.4f} ms, one text changed {2:.3f} ms "
+                          "(average of {3} layouts)",
+                          fullLayout, idleLayout, changedLayout, iterations);
+        }
+    } // namespace SCREEN_UI
+} // namespace GfxRenderEngine
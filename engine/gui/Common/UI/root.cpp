@@ -167,9 +167,10 @@ namespace GfxRenderEngine
             MeasureSpec horiz(EXACTLY, rootBounds.w);
             MeasureSpec vert(EXACTLY, rootBounds.h);
 
-            root->Measure(dc, horiz, vert);
+            // only invalidated subtrees are measured and laid out again
+            root->UpdateMeasure(dc, horiz, vert);
             root->SetBounds(rootBounds);
-            root->Layout();
+            root->UpdateLayout();
         }
 
         void MoveFocus(ViewGroup* root, FocusDirection direction)
@@ -167,6 +167,55 @@ namespace GfxRenderEngine
             MeasureBySpec(layoutParams_->height, contentH, vert, &measuredHeight_);
         }
 
+        void View::UpdateMeasure(const SCREEN_UIContext& dc, MeasureSpec horiz, MeasureSpec vert)
+        {
+            if (!measureDirty_ && (horiz == lastHoriz_) && (vert == lastVert_))
+            {
+                return;
+            }
+            Measure(dc, horiz, vert);
+            lastHoriz_ = horiz;
+            lastVert_ = vert;
+            measureDirty_ = false;
+            layoutDirty_ = true;
+        }
+
+        void View::UpdateLayout()
+        {
+            if (!layoutDirty_ && (bounds_ == lastLayoutBounds_))
+            {
+                return;
+            }
+            bool resized = (bounds_.w != lastLayoutBounds_.w) || (bounds_.h != lastLayoutBounds_.h);
+            Layout();
+            lastLayoutBounds_ = bounds_;
+            layoutDirty_ = false;
+
+            if (resized && MeasureUsesBounds())
+            {
+                // measured with the previous size, measure again in the next frame
+                InvalidateMeasure();
+            }
+        }
+
+        void View::InvalidateMeasure()
+        {
+            // no early out, a child of a view that skipped it (e.g. V_GONE) may still be dirty
+            for (View* view = this; view; view = view->parent_)
+            {
+                view->measureDirty_ = true;
+                view->layoutDirty_ = true;
+            }
+        }
+
+        void View::InvalidateLayout()
+        {
+            for (View* view = this; view; view = view->parent_)
+            {
+                view->layoutDirty_ = true;
+            }
+        }
+
         void View::GetContentDimensions(const SCREEN_UIContext& dc, float& w, float& h) const
         {
             w = 10.0f;
@@ -250,6 +250,7 @@ namespace GfxRenderEngine
             MeasureSpec() : type(UNSPECIFIED), size(0) {}
 
             MeasureSpec operator-(float amount) { return MeasureSpec(type, size - amount); }
+            bool operator==(const MeasureSpec& other) const { return type == other.type && size == other.size; }
             MeasureSpecType type;
             float size;
         };
@@ -402,6 +403,18 @@ namespace GfxRenderEngine
             virtual void Layout() {}
             virtual void Draw(SCREEN_UIContext& dc) {}
 
+            // Incremental layout: parents call UpdateMeasure() and UpdateLayout() for their children, which skip
+            // Measure() and Layout() of a view that was not invalidated and gets the same measure spec and bounds
+            // as last time. Anything that changes the content size must call InvalidateMeasure(), anything that
+            // only moves the children (e.g. scrolling) InvalidateLayout(). Both mark all ancestors, too.
+            void UpdateMeasure(const SCREEN_UIContext& dc, MeasureSpec horiz, MeasureSpec vert);
+            void UpdateLayout();
+            void InvalidateMeasure();
+            void InvalidateLayout();
+            bool IsMeasureDirty() const { return measureDirty_; }
+            bool IsLayoutDirty() const { return layoutDirty_; }
+            View* GetParent() const { return parent_; }
+
             virtual float GetMeasuredWidth() const { return measuredWidth_; }
             virtual float GetMeasuredHeight() const { return measuredHeight_; }
 
@@ -411,7 +424,11 @@ namespace GfxRenderEngine
 
             void SetBounds(Bounds bounds) { bounds_ = bounds; }
             virtual const LayoutParams* GetLayoutParams() const { return layoutParams_.get(); }
-            virtual void ReplaceLayoutParams(LayoutParams* newLayoutParams) { layoutParams_.reset(newLayoutParams); }
+            virtual void ReplaceLayoutParams(LayoutParams* newLayoutParams)
+            {
+                layoutParams_.reset(newLayoutParams);
+                InvalidateMeasure();
+            }
             const Bounds& GetBounds() const { return bounds_; }
 
             virtual bool SetFocus();
@@ -460,7 +477,14 @@ namespace GfxRenderEngine
                 enabledMeansDisabled_ = true;
             }
 
-            virtual void SetVisibility(Visibility visibility) { visibility_ = visibility; }
+            virtual void SetVisibility(Visibility visibility)
+            {
+                if (visibility_ != visibility)
+                {
+                    visibility_ = visibility;
+                    InvalidateMeasure();
+                }
+            }
             Visibility GetVisibility() const { return visibility_; }
 
             const std::string& Tag() const { return tag_; }
@@ -476,6 +500,19 @@ namespace GfxRenderEngine
                 return t;
             }
 
+        protected:
+            // the size of the last layout is used by Measure()
+            virtual bool MeasureUsesBounds() const { return false; }
+            // updates a string that is measured, invalidates the view if it changed
+            void SetMeasuredText(std::string& member, const std::string& text)
+            {
+                if (member != text)
+                {
+                    member = text;
+                    InvalidateMeasure();
+                }
+            }
+
         protected:
             std::unique_ptr<LayoutParams> layoutParams_;
 
@@ -494,6 +531,16 @@ namespace GfxRenderEngine
             bool* enabledPtr_;
             bool enabled_;
             bool enabledMeansDisabled_;
+
+            // incremental layout
+            View* parent_ = nullptr;
+            bool measureDirty_ = true;
+            bool layoutDirty_ = true;
+            MeasureSpec lastHoriz_;
+            MeasureSpec lastVert_;
+            Bounds lastLayoutBounds_;
+
+            friend class ViewGroup;
         };
 
         class InertView : public View
@@ -548,9 +595,14 @@ namespace GfxRenderEngine
             {
                 paddingW_ = w;
                 paddingH_ = h;
+                InvalidateMeasure();
             }
 
-            void SetScale(float f) { scale_ = f; }
+            void SetScale(float f)
+            {
+                scale_ = f;
+                InvalidateMeasure();
+            }
 
         private:
             Style style_;
@@ -715,10 +767,14 @@ namespace GfxRenderEngine
                                             float& h) const override;
             void Draw(SCREEN_UIContext& dc) override;
             virtual void SetCentered(bool c) { centered_ = c; }
-            virtual void SetIcon(Sprite& iconImage) { m_Image = iconImage; }
+            virtual void SetIcon(Sprite& iconImage)
+            {
+                m_Image = iconImage;
+                InvalidateMeasure();
+            }
             bool CanBeFocused() const override { return focusable_; }
             void SetFocusable(bool focusable) { focusable_ = focusable; }
-            void SetText(const std::string& text) { text_ = text; }
+            void SetText(const std::string& text) { SetMeasuredText(text_, text); }
             void SetName(const std::string& name) { m_Name = name; }
             std::string GetName() const { return m_Name; }
 
@@ -856,6 +912,9 @@ namespace GfxRenderEngine
             virtual void Toggle();
             virtual bool Toggled() const;
 
+        protected:
+            bool MeasureUsesBounds() const override { return true; }
+
         private:
             float CalculateTextScale(const SCREEN_UIContext& dc, float availWidth) const;
 
@@ -918,7 +977,7 @@ namespace GfxRenderEngine
                                             float& h) const override;
             void Draw(SCREEN_UIContext& dc) override;
 
-            void SetText(const std::string& text) { text_ = text; }
+            void SetText(const std::string& text) { SetMeasuredText(text_, text); }
             const std::string& GetText() const { return text_; }
             void SetTextColor(uint32_t color)
             {
@@ -86,6 +86,7 @@ namespace GfxRenderEngine
                 {
                     views_.erase(views_.begin() + i);
                     delete view;
+                    InvalidateMeasure();
                     return;
                 }
             }
@@ -99,7 +100,11 @@ namespace GfxRenderEngine
                 delete views_[i];
                 views_[i] = nullptr;
             }
-            views_.clear();
+            if (!views_.empty())
+            {
+                views_.clear();
+                InvalidateMeasure();
+            }
         }
 
         void ViewGroup::PersistData(PersistStatus status, std::string anonId, PersistMap& storage)
@@ -531,10 +536,10 @@ namespace GfxRenderEngine
                     {
                         v = MeasureSpec(AT_MOST, measuredHeight_);
                     }
-                    view->Measure(dc, MeasureSpec(UNSPECIFIED, measuredWidth_), v - (float)margins.vert());
+                    view->UpdateMeasure(dc, MeasureSpec(UNSPECIFIED, measuredWidth_), v - (float)margins.vert());
                     if (horiz.type == AT_MOST && view->GetMeasuredWidth() + margins.horiz() > horiz.size - weightZeroSum)
                     {
-                        view->Measure(dc, horiz, v - (float)margins.vert());
+                        view->UpdateMeasure(dc, horiz, v - (float)margins.vert());
                     }
                 }
                 else if (orientation_ == ORIENT_VERTICAL)
@@ -544,10 +549,10 @@ namespace GfxRenderEngine
                     {
                         h = MeasureSpec(AT_MOST, measuredWidth_);
                     }
-                    view->Measure(dc, h - (float)margins.horiz(), MeasureSpec(UNSPECIFIED, measuredHeight_));
+                    view->UpdateMeasure(dc, h - (float)margins.horiz(), MeasureSpec(UNSPECIFIED, measuredHeight_));
                     if (vert.type == AT_MOST && view->GetMeasuredHeight() + margins.vert() > vert.size - weightZeroSum)
                     {
-                        view->Measure(dc, h - (float)margins.horiz(), vert);
+                        view->UpdateMeasure(dc, h - (float)margins.horiz(), vert);
                     }
                 }
 
@@ -616,7 +621,7 @@ namespace GfxRenderEngine
                         {
                             h.type = EXACTLY;
                         }
-                        view->Measure(dc, h, v - (float)margins.vert());
+                        view->UpdateMeasure(dc, h, v - (float)margins.vert());
                         usedWidth += view->GetMeasuredWidth();
                         maxOther = std::max(maxOther, view->GetMeasuredHeight() + margins.vert());
                     }
@@ -668,7 +673,7 @@ namespace GfxRenderEngine
                         {
                             v.type = EXACTLY;
                         }
-                        view->Measure(dc, h - (float)margins.horiz(), v);
+                        view->UpdateMeasure(dc, h - (float)margins.horiz(), v);
                         usedHeight += view->GetMeasuredHeight();
                         maxOther = std::max(maxOther, view->GetMeasuredWidth() + margins.horiz());
                     }
@@ -737,7 +742,7 @@ namespace GfxRenderEngine
                              innerBounds);
 
                 views_[i]->SetBounds(innerBounds);
-                views_[i]->Layout();
+                views_[i]->UpdateLayout();
 
                 pos += spacing_ + (orientation_ == ORIENT_HORIZONTAL ? itemBounds.w : itemBounds.h);
             }
@@ -802,7 +807,7 @@ namespace GfxRenderEngine
                     {
                         v.type = UNSPECIFIED;
                     }
-                    views_[0]->Measure(dc, MeasureSpec(UNSPECIFIED, measuredWidth_), v);
+                    views_[0]->UpdateMeasure(dc, MeasureSpec(UNSPECIFIED, measuredWidth_), v);
                     MeasureBySpec(layoutParams_->height, views_[0]->GetMeasuredHeight(), vert, &measuredHeight_);
                 }
                 else
@@ -813,7 +818,7 @@ namespace GfxRenderEngine
                     {
                         h.type = UNSPECIFIED;
                     }
-                    views_[0]->Measure(dc, h, MeasureSpec(UNSPECIFIED, measuredHeight_));
+                    views_[0]->UpdateMeasure(dc, h, MeasureSpec(UNSPECIFIED, measuredHeight_));
                     MeasureBySpec(layoutParams_->width, views_[0]->GetMeasuredWidth(), horiz, &measuredWidth_);
                 }
                 if (orientation_ == ORIENT_VERTICAL && !vert_type_exactly_)
@@ -852,6 +857,7 @@ namespace GfxRenderEngine
             scrolled.h = views_[0]->GetMeasuredHeight() - margins.vert();
 
             float layoutScrollPos = ClampedScrollPos(scrollPos_);
+            layoutScrollPos_ = layoutScrollPos;
 
             switch (orientation_)
             {
@@ -875,8 +881,14 @@ namespace GfxRenderEngine
                     break;
             }
 
+            // the child size is used by Measure(), measure again in the next frame if it changed
+            Bounds const& previous = views_[0]->GetBounds();
+            if ((previous.w != scrolled.w) || (previous.h != scrolled.h))
+            {
+                InvalidateMeasure();
+            }
             views_[0]->SetBounds(scrolled);
-            views_[0]->Layout();
+            views_[0]->UpdateLayout();
         }
 
         bool ScrollView::Key(const SCREEN_KeyInput& input)
@@ -1136,6 +1148,11 @@ namespace GfxRenderEngine
             {
                 pull_ = 0.0f;
             }
+
+            if (ClampedScrollPos(scrollPos_) != layoutScrollPos_)
+            {
+                InvalidateLayout();
+            }
         }
 
         void AnchorLayout::Measure(const SCREEN_UIContext& dc, MeasureSpec horiz, MeasureSpec vert)
@@ -1206,7 +1223,7 @@ namespace GfxRenderEngine
                     }
                 }
 
-                views_[i]->Measure(dc, specW, specH);
+                views_[i]->UpdateMeasure(dc, specW, specH);
 
                 if (layoutParams_->width == static_cast<float>(WRAP_CONTENT))
                 {
@@ -1278,7 +1295,7 @@ namespace GfxRenderEngine
                     }
                 }
                 views_[i]->SetBounds(vBounds);
-                views_[i]->Layout();
+                views_[i]->UpdateLayout();
             }
         }
 
@@ -1293,7 +1310,7 @@ namespace GfxRenderEngine
 
             for (size_t i = 0; i < views_.size(); ++i)
             {
-                views_[i]->Measure(dc, MeasureSpec(measureType, settings_.columnWidth),
+                views_[i]->UpdateMeasure(dc, MeasureSpec(measureType, settings_.columnWidth),
                                    MeasureSpec(measureType, settings_.rowHeight));
             }
 
@@ -1327,7 +1344,7 @@ namespace GfxRenderEngine
                              G_HCENTER | G_VCENTER, innerBounds);
 
                 views_[i]->SetBounds(innerBounds);
-                views_[i]->Layout();
+                views_[i]->UpdateLayout();
 
                 ++count;
                 if (count == numColumns_)
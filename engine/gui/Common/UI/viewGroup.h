@@ -74,6 +74,8 @@ namespace GfxRenderEngine
             {
                 std::lock_guard<std::mutex> guard(modifyLock_);
                 views_.push_back(view);
+                view->parent_ = this;
+                InvalidateMeasure();
                 return view;
             }
 
@@ -154,7 +156,11 @@ namespace GfxRenderEngine
             AnchorLayout(LayoutParams* layoutParams = 0) : ViewGroup(layoutParams), overflow_(true) {}
             void Measure(const SCREEN_UIContext& dc, MeasureSpec horiz, MeasureSpec vert) override;
             void Layout() override;
-            void Overflow(bool allow) { overflow_ = allow; }
+            void Overflow(bool allow)
+            {
+                overflow_ = allow;
+                InvalidateMeasure();
+            }
             std::string Describe() const override { return "AnchorLayout: " + View::Describe(); }
 
         private:
@@ -218,7 +224,11 @@ namespace GfxRenderEngine
 
             void Measure(const SCREEN_UIContext& dc, MeasureSpec horiz, MeasureSpec vert) override;
             void Layout() override;
-            void SetSpacing(float spacing) { spacing_ = spacing; }
+            void SetSpacing(float spacing)
+            {
+                spacing_ = spacing;
+                InvalidateMeasure();
+            }
             std::string Describe() const override
             {
                 return (orientation_ == ORIENT_HORIZONTAL ? "LinearLayoutHoriz: " : "LinearLayoutVert: ") + View::Describe();
@@ -298,6 +308,7 @@ namespace GfxRenderEngine
 
             Orientation orientation_;
             float scrollPos_ = 0.0f;
+            float layoutScrollPos_ = 0.0f; // scroll position of the last layout
             float scrollTarget_ = 0.0f;
             bool scrollToTarget_ = false;
             float inertia_ = 0.0f;
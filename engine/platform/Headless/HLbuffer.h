@@ -0,0 +1,67 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include "engine.h"
+#include "renderer/buffer.h"
+
+namespace GfxRenderEngine
+{
+    // buffer in CPU memory, always mapped
+    class HL_Buffer : public Buffer
+    {
+
+    public:
+        HL_Buffer(uint size, Buffer::BufferUsage bufferUsage = Buffer::BufferUsage::UNIFORM_BUFFER_VISIBLE_TO_CPU);
+        virtual ~HL_Buffer() override;
+
+        HL_Buffer(const HL_Buffer&) = delete;
+        HL_Buffer& operator=(const HL_Buffer&) = delete;
+
+        virtual void MapBuffer() override {}
+        virtual void WriteToBuffer(const void* data) override;
+        virtual BufferID GetBufferID() const override { return m_BufferID; }
+        virtual bool Flush() override { return true; }
+        // the address of the CPU copy, only used as an opaque handle
+        virtual BufferDeviceAddress GetBufferDeviceAddress() const override
+        {
+            return reinterpret_cast<BufferDeviceAddress>(m_Data.data());
+        }
+
+        void* GetMappedMemory() { return m_Data.data(); }
+        size_t GetBufferSize() const { return m_Data.size(); }
+
+    private:
+        BufferID m_BufferID{0};
+        Buffer::BufferUsage m_BufferUsage;
+        std::vector<uchar> m_Data;
+
+    private:
+        static std::mutex m_Mutex;
+        static BufferID m_GlobalBufferIDCounter;
+    };
+} // namespace GfxRenderEngine
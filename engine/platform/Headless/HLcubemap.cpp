@@ -0,0 +1,62 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include "core.h"
+#include "stb_image.h"
+
+#include "HLcubemap.h"
+
+namespace GfxRenderEngine
+{
+    HL_Cubemap::HL_Cubemap() : m_Width(0), m_Height(0), m_sRGB(false) {}
+
+    HL_Cubemap::~HL_Cubemap() {}
+
+    bool HL_Cubemap::Init(const std::vector<std::string>& fileNames, bool sRGB, bool flip)
+    {
+        if (fileNames.size() != NUMBER_OF_CUBEMAP_IMAGES)
+        {
+            LOG_CORE_CRITICAL("Cubemap: {0} images required, {1} provided", NUMBER_OF_CUBEMAP_IMAGES, fileNames.size());
+            return false;
+        }
+
+        stbi_set_flip_vertically_on_load(flip);
+        m_sRGB = sRGB;
+        m_Pixels.clear();
+        for (auto const& fileName : fileNames)
+        {
+            int width, height, bytesPerPixel;
+            uchar* localBuffer = stbi_load(fileName.c_str(), &width, &height, &bytesPerPixel, 4);
+            if (!localBuffer)
+            {
+                LOG_CORE_CRITICAL("Cubemap: Couldn't load file {0}", fileName);
+                return false;
+            }
+            m_Width = width;
+            m_Height = height;
+            m_Pixels.insert(m_Pixels.end(), localBuffer, localBuffer + width * height * 4);
+            stbi_image_free(localBuffer);
+        }
+        return true;
+    }
+} // namespace GfxRenderEngine
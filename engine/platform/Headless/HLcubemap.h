@@ -0,0 +1,51 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include <vector>
+
+#include "engine.h"
+#include "renderer/cubemap.h"
+
+namespace GfxRenderEngine
+{
+    // the six faces of a cube map in CPU memory
+    class HL_Cubemap : public Cubemap
+    {
+
+    public:
+        HL_Cubemap();
+        virtual ~HL_Cubemap();
+
+        virtual bool Init(const std::vector<std::string>& fileNames, bool sRGB, bool flip = false) override;
+        virtual int GetWidth() const override { return m_Width; }
+        virtual int GetHeight() const override { return m_Height; }
+
+    private:
+        static constexpr int NUMBER_OF_CUBEMAP_IMAGES = 6;
+        int m_Width, m_Height;
+        bool m_sRGB;
+        std::vector<uchar> m_Pixels;
+    };
+} // namespace GfxRenderEngine
@@ -0,0 +1,45 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include "engine.h"
+#include "renderer/cursor.h"
+
+namespace GfxRenderEngine
+{
+    // there is no window to show a cursor in
+    class HL_Cursor : public Cursor
+    {
+
+    public:
+        HL_Cursor() {}
+        virtual ~HL_Cursor() {}
+
+        virtual bool SetCursor(const unsigned char* data, int length, uint xHot, uint yHot) override { return true; }
+        virtual bool SetCursor(const std::string& fileName, uint xHot, uint yHot) override { return true; }
+        virtual void DisallowCursor() override {}
+        virtual void RestoreCursor() override {}
+        virtual void AllowCursor() override {}
+    };
+} // namespace GfxRenderEngine
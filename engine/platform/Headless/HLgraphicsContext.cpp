@@ -0,0 +1,68 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include "core.h"
+
+#include "HLgraphicsContext.h"
+#include "HLmodel.h"
+
+namespace GfxRenderEngine
+{
+    HL_Context::HL_Context(HL_Window* window, ThreadPool& threadPoolPrimary, ThreadPool& threadPoolSecondary)
+        : m_Window{window}, m_Initialized{false}
+    {
+        m_Renderer = std::make_unique<HL_Renderer>(m_Window);
+        m_Initialized = m_Renderer->Init();
+    }
+
+    HL_Context::~HL_Context() {}
+
+    bool HL_Context::Init()
+    {
+        if (!m_Initialized)
+        {
+            m_Initialized = m_Renderer->Init();
+        }
+        return m_Initialized;
+    }
+
+    std::shared_ptr<Model> HL_Context::LoadModel(const Builder& builder) { return std::make_shared<HL_Model>(builder); }
+
+    std::shared_ptr<Model> HL_Context::LoadModel(const TerrainBuilder& builder)
+    {
+        return std::make_shared<HL_Model>(builder);
+    }
+
+    std::shared_ptr<Model> HL_Context::LoadModel(const GltfBuilder& builder) { return std::make_shared<HL_Model>(builder); }
+
+    std::shared_ptr<Model> HL_Context::LoadModel(const Model::ModelData& modelData)
+    {
+        return std::make_shared<HL_Model>(modelData);
+    }
+
+    std::shared_ptr<Model> HL_Context::LoadModel(const FbxBuilder& builder) { return std::make_shared<HL_Model>(builder); }
+
+    std::shared_ptr<Model> HL_Context::LoadModel(const UFbxBuilder& builder) { return std::make_shared<HL_Model>(builder); }
+
+    std::shared_ptr<Model> HL_Context::LoadModel(const IBLBuilder& builder) { return std::make_shared<HL_Model>(builder); }
+} // namespace GfxRenderEngine
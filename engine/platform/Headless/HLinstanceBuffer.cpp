@@ -0,0 +1,79 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include "core.h"
+
+#include "HLinstanceBuffer.h"
+
+namespace GfxRenderEngine
+{
+    HL_InstanceBuffer::HL_InstanceBuffer(uint numInstances) : m_NumInstances(numInstances)
+    {
+        // all instances, followed by the packed ranges of the culled passes
+        m_Ubo = std::make_shared<HL_Buffer>((1 + NUMBER_OF_PASSES) * numInstances * sizeof(glm::mat4),
+                                            Buffer::BufferUsage::STORAGE_BUFFER_VISIBLE_TO_CPU);
+        m_ModelMatrices.resize(numInstances, glm::mat4(1.0f));
+        m_WorldBounds.resize(numInstances);
+    }
+
+    HL_InstanceBuffer::~HL_InstanceBuffer() {}
+
+    void HL_InstanceBuffer::SetInstanceData(uint index, glm::mat4 const& mat4Global)
+    {
+        CORE_ASSERT(index < m_NumInstances, "out of bounds");
+
+        m_ModelMatrices[index] = mat4Global;
+        static_cast<glm::mat4*>(m_Ubo->GetMappedMemory())[index] = mat4Global;
+        m_BoundsDirty = true;
+    }
+
+    void HL_InstanceBuffer::UpdateWorldBounds(AABB const& localBounds)
+    {
+        bool localBoundsChanged = (localBounds.m_Min != m_LocalBounds.m_Min) || (localBounds.m_Max != m_LocalBounds.m_Max);
+        if (!m_BoundsDirty && !localBoundsChanged)
+        {
+            return;
+        }
+
+        m_LocalBounds = localBounds;
+        for (uint index = 0; index < m_NumInstances; ++index)
+        {
+            m_WorldBounds[index] = m_LocalBounds.Transform(m_ModelMatrices[index]);
+        }
+        m_BoundsDirty = false;
+    }
+
+    void HL_InstanceBuffer::SetVisibleInstances(uint pass, uint, uchar const* visible)
+    {
+        CORE_ASSERT(pass < NUMBER_OF_PASSES, "pass out of range");
+        glm::mat4* range = static_cast<glm::mat4*>(m_Ubo->GetMappedMemory()) + (1 + pass) * m_NumInstances;
+        uint packedIndex = 0;
+        for (uint index = 0; index < m_NumInstances; ++index)
+        {
+            if (visible[index])
+            {
+                range[packedIndex++] = m_ModelMatrices[index];
+            }
+        }
+    }
+} // namespace GfxRenderEngine
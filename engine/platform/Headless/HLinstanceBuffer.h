@@ -0,0 +1,69 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include "engine.h"
+#include "renderer/instanceBuffer.h"
+#include "renderer/frustumCuller.h"
+
+#include "HLbuffer.h"
+
+namespace GfxRenderEngine
+{
+    // model matrices in CPU memory, the world bounds and the packed ranges of the culled passes
+    // are maintained like in VK_InstanceBuffer (there is only one frame in flight)
+    class HL_InstanceBuffer : public InstanceBuffer
+    {
+
+    public:
+        HL_InstanceBuffer(uint numInstances);
+        virtual ~HL_InstanceBuffer();
+
+        HL_InstanceBuffer(const HL_InstanceBuffer&) = delete;
+        HL_InstanceBuffer& operator=(const HL_InstanceBuffer&) = delete;
+
+        virtual void SetInstanceData(uint index, glm::mat4 const& mat4Global) override;
+        virtual const glm::mat4& GetModelMatrix(uint index) override { return m_ModelMatrices[index]; }
+        virtual std::shared_ptr<Buffer> GetBuffer() override { return m_Ubo; }
+        virtual Buffer::BufferDeviceAddress GetBufferDeviceAddress() override { return m_Ubo->GetBufferDeviceAddress(); }
+        virtual uint GetInstanceCount() const override { return m_NumInstances; }
+        virtual void UpdateWorldBounds(AABB const& localBounds) override;
+        virtual AABB const& GetWorldBounds(uint index) const override { return m_WorldBounds[index]; }
+        virtual void SetVisibleInstances(uint pass, uint frameIndex, uchar const* visible) override;
+
+    private:
+        static constexpr uint NUMBER_OF_PASSES = FrustumCuller::NUMBER_OF_PASSES;
+
+        uint m_NumInstances;
+        // instances may be written concurrently by the transform hierarchy update
+        std::atomic<bool> m_BoundsDirty{true};
+        AABB m_LocalBounds;
+        std::vector<AABB> m_WorldBounds;
+        std::vector<glm::mat4> m_ModelMatrices;
+        std::shared_ptr<HL_Buffer> m_Ubo;
+    };
+} // namespace GfxRenderEngine
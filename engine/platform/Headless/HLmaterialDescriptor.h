@@ -0,0 +1,60 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include "renderer/materialDescriptor.h"
+
+namespace GfxRenderEngine
+{
+    // no descriptor sets without a GPU, only the material type is kept
+    class HL_MaterialDescriptor : public MaterialDescriptor
+    {
+
+    public:
+        HL_MaterialDescriptor(Material::MaterialType materialType, PbrMaterial::MaterialTextures& textures)
+            : m_MaterialType{materialType}
+        {
+        }
+        HL_MaterialDescriptor(Material::MaterialType materialType, std::shared_ptr<Cubemap> const& cubemap)
+            : m_MaterialType{materialType}
+        {
+        }
+        HL_MaterialDescriptor(Material::MaterialType materialType, std::shared_ptr<Texture> const& texture)
+            : m_MaterialType{materialType}
+        {
+        }
+        HL_MaterialDescriptor(Material::MaterialType materialType,
+                              PbrMultiMaterial::PbrMultiMaterialTextures& multiTextures)
+            : m_MaterialType{materialType}
+        {
+        }
+        virtual ~HL_MaterialDescriptor() {}
+
+    public:
+        virtual Material::MaterialType GetMaterialType() const override { return m_MaterialType; }
+
+    private:
+        Material::MaterialType m_MaterialType;
+    };
+} // namespace GfxRenderEngine
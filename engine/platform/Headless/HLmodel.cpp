@@ -0,0 +1,125 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include "core.h"
+
+#include "HLmodel.h"
+
+namespace GfxRenderEngine
+{
+
+#define INIT_MODEL()                        \
+    CopySubmeshes(builder.m_Submeshes);     \
+    CreateVertexBuffer(builder.m_Vertices); \
+    CreateIndexBuffer(builder.m_Indices);
+
+#define INIT_GLTF_AND_FBX_MODEL()                   \
+    CopySubmeshes(builder.m_Submeshes);             \
+    m_Skeleton = std::move(builder.m_Skeleton);     \
+    CreateVertexStreams(builder.m_Vertices);        \
+    CreateIndexBuffer(builder.m_Indices);           \
+    m_Animations = std::move(builder.m_Animations);
+
+    HL_Model::HL_Model(const Model::ModelData& modelData)
+    {
+        ZoneScopedNC("HL_Model(FastgltfBuilder)", 0x00ffff);
+
+        CopySubmeshes(modelData.m_Submeshes);
+        m_Skeleton = std::move(modelData.m_Skeleton);
+        CreateVertexStreams(modelData.m_Vertices);
+        CreateIndexBuffer(modelData.m_Indices);
+        m_Animations = std::move(modelData.m_Animations);
+    }
+    HL_Model::HL_Model(const UFbxBuilder& builder) { INIT_GLTF_AND_FBX_MODEL(); }
+    HL_Model::HL_Model(const GltfBuilder& builder) { INIT_GLTF_AND_FBX_MODEL(); }
+    HL_Model::HL_Model(const FbxBuilder& builder) { INIT_GLTF_AND_FBX_MODEL(); }
+    HL_Model::HL_Model(const Builder& builder)
+    {
+        INIT_MODEL();
+        m_Cubemaps = std::move(builder.m_Cubemaps); // used to manage lifetime
+    }
+    HL_Model::HL_Model(const TerrainBuilder& builder)
+    {
+        CopySubmeshes(builder.m_Submeshes);
+        CreateVertexStreams(builder.m_Vertices);
+        CreateIndexBuffer(builder.m_Indices);
+    }
+    HL_Model::HL_Model(const IBLBuilder& builder)
+    {
+        CopySubmeshes(builder.m_Submeshes);
+        CreateVertexBuffer(builder.m_Vertices);
+    }
+
+    HL_Model::~HL_Model() {}
+
+    void HL_Model::CopySubmeshes(std::vector<Submesh> const& submeshes)
+    {
+        for (auto& submesh : submeshes)
+        {
+            m_LocalBounds.Extend(submesh.m_LocalBounds);
+            m_Submeshes.push_back(submesh);
+        }
+    }
+
+    void HL_Model::CreateVertexBuffer(const std::vector<Vertex>& vertices)
+    {
+        m_VertexCount = static_cast<uint>(vertices.size());
+        CORE_ASSERT(m_VertexCount >= 3, "CreateVertexBuffer: at least one triangle required");
+        m_Vertices = vertices;
+    }
+
+    // PBR meshes: same compaction as on the GPU, the CPU cost is part of loading a scene
+    void HL_Model::CreateVertexStreams(std::vector<Vertex> const& vertices)
+    {
+        m_VertexCount = static_cast<uint>(vertices.size());
+        CORE_ASSERT(m_VertexCount >= 3, "CreateVertexStreams: at least one triangle required");
+
+        bool skinned = m_Skeleton != nullptr;
+        VertexStreams vertexStreams(vertices, skinned);
+        m_VertexFormat = vertexStreams.GetVertexFormat();
+        m_PositionStream = vertexStreams.GetPositionStream();
+        m_AttributeStream = vertexStreams.GetAttributeStream();
+    }
+
+    void HL_Model::CreateIndexBuffer(const std::vector<uint>& indices)
+    {
+        m_IndexCount = static_cast<uint>(indices.size());
+        m_Indices = indices;
+    }
+
+    Buffer::BufferDeviceAddress HL_Model::GetVertexBufferDeviceAddress() const
+    {
+        return m_AttributeStream.empty() ? reinterpret_cast<Buffer::BufferDeviceAddress>(m_Vertices.data())
+                                         : reinterpret_cast<Buffer::BufferDeviceAddress>(m_AttributeStream.data());
+    }
+
+    Buffer::BufferDeviceAddress HL_Model::GetIndexBufferDeviceAddress() const
+    {
+        return reinterpret_cast<Buffer::BufferDeviceAddress>(m_Indices.data());
+    }
+
+    Buffer::BufferDeviceAddress HL_Model::GetPositionBufferDeviceAddress() const
+    {
+        return reinterpret_cast<Buffer::BufferDeviceAddress>(m_PositionStream.data());
+    }
+} // namespace GfxRenderEngine
@@ -0,0 +1,85 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "engine.h"
+#include "renderer/model.h"
+#include "renderer/buffer.h"
+#include "renderer/vertexStreams.h"
+#include "renderer/builder/builder.h"
+#include "renderer/builder/IBLBuilder.h"
+#include "renderer/builder/gltfBuilder.h"
+#include "renderer/builder/terrainBuilder.h"
+#include "renderer/builder/fastgltfBuilder.h"
+#include "renderer/builder/ufbxBuilder.h"
+#include "renderer/builder/fbxBuilder.h"
+
+namespace GfxRenderEngine
+{
+    // vertex and index data in CPU memory, in the same layout as the GPU buffers of VK_Model
+    class HL_Model : public Model
+    {
+
+    public:
+        HL_Model(const Builder& builder);
+        HL_Model(const GltfBuilder& builder);
+        HL_Model(const Model::ModelData&);
+        HL_Model(const FbxBuilder& builder);
+        HL_Model(const UFbxBuilder& builder);
+        HL_Model(const TerrainBuilder& builder);
+        HL_Model(const IBLBuilder& builder);
+        virtual ~HL_Model() override;
+
+        HL_Model(const HL_Model&) = delete;
+        HL_Model& operator=(const HL_Model&) = delete;
+
+        virtual void CreateVertexBuffer(const std::vector<Vertex>& vertices) override;
+        virtual void CreateIndexBuffer(const std::vector<uint>& indices) override;
+        virtual Buffer::BufferDeviceAddress GetVertexBufferDeviceAddress() const override;
+        virtual Buffer::BufferDeviceAddress GetIndexBufferDeviceAddress() const override;
+        virtual Buffer::BufferDeviceAddress GetPositionBufferDeviceAddress() const override;
+
+
+        uint GetVertexCount() const { return m_VertexCount; }
+        uint GetIndexCount() const { return m_IndexCount; }
+
+    private:
+        void CopySubmeshes(std::vector<Submesh> const& submeshes);
+        void CreateVertexStreams(std::vector<Vertex> const& vertices);
+
+    private:
+        std::vector<Vertex> m_Vertices;      // IBL and sprite meshes
+        std::vector<uint> m_AttributeStream; // PBR meshes
+        std::vector<uint> m_PositionStream;
+        std::vector<uint> m_Indices;
+
+        uint m_VertexCount{0};
+        uint m_IndexCount{0};
+
+        std::vector<Submesh> m_Submeshes{};
+    };
+} // namespace GfxRenderEngine
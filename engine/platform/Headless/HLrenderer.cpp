@@ -0,0 +1,150 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include "core.h"
+#include "engine.h"
+#include "resources/resources.h"
+#include "renderer/frameUpdate.h"
+
+#include "HLrenderer.h"
+#include "HLwindow.h"
+#include "HLmodel.h"
+#include "HLtexture.h"
+
+namespace GfxRenderEngine
+{
+    HL_Renderer::PhaseTimer::PhaseTimer(RecordTime& recordTime)
+        : m_RecordTime{recordTime}, m_Start{std::chrono::high_resolution_clock::now()}
+    {
+    }
+
+    HL_Renderer::PhaseTimer::~PhaseTimer()
+    {
+        auto duration = std::chrono::high_resolution_clock::now() - m_Start;
+        m_RecordTime.m_Milliseconds += std::chrono::duration<float, std::milli>(duration).count();
+    }
+
+    HL_Renderer::HL_Renderer(HL_Window* window) : m_Window{window}
+    {
+        m_PhaseTimes = {{"transform cache", 0.0f}, {"animations", 0.0f}, {"culling", 0.0f}};
+    }
+
+    HL_Renderer::~HL_Renderer() {}
+
+    uint HL_Renderer::GetContextWidth() const { return m_Window->GetWidth(); }
+
+    uint HL_Renderer::GetContextHeight() const { return m_Window->GetHeight(); }
+
+    bool HL_Renderer::Init()
+    {
+        ZoneScopedN("HL_Renderer::Init()");
+        // the sprite sheets of the application are built from the atlas
+        size_t fileSize;
+        auto data = (const uchar*)ResourceSystem::GetDataPointer(fileSize, "/images/atlas/atlas.png", IDB_ATLAS, "PNG");
+        auto textureSpritesheet = std::make_shared<HL_Texture>();
+        if (!textureSpritesheet->Init(data, fileSize, Texture::USE_SRGB))
+        {
+            return false;
+        }
+        textureSpritesheet->SetFilename("spritesheet");
+        m_TextureAtlas = textureSpritesheet;
+        AddTexture(m_TextureAtlas.get());
+        return true;
+    }
+
+    bool HL_Renderer::BeginFrame(Camera* camera)
+    {
+        m_Camera = camera;
+        m_FrameInProgress = true;
+        for (auto& phaseTime : m_PhaseTimes)
+        {
+            phaseTime.m_Milliseconds = 0.0f;
+        }
+        m_FrustumCuller.BeginFrame();
+        return true;
+    }
+
+    void HL_Renderer::EndScene()
+    {
+        m_FrameInProgress = false;
+        ++m_FrameCounter;
+    }
+
+    void HL_Renderer::SubmitShadows(Registry& registry, const std::vector<DirectionalLightComponent*>& directionalLights)
+    {
+        if (directionalLights.size() != 2)
+        {
+            return;
+        }
+
+        PhaseTimer phaseTimer(m_PhaseTimes[PHASE_CULLING]);
+        for (uint cascade = 0; cascade < directionalLights.size(); ++cascade)
+        {
+            auto lightView = directionalLights[cascade]->m_LightView;
+            auto visibilityPass = static_cast<FrustumCuller::Pass>(FrustumCuller::SHADOW_CASCADE_0 + cascade);
+            glm::mat4 viewProjection = lightView->GetProjectionMatrix() * lightView->GetViewMatrix();
+            m_FrustumCuller.Cull(registry, visibilityPass, viewProjection, m_FrameCounter % MAX_FRAMES_IN_FLIGHT);
+        }
+    }
+
+    void HL_Renderer::RenderpassWater(Registry& registry, Camera& camera, bool reflection, glm::vec4 const& clippingPlane)
+    {
+        PhaseTimer phaseTimer(m_PhaseTimes[PHASE_CULLING]);
+        auto renderpassIndex = reflection ? WaterPasses::REFLECTION : WaterPasses::REFRACTION;
+        auto visibilityPass =
+            static_cast<FrustumCuller::Pass>(static_cast<uint>(FrustumCuller::WATER_REFRACTION) + renderpassIndex);
+        m_FrustumCuller.Cull(registry, visibilityPass, camera.GetProjectionMatrix() * camera.GetViewMatrix(),
+                             m_FrameCounter % MAX_FRAMES_IN_FLIGHT);
+    }
+
+    void HL_Renderer::Renderpass3D(Registry& registry)
+    {
+        if (!m_FrameInProgress)
+        {
+            return;
+        }
+        PhaseTimer phaseTimer(m_PhaseTimes[PHASE_CULLING]);
+        m_FrustumCuller.Cull(registry, FrustumCuller::CAMERA, m_Camera->GetProjectionMatrix() * m_Camera->GetViewMatrix(),
+                             m_FrameCounter % MAX_FRAMES_IN_FLIGHT);
+    }
+
+    void HL_Renderer::UpdateTransformCache(Scene& scene)
+    {
+        ZoneScopedN("HL_Renderer::UpdateTransformCache()");
+        PhaseTimer phaseTimer(m_PhaseTimes[PHASE_TRANSFORM_CACHE]);
+        Camera const* camera = m_FrameInProgress ? m_Camera : nullptr;
+        FrameUpdate::UpdateTransformCache(scene, camera, m_FrameCounter % MAX_FRAMES_IN_FLIGHT);
+    }
+
+    void HL_Renderer::UpdateAnimations(Registry& registry, const Timestep& timestep)
+    {
+        ZoneScopedN("HL_Renderer::UpdateAnimations()");
+        PhaseTimer phaseTimer(m_PhaseTimes[PHASE_ANIMATIONS]);
+        auto allocateJointMatrices = [&](uint numberOfJoints)
+        {
+            m_JointMatrices.resize(numberOfJoints);
+            return m_JointMatrices.data();
+        };
+        FrameUpdate::UpdateAnimations(registry, timestep, m_FrameCounter, allocateJointMatrices);
+    }
+} // namespace GfxRenderEngine
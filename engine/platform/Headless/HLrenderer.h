@@ -0,0 +1,143 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "engine.h"
+#include "renderer/renderer.h"
+#include "renderer/texture.h"
+
+namespace GfxRenderEngine
+{
+    class HL_Window;
+
+    // Renderer without a GPU: all CPU work of a frame (transform cache, terrain and grass streaming,
+    // skeletal animation, frustum culling) runs as with the Vulkan renderer, the passes record nothing.
+    // The CPU time of each phase is reported through GetRecordTimes().
+    class HL_Renderer : public Renderer
+    {
+
+    public:
+        HL_Renderer(HL_Window* window);
+        virtual ~HL_Renderer();
+
+        HL_Renderer(const HL_Renderer&) = delete;
+        HL_Renderer& operator=(const HL_Renderer&) = delete;
+
+        uint GetContextWidth() const;
+        uint GetContextHeight() const;
+
+        virtual bool Init() override;
+        virtual bool BeginFrame(Camera* camera) override;
+        virtual void Renderpass3D(Registry& registry) override;
+        virtual void RenderpassWater(Registry& registry, Camera& camera, bool reflection,
+                                     glm::vec4 const& clippingPlane) override;
+        virtual void EndRenderpassWater() override {}
+        virtual void SubmitShadows(Registry& registry,
+                                   const std::vector<DirectionalLightComponent*>& directionalLights = {}) override;
+        virtual void Submit(Scene& scene) override {}
+        virtual void SubmitWater(Scene& scene, bool reflection) override {}
+        virtual void NextSubpass() override {}
+        virtual void LightingPass() override {}
+        virtual void LightingPassIBL(float uMaxPrefilterMip,
+                                     std::shared_ptr<ResourceDescriptor> const& resourceDescriptorIBL) override
+        {
+        }
+        virtual void LightingPassWater(bool reflection) override {}
+        virtual void PostProcessingRenderpass() override {}
+        virtual void TransparencyPass(Registry& registry, std::vector<ParticleSystem*> const& particleSystems) override {}
+        virtual void TransparencyPassWater(Registry& registry, bool reflection) override {}
+        virtual void Submit2D(Camera* camera, Registry& registry) override {}
+        virtual void GUIRenderpass(Camera* camera) override {}
+        virtual void EndScene() override;
+        virtual uint GetFrameCounter() override { return m_FrameCounter; }
+        virtual FrustumCuller::Statistics const& GetCullingStatistics(FrustumCuller::Pass pass) const override
+        {
+            return m_FrustumCuller.GetStatistics(pass);
+        }
+        virtual std::vector<RecordTime> const& GetRecordTimes() const override { return m_PhaseTimes; }
+        virtual void SetAmbientLightIntensity(float ambientLightIntensity) override
+        {
+            m_AmbientLightIntensity = ambientLightIntensity;
+        }
+        virtual float GetAmbientLightIntensity() override { return m_AmbientLightIntensity; }
+        virtual void DrawWithTransform(const Sprite& sprite, const glm::mat4& transform) override {}
+        virtual void Draw(const Sprite& sprite, const glm::mat4& position, const glm::vec4& color,
+                          const float textureID = 1.0f) override
+        {
+        }
+        virtual void ShowDebugShadowMap(bool showDebugShadowMap) override {}
+        virtual void UpdateTransformCache(Scene& scene) override;
+        virtual void UpdateAnimations(Registry& registry, const Timestep& timestep) override;
+        virtual float& Exposure() override { return m_Exposure; }
+        virtual std::bitset<32>& ShaderSettings0() override { return m_ShaderSettings0; }
+
+        virtual Texture::BindlessTextureID AddTexture(Texture* texture) override { return m_NextBindlessTextureID++; }
+        virtual std::shared_ptr<Texture> GetTextureAtlas() override { return m_TextureAtlas; }
+
+    private:
+        // frame index for per-frame buffers such as the grass slices, like VK_SwapChain
+        static constexpr uint MAX_FRAMES_IN_FLIGHT = 2;
+
+        enum Phases
+        {
+            PHASE_TRANSFORM_CACHE = 0,
+            PHASE_ANIMATIONS,
+            PHASE_CULLING,
+            NUMBER_OF_PHASES
+        };
+
+        // adds the CPU time of a scope to a phase
+        class PhaseTimer
+        {
+        public:
+            PhaseTimer(RecordTime& recordTime);
+            ~PhaseTimer();
+
+        private:
+            RecordTime& m_RecordTime;
+            std::chrono::high_resolution_clock::time_point m_Start;
+        };
+
+    private:
+        HL_Window* m_Window;
+        Camera* m_Camera{nullptr};
+        uint m_FrameCounter{0};
+        bool m_FrameInProgress{false};
+        FrustumCuller m_FrustumCuller;
+        std::vector<RecordTime> m_PhaseTimes;
+        // final joint matrices of all animated skeletons, the CPU side of the joint buffer of VK_Renderer
+        std::vector<glm::mat4> m_JointMatrices;
+
+        std::shared_ptr<Texture> m_TextureAtlas;
+        Texture::BindlessTextureID m_NextBindlessTextureID{0};
+
+        float m_AmbientLightIntensity{0.0f};
+        float m_Exposure{1.0f};
+        std::bitset<32> m_ShaderSettings0;
+    };
+} // namespace GfxRenderEngine
@@ -0,0 +1,49 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include "HLstorageImage.h"
+
+namespace GfxRenderEngine
+{
+    HL_StorageImage::StorageImageID HL_StorageImage::m_GlobalStorageImageIDCounter = 0;
+    std::mutex HL_StorageImage::m_Mutex;
+
+    HL_StorageImage::HL_StorageImage() : m_Width{0}, m_Height{0}
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_StorageImageID = m_GlobalStorageImageIDCounter;
+        ++m_GlobalStorageImageIDCounter;
+    }
+
+    HL_StorageImage::~HL_StorageImage() {}
+
+    bool HL_StorageImage::Init(const uint width, const uint height)
+    {
+        m_Width = width;
+        m_Height = height;
+        m_Pixels.assign(static_cast<size_t>(m_Width) * m_Height * BYTES_PER_PIXEL, 0);
+        return true;
+    }
+
+    void HL_StorageImage::Resize(uint width, uint height) { Init(width, height); }
+} // namespace GfxRenderEngine
@@ -0,0 +1,224 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include <cstring>
+#include <string>
+
+#include "core.h"
+#include "stb_image.h"
+#include "auxiliary/file.h"
+#include "renderer/cookedTexture.h"
+
+#include "HLtexture.h"
+
+namespace GfxRenderEngine
+{
+    HL_Texture::TextureID HL_Texture::m_GlobalTextureIDCounter = 0;
+    std::mutex HL_Texture::m_Mutex;
+
+    HL_Texture::HL_Texture() : m_FileName(""), m_Width(0), m_Height(0), m_BytesPerPixel(0), m_sRGB(false)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_TextureID = m_GlobalTextureIDCounter;
+        ++m_GlobalTextureIDCounter;
+    }
+
+    HL_Texture::~HL_Texture() {}
+
+    // create texture from raw memory
+    bool HL_Texture::Init(const uint width, const uint height, bool sRGB, const void* data, int minFilter, int magFilter)
+    {
+        ZoneScopedNC("HL_Texture::Init", 0xffff00);
+        m_FileName = "raw memory";
+        m_sRGB = sRGB;
+        if (!data)
+        {
+            return false;
+        }
+        m_Width = width;
+        m_Height = height;
+        m_BytesPerPixel = 4;
+        auto pixels = static_cast<uchar const*>(data);
+        m_Pixels.assign(pixels, pixels + m_Width * m_Height * m_BytesPerPixel);
+        return true;
+    }
+
+    // create texture from file on disk, same lookup of cooked textures as VK_Texture
+    bool HL_Texture::Init(const std::string& fileName, bool sRGB, bool flip)
+    {
+        ZoneScopedNC("HL_Texture::Init", 0xffff00);
+        m_sRGB = sRGB;
+        if (CookedTexture::IsCookedFilename(fileName))
+        {
+            return InitCooked(fileName, sRGB, flip, 0);
+        }
+        std::string cookedFileName = CookedTexture::GetCookedFilename(fileName);
+        if (EngineCore::FileExists(cookedFileName) &&
+            InitCooked(cookedFileName, sRGB, flip, CookedTexture::HashSource(fileName)))
+        {
+            return true;
+        }
+
+        stbi_set_flip_vertically_on_load(flip);
+        m_FileName = fileName;
+        uchar* localBuffer = stbi_load(m_FileName.c_str(), &m_Width, &m_Height, &m_BytesPerPixel, 4);
+        if (!localBuffer)
+        {
+            LOG_CORE_CRITICAL("Texture: Couldn't load file {0}", fileName);
+            return false;
+        }
+        m_BytesPerPixel = 4;
+        m_Pixels.assign(localBuffer, localBuffer + m_Width * m_Height * m_BytesPerPixel);
+        stbi_image_free(localBuffer);
+        return true;
+    }
+
+    // there is no sampler in headless mode, the filters are ignored
+    bool HL_Texture::Init(const std::string& fileName, bool sRGB, bool flip, int minFilter, int magFilter)
+    {
+        return Init(fileName, sRGB, flip);
+    }
+
+    // create texture from file in memory, same as VK_Texture for cooked textures
+    bool HL_Texture::Init(const unsigned char* data, int length, bool sRGB)
+    {
+        if (CookedTexture::IsCooked(data, length))
+        {
+            m_sRGB = sRGB;
+            CookedTexture cookedTexture;
+            if (!cookedTexture.Open(data, length))
+            {
+                LOG_CORE_CRITICAL("Texture: couldn't open cooked texture in memory: {0}", cookedTexture.GetError());
+                return false;
+            }
+            return InitCooked(cookedTexture, "cooked texture in memory", true);
+        }
+
+        stbi_set_flip_vertically_on_load(true);
+        m_FileName = "file in memory";
+        m_sRGB = sRGB;
+        uchar* localBuffer = stbi_load_from_memory(data, length, &m_Width, &m_Height, &m_BytesPerPixel, 4);
+        if (!localBuffer)
+        {
+            LOG_CORE_CRITICAL("Texture: Couldn't load file {0}", m_FileName);
+            return false;
+        }
+        m_BytesPerPixel = 4;
+        m_Pixels.assign(localBuffer, localBuffer + m_Width * m_Height * m_BytesPerPixel);
+        stbi_image_free(localBuffer);
+        return true;
+    }
+
+    // create texture with mip maps from vector of high resolution images
+    bool HL_Texture::Init(std::vector<HiResImage> const& hiResImages, bool linearFilter)
+    {
+        if (!hiResImages.size()) // sanity check
+        {
+            LOG_CORE_CRITICAL("Texture: hiResImages is empty");
+            return false;
+        }
+        m_FileName = hiResImages.size() == 1 ? "float data" : "float data with mip maps";
+        m_Width = hiResImages[0].GetWidth();
+        m_Height = hiResImages[0].GetHeight();
+        m_BytesPerPixel = 4 * sizeof(float); // RGBA float
+        m_Pixels.clear();
+        for (auto const& hiResImage : hiResImages)
+        {
+            if (!hiResImage.IsInitialized())
+            {
+                LOG_CORE_CRITICAL("Texture: Couldn't create texture from {0}", hiResImage.GetFilename());
+                return false;
+            }
+            auto pixels = reinterpret_cast<uchar const*>(hiResImage.GetBuffer());
+            size_t size = hiResImage.GetWidth() * hiResImage.GetHeight() * m_BytesPerPixel;
+            m_Pixels.insert(m_Pixels.end(), pixels, pixels + size);
+        }
+        return true;
+    }
+
+    // all mip levels of a cooked texture, as they would be uploaded
+    bool HL_Texture::InitCooked(const std::string& cookedFileName, bool sRGB, bool flip, uint64 sourceHash)
+    {
+        ZoneScopedNC("HL_Texture::InitCooked", 0xffff00);
+        m_sRGB = sRGB;
+        CookedTexture cookedTexture;
+        if (!cookedTexture.Open(cookedFileName))
+        {
+            LOG_CORE_WARN("Texture: couldn't open cooked texture {0}", cookedTexture.GetError());
+            return false;
+        }
+        if (sourceHash && (cookedTexture.GetSourceHash() != sourceHash))
+        {
+            LOG_CORE_WARN("Texture: {0} is out of date, its source changed since it was cooked, ignoring it",
+                          cookedFileName);
+            return false;
+        }
+        return InitCooked(cookedTexture, cookedFileName, flip);
+    }
+
+    // there is no sampler in headless mode, the filters are ignored
+    bool HL_Texture::InitCooked(const std::string& cookedFileName, bool sRGB, bool flip, uint64 sourceHash, int minFilter,
+                                int magFilter)
+    {
+        return InitCooked(cookedFileName, sRGB, flip, sourceHash);
+    }
+
+    bool HL_Texture::InitCooked(CookedTexture const& cookedTexture, const std::string& name, bool flip)
+    {
+        bool cookedFlipped = cookedTexture.GetFlags() & CookedTexture::FLAG_FLIPPED;
+        if (cookedFlipped != flip)
+        {
+            LOG_CORE_WARN("Texture: {0} was cooked {1}, ignoring it", name, cookedFlipped ? "flipped" : "not flipped");
+            return false;
+        }
+
+        m_FileName = name;
+        m_Width = static_cast<int>(cookedTexture.GetWidth());
+        m_Height = static_cast<int>(cookedTexture.GetHeight());
+        m_BytesPerPixel = 4;
+        m_Pixels.clear();
+        for (uint mipLevel = 0; mipLevel < cookedTexture.GetLevelCount(); ++mipLevel)
+        {
+            CookedTexture::Level const& level = cookedTexture.GetLevel(mipLevel);
+            m_Pixels.insert(m_Pixels.end(), level.m_Data, level.m_Data + level.m_Size);
+        }
+        return true;
+    }
+
+    void HL_Texture::Blit(uint x, uint y, uint width, uint height, uint bytesPerPixel, const void* data)
+    {
+        LOG_CORE_CRITICAL("not implemented void HL_Texture::Blit(uint x, uint y, uint width, uint height, uint "
+                          "bytesPerPixel, const void* data)");
+    }
+
+    void HL_Texture::Blit(uint x, uint y, uint width, uint height, int dataFormat, int type, const void* data)
+    {
+        LOG_CORE_CRITICAL("not implemented void HL_Texture::Blit(uint x, uint y, uint width, uint height, int dataFormat, "
+                          "int type, const void* data)");
+    }
+
+    void HL_Texture::Resize(uint width, uint height)
+    {
+        LOG_CORE_CRITICAL("not implemented void HL_Texture::Resize(uint width, uint height)");
+    }
+} // namespace GfxRenderEngine
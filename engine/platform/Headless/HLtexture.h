@@ -0,0 +1,77 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include "engine.h"
+#include "renderer/cookedTexture.h"
+#include "renderer/texture.h"
+
+namespace GfxRenderEngine
+{
+    // texture in CPU memory: the decoded pixels (or the payload of a cooked texture) are kept,
+    // so that the cost of loading a level is measured without a GPU
+    class HL_Texture : public Texture
+    {
+
+    public:
+        HL_Texture();
+        virtual ~HL_Texture();
+
+        virtual bool Init(const uint width, const uint height, bool sRGB, const void* data, int minFilter,
+                          int magFilter) override;
+        virtual bool Init(const std::string& fileName, bool sRGB, bool flip = true) override;
+        virtual bool Init(const std::string& fileName, bool sRGB, bool flip, int minFilter, int magFilter) override;
+        virtual bool Init(const unsigned char* data, int length, bool sRGB) override;
+        virtual bool Init(std::vector<HiResImage> const& hiResImages, bool linearFilter = true) override;
+        virtual bool InitCooked(const std::string& cookedFileName, bool sRGB, bool flip, uint64 sourceHash) override;
+        virtual bool InitCooked(const std::string& cookedFileName, bool sRGB, bool flip, uint64 sourceHash, int minFilter,
+                                int magFilter) override;
+        virtual int GetWidth() const override { return m_Width; }
+        virtual int GetHeight() const override { return m_Height; }
+        virtual TextureID GetTextureID() const override { return m_TextureID; }
+        virtual void Resize(uint width, uint height) override;
+        virtual void Blit(uint x, uint y, uint width, uint height, uint bytesPerPixel, const void* data) override;
+        virtual void Blit(uint x, uint y, uint width, uint height, int dataFormat, int type, const void* data) override;
+        virtual void SetFilename(const std::string& filename) override { m_FileName = filename; }
+
+        size_t GetSize() const { return m_Pixels.size(); }
+
+    private:
+        bool InitCooked(CookedTexture const& cookedTexture, const std::string& name, bool flip);
+
+    private:
+        TextureID m_TextureID;
+        std::string m_FileName;
+        int m_Width, m_Height, m_BytesPerPixel;
+        bool m_sRGB;
+        std::vector<uchar> m_Pixels;
+
+    private:
+        static TextureID m_GlobalTextureIDCounter;
+        static std::mutex m_Mutex;
+    };
+} // namespace GfxRenderEngine
@@ -0,0 +1,76 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include <chrono>
+
+#include "engine.h"
+#include "platform/window.h"
+
+namespace GfxRenderEngine
+{
+    // a window without a surface: no events, no swapchain, a fixed size
+    class HL_Window : public Window
+    {
+
+    public:
+        HL_Window(const WindowProperties& props);
+        virtual ~HL_Window() override;
+
+        HL_Window(const HL_Window&) = delete;
+        HL_Window& operator=(const HL_Window&) = delete;
+
+        virtual void Shutdown() override { m_OK = false; }
+        void* GetBackendWindow() const override { return nullptr; }
+
+        void OnUpdate() override {}
+        uint GetWidth() const override { return m_Width; }
+        uint GetHeight() const override { return m_Height; }
+        uint GetDesktopWidth() const override { return m_Width; }
+        uint GetDesktopHeight() const override { return m_Height; }
+
+        void SetEventCallback(const EventCallbackFunction& callback) override { m_EventCallback = callback; }
+        void ToggleFullscreen() override {}
+        bool IsFullscreen() override { return false; }
+        bool IsOK() const override { return m_OK; }
+        void SetWindowAspectRatio() override {}
+        void SetWindowAspectRatio(int numer, int denom) override {}
+        float GetWindowAspectRatio() const override { return static_cast<float>(m_Width) / m_Height; }
+        double GetTime() const override;
+
+        void EnableMousePointer() override {}
+        void DisableMousePointer() override {}
+        virtual void AllowCursor() override {}
+        virtual void DisallowCursor() override {}
+
+    private:
+        static constexpr uint DEFAULT_WIDTH = 1920;
+        static constexpr uint DEFAULT_HEIGHT = 1080;
+
+        bool m_OK;
+        uint m_Width, m_Height;
+        EventCallbackFunction m_EventCallback;
+        std::chrono::steady_clock::time_point m_StartTime;
+    };
+} // namespace GfxRenderEngine
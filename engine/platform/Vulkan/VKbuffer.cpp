@@ -131,10 +131,9 @@ namespace GfxRenderEngine
         {
             std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
             vkDestroyBuffer(VK_Core::m_Device->Device(), m_Buffer, nullptr);
-            vkFreeMemory(VK_Core::m_Device->Device(), m_Memory, nullptr);
+            VK_Core::m_Device->FreeMemory(m_Memory);
         }
         m_Buffer = VK_NULL_HANDLE;
-        m_Memory = VK_NULL_HANDLE;
         m_BufferID = 0;
         m_BufferDeviceAddress = 0;
 
@@ -149,6 +148,9 @@ namespace GfxRenderEngine
     /**
      * Map a memory range of this buffer. If successful, mapped points to the specified buffer range.
      *
+     * @note Host-visible memory is persistently mapped by the memory allocator,
+     * this only resolves the pointer into the sub-allocation
+     *
      * @param size (Optional) Size of the memory range to map. Pass VK_WHOLE_SIZE to map the complete
      * buffer range.
      * @param offset (Optional) Byte offset from beginning
@@ -157,18 +159,17 @@ namespace GfxRenderEngine
      */
     VkResult VK_Buffer::Map(VkDeviceSize size, VkDeviceSize offset)
     {
-        std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-        if (!(m_Buffer && m_Memory))
+        if (!(m_Buffer && m_Memory.IsValid()))
         {
             LOG_CORE_CRITICAL("VkResult VK_Buffer::Map(...): Called map on buffer before create");
         }
-        auto result = vkMapMemory(VK_Core::m_Device->Device(), m_Memory, offset, size, 0, &m_Mapped);
-        if (result != VK_SUCCESS)
+        if (!m_Memory.m_Mapped)
         {
-            VK_Core::m_Device->PrintError(result);
-            CORE_HARD_STOP("VK_Buffer::Map");
+            VK_Core::m_Device->PrintError(VK_ERROR_MEMORY_MAP_FAILED);
+            CORE_HARD_STOP("VK_Buffer::Map: buffer memory is not host visible");
         }
-        return result;
+        m_Mapped = static_cast<char*>(m_Memory.m_Mapped) + offset;
+        return VK_SUCCESS;
     }
 
     void VK_Buffer::MapBuffer() { Map(); }
@@ -176,19 +177,9 @@ namespace GfxRenderEngine
     /**
      * Unmap a mapped memory range
      *
-     * @note Does not return a result as vkUnmapMemory can't fail
+     * @note The underlying memory block stays mapped until it is released by the memory allocator
      */
-    void VK_Buffer::Unmap()
-    {
-        if (m_Mapped)
-        {
-            {
-                std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-                vkUnmapMemory(VK_Core::m_Device->Device(), m_Memory);
-            }
-            m_Mapped = nullptr;
-        }
-    }
+    void VK_Buffer::Unmap() { m_Mapped = nullptr; }
 
     /**
      * Copies the specified data to the m_Mapped buffer. Default value writes whole buffer range
@@ -229,11 +220,8 @@ namespace GfxRenderEngine
      */
     VkResult VK_Buffer::Flush(VkDeviceSize size, VkDeviceSize offset)
     {
-        VkMappedMemoryRange mappedRange = {};
-        mappedRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-        mappedRange.memory = m_Memory;
-        mappedRange.offset = offset;
-        mappedRange.size = size;
+        VkMappedMemoryRange mappedRange =
+            VK_Core::m_Device->GetMemoryAllocator()->GetMappedMemoryRange(m_Memory, size, offset);
         VkResult result;
         {
             std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
@@ -255,11 +243,8 @@ namespace GfxRenderEngine
      */
     VkResult VK_Buffer::Invalidate(VkDeviceSize size, VkDeviceSize offset)
     {
-        VkMappedMemoryRange mappedRange = {};
-        mappedRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-        mappedRange.memory = m_Memory;
-        mappedRange.offset = offset;
-        mappedRange.size = size;
+        VkMappedMemoryRange mappedRange =
+            VK_Core::m_Device->GetMemoryAllocator()->GetMappedMemoryRange(m_Memory, size, offset);
         std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
         return vkInvalidateMappedMemoryRanges(VK_Core::m_Device->Device(), 1, &mappedRange);
     }
@@ -92,7 +92,7 @@ namespace GfxRenderEngine
     private:
         void* m_Mapped{nullptr};
         VkBuffer m_Buffer{VK_NULL_HANDLE};
-        VkDeviceMemory m_Memory{VK_NULL_HANDLE};
+        VK_Allocation m_Memory{};
         BufferID m_BufferID{0};
         BufferDeviceAddress m_BufferDeviceAddress{0};
 
@@ -44,7 +44,7 @@ namespace GfxRenderEngine
         vkDestroyImage(device, m_CubemapImage, nullptr);
         vkDestroyImageView(device, m_ImageView, nullptr);
         vkDestroySampler(device, m_Sampler, nullptr);
-        vkFreeMemory(device, m_CubemapImageMemory, nullptr);
+        VK_Core::m_Device->FreeMemory(m_CubemapImageMemory);
     }
 
     // create texture from files on disk
@@ -109,8 +109,6 @@ namespace GfxRenderEngine
     void VK_Cubemap::CreateImage(VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage,
                                  VkMemoryPropertyFlags properties)
     {
-        auto device = VK_Core::m_Device->Device();
-
         m_ImageFormat = format;
         VkImageCreateInfo imageInfo{};
         imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
@@ -128,78 +126,7 @@ namespace GfxRenderEngine
         imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
         imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
-        {
-            auto result = vkCreateImage(device, &imageInfo, nullptr, &m_CubemapImage);
-            if (result != VK_SUCCESS)
-            {
-                VK_Core::m_Device->PrintError(result);
-                LOG_CORE_CRITICAL("failed to create image!");
-            }
-        }
-
-        VkMemoryRequirements memRequirements;
-        vkGetImageMemoryRequirements(device, m_CubemapImage, &memRequirements);
-
-        VkMemoryAllocateInfo allocInfo{};
-        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocInfo.allocationSize = memRequirements.size;
-        allocInfo.memoryTypeIndex = VK_Core::m_Device->FindMemoryType(memRequirements.memoryTypeBits, properties);
-
-        {
-            auto result = vkAllocateMemory(device, &allocInfo, nullptr, &m_CubemapImageMemory);
-            if (result != VK_SUCCESS)
-            {
-                VK_Core::m_Device->PrintError(result);
-                LOG_CORE_CRITICAL("failed to allocate image memory in 'void VK_Cubemap::CreateImage'");
-            }
-        }
-
-        {
-            std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-            vkBindImageMemory(device, m_CubemapImage, m_CubemapImageMemory, 0);
-        }
-    }
-
-    void VK_Cubemap::CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties,
-                                  VkBuffer& buffer, VkDeviceMemory& bufferMemory)
-    {
-        auto device = VK_Core::m_Device->Device();
-
-        VkBufferCreateInfo bufferInfo{};
-        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-        bufferInfo.size = size;
-        bufferInfo.usage = usage;
-        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-
-        {
-            auto result = vkCreateBuffer(device, &bufferInfo, nullptr, &buffer);
-            if (result != VK_SUCCESS)
-            {
-                VK_Core::m_Device->PrintError(result);
-                CORE_HARD_STOP("failed to create buffer!");
-            }
-        }
-
-        VkMemoryRequirements memRequirements;
-        vkGetBufferMemoryRequirements(device, buffer, &memRequirements);
-
-        VkMemoryAllocateInfo allocInfo{};
-        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocInfo.allocationSize = memRequirements.size;
-        allocInfo.memoryTypeIndex = VK_Core::m_Device->FindMemoryType(memRequirements.memoryTypeBits, properties);
-
-        {
-            auto result = vkAllocateMemory(device, &allocInfo, nullptr, &bufferMemory);
-            if (result != VK_SUCCESS)
-            {
-                VK_Core::m_Device->PrintError(result);
-                LOG_CORE_CRITICAL("failed to allocate buffer memory!");
-            }
-        }
-        {
-            std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-            vkBindBufferMemory(device, buffer, bufferMemory, 0);
-        }
+        VK_Core::m_Device->CreateImageWithInfo(imageInfo, properties, m_CubemapImage, m_CubemapImageMemory);
     }
 
     bool VK_Cubemap::Create()
@@ -210,9 +137,8 @@ namespace GfxRenderEngine
         VkDeviceSize imageSize;
 
         VkBuffer stagingBuffer;
-        VkDeviceMemory stagingBufferMemory;
+        VK_Allocation stagingBufferMemory;
 
-        void* data;
         uint64 memAddress;
         stbi_uc* pixels;
 
@@ -230,23 +156,15 @@ namespace GfxRenderEngine
                 layerSize = m_Width * m_Height * 4;
                 imageSize = layerSize * NUMBER_OF_CUBEMAP_IMAGES;
 
-                CreateBuffer(imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingBuffer,
-                             stagingBufferMemory);
-                {
-                    std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-                    vkMapMemory(device, stagingBufferMemory, 0, imageSize, 0, &data);
-                }
-                memAddress = reinterpret_cast<uint64>(data);
+                VK_Core::m_Device->CreateBuffer(imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                                                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                                stagingBuffer, stagingBufferMemory);
+                memAddress = reinterpret_cast<uint64>(stagingBufferMemory.m_Mapped);
             }
             memcpy(reinterpret_cast<void*>(memAddress), static_cast<void*>(pixels), static_cast<size_t>(layerSize));
             stbi_image_free(pixels);
             memAddress += layerSize;
         }
-        {
-            std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-            vkUnmapMemory(device, stagingBufferMemory);
-        }
 
         VkFormat format = m_sRGB ? VK_FORMAT_R8G8B8A8_SRGB : VK_FORMAT_R8G8B8A8_UNORM;
         CreateImage(format,                                                       /*VkFormat format                 */
@@ -269,7 +187,7 @@ namespace GfxRenderEngine
         {
             std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
             vkDestroyBuffer(device, stagingBuffer, nullptr);
-            vkFreeMemory(device, stagingBufferMemory, nullptr);
+            VK_Core::m_Device->FreeMemory(stagingBufferMemory);
         }
 
         // Create a texture sampler
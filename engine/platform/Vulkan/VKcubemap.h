@@ -48,8 +48,6 @@ namespace GfxRenderEngine
         bool Create();
         void CreateImage(VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties);
 
-        void CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer,
-                          VkDeviceMemory& bufferMemory);
         void TransitionImageLayout(VkImageLayout oldLayout, VkImageLayout newLayout);
 
     private:
@@ -62,7 +60,7 @@ namespace GfxRenderEngine
 
         VkFormat m_ImageFormat{VkFormat::VK_FORMAT_UNDEFINED};
         VkImage m_CubemapImage{nullptr};
-        VkDeviceMemory m_CubemapImageMemory{nullptr};
+        VK_Allocation m_CubemapImageMemory{};
         VkImageLayout m_ImageLayout{VkImageLayout::VK_IMAGE_LAYOUT_UNDEFINED};
         VkImageView m_ImageView{nullptr};
         VkSampler m_Sampler{nullptr};
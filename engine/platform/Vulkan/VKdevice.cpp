@@ -21,6 +21,7 @@
    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include <cstring>
+#include <fstream>
 #include <iostream>
 #include <set>
 #include <unordered_set>
@@ -83,13 +84,21 @@ namespace GfxRenderEngine
         CheckForBindlessSupport();
         CreateLogicalDevice();
         CreateCommandPool();
+        CreatePipelineCache();
+        m_MemoryAllocator = std::make_unique<VK_MemoryAllocator>(m_Device, m_PhysicalDevice);
+        m_Uploader = std::make_unique<VK_Uploader>(this);
     }
 
     VK_Device::~VK_Device()
     {
+        m_Uploader.reset();
         m_LoadPool.reset();
+        m_MemoryAllocator->PrintStats();
+        m_MemoryAllocator.reset();
+        SavePipelineCache();
         {
             std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
+            vkDestroyPipelineCache(m_Device, m_PipelineCache, nullptr);
             vkDestroyCommandPool(m_Device, m_GraphicsCommandPool, nullptr);
             vkDestroyDevice(m_Device, nullptr);
         }
@@ -118,6 +127,10 @@ namespace GfxRenderEngine
         std::lock_guard<std::mutex> guard(m_DeviceAccessMutex);
         vkQueueWaitIdle(m_GraphicsQueue);
         vkQueueWaitIdle(m_PresentQueue);
+        if (m_TransferQueue)
+        {
+            vkQueueWaitIdle(m_TransferQueue);
+        }
     }
 
     void VK_Device::CreateInstance()
@@ -252,6 +265,16 @@ namespace GfxRenderEngine
                 queueCreateInfos.push_back(CreateQueue(spec));
             }
         }
+        // dedicated transfer queue, never shares a family with graphics or present
+        QueueSpec transferQueueSpec = {
+            indices.m_TransferFamily, // int     m_QueueFamilyIndex;
+            1.0f,                     // float   m_QeuePriority;
+            1                         // int     m_QueueCount;
+        };
+        if (HasDedicatedTransferQueue())
+        {
+            queueCreateInfos.push_back(CreateQueue(transferQueueSpec));
+        }
 
         // PhysicalDeviceVulkan12Features required for timeline semaphore
         VkPhysicalDeviceVulkan12Features physicalDeviceVulkan12Features{};
@@ -283,8 +306,14 @@ namespace GfxRenderEngine
             exit(0);
         }
 
+        // block compressed textures are optional, cooked textures fall back to their source images
+        VkPhysicalDeviceFeatures supportedFeatures;
+        vkGetPhysicalDeviceFeatures(m_PhysicalDevice, &supportedFeatures);
+        m_TextureCompressionBC = supportedFeatures.textureCompressionBC;
+
         VkPhysicalDeviceFeatures deviceFeatures = {};
         deviceFeatures.samplerAnisotropy = VK_TRUE;
+        deviceFeatures.textureCompressionBC = supportedFeatures.textureCompressionBC;
         deviceFeatures.shaderClipDistance = VK_TRUE;
         deviceFeatures.fillModeNonSolid = VK_TRUE;
         deviceFeatures.shaderInt64 = VK_TRUE;
@@ -319,6 +348,11 @@ namespace GfxRenderEngine
         }
         vkGetDeviceQueue(m_Device, indices.m_GraphicsFamily, indices.m_QueueIndices[QueueTypes::GRAPHICS], &m_GraphicsQueue);
         vkGetDeviceQueue(m_Device, indices.m_PresentFamily, indices.m_QueueIndices[QueueTypes::PRESENT], &m_PresentQueue);
+        if (HasDedicatedTransferQueue())
+        {
+            vkGetDeviceQueue(m_Device, indices.m_TransferFamily, indices.m_QueueIndices[QueueTypes::TRANSFER],
+                             &m_TransferQueue);
+        }
         // PrintAllSupportedFormats();
     }
 
@@ -337,6 +371,87 @@ namespace GfxRenderEngine
         }
     }
 
+    void VK_Device::CreatePipelineCache()
+    {
+        std::vector<char> data;
+        {
+            std::ifstream file(PIPELINE_CACHE_FILEPATH, std::ios::ate | std::ios::binary);
+            if (file.is_open())
+            {
+                data.resize(static_cast<size_t>(file.tellg()));
+                file.seekg(0);
+                file.read(data.data(), data.size());
+            }
+        }
+        if (!data.empty() && !IsCompatiblePipelineCache(data))
+        {
+            LOG_CORE_INFO("discarding pipeline cache '{0}' (driver or device changed)", PIPELINE_CACHE_FILEPATH);
+            data.clear();
+        }
+
+        VkPipelineCacheCreateInfo cacheInfo{};
+        cacheInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        cacheInfo.initialDataSize = data.size();
+        cacheInfo.pInitialData = data.empty() ? nullptr : data.data();
+
+        auto result = vkCreatePipelineCache(m_Device, &cacheInfo, nullptr, &m_PipelineCache);
+        if (result != VK_SUCCESS)
+        {
+            // pipelines are still created without a cache
+            PrintError(result);
+            LOG_CORE_WARN("failed to create pipeline cache");
+            m_PipelineCache = nullptr;
+        }
+    }
+
+    bool VK_Device::IsCompatiblePipelineCache(std::vector<char> const& data)
+    {
+        // drivers must reject foreign blobs, but some don't, so the header is checked here
+        // header layout: size, version, vendor ID, device ID (uint32 each), pipeline cache UUID
+        constexpr size_t HEADER_SIZE = 4 * sizeof(uint32_t) + VK_UUID_SIZE;
+        if (data.size() < HEADER_SIZE)
+        {
+            return false;
+        }
+        uint32_t header[4];
+        memcpy(header, data.data(), sizeof(header));
+        return (header[0] >= HEADER_SIZE) && (header[1] == VK_PIPELINE_CACHE_HEADER_VERSION_ONE) &&
+               (header[2] == m_Properties.vendorID) && (header[3] == m_Properties.deviceID) &&
+               (memcmp(data.data() + sizeof(header), m_Properties.pipelineCacheUUID, VK_UUID_SIZE) == 0);
+    }
+
+    void VK_Device::SavePipelineCache()
+    {
+        if (!m_PipelineCache)
+        {
+            return;
+        }
+
+        size_t size = 0;
+        auto result = vkGetPipelineCacheData(m_Device, m_PipelineCache, &size, nullptr);
+        if ((result != VK_SUCCESS) || !size)
+        {
+            return;
+        }
+        std::vector<char> data(size);
+        result = vkGetPipelineCacheData(m_Device, m_PipelineCache, &size, data.data());
+        if (result != VK_SUCCESS)
+        {
+            PrintError(result);
+            return;
+        }
+
+        std::ofstream file(PIPELINE_CACHE_FILEPATH, std::ios::out | std::ios::binary);
+        if (file.is_open())
+        {
+            file.write(data.data(), size);
+        }
+        else
+        {
+            LOG_CORE_WARN("could not write pipeline cache '{0}'", PIPELINE_CACHE_FILEPATH);
+        }
+    }
+
     void VK_Device::CreateSurface() { m_Window->CreateWindowSurface(m_Instance, &m_Surface); }
 
     bool VK_Device::IsPreferredDevice(VkPhysicalDevice& device)
@@ -611,6 +726,26 @@ namespace GfxRenderEngine
         }
         LOG_CORE_INFO("all queue family indices found");
 
+        // transfer queue (optional): prefer a family that can only copy (DMA engine),
+        // otherwise any family without graphics support; uploads fall back to the graphics queue if none is found
+        for (int pass = 0; (pass < 2) && (indices.m_TransferFamily == NO_ASSIGNED); ++pass)
+        {
+            for (int familyIndex = 0; familyIndex < static_cast<int>(queueFamilyCount); ++familyIndex)
+            {
+                auto const& queueFamily = queueFamilies[familyIndex];
+                bool transferOnly = !(queueFamily.queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT));
+                if ((queueFamily.queueCount > 0) && (queueFamily.queueFlags & VK_QUEUE_TRANSFER_BIT) &&
+                    !(queueFamily.queueFlags & VK_QUEUE_GRAPHICS_BIT) && (transferOnly || (pass == 1)) &&
+                    (familyIndex != indices.m_PresentFamily))
+                {
+                    indices.m_TransferFamily = familyIndex;
+                    ++indices.m_NumberOfQueues;
+                    LOG_CORE_INFO("dedicated transfer queue family: {0}", familyIndex);
+                    break;
+                }
+            }
+        }
+
         indices.m_QueueIndices[QueueTypes::GRAPHICS] = 0;
         indices.m_QueueIndices[QueueTypes::PRESENT] =
             0; // either shares the same queue with grapics or has a different queue family, in which it will also be queue 0
@@ -695,7 +830,7 @@ namespace GfxRenderEngine
     }
 
     void VK_Device::CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties,
-                                 VkBuffer& buffer, VkDeviceMemory& bufferMemory)
+                                 VkBuffer& buffer, VK_Allocation& bufferMemory)
     {
         // no guard needed; none of the below are externally synchronized
         VkBufferCreateInfo bufferInfo{};
@@ -704,6 +839,17 @@ namespace GfxRenderEngine
         bufferInfo.usage = usage;
         bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
+        // buffers that take part in copies may be accessed by the transfer queue and the graphics queue;
+        // concurrent sharing avoids queue family ownership transfers
+        uint queueFamilyIndices[] = {static_cast<uint>(m_QueueFamilyIndices.m_GraphicsFamily),
+                                     static_cast<uint>(m_QueueFamilyIndices.m_TransferFamily)};
+        if (HasDedicatedTransferQueue() && (usage & (VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT)))
+        {
+            bufferInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+            bufferInfo.queueFamilyIndexCount = 2;
+            bufferInfo.pQueueFamilyIndices = queueFamilyIndices;
+        }
+
         auto result = vkCreateBuffer(m_Device, &bufferInfo, nullptr, &buffer);
         if (result != VK_SUCCESS)
         {
@@ -714,26 +860,15 @@ namespace GfxRenderEngine
         VkMemoryRequirements memRequirements;
         vkGetBufferMemoryRequirements(m_Device, buffer, &memRequirements);
 
-        VkMemoryAllocateFlagsInfo allocFlagsInfo{};
-        allocFlagsInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
-        allocFlagsInfo.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT; // for buffer device address feature (BDA)
-
-        VkMemoryAllocateInfo allocInfo{};
-        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocInfo.allocationSize = memRequirements.size;
-        allocInfo.memoryTypeIndex = FindMemoryType(memRequirements.memoryTypeBits, properties);
-        allocInfo.pNext = &allocFlagsInfo; // for buffer device address feature
-
-        result = vkAllocateMemory(m_Device, &allocInfo, nullptr, &bufferMemory);
-        if (result != VK_SUCCESS)
+        if (!m_MemoryAllocator->Allocate(memRequirements, properties, VK_MemoryAllocator::ResourceType::Buffer,
+                                         bufferMemory))
         {
-            VK_Core::m_Device->PrintError(result);
             LOG_CORE_CRITICAL("failed to allocate vertex buffer memory!");
         }
 
         {
             std::lock_guard<std::mutex> guard(m_DeviceAccessMutex);
-            vkBindBufferMemory(m_Device, buffer, bufferMemory, 0);
+            vkBindBufferMemory(m_Device, buffer, bufferMemory.m_Memory, bufferMemory.m_Offset);
         }
     }
 
@@ -770,6 +905,12 @@ namespace GfxRenderEngine
             std::lock_guard<std::mutex> guard(m_DeviceAccessMutex);
             vkEndCommandBuffer(commandBuffer);
         }
+        // the recorded commands may read resources with pending uploads
+        m_Uploader->FlushAll();
+        uint64 transferWaitValue = 0;
+        VkSemaphore transferSemaphore = m_Uploader->GetTransferSemaphore(transferWaitValue);
+        VkPipelineStageFlags transferWaitStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
         uint64_t& signalTimelineValue = m_LoadPool->GetSignalValue();
         ++signalTimelineValue;
         VkTimelineSemaphoreSubmitInfo timelineSemaphoreSubmitInfo{};
@@ -781,6 +922,14 @@ namespace GfxRenderEngine
         VkSubmitInfo submitInfo{};
         submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
         submitInfo.pNext = &timelineSemaphoreSubmitInfo;
+        if (transferSemaphore)
+        {
+            timelineSemaphoreSubmitInfo.waitSemaphoreValueCount = 1;
+            timelineSemaphoreSubmitInfo.pWaitSemaphoreValues = &transferWaitValue;
+            submitInfo.waitSemaphoreCount = 1;
+            submitInfo.pWaitSemaphores = &transferSemaphore;
+            submitInfo.pWaitDstStageMask = &transferWaitStage;
+        }
         submitInfo.commandBufferCount = 1;
         submitInfo.pCommandBuffers = &commandBuffer;
         submitInfo.signalSemaphoreCount = 1;
@@ -799,19 +948,13 @@ namespace GfxRenderEngine
             waitInfo.semaphoreCount = 1;
             waitInfo.pSemaphores = &signalSemaphore;
             waitInfo.pValues = &waitValue;
-            while (true)
             {
+                // block in the driver instead of polling
                 ZoneScopedN("ESTC wait sema");
-                {
-                    if (vkWaitSemaphores(m_Device, &waitInfo, 0 /* no timeout, return immediately*/) == VK_SUCCESS)
-                    {
-                        std::lock_guard<std::mutex> guard(m_DeviceAccessMutex);
-                        vkFreeCommandBuffers(m_Device, m_LoadPool->GetCommandPool(), 1, &commandBuffer);
-                        break;
-                    }
-                }
-                std::this_thread::sleep_for(1ms);
+                vkWaitSemaphores(m_Device, &waitInfo, UINT64_MAX);
             }
+            std::lock_guard<std::mutex> guard(m_DeviceAccessMutex);
+            vkFreeCommandBuffers(m_Device, m_LoadPool->GetCommandPool(), 1, &commandBuffer);
         }
     }
 
@@ -857,7 +1000,7 @@ namespace GfxRenderEngine
     }
 
     void VK_Device::CreateImageWithInfo(const VkImageCreateInfo& imageInfo, VkMemoryPropertyFlags properties, VkImage& image,
-                                        VkDeviceMemory& imageMemory)
+                                        VK_Allocation& imageMemory)
     {
         {
             auto result = vkCreateImage(m_Device, &imageInfo, nullptr, &image);
@@ -871,23 +1014,14 @@ namespace GfxRenderEngine
         VkMemoryRequirements memRequirements;
         vkGetImageMemoryRequirements(m_Device, image, &memRequirements);
 
-        VkMemoryAllocateInfo allocInfo{};
-        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocInfo.allocationSize = memRequirements.size;
-        allocInfo.memoryTypeIndex = FindMemoryType(memRequirements.memoryTypeBits, properties);
-
+        if (!m_MemoryAllocator->Allocate(memRequirements, properties, VK_MemoryAllocator::ResourceType::Image, imageMemory))
         {
-            auto result = vkAllocateMemory(m_Device, &allocInfo, nullptr, &imageMemory);
-            if (result != VK_SUCCESS)
-            {
-                PrintError(result);
-                LOG_CORE_CRITICAL("failed to allocate image memory! in 'void VK_Device::CreateImageWithInfo'");
-            }
+            LOG_CORE_CRITICAL("failed to allocate image memory! in 'void VK_Device::CreateImageWithInfo'");
         }
         // only vkBindImageMemory is externally synchronized in this function
         {
             std::lock_guard<std::mutex> guard(m_DeviceAccessMutex);
-            auto result = vkBindImageMemory(m_Device, image, imageMemory, 0);
+            auto result = vkBindImageMemory(m_Device, image, imageMemory.m_Memory, imageMemory.m_Offset);
             if (result != VK_SUCCESS)
             {
                 PrintError(result);
@@ -27,6 +27,8 @@
 
 #include "VKpool.h"
 #include "VKdeviceStructs.h"
+#include "VKmemoryAllocator.h"
+#include "VKuploader.h"
 #include "auxiliary/threadPool.h"
 
 namespace GfxRenderEngine
@@ -75,15 +77,20 @@ namespace GfxRenderEngine
 
         VkDevice Device() { return m_Device; }
         VkCommandPool GetCommandPool() { return m_GraphicsCommandPool; }
+        // shared by all pipelines, loaded from and saved to PIPELINE_CACHE_FILEPATH
+        VkPipelineCache GetPipelineCache() { return m_PipelineCache; }
         VkPhysicalDevice PhysicalDevice() { return m_PhysicalDevice; }
         VkSurfaceKHR Surface() { return m_Surface; }
         VkQueue GraphicsQueue() { return m_GraphicsQueue; }
         VkQueue PresentQueue() { return m_PresentQueue; }
+        VkQueue TransferQueue() { return m_TransferQueue; }
 
         SwapChainSupportDetails GetSwapChainSupport() { return QuerySwapChainSupport(m_PhysicalDevice); }
         uint FindMemoryType(uint typeFilter, VkMemoryPropertyFlags properties);
         QueueFamilyIndices& PhysicalQueueFamilies() { return m_QueueFamilyIndices; }
         uint GetGraphicsQueueFamily() { return m_QueueFamilyIndices.m_GraphicsFamily; }
+        uint GetTransferQueueFamily() { return m_QueueFamilyIndices.m_TransferFamily; }
+        bool HasDedicatedTransferQueue() const { return m_QueueFamilyIndices.m_TransferFamily != NO_ASSIGNED; }
         void SetMaxUsableSampleCount();
         VkFormat FindSupportedFormat(const std::vector<VkFormat>& candidates, VkImageTiling tiling,
                                      VkFormatFeatureFlags features);
@@ -92,7 +99,7 @@ namespace GfxRenderEngine
 
         // Buffer Helper Functions
         void CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer,
-                          VkDeviceMemory& bufferMemory);
+                          VK_Allocation& bufferMemory);
 
         VkCommandBuffer BeginSingleTimeCommands();
         void EndSingleTimeCommands(VkCommandBuffer commandBuffer);
@@ -100,13 +107,21 @@ namespace GfxRenderEngine
         void CopyBufferToImage(VkBuffer buffer, VkImage image, uint width, uint height, uint layerCount);
 
         void CreateImageWithInfo(const VkImageCreateInfo& imageInfo, VkMemoryPropertyFlags properties, VkImage& image,
-                                 VkDeviceMemory& imageMemory);
+                                 VK_Allocation& imageMemory);
+
+        // GPU memory is sub-allocated from large blocks, see VK_MemoryAllocator
+        VK_MemoryAllocator* GetMemoryAllocator() { return m_MemoryAllocator.get(); }
+        void FreeMemory(VK_Allocation& allocation) { m_MemoryAllocator->Free(allocation); }
+
+        // batched, asynchronous buffer and texture uploads, see VK_Uploader
+        VK_Uploader* GetUploader() { return m_Uploader.get(); }
 
         VkPhysicalDeviceProperties m_Properties;
         VkSampleCountFlagBits m_SampleCountFlagBits;
 
         VkInstance GetInstance() const { return m_Instance; }
         bool MultiThreadingSupport() const { return true; }
+        bool SupportsTextureCompressionBC() const { return m_TextureCompressionBC; }
         std::mutex m_DeviceAccessMutex;
         VK_Pool* GetLoadPool() { return m_LoadPool.get(); }
         void LoadPool(ThreadPool& threadPoolPrimary, ThreadPool& threadPoolSecondary);
@@ -116,6 +131,7 @@ namespace GfxRenderEngine
 
     private:
         static constexpr int NO_ASSIGNED = -1;
+        static constexpr const char* PIPELINE_CACHE_FILEPATH = "bin-int/pipeline.cache";
 
         struct QueueSpec
         {
@@ -137,6 +153,9 @@ namespace GfxRenderEngine
         VkDeviceQueueCreateInfo CreateQueue(const QueueSpec& spec);
         void CreateLogicalDevice();
         void CreateCommandPool();
+        void CreatePipelineCache();
+        void SavePipelineCache();
+        bool IsCompatiblePipelineCache(std::vector<char> const& data);
 
         // helper functions
         bool IsSuitableDevice(VkPhysicalDevice& device);
@@ -159,12 +178,16 @@ namespace GfxRenderEngine
         VkPhysicalDevice m_PhysicalDevice{nullptr};
         VK_Window* m_Window;
         VkCommandPool m_GraphicsCommandPool{nullptr};
+        VkPipelineCache m_PipelineCache{nullptr};
         std::unique_ptr<VK_Pool> m_LoadPool;
+        std::unique_ptr<VK_MemoryAllocator> m_MemoryAllocator;
+        std::unique_ptr<VK_Uploader> m_Uploader;
         VkDevice m_Device{nullptr};
         VkSurfaceKHR m_Surface{nullptr};
 
         VkQueue m_GraphicsQueue{nullptr};
         VkQueue m_PresentQueue{nullptr};
+        VkQueue m_TransferQueue{nullptr};
 
         const std::vector<const char*> m_ValidationLayers = {"VK_LAYER_KHRONOS_validation"};
 #ifdef MACOSX
@@ -180,5 +203,6 @@ namespace GfxRenderEngine
         bool m_DeviceSupportsBufferDeviceAddress{false};
         bool m_FormatSupportsStorageImage{false};
         bool m_BindlessSupport{false};
+        bool m_TextureCompressionBC{false};
     };
 } // namespace GfxRenderEngine
@@ -25,6 +25,7 @@
 #include <vulkan/vulkan.h>
 
 #include "renderer/camera.h"
+#include "renderer/frustumCuller.h"
 #include "scene/components.h"
 #include "pointlights.h"
 
@@ -73,6 +74,7 @@ namespace GfxRenderEngine
         Camera* m_Camera{nullptr};
         VkDescriptorSet m_GlobalDescriptorSet{nullptr};
         VkDescriptorSet m_DiffuseDescriptorSet{nullptr};
+        uint m_VisibilityPass{FrustumCuller::CAMERA};
     };
 
 } // namespace GfxRenderEngine
@@ -32,6 +32,10 @@ namespace GfxRenderEngine
     bool Input::IsKeyPressed(const KeyCode key)
     {
         auto* window = static_cast<GLFWwindow*>(Engine::m_Engine->GetBackendWindow());
+        if (!window) // headless
+        {
+            return false;
+        }
         auto state = glfwGetKey(window, static_cast<int32_t>(key));
         return state == GLFW_PRESS || state == GLFW_REPEAT;
     }
@@ -39,6 +43,10 @@ namespace GfxRenderEngine
     bool Input::IsMouseButtonPressed(const MouseCode button)
     {
         auto* window = static_cast<GLFWwindow*>(Engine::m_Engine->GetBackendWindow());
+        if (!window) // headless
+        {
+            return false;
+        }
         auto state = glfwGetMouseButton(window, static_cast<int32_t>(button));
         return state == GLFW_PRESS;
     }
@@ -46,6 +54,10 @@ namespace GfxRenderEngine
     glm::vec2 Input::GetMousePosition()
     {
         auto* window = static_cast<GLFWwindow*>(Engine::m_Engine->GetBackendWindow());
+        if (!window) // headless
+        {
+            return {0.0f, 0.0f};
+        }
         double xpos, ypos;
         glfwGetCursorPos(window, &xpos, &ypos);
 
@@ -25,46 +25,200 @@
    Initially based off VulkanBuffer by Sascha Willems -
    https://github.com/SaschaWillems/Vulkan/blob/master/base/VulkanBuffer.h */
 
+#include <algorithm>
+
 #include "VKinstanceBuffer.h"
 
 namespace GfxRenderEngine
 {
-    VK_InstanceBuffer::VK_InstanceBuffer(uint numInstances) : m_NumInstances(numInstances), m_Dirty{true}
+    static_assert(VK_SwapChain::MAX_FRAMES_IN_FLIGHT <= 8, "one dirty bit per slice must fit in a uchar");
+    static_assert(VK_SwapChain::MAX_FRAMES_IN_FLIGHT * FrustumCuller::NUMBER_OF_PASSES <= 32,
+                  "one in-flight bit per pass and frame must fit in a uint");
+
+    VK_InstanceBuffer::VK_InstanceBuffer(uint numInstances) : m_NumInstances(numInstances)
     {
-        m_Ubo = std::make_shared<VK_Buffer>(numInstances * sizeof(InstanceData),
+        // the slices of all frames in flight, followed by the packed ranges of the culled passes
+        m_Ubo = std::make_shared<VK_Buffer>((NUMBER_OF_SLICES + NUMBER_OF_PASSES) * numInstances * sizeof(InstanceData),
                                             Buffer::BufferUsage::STORAGE_BUFFER_VISIBLE_TO_CPU);
         m_Ubo->MapBuffer();
-        m_DataInstances.resize(numInstances);
+        m_ModelMatrices.resize(numInstances, glm::mat4(1.0f));
+        m_DirtyInstances.resize(numInstances, ALL_SLICES);
+        m_WorldBounds.resize(numInstances);
     }
 
     VK_InstanceBuffer::~VK_InstanceBuffer() {}
 
-    void VK_InstanceBuffer::SetInstanceData(uint index, glm::mat4 const& mat4Global, glm::mat4 const& normalMatrix)
+    void VK_InstanceBuffer::SetInstanceData(uint index, glm::mat4 const& mat4Global)
     {
         CORE_ASSERT(index < m_NumInstances, "out of bounds");
 
-        m_DataInstances[index].m_ModelMatrix = mat4Global;
-        m_DataInstances[index].m_NormalMatrix = normalMatrix;
+        m_ModelMatrices[index] = mat4Global;
+        m_DirtyInstances[index] = ALL_SLICES;
 
-        m_Dirty = true;
+        m_DirtySlices = ALL_SLICES;
+        m_BoundsDirty = true;
+        // packed ranges hold the old matrix, draw whole slices until the passes are repacked
+        m_StaleRanges = ALL_PASSES;
     }
 
-    void VK_InstanceBuffer::Update()
+    void VK_InstanceBuffer::UpdateWorldBounds(AABB const& localBounds)
     {
-        if (m_Dirty)
+        bool localBoundsChanged = (localBounds.m_Min != m_LocalBounds.m_Min) || (localBounds.m_Max != m_LocalBounds.m_Max);
+        if (!m_BoundsDirty && !localBoundsChanged)
+        {
+            return;
+        }
+
+        m_LocalBounds = localBounds;
+        for (uint index = 0; index < m_NumInstances; ++index)
         {
-            // update ubo
-            m_Ubo->WriteToBuffer(m_DataInstances.data());
-            m_Ubo->Flush();
-            m_Dirty = false;
+            m_WorldBounds[index] = m_LocalBounds.Transform(m_ModelMatrices[index]);
         }
+        m_BoundsDirty = false;
+    }
+
+    void VK_InstanceBuffer::SetVisibleInstances(uint pass, uint frameIndex, uchar const* visible)
+    {
+        CORE_ASSERT(pass < NUMBER_OF_PASSES, "pass out of range");
+        uint passBit = 1u << pass;
+
+        uint visibleCount = 0;
+        for (uint index = 0; index < m_NumInstances; ++index)
+        {
+            visibleCount += visible[index] ? 1 : 0;
+        }
+        if (visibleCount == m_NumInstances)
+        {
+            // nothing culled, the pass draws the whole slice
+            m_DrawPackedRanges &= ~passBit;
+            return;
+        }
+
+        std::vector<uchar> const& packedVisible = m_PackedVisible[pass];
+        bool stale = (m_StaleRanges & passBit) || packedVisible.empty();
+        if (!stale && std::equal(visible, visible + m_NumInstances, packedVisible.begin()))
+        {
+            // the range of the pass is up to date
+            m_DrawPackedRanges |= passBit;
+            return;
+        }
+
+        // the frame of this slice has retired, only the other frames in flight may still draw from the range
+        uint otherFrames = (static_cast<uint>(ALL_SLICES) << (pass * NUMBER_OF_SLICES)) & ~GetInFlightBit(frameIndex, pass);
+        if (!(m_RangesInFlight & otherFrames))
+        {
+            PackVisibleInstances(pass, visible, visibleCount);
+            m_DrawPackedRanges |= passBit;
+            return;
+        }
+
+        // the old range can't be overwritten yet, keep drawing it as long as no instance became visible
+        bool rangeHoldsVisible = !stale;
+        for (uint index = 0; rangeHoldsVisible && (index < m_NumInstances); ++index)
+        {
+            rangeHoldsVisible = !visible[index] || packedVisible[index];
+        }
+        if (rangeHoldsVisible)
+        {
+            m_DrawPackedRanges |= passBit;
+        }
+        else
+        {
+            m_DrawPackedRanges &= ~passBit;
+        }
+    }
+
+    void VK_InstanceBuffer::PackVisibleInstances(uint pass, uchar const* visible, uint visibleCount)
+    {
+        uint firstInstance = (NUMBER_OF_SLICES + pass) * m_NumInstances;
+        InstanceData* range = static_cast<InstanceData*>(m_Ubo->GetMappedMemory()) + firstInstance;
+        uint packedIndex = 0;
+        for (uint index = 0; index < m_NumInstances; ++index)
+        {
+            if (visible[index])
+            {
+                WriteInstanceData(range[packedIndex++], m_ModelMatrices[index]);
+            }
+        }
+        if (visibleCount)
+        {
+            m_Ubo->Flush(visibleCount * sizeof(InstanceData), firstInstance * sizeof(InstanceData));
+        }
+
+        m_PackedVisible[pass].assign(visible, visible + m_NumInstances);
+        m_VisibleCount[pass] = visibleCount;
+        m_StaleRanges.fetch_and(~(1u << pass));
+    }
+
+    VK_InstanceBuffer::InstanceRange VK_InstanceBuffer::GetInstanceRange(int frameIndex, uint pass)
+    {
+        uint passBit = 1u << pass;
+        uint inFlightBit = GetInFlightBit(frameIndex, pass);
+        if ((m_DrawPackedRanges & passBit) && !(m_StaleRanges & passBit))
+        {
+            m_RangesInFlight.fetch_or(inFlightBit);
+            return {(NUMBER_OF_SLICES + pass) * m_NumInstances, m_VisibleCount[pass]};
+        }
+        m_RangesInFlight.fetch_and(~inFlightBit);
+        return {GetFirstInstance(frameIndex, m_NumInstances), m_NumInstances};
+    }
+
+    void VK_InstanceBuffer::WriteInstanceData(InstanceData& instanceData, glm::mat4 const& modelMatrix)
+    {
+        for (int row = 0; row < 3; ++row)
+        {
+            instanceData.m_ModelMatrixRows[row] =
+                glm::vec4(modelMatrix[0][row], modelMatrix[1][row], modelMatrix[2][row], modelMatrix[3][row]);
+        }
+    }
+
+    void VK_InstanceBuffer::Update(int frameIndex)
+    {
+        uchar sliceBit = 1 << frameIndex;
+        if (!(m_DirtySlices.fetch_and(static_cast<uchar>(~sliceBit)) & sliceBit))
+        {
+            return;
+        }
+
+        InstanceData* slice = static_cast<InstanceData*>(m_Ubo->GetMappedMemory()) + frameIndex * m_NumInstances;
+        uint spanBegin = 0;
+        uint spanEnd = 0; // one past the last dirty instance of the current span, 0: no span
+        auto flushSpan = [&]()
+        {
+            if (spanEnd)
+            {
+                VkDeviceSize offset = (frameIndex * m_NumInstances + spanBegin) * sizeof(InstanceData);
+                m_Ubo->Flush((spanEnd - spanBegin) * sizeof(InstanceData), offset);
+            }
+        };
+
+        for (uint index = 0; index < m_NumInstances; ++index)
+        {
+            if (!(m_DirtyInstances[index] & sliceBit))
+            {
+                continue;
+            }
+            m_DirtyInstances[index] &= ~sliceBit;
+
+            WriteInstanceData(slice[index], m_ModelMatrices[index]);
+
+            if (spanEnd && (index - spanEnd) <= MAX_SPAN_GAP)
+            {
+                spanEnd = index + 1;
+            }
+            else
+            {
+                flushSpan();
+                spanBegin = index;
+                spanEnd = index + 1;
+            }
+        }
+        flushSpan();
     }
 
     std::shared_ptr<Buffer> VK_InstanceBuffer::GetBuffer() { return m_Ubo; }
 
     Buffer::BufferDeviceAddress VK_InstanceBuffer::GetBufferDeviceAddress() { return m_Ubo.get()->GetBufferDeviceAddress(); }
 
-    const glm::mat4& VK_InstanceBuffer::GetModelMatrix(uint index) { return m_DataInstances[index].m_ModelMatrix; }
-
-    const glm::mat4& VK_InstanceBuffer::GetNormalMatrix(uint index) { return m_DataInstances[index].m_NormalMatrix; }
+    const glm::mat4& VK_InstanceBuffer::GetModelMatrix(uint index) { return m_ModelMatrices[index]; }
 } // namespace GfxRenderEngine
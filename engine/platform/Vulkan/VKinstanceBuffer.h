@@ -25,18 +25,36 @@
 
 #pragma once
 
+#include <atomic>
 #include <vulkan/vulkan.h>
 
 #include "engine.h"
 #include "renderer/instanceBuffer.h"
+#include "renderer/frustumCuller.h"
 
 #include "VKbuffer.h"
+#include "VKswapChain.h"
 
 namespace GfxRenderEngine
 {
+    // The GPU buffer holds one slice per frame in flight, so that the CPU never writes to a slice
+    // the GPU might still read. Draw calls select the slice of the current frame through
+    // firstInstance (see GetFirstInstance()), and only instances that changed are copied into a slice.
+    // Behind the slices, each culled render pass has one range that is shared by all frames in flight. When the
+    // frustum culler rejects instances of a pass, the visible ones are packed into that range and the pass draws
+    // only them. A range is repacked only when the visibility of the pass or the instances changed, and only
+    // once no other frame in flight draws from it. Until then the pass keeps the old range if it still holds
+    // every visible instance, or draws the whole slice.
     class VK_InstanceBuffer : public InstanceBuffer
     {
 
+    public:
+        struct InstanceRange
+        {
+            uint m_FirstInstance;
+            uint m_InstanceCount;
+        };
+
     public:
         VK_InstanceBuffer(uint numInstances);
         virtual ~VK_InstanceBuffer();
@@ -44,23 +62,55 @@ namespace GfxRenderEngine
         VK_InstanceBuffer(const VK_InstanceBuffer&) = delete;
         VK_InstanceBuffer& operator=(const VK_InstanceBuffer&) = delete;
 
-        virtual void SetInstanceData(uint index, glm::mat4 const& mat4Global, glm::mat4 const& normalMatrix) override;
+        virtual void SetInstanceData(uint index, glm::mat4 const& mat4Global) override;
         virtual const glm::mat4& GetModelMatrix(uint index) override;
-        virtual const glm::mat4& GetNormalMatrix(uint index) override;
         virtual std::shared_ptr<Buffer> GetBuffer() override;
         virtual Buffer::BufferDeviceAddress GetBufferDeviceAddress() override;
-        void Update();
+        virtual uint GetInstanceCount() const override { return m_NumInstances; }
+        virtual void UpdateWorldBounds(AABB const& localBounds) override;
+        virtual AABB const& GetWorldBounds(uint index) const override { return m_WorldBounds[index]; }
+        virtual void SetVisibleInstances(uint pass, uint frameIndex, uchar const* visible) override;
+        // copy the instances that changed into the slice of frameIndex
+        void Update(int frameIndex);
+        // instances to draw in a render pass: the packed visible instances, or the whole slice
+        // if the pass wasn't culled since the instances last moved
+        InstanceRange GetInstanceRange(int frameIndex, uint pass);
+
+        static uint GetFirstInstance(int frameIndex, uint numInstances) { return frameIndex * numInstances; }
 
     private:
+        // compact GPU format: rows 0 to 2 of the model matrix, row 3 is always (0, 0, 0, 1)
         struct InstanceData
         {
-            glm::mat4 m_ModelMatrix;
-            glm::mat4 m_NormalMatrix;
+            glm::vec4 m_ModelMatrixRows[3];
         };
+        static void WriteInstanceData(InstanceData& instanceData, glm::mat4 const& modelMatrix);
+        void PackVisibleInstances(uint pass, uchar const* visible, uint visibleCount);
+        // one bit per pass and frame in flight, set while that frame draws from the packed range of the pass
+        static uint GetInFlightBit(uint frameIndex, uint pass) { return 1u << (pass * NUMBER_OF_SLICES + frameIndex); }
+        static constexpr uint NUMBER_OF_SLICES = VK_SwapChain::MAX_FRAMES_IN_FLIGHT;
+        static constexpr uchar ALL_SLICES = (1 << NUMBER_OF_SLICES) - 1;
+        static constexpr uint NUMBER_OF_PASSES = FrustumCuller::NUMBER_OF_PASSES;
+        static constexpr uint ALL_PASSES = (1u << NUMBER_OF_PASSES) - 1;
+        // dirty instances closer than this are copied and flushed as one span
+        static constexpr uint MAX_SPAN_GAP = 16;
 
         uint m_NumInstances;
-        bool m_Dirty;
-        std::vector<InstanceData> m_DataInstances;
+        // instances may be written concurrently by the transform hierarchy update
+        std::atomic<uchar> m_DirtySlices{ALL_SLICES};
+        std::atomic<bool> m_BoundsDirty{true};
+        // one bit per pass, set when an instance moved after the range of the pass was packed
+        std::atomic<uint> m_StaleRanges{ALL_PASSES};
+        // one bit per pass, set when the pass draws its packed range in the current frame
+        uint m_DrawPackedRanges{0};
+        std::atomic<uint> m_RangesInFlight{0};
+        AABB m_LocalBounds;
+        std::vector<AABB> m_WorldBounds;
+        std::vector<glm::mat4> m_ModelMatrices;
+        // visibility of each instance when the range of the pass was packed
+        std::vector<uchar> m_PackedVisible[NUMBER_OF_PASSES];
+        uint m_VisibleCount[NUMBER_OF_PASSES]{};
+        std::vector<uchar> m_DirtyInstances; // one bit per slice
         std::shared_ptr<VK_Buffer> m_Ubo;
     };
 } // namespace GfxRenderEngine
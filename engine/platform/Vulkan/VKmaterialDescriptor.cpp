@@ -197,6 +197,7 @@ namespace GfxRenderEngine
     {
         switch (materialType)
         {
+            case Material::MaterialType::MtDiffuse:
             case Material::MaterialType::MtSkyboxHDRI:
             {
                 VkDescriptorImageInfo textureInfo = static_cast<VK_Texture*>(texture.get())->GetDescriptorImageInfo();
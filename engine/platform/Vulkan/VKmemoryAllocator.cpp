@@ -0,0 +1,426 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <algorithm>
+#include <bit>
+
+#include "VKmemoryAllocator.h"
+#include "VKcore.h"
+
+namespace GfxRenderEngine
+{
+    VK_MemoryBlock::VK_MemoryBlock(VkDeviceMemory memory, void* mapped, uint memoryTypeIndex,
+                                   std::unique_ptr<BlockAllocator> blockAllocator)
+        : m_Memory{memory}, m_Mapped{mapped}, m_MemoryTypeIndex{memoryTypeIndex}, m_BlockAllocator{std::move(blockAllocator)}
+    {
+    }
+
+    VK_MemoryAllocator::VK_MemoryAllocator(VkDevice device, VkPhysicalDevice physicalDevice) : m_Device{device}
+    {
+        vkGetPhysicalDeviceMemoryProperties(physicalDevice, &m_MemoryProperties);
+
+        VkPhysicalDeviceProperties properties;
+        vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+        m_NonCoherentAtomSize = std::max<VkDeviceSize>(properties.limits.nonCoherentAtomSize, 1);
+
+        uint numberOfResourceTypes = static_cast<uint>(ResourceType::NumberOfResourceTypes);
+        m_Heaps.resize(m_MemoryProperties.memoryTypeCount * numberOfResourceTypes);
+        for (uint memoryTypeIndex = 0; memoryTypeIndex < m_MemoryProperties.memoryTypeCount; ++memoryTypeIndex)
+        {
+            VkMemoryType const& memoryType = m_MemoryProperties.memoryTypes[memoryTypeIndex];
+            VkDeviceSize heapSize = m_MemoryProperties.memoryHeaps[memoryType.heapIndex].size;
+
+            // host-visible memory mostly holds small, short-lived uniform and staging buffers: buddy
+            // device-local memory holds long-lived vertex/index buffers and textures: linear
+            bool hostVisible = IsHostVisible(memoryTypeIndex);
+            VkDeviceSize blockSize = hostVisible ? HOST_VISIBLE_BLOCK_SIZE : DEVICE_LOCAL_BLOCK_SIZE;
+            blockSize = std::max(MIN_BLOCK_SIZE, std::min(blockSize, std::bit_floor(heapSize / 8)));
+            for (uint resourceType = 0; resourceType < numberOfResourceTypes; ++resourceType)
+            {
+                Heap& heap = m_Heaps[memoryTypeIndex * numberOfResourceTypes + resourceType];
+                heap.m_Strategy = hostVisible ? BlockAllocator::Strategy::Buddy : BlockAllocator::Strategy::Linear;
+                heap.m_BlockSize = blockSize;
+            }
+        }
+    }
+
+    VK_MemoryAllocator::~VK_MemoryAllocator()
+    {
+        for (auto& heap : m_Heaps)
+        {
+            for (auto& block : heap.m_Blocks)
+            {
+                if (!block->GetBlockAllocator().IsEmpty())
+                {
+                    LOG_CORE_WARN("VK_MemoryAllocator: memory block of type {0} still has {1} live allocation(s)",
+                                  block->GetMemoryTypeIndex(), block->GetBlockAllocator().GetStats().m_AllocationCount);
+                }
+                FreeDeviceMemory(block->GetMemory(), block->GetMapped());
+            }
+            heap.m_Blocks.clear();
+        }
+    }
+
+    bool VK_MemoryAllocator::IsHostVisible(uint memoryTypeIndex) const
+    {
+        return m_MemoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+    }
+
+    uint VK_MemoryAllocator::FindMemoryType(uint typeFilter, VkMemoryPropertyFlags properties) const
+    {
+        for (uint i = 0; i < m_MemoryProperties.memoryTypeCount; ++i)
+        {
+            if ((typeFilter & (1 << i)) && (m_MemoryProperties.memoryTypes[i].propertyFlags & properties) == properties)
+            {
+                return i;
+            }
+        }
+
+        LOG_CORE_CRITICAL("VK_MemoryAllocator: failed to find suitable memory type!");
+        return 0;
+    }
+
+    VK_MemoryAllocator::Heap& VK_MemoryAllocator::GetHeap(uint memoryTypeIndex, ResourceType resourceType)
+    {
+        uint numberOfResourceTypes = static_cast<uint>(ResourceType::NumberOfResourceTypes);
+        return m_Heaps[memoryTypeIndex * numberOfResourceTypes + static_cast<uint>(resourceType)];
+    }
+
+    VkDeviceMemory VK_MemoryAllocator::AllocateDeviceMemory(VkDeviceSize size, uint memoryTypeIndex,
+                                                            ResourceType resourceType, void*& mapped)
+    {
+        VkMemoryAllocateFlagsInfo allocFlagsInfo{};
+        allocFlagsInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+        allocFlagsInfo.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT; // for buffer device address feature (BDA)
+
+        VkMemoryAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.allocationSize = size;
+        allocInfo.memoryTypeIndex = memoryTypeIndex;
+        allocInfo.pNext = (resourceType == ResourceType::Buffer) ? &allocFlagsInfo : nullptr;
+
+        VkDeviceMemory memory{VK_NULL_HANDLE};
+        auto result = vkAllocateMemory(m_Device, &allocInfo, nullptr, &memory);
+        if (result != VK_SUCCESS)
+        {
+            VK_Core::m_Device->PrintError(result);
+            LOG_CORE_CRITICAL("VK_MemoryAllocator: failed to allocate {0} bytes of device memory", size);
+            return VK_NULL_HANDLE;
+        }
+        ++m_DeviceMemoryObjectCount;
+
+        mapped = nullptr;
+        if (IsHostVisible(memoryTypeIndex))
+        {
+            result = vkMapMemory(m_Device, memory, 0, VK_WHOLE_SIZE, 0, &mapped);
+            if (result != VK_SUCCESS)
+            {
+                VK_Core::m_Device->PrintError(result);
+                LOG_CORE_CRITICAL("VK_MemoryAllocator: failed to map device memory");
+            }
+        }
+        return memory;
+    }
+
+    void VK_MemoryAllocator::FreeDeviceMemory(VkDeviceMemory memory, void* mapped)
+    {
+        if (mapped)
+        {
+            vkUnmapMemory(m_Device, memory);
+        }
+        vkFreeMemory(m_Device, memory, nullptr);
+        --m_DeviceMemoryObjectCount;
+    }
+
+    bool VK_MemoryAllocator::Allocate(VkMemoryRequirements const& memoryRequirements, VkMemoryPropertyFlags properties,
+                                      ResourceType resourceType, VK_Allocation& allocation)
+    {
+        std::lock_guard<std::mutex> guard(m_Mutex);
+
+        uint memoryTypeIndex = FindMemoryType(memoryRequirements.memoryTypeBits, properties);
+        Heap& heap = GetHeap(memoryTypeIndex, resourceType);
+
+        allocation = VK_Allocation{};
+        allocation.m_MemoryTypeIndex = memoryTypeIndex;
+        allocation.m_Size = memoryRequirements.size;
+
+        // large resources (render targets, big textures) get their own device memory object
+        if (memoryRequirements.size > heap.m_BlockSize / 2)
+        {
+            void* mapped{nullptr};
+            allocation.m_Memory = AllocateDeviceMemory(memoryRequirements.size, memoryTypeIndex, resourceType, mapped);
+            allocation.m_Mapped = mapped;
+            if (allocation.IsValid())
+            {
+                ++m_DedicatedAllocationCount;
+                m_DedicatedAllocationSize += memoryRequirements.size;
+            }
+            return allocation.IsValid();
+        }
+
+        auto subAllocate = [&](VK_MemoryBlock& block)
+        {
+            uint64 offset = block.GetBlockAllocator().Allocate(memoryRequirements.size, memoryRequirements.alignment);
+            if (offset == BlockAllocator::INVALID_OFFSET)
+            {
+                return false;
+            }
+            allocation.m_Memory = block.GetMemory();
+            allocation.m_Offset = offset;
+            allocation.m_Mapped = block.GetMapped() ? static_cast<char*>(block.GetMapped()) + offset : nullptr;
+            allocation.m_Block = &block;
+            return true;
+        };
+
+        for (auto& block : heap.m_Blocks)
+        {
+            if (!m_RelocatingBlocks.contains(block.get()) && subAllocate(*block))
+            {
+                return true;
+            }
+        }
+
+        // no room in existing blocks, open a new one
+        void* mapped{nullptr};
+        VkDeviceMemory memory = AllocateDeviceMemory(heap.m_BlockSize, memoryTypeIndex, resourceType, mapped);
+        if (memory == VK_NULL_HANDLE)
+        {
+            return false;
+        }
+        heap.m_Blocks.push_back(std::make_unique<VK_MemoryBlock>(
+            memory, mapped, memoryTypeIndex, BlockAllocator::Create(heap.m_Strategy, heap.m_BlockSize)));
+        return subAllocate(*heap.m_Blocks.back());
+    }
+
+    void VK_MemoryAllocator::Free(VK_Allocation& allocation)
+    {
+        if (!allocation.IsValid())
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> guard(m_Mutex);
+        if (allocation.m_Block)
+        {
+            auto callbacks = m_RelocationCallbacks.find(allocation.m_Block);
+            if (callbacks != m_RelocationCallbacks.end())
+            {
+                callbacks->second.erase(allocation.m_Offset);
+                if (callbacks->second.empty())
+                {
+                    m_RelocationCallbacks.erase(callbacks);
+                }
+            }
+            allocation.m_Block->GetBlockAllocator().Free(allocation.m_Offset);
+            if (allocation.m_Block->GetBlockAllocator().IsEmpty())
+            {
+                ReleaseEmptyBlock(allocation.m_Block);
+            }
+        }
+        else
+        {
+            void* mapped = allocation.m_Mapped;
+            FreeDeviceMemory(allocation.m_Memory, mapped);
+            --m_DedicatedAllocationCount;
+            m_DedicatedAllocationSize -= allocation.m_Size;
+        }
+        allocation = VK_Allocation{};
+    }
+
+    void VK_MemoryAllocator::ReleaseEmptyBlock(VK_MemoryBlock* block)
+    {
+        // buffers and images of a memory type live in different heaps
+        for (uint resourceType = 0; resourceType < static_cast<uint>(ResourceType::NumberOfResourceTypes); ++resourceType)
+        {
+            auto& blocks = GetHeap(block->GetMemoryTypeIndex(), static_cast<ResourceType>(resourceType)).m_Blocks;
+            auto iterator = std::find_if(blocks.begin(), blocks.end(), [block](auto const& element)
+                                         { return element.get() == block; });
+            if (iterator == blocks.end())
+            {
+                continue;
+            }
+
+            // keep one empty block as a spare, so that a heap that drains and refills
+            // (e.g. a scene change) does not allocate device memory again right away
+            bool hasSpare = std::any_of(blocks.begin(), blocks.end(), [block](auto const& element)
+                                        { return (element.get() != block) && element->GetBlockAllocator().IsEmpty(); });
+            if (hasSpare)
+            {
+                m_RelocationCallbacks.erase(block);
+                m_RelocatingBlocks.erase(block);
+                ++m_ReleasedBlockCount;
+                m_ReleasedBlockSize += block->GetBlockAllocator().GetSize();
+                FreeDeviceMemory(block->GetMemory(), block->GetMapped());
+                blocks.erase(iterator);
+            }
+            return;
+        }
+    }
+
+    void VK_MemoryAllocator::SetRelocationCallback(VK_Allocation const& allocation, RelocationCallback&& callback)
+    {
+        if (!allocation.m_Block)
+        {
+            return;
+        }
+        std::lock_guard<std::mutex> guard(m_Mutex);
+        m_RelocationCallbacks[allocation.m_Block][allocation.m_Offset] = std::move(callback);
+    }
+
+    uint VK_MemoryAllocator::Relocate(float maxUsage)
+    {
+        ZoneScopedN("VK_MemoryAllocator::Relocate");
+        std::vector<VK_MemoryBlock*> blocks;
+        std::vector<RelocationCallback> callbacks;
+        {
+            std::lock_guard<std::mutex> guard(m_Mutex);
+            for (auto& heap : m_Heaps)
+            {
+                // the allocations need somewhere else to go
+                if (heap.m_Blocks.size() < 2)
+                {
+                    continue;
+                }
+                for (auto& block : heap.m_Blocks)
+                {
+                    BlockAllocator& blockAllocator = block->GetBlockAllocator();
+                    BlockAllocator::Stats stats = blockAllocator.GetStats();
+                    if (!stats.m_AllocationCount || (stats.m_Used >= maxUsage * stats.m_Size))
+                    {
+                        continue;
+                    }
+                    auto blockCallbacks = m_RelocationCallbacks.find(block.get());
+                    if ((blockCallbacks == m_RelocationCallbacks.end()) ||
+                        (blockCallbacks->second.size() != stats.m_AllocationCount))
+                    {
+                        continue; // the block would not become empty
+                    }
+                    blocks.push_back(block.get());
+                    m_RelocatingBlocks.insert(block.get());
+                    for (auto const& [offset, callback] : blockCallbacks->second)
+                    {
+                        callbacks.push_back(callback);
+                    }
+                }
+            }
+        }
+
+        // the owners allocate and free, which takes the lock
+        for (auto& callback : callbacks)
+        {
+            callback();
+        }
+
+        std::lock_guard<std::mutex> guard(m_Mutex);
+        for (auto block : blocks)
+        {
+            m_RelocatingBlocks.erase(block);
+        }
+        m_RelocationCount += static_cast<uint>(callbacks.size());
+        if (callbacks.size())
+        {
+            LOG_CORE_INFO("VK_MemoryAllocator::Relocate: {0} allocation(s) relocated out of {1} block(s)",
+                          callbacks.size(), blocks.size());
+        }
+        return static_cast<uint>(callbacks.size());
+    }
+
+    VkMappedMemoryRange VK_MemoryAllocator::GetMappedMemoryRange(VK_Allocation const& allocation, VkDeviceSize size,
+                                                                 VkDeviceSize offset) const
+    {
+        if (size == VK_WHOLE_SIZE)
+        {
+            size = allocation.m_Size - offset;
+        }
+
+        // flush/invalidate ranges must be multiples of nonCoherentAtomSize within the memory object
+        VkDeviceSize begin = allocation.m_Offset + offset;
+        VkDeviceSize end = begin + size;
+        begin = (begin / m_NonCoherentAtomSize) * m_NonCoherentAtomSize;
+        end = ((end + m_NonCoherentAtomSize - 1) / m_NonCoherentAtomSize) * m_NonCoherentAtomSize;
+
+        VkMappedMemoryRange mappedRange{};
+        mappedRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        mappedRange.memory = allocation.m_Memory;
+        mappedRange.offset = begin;
+        VkDeviceSize memorySize = allocation.m_Block ? allocation.m_Block->GetBlockAllocator().GetSize() : allocation.m_Size;
+        mappedRange.size = (end >= memorySize) ? VK_WHOLE_SIZE : end - begin;
+        return mappedRange;
+    }
+
+    void VK_MemoryAllocator::SetStrategy(uint memoryTypeIndex, BlockAllocator::Strategy strategy)
+    {
+        std::lock_guard<std::mutex> guard(m_Mutex);
+        for (uint resourceType = 0; resourceType < static_cast<uint>(ResourceType::NumberOfResourceTypes); ++resourceType)
+        {
+            Heap& heap = GetHeap(memoryTypeIndex, static_cast<ResourceType>(resourceType));
+            if (heap.m_Blocks.size())
+            {
+                LOG_CORE_WARN("VK_MemoryAllocator::SetStrategy: memory type {0} already in use, new strategy only "
+                              "applies to new blocks",
+                              memoryTypeIndex);
+            }
+            heap.m_Strategy = strategy;
+        }
+    }
+
+    void VK_MemoryAllocator::PrintStats()
+    {
+        std::lock_guard<std::mutex> guard(m_Mutex);
+        LOG_CORE_INFO("VK_MemoryAllocator: {0} device memory object(s), {1} dedicated allocation(s) ({2} KB), "
+                      "{3} empty block(s) released ({4} KB), {5} allocation(s) relocated",
+                      m_DeviceMemoryObjectCount, m_DedicatedAllocationCount, m_DedicatedAllocationSize / 1024,
+                      m_ReleasedBlockCount, m_ReleasedBlockSize / 1024, m_RelocationCount);
+
+        uint numberOfResourceTypes = static_cast<uint>(ResourceType::NumberOfResourceTypes);
+        for (uint heapIndex = 0; heapIndex < m_Heaps.size(); ++heapIndex)
+        {
+            Heap const& heap = m_Heaps[heapIndex];
+            if (heap.m_Blocks.empty())
+            {
+                continue;
+            }
+            uint memoryTypeIndex = heapIndex / numberOfResourceTypes;
+            bool isBuffer = (heapIndex % numberOfResourceTypes) == static_cast<uint>(ResourceType::Buffer);
+
+            BlockAllocator::Stats total{};
+            float maxFragmentation = 0.0f;
+            uint emptyBlocks = 0;
+            for (auto const& block : heap.m_Blocks)
+            {
+                BlockAllocator::Stats stats = block->GetBlockAllocator().GetStats();
+                emptyBlocks += (stats.m_AllocationCount == 0) ? 1 : 0;
+                total.m_Size += stats.m_Size;
+                total.m_Used += stats.m_Used;
+                total.m_AllocationCount += stats.m_AllocationCount;
+                total.m_FreeRangeCount += stats.m_FreeRangeCount;
+                maxFragmentation = std::max(maxFragmentation, block->GetBlockAllocator().GetFragmentation());
+            }
+            LOG_CORE_INFO("    memory type {0} ({1}, {2}): {3} block(s) ({4} spare), {5} allocation(s), "
+                          "{6}/{7} KB used, {8} free range(s), max fragmentation {9:.2f}",
+                          memoryTypeIndex, isBuffer ? "buffers" : "images",
+                          heap.m_Strategy == BlockAllocator::Strategy::Buddy ? "buddy" : "linear", heap.m_Blocks.size(),
+                          emptyBlocks, total.m_AllocationCount, total.m_Used / 1024, total.m_Size / 1024,
+                          total.m_FreeRangeCount, maxFragmentation);
+        }
+    }
+} // namespace GfxRenderEngine
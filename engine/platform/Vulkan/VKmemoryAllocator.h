@@ -0,0 +1,159 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vulkan/vulkan.h>
+
+#include "engine.h"
+#include "auxiliary/blockAllocator.h"
+
+namespace GfxRenderEngine
+{
+    class VK_MemoryBlock;
+
+    struct VK_Allocation
+    {
+        VkDeviceMemory m_Memory{VK_NULL_HANDLE};
+        VkDeviceSize m_Offset{0};
+        VkDeviceSize m_Size{0};
+        void* m_Mapped{nullptr}; // host-visible memory is persistently mapped, points to m_Offset
+        uint m_MemoryTypeIndex{0};
+        VK_MemoryBlock* m_Block{nullptr}; // nullptr for dedicated allocations
+
+        bool IsValid() const { return m_Memory != VK_NULL_HANDLE; }
+    };
+
+    // one vkAllocateMemory of a heap, sub-allocated by a BlockAllocator
+    class VK_MemoryBlock
+    {
+
+    public:
+        VK_MemoryBlock(VkDeviceMemory memory, void* mapped, uint memoryTypeIndex,
+                       std::unique_ptr<BlockAllocator> blockAllocator);
+
+        VkDeviceMemory GetMemory() const { return m_Memory; }
+        void* GetMapped() const { return m_Mapped; }
+        uint GetMemoryTypeIndex() const { return m_MemoryTypeIndex; }
+        BlockAllocator& GetBlockAllocator() { return *m_BlockAllocator; }
+
+    private:
+        VkDeviceMemory m_Memory;
+        void* m_Mapped;
+        uint m_MemoryTypeIndex;
+        std::unique_ptr<BlockAllocator> m_BlockAllocator;
+    };
+
+    class VK_MemoryAllocator
+    {
+
+    public:
+        enum class ResourceType
+        {
+            Buffer = 0,
+            Image,
+            NumberOfResourceTypes
+        };
+
+        static constexpr VkDeviceSize DEVICE_LOCAL_BLOCK_SIZE = 256 * 1024 * 1024;
+        static constexpr VkDeviceSize HOST_VISIBLE_BLOCK_SIZE = 64 * 1024 * 1024;
+        static constexpr VkDeviceSize MIN_BLOCK_SIZE = 1024 * 1024;
+        // blocks below this usage are emptied by Relocate()
+        static constexpr float RELOCATION_MAX_USAGE = 0.25f;
+
+        // asks the owner of an allocation to move its resource: create a new resource (new allocation,
+        // copy of the contents, views, descriptors, device addresses) and free the old allocation.
+        // Bound Vulkan resources cannot be moved in place, so relocation always means recreation
+        using RelocationCallback = std::function<void()>;
+
+    public:
+        VK_MemoryAllocator(VkDevice device, VkPhysicalDevice physicalDevice);
+        ~VK_MemoryAllocator();
+
+        VK_MemoryAllocator(const VK_MemoryAllocator&) = delete;
+        VK_MemoryAllocator& operator=(const VK_MemoryAllocator&) = delete;
+
+        bool Allocate(VkMemoryRequirements const& memoryRequirements, VkMemoryPropertyFlags properties,
+                      ResourceType resourceType, VK_Allocation& allocation);
+        void Free(VK_Allocation& allocation);
+
+        // sub-allocation-aware ranges for vkFlushMappedMemoryRanges/vkInvalidateMappedMemoryRanges
+        VkMappedMemoryRange GetMappedMemoryRange(VK_Allocation const& allocation, VkDeviceSize size,
+                                                 VkDeviceSize offset) const;
+
+        void SetStrategy(uint memoryTypeIndex, BlockAllocator::Strategy strategy);
+        void PrintStats();
+
+        // relocation hook: owners that can recreate their resource register a callback for its allocation,
+        // the callback is removed when the allocation is freed; dedicated allocations are never relocated
+        void SetRelocationCallback(VK_Allocation const& allocation, RelocationCallback&& callback);
+        // empties sparsely used blocks so that they can be released: calls the relocation callbacks of all
+        // allocations in blocks below maxUsage, provided every allocation of the block has one.
+        // The callbacks run on the calling thread without the allocator lock, new allocations don't go to
+        // the blocks being emptied. Returns the number of callbacks called
+        uint Relocate(float maxUsage = RELOCATION_MAX_USAGE);
+
+    private:
+        struct Heap
+        {
+            BlockAllocator::Strategy m_Strategy{BlockAllocator::Strategy::Linear};
+            VkDeviceSize m_BlockSize{0};
+            std::vector<std::unique_ptr<VK_MemoryBlock>> m_Blocks;
+        };
+
+        uint FindMemoryType(uint typeFilter, VkMemoryPropertyFlags properties) const;
+        Heap& GetHeap(uint memoryTypeIndex, ResourceType resourceType);
+        // frees an empty block unless it is the only empty block of its heap
+        void ReleaseEmptyBlock(VK_MemoryBlock* block);
+        VkDeviceMemory AllocateDeviceMemory(VkDeviceSize size, uint memoryTypeIndex, ResourceType resourceType,
+                                            void*& mapped);
+        void FreeDeviceMemory(VkDeviceMemory memory, void* mapped);
+        bool IsHostVisible(uint memoryTypeIndex) const;
+
+    private:
+        VkDevice m_Device;
+        VkPhysicalDeviceMemoryProperties m_MemoryProperties{};
+        VkDeviceSize m_NonCoherentAtomSize{1};
+        std::mutex m_Mutex;
+
+        // indexed by memoryTypeIndex * NumberOfResourceTypes + resourceType;
+        // buffers and images never share a block to avoid bufferImageGranularity conflicts
+        std::vector<Heap> m_Heaps;
+        uint m_DedicatedAllocationCount{0};
+        VkDeviceSize m_DedicatedAllocationSize{0};
+        uint m_DeviceMemoryObjectCount{0};
+        uint m_ReleasedBlockCount{0};
+        VkDeviceSize m_ReleasedBlockSize{0};
+
+        // per block: allocation offset -> relocation callback
+        std::unordered_map<VK_MemoryBlock*, std::map<VkDeviceSize, RelocationCallback>> m_RelocationCallbacks;
+        std::unordered_set<VK_MemoryBlock*> m_RelocatingBlocks; // skipped by Allocate()
+        uint m_RelocationCount{0};
+    };
+} // namespace GfxRenderEngine
@@ -25,6 +25,7 @@
 #include "VKdescriptor.h"
 #include "VKmaterialDescriptor.h"
 #include "VKrenderer.h"
+#include "VKinstanceBuffer.h"
 
 #include "systems/pushConstantData.h"
 #include "renderer/shader.h"
@@ -58,29 +59,56 @@ namespace GfxRenderEngine
         return attributeDescriptions;
     }
 
+    // position stream
+    std::vector<VkVertexInputBindingDescription> VK_Model::VK_PositionStream::GetBindingDescriptions(bool skinned)
+    {
+        std::vector<VkVertexInputBindingDescription> bindingDescriptions(1);
+
+        bindingDescriptions[0].binding = 0;
+        bindingDescriptions[0].stride = VertexStreams::GetPositionStride(skinned ? GLSL_VERTEX_FORMAT_SKINNED : 0);
+        bindingDescriptions[0].inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+
+        return bindingDescriptions;
+    }
+
+    std::vector<VkVertexInputAttributeDescription> VK_Model::VK_PositionStream::GetAttributeDescriptions(bool skinned)
+    {
+        std::vector<VkVertexInputAttributeDescription> attributeDescriptions{};
+
+        // same locations as VK_Vertex
+        constexpr uint jointIdsOffset = VertexStreams::POSITION_STREAM_WORDS * sizeof(uint);
+        constexpr uint weightsOffset = jointIdsOffset + sizeof(uint);
+        attributeDescriptions.push_back({0, 0, VK_FORMAT_R32G32B32_SFLOAT, 0});
+        if (skinned)
+        {
+            attributeDescriptions.push_back({5, 0, VK_FORMAT_R8G8B8A8_UINT, jointIdsOffset});
+            attributeDescriptions.push_back({6, 0, VK_FORMAT_R16G16B16A16_UNORM, weightsOffset});
+        }
+
+        return attributeDescriptions;
+    }
+
 #define INIT_MODEL()                                   \
     CopySubmeshes(builder.m_Submeshes);                \
     CreateVertexBuffer(std::move(builder.m_Vertices)); \
     CreateIndexBuffer(std::move(builder.m_Indices));
 
-#define INIT_GLTF_AND_FBX_MODEL()                      \
-    CopySubmeshes(builder.m_Submeshes);                \
-    CreateVertexBuffer(std::move(builder.m_Vertices)); \
-    CreateIndexBuffer(std::move(builder.m_Indices));   \
-    m_Skeleton = std::move(builder.m_Skeleton);        \
-    m_Animations = std::move(builder.m_Animations);    \
-    m_ShaderDataUbo = builder.m_ShaderData;
+#define INIT_GLTF_AND_FBX_MODEL()                    \
+    CopySubmeshes(builder.m_Submeshes);              \
+    m_Skeleton = std::move(builder.m_Skeleton);      \
+    CreateVertexStreams(builder.m_Vertices);         \
+    CreateIndexBuffer(std::move(builder.m_Indices)); \
+    m_Animations = std::move(builder.m_Animations);
 
     VK_Model::VK_Model(const Model::ModelData& modelData)
     {
         ZoneScopedNC("VK_Model(FastgltfBuilder)", 0x00ffff);
 
         CopySubmeshes(modelData.m_Submeshes);
-        CreateVertexBuffer(std::move(modelData.m_Vertices));
-        CreateIndexBuffer(std::move(modelData.m_Indices));
         m_Skeleton = std::move(modelData.m_Skeleton);
+        CreateVertexStreams(modelData.m_Vertices);
+        CreateIndexBuffer(std::move(modelData.m_Indices));
         m_Animations = std::move(modelData.m_Animations);
-        m_ShaderDataUbo = std::move(modelData.m_ShaderData);
     }
     VK_Model::VK_Model(VK_Device* device, const UFbxBuilder& builder) { INIT_GLTF_AND_FBX_MODEL(); }
     VK_Model::VK_Model(VK_Device* device, const GltfBuilder& builder) { INIT_GLTF_AND_FBX_MODEL(); }
@@ -90,7 +118,12 @@ namespace GfxRenderEngine
         INIT_MODEL();
         m_Cubemaps = std::move(builder.m_Cubemaps); // used to manage lifetime
     }
-    VK_Model::VK_Model(VK_Device* device, const TerrainBuilder& builder) { INIT_MODEL(); }
+    VK_Model::VK_Model(VK_Device* device, const TerrainBuilder& builder)
+    {
+        CopySubmeshes(builder.m_Submeshes);
+        CreateVertexStreams(builder.m_Vertices);
+        CreateIndexBuffer(std::move(builder.m_Indices));
+    }
     VK_Model::VK_Model(VK_Device* device, const IBLBuilder& builder)
     {
         CopySubmeshes(builder.m_Submeshes);
@@ -100,9 +133,7 @@ namespace GfxRenderEngine
     VK_Model::~VK_Model() {}
 
     VK_Submesh::VK_Submesh(Submesh const& submesh)
-        : Submesh{submesh.m_FirstIndex,    submesh.m_FirstVertex, submesh.m_IndexCount, submesh.m_VertexCount,
-                  submesh.m_InstanceCount, submesh.m_Material,    submesh.m_Resources},
-          m_MaterialDescriptor(submesh.m_Material->GetMaterialDescriptor()),
+        : Submesh{submesh}, m_MaterialDescriptor(submesh.m_Material->GetMaterialDescriptor()),
           m_ResourceDescriptor(submesh.m_Resources.m_ResourceDescriptor)
     {
     }
@@ -111,6 +142,7 @@ namespace GfxRenderEngine
     {
         for (auto& submesh : submeshes)
         {
+            m_LocalBounds.Extend(submesh.m_LocalBounds);
             VK_Submesh vkSubmesh(submesh);
 
             Material::MaterialType materialType = vkSubmesh.m_Material->GetType();
@@ -148,6 +180,31 @@ namespace GfxRenderEngine
 
     void VK_Model::CreateVertexBuffer(const std::vector<Vertex>& vertices) { CreateVertexBuffer<Vertex>(vertices); }
 
+    // PBR meshes: compact attribute stream (m_VertexBuffer) plus position stream (m_PositionBuffer), see VertexStreams
+    void VK_Model::CreateVertexStreams(std::vector<Vertex> const& vertices)
+    {
+        m_VertexCount = static_cast<uint>(vertices.size());
+        CORE_ASSERT(m_VertexCount >= 3, "CreateVertexStreams: at least one triangle required");
+
+        bool skinned = m_Skeleton != nullptr;
+        VertexStreams vertexStreams(vertices, skinned);
+        m_VertexFormat = vertexStreams.GetVertexFormat();
+
+        CreateStreamBuffer(m_PositionBuffer, vertexStreams.GetPositionStream(), vertexStreams.GetPositionStride());
+        CreateStreamBuffer(m_VertexBuffer, vertexStreams.GetAttributeStream(), vertexStreams.GetAttributeStride());
+    }
+
+    void VK_Model::CreateStreamBuffer(std::unique_ptr<VK_Buffer>& buffer, std::vector<uint> const& stream, uint stride)
+    {
+        buffer = std::make_unique<VK_Buffer>(stride, m_VertexCount,
+                                             VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+                                                 VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+                                             VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+        // asynchronous, the GPU copy is ordered before the first frame that draws this model
+        VK_Core::m_Device->GetUploader()->UploadBuffer(buffer->GetBuffer(), stream.data(), stream.size() * sizeof(uint));
+    }
+
     void VK_Model::CreateIndexBuffer(const std::vector<uint>& indices)
     {
         m_IndexCount = static_cast<uint>(indices.size());
@@ -159,21 +216,17 @@ namespace GfxRenderEngine
         VkDeviceSize bufferSize = sizeof(uint) * m_IndexCount;
         uint indexSize = sizeof(indices[0]);
 
-        VK_Buffer stagingBuffer{indexSize, m_IndexCount, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT};
-        stagingBuffer.Map();
-        stagingBuffer.WriteToBuffer((void*)indices.data());
-
         m_IndexBuffer = std::make_unique<VK_Buffer>(indexSize, m_IndexCount,
                                                     VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
                                                         VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
                                                     VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-        VK_Core::m_Device->CopyBuffer(stagingBuffer.GetBuffer(), m_IndexBuffer->GetBuffer(), bufferSize);
+        VK_Core::m_Device->GetUploader()->UploadBuffer(m_IndexBuffer->GetBuffer(), indices.data(), bufferSize);
     }
 
     void VK_Model::Bind(VkCommandBuffer commandBuffer)
     {
-        VkBuffer buffers[] = {m_VertexBuffer->GetBuffer()};
+        // PBR meshes bind the position stream (only the shadow passes use vertex input)
+        VkBuffer buffers[] = {m_PositionBuffer ? m_PositionBuffer->GetBuffer() : m_VertexBuffer->GetBuffer()};
         VkDeviceSize offsets[] = {0};
         vkCmdBindVertexBuffers(commandBuffer, 0, 1, buffers, offsets);
 
@@ -183,17 +236,6 @@ namespace GfxRenderEngine
         }
     }
 
-    void VK_Model::UpdateAnimation(const Timestep& timestep, uint frameCounter)
-    {
-
-        m_Animations->Update(timestep, *m_Skeleton, frameCounter);
-        m_Skeleton->Update();
-
-        // update ubo
-        static_cast<VK_Buffer*>(m_ShaderDataUbo.get())->WriteToBuffer(m_Skeleton->m_ShaderData.m_FinalJointsMatrices.data());
-        static_cast<VK_Buffer*>(m_ShaderDataUbo.get())->Flush();
-    }
-
     void VK_Model::BindDescriptors(const VK_FrameInfo& frameInfo, const VkPipelineLayout& pipelineLayout,
                                    VK_Submesh const& submesh)
     {
@@ -228,13 +270,13 @@ namespace GfxRenderEngine
         );
     }
 
-    void VK_Model::Draw(VkCommandBuffer commandBuffer)
+    void VK_Model::Draw(VkCommandBuffer commandBuffer, uint instanceCount)
     {
         if (m_IndexBuffer)
         {
             vkCmdDrawIndexed(commandBuffer, // VkCommandBuffer commandBuffer
                              m_IndexCount,  // uint32_t        indexCount
-                             1,             // uint32_t        instanceCount
+                             instanceCount, // uint32_t        instanceCount
                              0,             // uint32_t        firstIndex
                              0,             // int32_t         vertexOffset
                              0              // uint32_t        firstInstance
@@ -244,32 +286,33 @@ namespace GfxRenderEngine
         {
             vkCmdDraw(commandBuffer, // VkCommandBuffer commandBuffer
                       m_VertexCount, // uint32_t        vertexCount
-                      1,             // uint32_t        instanceCount
+                      instanceCount, // uint32_t        instanceCount
                       0,             // uint32_t        firstVertex
                       0              // uint32_t        firstInstance
             );
         }
     }
 
-    void VK_Model::DrawSubmesh(VkCommandBuffer commandBuffer, Submesh const& submesh)
+    void VK_Model::DrawSubmesh(VkCommandBuffer commandBuffer, Submesh const& submesh,
+                               VK_InstanceBuffer::InstanceRange const& instanceRange)
     {
         if (m_IndexBuffer)
         {
-            vkCmdDrawIndexed(commandBuffer,           // VkCommandBuffer commandBuffer
-                             submesh.m_IndexCount,    // uint32_t        indexCount
-                             submesh.m_InstanceCount, // uint32_t        instanceCount
-                             submesh.m_FirstIndex,    // uint32_t        firstIndex
-                             submesh.m_FirstVertex,   // int32_t         vertexOffset
-                             0                        // uint32_t        firstInstance
+            vkCmdDrawIndexed(commandBuffer,                 // VkCommandBuffer commandBuffer
+                             submesh.m_IndexCount,          // uint32_t        indexCount
+                             instanceRange.m_InstanceCount, // uint32_t        instanceCount
+                             submesh.m_FirstIndex,          // uint32_t        firstIndex
+                             submesh.m_FirstVertex,         // int32_t         vertexOffset
+                             instanceRange.m_FirstInstance  // uint32_t        firstInstance
             );
         }
         else
         {
-            vkCmdDraw(commandBuffer,           // VkCommandBuffer commandBuffer
-                      submesh.m_VertexCount,   // uint32_t        vertexCount
-                      submesh.m_InstanceCount, // uint32_t        instanceCount
-                      submesh.m_FirstVertex,   // uint32_t        firstVertex
-                      0                        // uint32_t        firstInstance
+            vkCmdDraw(commandBuffer,                 // VkCommandBuffer commandBuffer
+                      submesh.m_VertexCount,         // uint32_t        vertexCount
+                      instanceRange.m_InstanceCount, // uint32_t        instanceCount
+                      submesh.m_FirstVertex,         // uint32_t        firstVertex
+                      instanceRange.m_FirstInstance  // uint32_t        firstInstance
             );
         }
     }
@@ -313,6 +356,9 @@ namespace GfxRenderEngine
     {
         drawCallInfoGrass.m_SubmeshInfo = {submesh.m_FirstIndex, submesh.m_FirstVertex};
         drawCallInfoGrass.m_MaterialBufferDeviceAddress = submesh.GetMaterialBufferDeviceAddress();
+        // the blades are the instances of the draw call, the base model is read from the slice of this frame
+        drawCallInfoGrass.m_InstanceBase =
+            VK_InstanceBuffer::GetFirstInstance(frameInfo.m_FrameIndex, submesh.m_InstanceCount);
 
         constexpr VkShaderStageFlags stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
         vkCmdPushConstants(frameInfo.m_CommandBuffer, // VkCommandBuffer     commandBuffer,
@@ -324,32 +370,36 @@ namespace GfxRenderEngine
     }
 
     // regular Pbr
-    void VK_Model::DrawPbr(const VK_FrameInfo& frameInfo, const VkPipelineLayout& pipelineLayout, DrawCallInfo& drawCallInfo)
+    void VK_Model::DrawPbr(const VK_FrameInfo& frameInfo, const VkPipelineLayout& pipelineLayout, DrawCallInfo& drawCallInfo,
+                           VK_InstanceBuffer::InstanceRange const& instanceRange)
     {
         for (auto& submesh : m_SubmeshesPbr)
         {
             PushConstantsPbr(frameInfo, pipelineLayout, submesh, drawCallInfo);
-            vkCmdDraw(frameInfo.m_CommandBuffer, // VkCommandBuffer commandBuffer
-                      submesh.m_IndexCount,      // uint32_t        vertexCount (index count is used(!))
-                      submesh.m_InstanceCount,   // uint32_t        instanceCount
-                      0,                         // uint32_t        firstVertex
-                      0                          // uint32_t        firstInstance
+            // firstInstance selects the instance buffer slice or packed range of this frame
+            vkCmdDraw(frameInfo.m_CommandBuffer,     // VkCommandBuffer commandBuffer
+                      submesh.m_IndexCount,          // uint32_t        vertexCount (index count is used(!))
+                      instanceRange.m_InstanceCount, // uint32_t        instanceCount
+                      0,                             // uint32_t        firstVertex
+                      instanceRange.m_FirstInstance  // uint32_t        firstInstance
             );
         }
     }
 
     // Pbr with multi material
     void VK_Model::DrawPbr(const VK_FrameInfo& frameInfo, const VkPipelineLayout& pipelineLayout,
-                           DrawCallInfoMultiMaterial& drawCallInfoMultiMaterial)
+                           DrawCallInfoMultiMaterial& drawCallInfoMultiMaterial,
+                           VK_InstanceBuffer::InstanceRange const& instanceRange)
     {
         for (auto& submesh : m_SubmeshesPbrMulti)
         {
             PushConstantsPbr(frameInfo, pipelineLayout, submesh, drawCallInfoMultiMaterial);
-            vkCmdDraw(frameInfo.m_CommandBuffer, // VkCommandBuffer commandBuffer
-                      submesh.m_IndexCount,      // uint32_t        vertexCount (index count is used(!))
-                      submesh.m_InstanceCount,   // uint32_t        instanceCount
-                      0,                         // uint32_t        firstVertex
-                      0                          // uint32_t        firstInstance
+            // firstInstance selects the instance buffer slice or packed range of this frame
+            vkCmdDraw(frameInfo.m_CommandBuffer,     // VkCommandBuffer commandBuffer
+                      submesh.m_IndexCount,          // uint32_t        vertexCount (index count is used(!))
+                      instanceRange.m_InstanceCount, // uint32_t        instanceCount
+                      0,                             // uint32_t        firstVertex
+                      instanceRange.m_FirstInstance  // uint32_t        firstInstance
             );
         }
     }
@@ -371,16 +421,18 @@ namespace GfxRenderEngine
     }
 
     void VK_Model::DrawShadowInstanced(const VK_FrameInfo& frameInfo, const VkPipelineLayout& pipelineLayout,
-                                       const VkDescriptorSet& shadowDescriptorSet)
+                                       const VkDescriptorSet& shadowDescriptorSet,
+                                       VK_InstanceBuffer::InstanceRange const& instanceRange)
     {
         for (auto& submesh : m_SubmeshesPbr)
         {
-            DrawShadowInstancedInternal(frameInfo, pipelineLayout, submesh, shadowDescriptorSet);
+            DrawShadowInstancedInternal(frameInfo, pipelineLayout, submesh, shadowDescriptorSet, instanceRange);
         }
     }
 
     void VK_Model::DrawShadowInstancedInternal(VK_FrameInfo const& frameInfo, VkPipelineLayout const& pipelineLayout,
-                                               VK_Submesh const& submesh, VkDescriptorSet const& shadowDescriptorSet)
+                                               VK_Submesh const& submesh, VkDescriptorSet const& shadowDescriptorSet,
+                                               VK_InstanceBuffer::InstanceRange const& instanceRange)
     {
         VkDescriptorSet localDescriptorSet = submesh.m_ResourceDescriptor.GetDescriptorSet();
         auto descriptorSets = std::to_array<VkDescriptorSet>({shadowDescriptorSet, localDescriptorSet});
@@ -388,7 +440,7 @@ namespace GfxRenderEngine
         vkCmdBindDescriptorSets(frameInfo.m_CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 2,
                                 descriptorSets.data(), 0, nullptr);
 
-        DrawSubmesh(frameInfo.m_CommandBuffer, submesh);
+        DrawSubmesh(frameInfo.m_CommandBuffer, submesh, instanceRange);
     }
 
     void VK_Model::DrawCubemap(const VK_FrameInfo& frameInfo, const VkPipelineLayout& pipelineLayout)
@@ -424,6 +476,11 @@ namespace GfxRenderEngine
         return m_VertexBuffer->GetBufferDeviceAddress();
     }
 
+    Buffer::BufferDeviceAddress VK_Model::GetPositionBufferDeviceAddress() const
+    {
+        return m_PositionBuffer ? m_PositionBuffer->GetBufferDeviceAddress() : 0;
+    }
+
     Buffer::BufferDeviceAddress VK_Model::GetIndexBufferDeviceAddress() const
     {
 #ifdef DEBUG
@@ -29,6 +29,7 @@
 #include "renderer/model.h"
 #include "renderer/buffer.h"
 #include "renderer/shader.h"
+#include "renderer/vertexStreams.h"
 #include "renderer/builder/builder.h"
 #include "renderer/builder/IBLBuilder.h"
 #include "renderer/builder/gltfBuilder.h"
@@ -47,6 +48,7 @@
 #include "VKcubemap.h"
 #include "VKmaterialDescriptor.h"
 #include "VKresourceDescriptor.h"
+#include "VKinstanceBuffer.h"
 
 namespace GfxRenderEngine
 {
@@ -68,20 +70,19 @@ namespace GfxRenderEngine
             uint vertexSize = sizeof(T);
             VkDeviceSize bufferSize = vertexSize * m_VertexCount;
 
-            VK_Buffer stagingBuffer{vertexSize, m_VertexCount, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                                    VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT};
-            stagingBuffer.Map();
-            stagingBuffer.WriteToBuffer((void*)vertices.data());
-
             m_VertexBuffer =
                 std::make_unique<VK_Buffer>(vertexSize, m_VertexCount,
                                             VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
                                                 VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
                                             VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
 
-            VK_Core::m_Device->CopyBuffer(stagingBuffer.GetBuffer(), m_VertexBuffer->GetBuffer(), bufferSize);
+            // asynchronous, the GPU copy is ordered before the first frame that draws this model
+            VK_Core::m_Device->GetUploader()->UploadBuffer(m_VertexBuffer->GetBuffer(), vertices.data(), bufferSize);
         }
 
+        void CreateVertexStreams(std::vector<Vertex> const& vertices);
+        void CreateStreamBuffer(std::unique_ptr<VK_Buffer>& buffer, std::vector<uint> const& stream, uint stride);
+
     public:
         struct VK_Vertex : public Vertex
         {
@@ -89,6 +90,13 @@ namespace GfxRenderEngine
             static std::vector<VkVertexInputAttributeDescription> GetAttributeDescriptions();
         };
 
+        // position stream of the PBR vertex streams, used by the shadow passes
+        struct VK_PositionStream
+        {
+            static std::vector<VkVertexInputBindingDescription> GetBindingDescriptions(bool skinned);
+            static std::vector<VkVertexInputAttributeDescription> GetAttributeDescriptions(bool skinned);
+        };
+
     public:
         VK_Model(VK_Device* device, const Builder& builder);
         VK_Model(VK_Device* device, const GltfBuilder& builder);
@@ -106,17 +114,18 @@ namespace GfxRenderEngine
         virtual void CreateIndexBuffer(const std::vector<uint>& indices) override;
         virtual Buffer::BufferDeviceAddress GetVertexBufferDeviceAddress() const override;
         virtual Buffer::BufferDeviceAddress GetIndexBufferDeviceAddress() const override;
+        virtual Buffer::BufferDeviceAddress GetPositionBufferDeviceAddress() const override;
 
         void Bind(VkCommandBuffer commandBuffer);
-        void UpdateAnimation(const Timestep& timestep, uint frameCounter);
 
         void BindDescriptors(const VK_FrameInfo& frameInfo, const VkPipelineLayout& pipelineLayout,
                              VK_Submesh const& submesh);
         void BindDescriptors(const VK_FrameInfo& frameInfo, const VkPipelineLayout& pipelineLayout,
                              VK_Submesh const& submesh, bool bindResources);
 
-        void Draw(VkCommandBuffer commandBuffer);
-        void DrawSubmesh(VkCommandBuffer commandBuffer, Submesh const& submesh);
+        void Draw(VkCommandBuffer commandBuffer, uint instanceCount = 1);
+        void DrawSubmesh(VkCommandBuffer commandBuffer, Submesh const& submesh,
+                         VK_InstanceBuffer::InstanceRange const& instanceRange);
 
         // draw pbr materials
         void PushConstantsPbr(const VK_FrameInfo& frameInfo, const VkPipelineLayout& pipelineLayout,
@@ -126,17 +135,22 @@ namespace GfxRenderEngine
         void PushConstantsPbr(const VK_FrameInfo& frameInfo, const VkPipelineLayout& pipelineLayout,
                               VK_Submesh const& submesh, DrawCallInfoGrass& drawCallInfoGrass);
 
-        void DrawPbr(const VK_FrameInfo& frameInfo, const VkPipelineLayout& pipelineLayout, DrawCallInfo& drawCallInfo);
+        // instanceRange: see VK_InstanceBuffer::GetInstanceRange()
+        void DrawPbr(const VK_FrameInfo& frameInfo, const VkPipelineLayout& pipelineLayout, DrawCallInfo& drawCallInfo,
+                     VK_InstanceBuffer::InstanceRange const& instanceRange);
         void DrawPbr(const VK_FrameInfo& frameInfo, const VkPipelineLayout& pipelineLayout,
-                     DrawCallInfoMultiMaterial& drawCallInfoMultiMaterial);
+                     DrawCallInfoMultiMaterial& drawCallInfoMultiMaterial,
+                     VK_InstanceBuffer::InstanceRange const& instanceRange);
         void DrawPbr(const VK_FrameInfo& frameInfo, const VkPipelineLayout& pipelineLayout,
                      DrawCallInfoGrass& drawCallInfoGrass, int instanceCount);
 
         // draw shadow
         void DrawShadowInstanced(const VK_FrameInfo& frameInfo, const VkPipelineLayout& pipelineLayout,
-                                 VkDescriptorSet const& shadowDescriptorSet);
+                                 VkDescriptorSet const& shadowDescriptorSet,
+                                 VK_InstanceBuffer::InstanceRange const& instanceRange);
         void DrawShadowInstancedInternal(VK_FrameInfo const& frameInfo, VkPipelineLayout const& pipelineLayout,
-                                         VK_Submesh const& submesh, VkDescriptorSet const& shadowDescriptorSet);
+                                         VK_Submesh const& submesh, VkDescriptorSet const& shadowDescriptorSet,
+                                         VK_InstanceBuffer::InstanceRange const& instanceRange);
         // cube map
         void DrawCubemap(const VK_FrameInfo& frameInfo, const VkPipelineLayout& pipelineLayout);
         // skybox HDRI
@@ -146,7 +160,8 @@ namespace GfxRenderEngine
         void CopySubmeshes(std::vector<Submesh> const& submeshes);
 
     private:
-        std::unique_ptr<VK_Buffer> m_VertexBuffer;
+        std::unique_ptr<VK_Buffer> m_VertexBuffer; // attribute stream for PBR meshes
+        std::unique_ptr<VK_Buffer> m_PositionBuffer;
         std::unique_ptr<VK_Buffer> m_IndexBuffer;
 
         uint m_VertexCount{0};
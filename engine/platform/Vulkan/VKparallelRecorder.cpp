@@ -0,0 +1,203 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <chrono>
+#include <future>
+#include <thread>
+
+#include "VKcore.h"
+#include "VKpool.h"
+#include "VKparallelRecorder.h"
+
+namespace GfxRenderEngine
+{
+    VK_ParallelRecorder::VK_ParallelRecorder(std::vector<char const*> const& systemNames)
+        : m_CurrentFrameTimes(systemNames.size(), 0.0f)
+    {
+        m_RecordTimes.reserve(systemNames.size());
+        for (auto name : systemNames)
+        {
+            m_RecordTimes.push_back({name, 0.0f});
+        }
+
+        // worker threads of the primary pool and the main thread, which records the first task of a batch
+        for (auto& threadID : Engine::m_Engine->m_PoolPrimary.GetThreadIDs())
+        {
+            m_ThreadCommandBuffers[std::hash<std::thread::id>()(threadID)];
+        }
+        m_ThreadCommandBuffers[std::hash<std::thread::id>()(std::this_thread::get_id())];
+    }
+
+    VK_ParallelRecorder::~VK_ParallelRecorder()
+    {
+        for (auto& [hash, threadCommandBuffers] : m_ThreadCommandBuffers)
+        {
+            for (auto& commandBuffers : threadCommandBuffers.m_CommandBuffers)
+            {
+                if (!commandBuffers.empty())
+                {
+                    std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
+                    vkFreeCommandBuffers(VK_Core::m_Device->Device(), threadCommandBuffers.m_CommandPool,
+                                         static_cast<uint>(commandBuffers.size()), commandBuffers.data());
+                }
+            }
+        }
+    }
+
+    void VK_ParallelRecorder::BeginFrame(uint frameIndex)
+    {
+        m_FrameIndex = frameIndex;
+        for (auto& [hash, threadCommandBuffers] : m_ThreadCommandBuffers)
+        {
+            threadCommandBuffers.m_Used = 0;
+        }
+
+        for (uint index = 0; index < m_RecordTimes.size(); ++index)
+        {
+            m_RecordTimes[index].m_Milliseconds = m_CurrentFrameTimes[index];
+            m_CurrentFrameTimes[index] = 0.0f;
+        }
+    }
+
+    // a command buffer of the calling thread for the current frame in flight,
+    // only the calling thread touches its entry
+    VkCommandBuffer VK_ParallelRecorder::GetCommandBuffer()
+    {
+        uint64 hash = std::hash<std::thread::id>()(std::this_thread::get_id());
+        auto iterator = m_ThreadCommandBuffers.find(hash);
+        CORE_ASSERT(iterator != m_ThreadCommandBuffers.end(), "VK_ParallelRecorder: unknown thread");
+        ThreadCommandBuffers& threadCommandBuffers = iterator->second;
+        auto& commandBuffers = threadCommandBuffers.m_CommandBuffers[m_FrameIndex];
+
+        if (threadCommandBuffers.m_Used == commandBuffers.size())
+        {
+            if (!threadCommandBuffers.m_CommandPool)
+            {
+                threadCommandBuffers.m_CommandPool = VK_Core::m_Device->GetLoadPool()->GetCommandPool();
+            }
+
+            VkCommandBufferAllocateInfo allocateInfo{};
+            allocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocateInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+            allocateInfo.commandPool = threadCommandBuffers.m_CommandPool;
+            allocateInfo.commandBufferCount = 1;
+
+            VkCommandBuffer commandBuffer{nullptr};
+            {
+                std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
+                auto result = vkAllocateCommandBuffers(VK_Core::m_Device->Device(), &allocateInfo, &commandBuffer);
+                if (result != VK_SUCCESS)
+                {
+                    VK_Core::m_Device->PrintError(result);
+                    LOG_CORE_CRITICAL("failed to allocate secondary command buffer");
+                }
+            }
+            commandBuffers.push_back(commandBuffer);
+        }
+        return commandBuffers[threadCommandBuffers.m_Used++];
+    }
+
+    void VK_ParallelRecorder::RecordTask(Task const& task, VkCommandBuffer& commandBuffer, float& milliseconds)
+    {
+        ZoneScopedN("VK_ParallelRecorder::RecordTask");
+        auto start = std::chrono::steady_clock::now();
+        commandBuffer = GetCommandBuffer();
+
+        Target const& target = *task.m_Target;
+        VkCommandBufferInheritanceInfo inheritanceInfo{};
+        inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        inheritanceInfo.renderPass = target.m_RenderPass;
+        inheritanceInfo.subpass = target.m_Subpass;
+        inheritanceInfo.framebuffer = target.m_Framebuffer;
+
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT | VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        beginInfo.pInheritanceInfo = &inheritanceInfo;
+        {
+            // implicitly resets the command buffer of the previous use of this frame in flight
+            auto result = vkBeginCommandBuffer(commandBuffer, &beginInfo);
+            if (result != VK_SUCCESS)
+            {
+                VK_Core::m_Device->PrintError(result);
+                LOG_CORE_CRITICAL("failed to begin secondary command buffer");
+            }
+        }
+
+        // dynamic state is not inherited from the primary command buffer
+        vkCmdSetViewport(commandBuffer, 0, 1, &target.m_Viewport);
+        vkCmdSetScissor(commandBuffer, 0, 1, &target.m_Scissor);
+
+        task.m_Record(commandBuffer);
+
+        {
+            auto result = vkEndCommandBuffer(commandBuffer);
+            if (result != VK_SUCCESS)
+            {
+                VK_Core::m_Device->PrintError(result);
+                LOG_CORE_CRITICAL("recording of secondary command buffer failed");
+            }
+        }
+        milliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    void VK_ParallelRecorder::Record(std::vector<Task> const& tasks, std::vector<VkCommandBuffer>& commandBuffers)
+    {
+        ZoneScopedN("VK_ParallelRecorder::Record");
+        uint numberOfTasks = static_cast<uint>(tasks.size());
+        commandBuffers.resize(numberOfTasks);
+        if (!numberOfTasks)
+        {
+            return;
+        }
+
+        std::vector<float> milliseconds(numberOfTasks, 0.0f);
+        std::vector<std::future<void>> futures;
+        futures.reserve(numberOfTasks - 1);
+        ThreadPool& threadPool = Engine::m_Engine->m_PoolPrimary;
+        for (uint index = 1; index < numberOfTasks; ++index)
+        {
+            futures.push_back(threadPool.SubmitTask([&, index]()
+                                                    { RecordTask(tasks[index], commandBuffers[index], milliseconds[index]); }));
+        }
+        // the main thread records the first task instead of waiting idle
+        RecordTask(tasks[0], commandBuffers[0], milliseconds[0]);
+        for (auto& future : futures)
+        {
+            threadPool.GetResult(future);
+        }
+
+        for (uint index = 0; index < numberOfTasks; ++index)
+        {
+            m_CurrentFrameTimes[tasks[index].m_System] += milliseconds[index];
+        }
+    }
+
+    void VK_ParallelRecorder::Execute(VkCommandBuffer primaryCommandBuffer, VkCommandBuffer const* commandBuffers,
+                                      uint count)
+    {
+        if (count)
+        {
+            vkCmdExecuteCommands(primaryCommandBuffer, count, commandBuffers);
+        }
+    }
+} // namespace GfxRenderEngine
@@ -0,0 +1,98 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include <vulkan/vulkan.h>
+
+#include "engine.h"
+#include "renderer/renderer.h"
+#include "VKswapChain.h"
+
+namespace GfxRenderEngine
+{
+    // Records render systems into secondary command buffers on the primary thread pool.
+    // The command buffers are allocated from the per-thread command pools of VK_Pool and are reused
+    // when their frame in flight comes around again. The caller executes them in pass order.
+    class VK_ParallelRecorder
+    {
+
+    public:
+        // the subpass the command buffers of a task are executed in
+        struct Target
+        {
+            VkRenderPass m_RenderPass{nullptr};
+            uint m_Subpass{0};
+            VkFramebuffer m_Framebuffer{nullptr};
+            VkViewport m_Viewport{};
+            VkRect2D m_Scissor{};
+        };
+
+        struct Task
+        {
+            Target const* m_Target;
+            uint m_System; // index into the record times
+            std::function<void(VkCommandBuffer commandBuffer)> m_Record;
+        };
+
+    public:
+        VK_ParallelRecorder(std::vector<char const*> const& systemNames);
+        ~VK_ParallelRecorder();
+
+        VK_ParallelRecorder(const VK_ParallelRecorder&) = delete;
+        VK_ParallelRecorder& operator=(const VK_ParallelRecorder&) = delete;
+
+        // call after the fence of the frame in flight was waited for
+        void BeginFrame(uint frameIndex);
+
+        // records all tasks in parallel, commandBuffers[i] belongs to tasks[i]
+        void Record(std::vector<Task> const& tasks, std::vector<VkCommandBuffer>& commandBuffers);
+        static void Execute(VkCommandBuffer primaryCommandBuffer, VkCommandBuffer const* commandBuffers, uint count);
+
+        // record times of the previous frame, summed over all passes
+        std::vector<Renderer::RecordTime> const& GetRecordTimes() const { return m_RecordTimes; }
+
+    private:
+        struct ThreadCommandBuffers
+        {
+            VkCommandPool m_CommandPool{nullptr}; // command pool of the thread, see VK_Pool
+            std::array<std::vector<VkCommandBuffer>, VK_SwapChain::MAX_FRAMES_IN_FLIGHT> m_CommandBuffers;
+            uint m_Used{0}; // in the current frame
+        };
+
+    private:
+        VkCommandBuffer GetCommandBuffer();
+        void RecordTask(Task const& task, VkCommandBuffer& commandBuffer, float& milliseconds);
+
+    private:
+        uint m_FrameIndex{0};
+        // thread id hash -> command buffers, one entry per worker thread and the main thread, never modified after
+        // construction
+        std::unordered_map<uint64, ThreadCommandBuffers> m_ThreadCommandBuffers;
+
+        std::vector<float> m_CurrentFrameTimes;
+        std::vector<Renderer::RecordTime> m_RecordTimes;
+    };
+} // namespace GfxRenderEngine
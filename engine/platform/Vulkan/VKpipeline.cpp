@@ -131,15 +131,13 @@ namespace GfxRenderEngine
         pipelineInfo.basePipelineIndex = -1;
         pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
 
+        // pipelines are created in parallel, the pipeline cache is internally synchronized
+        auto result = vkCreateGraphicsPipelines(m_Device->Device(), m_Device->GetPipelineCache(), 1, &pipelineInfo,
+                                                nullptr, &m_GraphicsPipeline);
+        if (result != VK_SUCCESS)
         {
-            std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-            auto result = vkCreateGraphicsPipelines(m_Device->Device(), VK_NULL_HANDLE, 1, &pipelineInfo, nullptr,
-                                                    &m_GraphicsPipeline);
-            if (result != VK_SUCCESS)
-            {
-                m_Device->PrintError(result);
-                LOG_CORE_CRITICAL("failed to create graphics pipeline");
-            }
+            m_Device->PrintError(result);
+            LOG_CORE_CRITICAL("failed to create graphics pipeline");
         }
     }
     void VK_Pipeline::CreateShaderModule(const std::vector<char>& code, VkShaderModule* shaderModule)
@@ -89,6 +89,12 @@ namespace GfxRenderEngine
 
         auto emplacePoolObjects = [this, createCommandPool, createDescriptorPool, createUploadSemaphore](uint64 hash)
         {
+            // the thread pools share the workers of the job system
+            if (m_CommandPools.contains(hash))
+            {
+                return;
+            }
+
             // create command pool
             m_CommandPools.emplace(hash, createCommandPool());
 
@@ -28,13 +28,14 @@
 #include "VKswapChain.h"
 #include "VKshadowMap.h"
 #include "VKrenderPass.h"
+#include "VKtransientImages.h"
 #include "systems/bloom/VKbloomRenderSystem.h"
 
 namespace GfxRenderEngine
 {
 
-    VK_RenderPass::VK_RenderPass(VK_SwapChain* swapChain)
-        : m_RenderPassExtent{swapChain->GetSwapChainExtent()}, m_SwapChain{swapChain}
+    VK_RenderPass::VK_RenderPass(VK_SwapChain* swapChain, std::shared_ptr<VK_TransientImages> const& transientImages)
+        : m_RenderPassExtent{swapChain->GetSwapChainExtent()}, m_SwapChain{swapChain}, m_TransientImages{transientImages}
     {
         m_Device = VK_Core::m_Device;
 
@@ -63,12 +64,10 @@ namespace GfxRenderEngine
     VK_RenderPass::~VK_RenderPass()
     {
         vkDestroyImageView(m_Device->Device(), m_DepthImageView, nullptr);
-        vkDestroyImage(m_Device->Device(), m_DepthImage, nullptr);
-        vkFreeMemory(m_Device->Device(), m_DepthImageMemory, nullptr);
+        m_TransientImages->DestroyImage(m_DepthImage);
 
         vkDestroyImageView(m_Device->Device(), m_ColorAttachmentView, nullptr);
-        vkDestroyImage(m_Device->Device(), m_ColorAttachmentImage, nullptr);
-        vkFreeMemory(m_Device->Device(), m_ColorAttachmentImageMemory, nullptr);
+        m_TransientImages->DestroyImage(m_ColorAttachmentImage);
 
         for (auto framebuffer : m_3DFramebuffers)
         {
@@ -110,8 +109,7 @@ namespace GfxRenderEngine
         imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
         imageInfo.flags = 0;
 
-        m_Device->CreateImageWithInfo(imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_ColorAttachmentImage,
-                                      m_ColorAttachmentImageMemory);
+        m_TransientImages->CreateImage("3D color", imageInfo, m_ColorAttachmentImage);
 
         VkImageViewCreateInfo viewInfo{};
         viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
@@ -153,7 +151,7 @@ namespace GfxRenderEngine
         imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
         imageInfo.flags = 0;
 
-        m_Device->CreateImageWithInfo(imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_DepthImage, m_DepthImageMemory);
+        m_TransientImages->CreateImage("3D depth", imageInfo, m_DepthImage);
 
         VkImageViewCreateInfo viewInfo{};
         viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
@@ -273,8 +271,7 @@ namespace GfxRenderEngine
             imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
             imageInfo.flags = 0;
 
-            m_Device->CreateImageWithInfo(imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_GBufferPositionImage,
-                                          m_GBufferPositionImageMemory);
+            m_TransientImages->CreateImage("3D g-buffer position", imageInfo, m_GBufferPositionImage);
         }
 
         {
@@ -294,8 +291,7 @@ namespace GfxRenderEngine
             imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
             imageInfo.flags = 0;
 
-            m_Device->CreateImageWithInfo(imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_GBufferNormalImage,
-                                          m_GBufferNormalImageMemory);
+            m_TransientImages->CreateImage("3D g-buffer normal", imageInfo, m_GBufferNormalImage);
         }
 
         {
@@ -315,8 +311,7 @@ namespace GfxRenderEngine
             imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
             imageInfo.flags = 0;
 
-            m_Device->CreateImageWithInfo(imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_GBufferColorImage,
-                                          m_GBufferColorImageMemory);
+            m_TransientImages->CreateImage("3D g-buffer color", imageInfo, m_GBufferColorImage);
         }
 
         {
@@ -336,8 +331,7 @@ namespace GfxRenderEngine
             imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
             imageInfo.flags = 0;
 
-            m_Device->CreateImageWithInfo(imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_GBufferMaterialImage,
-                                          m_GBufferMaterialImageMemory);
+            m_TransientImages->CreateImage("3D g-buffer material", imageInfo, m_GBufferMaterialImage);
         }
 
         {
@@ -358,8 +352,7 @@ namespace GfxRenderEngine
             imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
             imageInfo.flags = 0;
 
-            m_Device->CreateImageWithInfo(imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_GBufferEmissionImage,
-                                          m_GBufferEmissionImageMemory);
+            m_TransientImages->CreateImage("3D g-buffer emission", imageInfo, m_GBufferEmissionImage);
         }
     }
 
@@ -651,7 +644,7 @@ namespace GfxRenderEngine
         subpassTransparency.preserveAttachmentCount = 0;
         subpassTransparency.pPreserveAttachments = nullptr;
 
-        constexpr uint NUMBER_OF_DEPENDENCIES = 4;
+        constexpr uint NUMBER_OF_DEPENDENCIES = 5;
         std::array<VkSubpassDependency, NUMBER_OF_DEPENDENCIES> dependencies;
 
         // lighting depends on geometry
@@ -678,21 +671,43 @@ namespace GfxRenderEngine
         dependencies[1].dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
         dependencies[1].dependencyFlags = VK_DEPENDENCY_BY_REGION_BIT;
 
+        // the attachments share memory with attachments of other render passes (see VK_TransientImages),
+        // the first use of each attachment waits for all earlier attachment writes and fragment shader reads
+        constexpr VkPipelineStageFlags attachmentStages =
+            VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT |
+            VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        constexpr VkAccessFlags attachmentWrites =
+            VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+        constexpr VkAccessFlags attachmentAccesses = attachmentWrites | VK_ACCESS_COLOR_ATTACHMENT_READ_BIT |
+                                                     VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT;
+
+        // g-buffer and depth are first used in the geometry subpass
         dependencies[2].srcSubpass = VK_SUBPASS_EXTERNAL;
         dependencies[2].dstSubpass = static_cast<uint>(SubPasses3D::SUBPASS_GEOMETRY);
-        dependencies[2].srcStageMask = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
-        dependencies[2].dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-        dependencies[2].srcAccessMask = VK_ACCESS_MEMORY_READ_BIT;
-        dependencies[2].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
-        dependencies[2].dependencyFlags = VK_DEPENDENCY_BY_REGION_BIT;
-
-        dependencies[3].srcSubpass = static_cast<uint>(SubPasses3D::SUBPASS_GEOMETRY);
-        dependencies[3].dstSubpass = VK_SUBPASS_EXTERNAL;
-        dependencies[3].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-        dependencies[3].dstStageMask = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
-        dependencies[3].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
-        dependencies[3].dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
-        dependencies[3].dependencyFlags = VK_DEPENDENCY_BY_REGION_BIT;
+        dependencies[2].srcStageMask = attachmentStages | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+        dependencies[2].dstStageMask = attachmentStages;
+        dependencies[2].srcAccessMask = attachmentWrites;
+        dependencies[2].dstAccessMask = attachmentAccesses;
+        dependencies[2].dependencyFlags = 0;
+
+        // the color attachment is first used in the lighting subpass
+        dependencies[3].srcSubpass = VK_SUBPASS_EXTERNAL;
+        dependencies[3].dstSubpass = static_cast<uint>(SubPasses3D::SUBPASS_LIGHTING);
+        dependencies[3].srcStageMask = attachmentStages | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+        dependencies[3].dstStageMask = attachmentStages;
+        dependencies[3].srcAccessMask = attachmentWrites;
+        dependencies[3].dstAccessMask = attachmentAccesses;
+        dependencies[3].dependencyFlags = 0;
+
+        // later render passes sample the color attachment or reuse the memory of the attachments
+        dependencies[4].srcSubpass = static_cast<uint>(SubPasses3D::SUBPASS_TRANSPARENCY);
+        dependencies[4].dstSubpass = VK_SUBPASS_EXTERNAL;
+        dependencies[4].srcStageMask = attachmentStages;
+        dependencies[4].dstStageMask = attachmentStages | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+        dependencies[4].srcAccessMask = attachmentWrites;
+        dependencies[4].dstAccessMask =
+            attachmentAccesses | VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_INPUT_ATTACHMENT_READ_BIT;
+        dependencies[4].dependencyFlags = 0;
 
         // render pass
         std::array<VkAttachmentDescription, static_cast<uint>(RenderTargets3D::NUMBER_OF_ATTACHMENTS)> attachments = {
@@ -900,23 +915,18 @@ namespace GfxRenderEngine
     {
         std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
         vkDestroyImageView(m_Device->Device(), m_GBufferPositionView, nullptr);
-        vkDestroyImage(m_Device->Device(), m_GBufferPositionImage, nullptr);
-        vkFreeMemory(m_Device->Device(), m_GBufferPositionImageMemory, nullptr);
+        m_TransientImages->DestroyImage(m_GBufferPositionImage);
 
         vkDestroyImageView(m_Device->Device(), m_GBufferNormalView, nullptr);
-        vkDestroyImage(m_Device->Device(), m_GBufferNormalImage, nullptr);
-        vkFreeMemory(m_Device->Device(), m_GBufferNormalImageMemory, nullptr);
+        m_TransientImages->DestroyImage(m_GBufferNormalImage);
 
         vkDestroyImageView(m_Device->Device(), m_GBufferColorView, nullptr);
-        vkDestroyImage(m_Device->Device(), m_GBufferColorImage, nullptr);
-        vkFreeMemory(m_Device->Device(), m_GBufferColorImageMemory, nullptr);
+        m_TransientImages->DestroyImage(m_GBufferColorImage);
 
         vkDestroyImageView(m_Device->Device(), m_GBufferMaterialView, nullptr);
-        vkDestroyImage(m_Device->Device(), m_GBufferMaterialImage, nullptr);
-        vkFreeMemory(m_Device->Device(), m_GBufferMaterialImageMemory, nullptr);
+        m_TransientImages->DestroyImage(m_GBufferMaterialImage);
 
         vkDestroyImageView(m_Device->Device(), m_GBufferEmissionView, nullptr);
-        vkDestroyImage(m_Device->Device(), m_GBufferEmissionImage, nullptr);
-        vkFreeMemory(m_Device->Device(), m_GBufferEmissionImageMemory, nullptr);
+        m_TransientImages->DestroyImage(m_GBufferEmissionImage);
     }
 } // namespace GfxRenderEngine
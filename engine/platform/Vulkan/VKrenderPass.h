@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <memory>
 #include <vulkan/vulkan.h>
 
 #include "engine.h"
@@ -30,6 +31,7 @@
 namespace GfxRenderEngine
 {
     class VK_SwapChain;
+    class VK_TransientImages;
     class VK_RenderPass
     {
 
@@ -90,7 +92,8 @@ namespace GfxRenderEngine
                                                                              // attachments
 
     public:
-        VK_RenderPass(VK_SwapChain* swapChain);
+        // the images of the render passes are called "3D ..." in the frame graph
+        VK_RenderPass(VK_SwapChain* swapChain, std::shared_ptr<VK_TransientImages> const& transientImages);
         ~VK_RenderPass();
 
         VK_RenderPass(const VK_RenderPass&) = delete;
@@ -137,6 +140,7 @@ namespace GfxRenderEngine
         VK_Device* m_Device;
         VK_SwapChain* m_SwapChain;     // constructor initialized
         VkExtent2D m_RenderPassExtent; // constructor initialized
+        std::shared_ptr<VK_TransientImages> m_TransientImages; // constructor initialized, owns the image memory
 
         VkFormat m_DepthFormat{VkFormat::VK_FORMAT_UNDEFINED};
         VkFormat m_BufferPositionFormat{VkFormat::VK_FORMAT_UNDEFINED};
@@ -161,14 +165,6 @@ namespace GfxRenderEngine
         VkImageView m_GBufferMaterialView{nullptr};
         VkImageView m_GBufferEmissionView{nullptr};
 
-        VkDeviceMemory m_DepthImageMemory{nullptr};
-        VkDeviceMemory m_ColorAttachmentImageMemory{nullptr};
-        VkDeviceMemory m_GBufferPositionImageMemory{nullptr};
-        VkDeviceMemory m_GBufferNormalImageMemory{nullptr};
-        VkDeviceMemory m_GBufferColorImageMemory{nullptr};
-        VkDeviceMemory m_GBufferMaterialImageMemory{nullptr};
-        VkDeviceMemory m_GBufferEmissionImageMemory{nullptr};
-
         std::vector<VkFramebuffer> m_3DFramebuffers;
         std::vector<VkFramebuffer> m_PostProcessingFramebuffers;
         std::vector<VkFramebuffer> m_GUIFramebuffers;
@@ -24,6 +24,7 @@
 #include "engine.h"
 #include "resources/resources.h"
 #include "auxiliary/file.h"
+#include "renderer/frameUpdate.h"
 
 #include "shadowMapping.h"
 #include "VKrenderer.h"
@@ -54,6 +55,7 @@ namespace GfxRenderEngine
     bool VK_Renderer::Init()
     {
         ZoneScopedN("VK_Renderer::Init()");
+        PROFILE_SCOPE("VK_Renderer::Init()");
         if (!m_ShadersCompiled)
         {
             return m_ShadersCompiled;
@@ -178,12 +180,6 @@ namespace GfxRenderEngine
                 .AddBinding(0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_VERTEX_BIT) // shader data for instances
                 .Build();
 
-        m_ResourceDescriptorSetLayouts[Rt::RtInstanceSA] =
-            VK_DescriptorSetLayout::Builder()
-                .AddBinding(0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_VERTEX_BIT) // shader data for instances
-                .AddBinding(1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_VERTEX_BIT) // shader data for animation
-                .Build();
-
         m_ResourceDescriptorSetLayouts[Rt::RtGrass] =
             VK_DescriptorSetLayout::Builder()
                 .AddBinding(0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_VERTEX_BIT) // shader data for instances
@@ -279,7 +275,7 @@ namespace GfxRenderEngine
 
         std::vector<VkDescriptorSetLayout> descriptorSetLayoutsShadowAnimatedInstanced = {
             m_ShadowUniformBufferDescriptorSetLayout->GetDescriptorSetLayout(),
-            m_ResourceDescriptorSetLayouts[Rt::RtInstanceSA]->GetDescriptorSetLayout()};
+            m_ResourceDescriptorSetLayouts[Rt::RtInstance]->GetDescriptorSetLayout()};
 
         std::vector<VkDescriptorSetLayout> descriptorSetLayoutsDebug = {
             m_ShadowMapDescriptorSetLayout->GetDescriptorSetLayout()};
@@ -350,42 +346,91 @@ namespace GfxRenderEngine
                 .Build(m_GlobalDescriptorSetsWater[i]);
         }
 
-        m_RenderSystemWater1 =
-            std::make_unique<VK_RenderSystemWater1>(m_RenderPass->Get3DRenderPass(), descriptorSetLayoutsWater1);
-        // regular pbr
-        m_RenderSystemPbr = std::make_unique<VK_RenderSystemPbr>(m_RenderPass->Get3DRenderPass(), descriptorSetLayoutsPbr);
-        // pbr with skeletal animation
-        m_RenderSystemPbrSA =
-            std::make_unique<VK_RenderSystemPbrSA>(m_RenderPass->Get3DRenderPass(), descriptorSetLayoutsPbr);
-        // pbr grass shader according to height and density map
-        m_RenderSystemGrass =
-            std::make_unique<VK_RenderSystemGrass>(m_RenderPass->Get3DRenderPass(), descriptorSetLayoutsPbr);
-        // pbr grass shader according to placement mesh
-        m_RenderSystemGrass2 =
-            std::make_unique<VK_RenderSystemGrass2>(m_RenderPass->Get3DRenderPass(), descriptorSetLayoutsPbr);
-        // multiple pbr materials according to altitude for terrain
-        m_RenderSystemPbrMultiMaterial =
-            std::make_unique<VK_RenderSystemPbrMultiMaterial>(m_RenderPass->Get3DRenderPass(), descriptorSetLayoutsPbr);
-
-        m_RenderSystemShadowInstanced = std::make_unique<VK_RenderSystemShadowInstanced>(
-            m_ShadowMap[ShadowMaps::HIGH_RES]->GetShadowRenderPass(),
-            m_ShadowMap[ShadowMaps::LOW_RES]->GetShadowRenderPass(), descriptorSetLayoutsShadowInstanced);
-        m_RenderSystemShadowAnimatedInstanced = std::make_unique<VK_RenderSystemShadowAnimatedInstanced>(
-            m_ShadowMap[ShadowMaps::HIGH_RES]->GetShadowRenderPass(),
-            m_ShadowMap[ShadowMaps::LOW_RES]->GetShadowRenderPass(), descriptorSetLayoutsShadowAnimatedInstanced);
-
-        m_LightSystem =
-            std::make_unique<VK_LightSystem>(m_Device, m_RenderPass->Get3DRenderPass(), *m_GlobalDescriptorSetLayout);
-        m_RenderSystemSpriteRenderer =
-            std::make_unique<VK_RenderSystemSpriteRenderer>(m_RenderPass->Get3DRenderPass(), descriptorSetLayoutsDiffuse);
-        m_RenderSystemSpriteRenderer2D = std::make_unique<VK_RenderSystemSpriteRenderer2D>(m_RenderPass->GetGUIRenderPass(),
-                                                                                           *m_GlobalDescriptorSetLayout);
-        m_RenderSystemGUIRenderer =
-            std::make_unique<VK_RenderSystemGUIRenderer>(m_RenderPass->GetGUIRenderPass(), *m_GlobalDescriptorSetLayout);
-        m_RenderSystemCubemap =
-            std::make_unique<VK_RenderSystemCubemap>(m_RenderPass->Get3DRenderPass(), descriptorSetLayoutsCubemap);
-        m_RenderSystemSkyboxHDRI =
-            std::make_unique<VK_RenderSystemSkyboxHDRI>(m_RenderPass->Get3DRenderPass(), descriptorSetLayoutsSkyboxHDRI);
+        // the render systems below only create pipeline layouts and pipelines,
+        // they are constructed in parallel and share the device's pipeline cache
+        {
+            PROFILE_SCOPE("VK_Renderer::Init() pipelines");
+            CreateInParallel({
+                [&]()
+                {
+                    m_RenderSystemWater1 = std::make_unique<VK_RenderSystemWater1>(m_RenderPass->Get3DRenderPass(),
+                                                                                   descriptorSetLayoutsWater1);
+                },
+                // regular pbr
+                [&]()
+                {
+                    m_RenderSystemPbr =
+                        std::make_unique<VK_RenderSystemPbr>(m_RenderPass->Get3DRenderPass(), descriptorSetLayoutsPbr);
+                },
+                // pbr with skeletal animation
+                [&]()
+                {
+                    m_RenderSystemPbrSA =
+                        std::make_unique<VK_RenderSystemPbrSA>(m_RenderPass->Get3DRenderPass(), descriptorSetLayoutsPbr);
+                },
+                // pbr grass shader according to height and density map
+                [&]()
+                {
+                    m_RenderSystemGrass =
+                        std::make_unique<VK_RenderSystemGrass>(m_RenderPass->Get3DRenderPass(), descriptorSetLayoutsPbr);
+                },
+                // pbr grass shader according to placement mesh
+                [&]()
+                {
+                    m_RenderSystemGrass2 =
+                        std::make_unique<VK_RenderSystemGrass2>(m_RenderPass->Get3DRenderPass(), descriptorSetLayoutsPbr);
+                },
+                // multiple pbr materials according to altitude for terrain
+                [&]()
+                {
+                    m_RenderSystemPbrMultiMaterial = std::make_unique<VK_RenderSystemPbrMultiMaterial>(
+                        m_RenderPass->Get3DRenderPass(), descriptorSetLayoutsPbr);
+                },
+                [&]()
+                {
+                    m_RenderSystemShadowInstanced = std::make_unique<VK_RenderSystemShadowInstanced>(
+                        m_ShadowMap[ShadowMaps::HIGH_RES]->GetShadowRenderPass(),
+                        m_ShadowMap[ShadowMaps::LOW_RES]->GetShadowRenderPass(), descriptorSetLayoutsShadowInstanced);
+                },
+                [&]()
+                {
+                    m_RenderSystemShadowAnimatedInstanced = std::make_unique<VK_RenderSystemShadowAnimatedInstanced>(
+                        m_ShadowMap[ShadowMaps::HIGH_RES]->GetShadowRenderPass(),
+                        m_ShadowMap[ShadowMaps::LOW_RES]->GetShadowRenderPass(),
+                        descriptorSetLayoutsShadowAnimatedInstanced);
+                },
+                [&]()
+                {
+                    m_LightSystem = std::make_unique<VK_LightSystem>(m_Device, m_RenderPass->Get3DRenderPass(),
+                                                                     *m_GlobalDescriptorSetLayout);
+                },
+                [&]()
+                {
+                    m_RenderSystemSpriteRenderer = std::make_unique<VK_RenderSystemSpriteRenderer>(
+                        m_RenderPass->Get3DRenderPass(), descriptorSetLayoutsDiffuse);
+                },
+                [&]()
+                {
+                    m_RenderSystemSpriteRenderer2D = std::make_unique<VK_RenderSystemSpriteRenderer2D>(
+                        m_RenderPass->GetGUIRenderPass(), *m_GlobalDescriptorSetLayout);
+                },
+                [&]()
+                {
+                    m_RenderSystemGUIRenderer = std::make_unique<VK_RenderSystemGUIRenderer>(
+                        m_RenderPass->GetGUIRenderPass(), *m_GlobalDescriptorSetLayout);
+                },
+                [&]()
+                {
+                    m_RenderSystemCubemap = std::make_unique<VK_RenderSystemCubemap>(m_RenderPass->Get3DRenderPass(),
+                                                                                     descriptorSetLayoutsCubemap);
+                },
+                [&]()
+                {
+                    m_RenderSystemSkyboxHDRI = std::make_unique<VK_RenderSystemSkyboxHDRI>(
+                        m_RenderPass->Get3DRenderPass(), descriptorSetLayoutsSkyboxHDRI);
+                },
+            });
+        }
 
         CreateShadowMapDescriptorSets();
         CreateLightingDescriptorSets();
@@ -393,17 +438,34 @@ namespace GfxRenderEngine
         CreateDescriptorSetRefractionReflection();
         CreatePostProcessingDescriptorSets();
 
-        m_RenderSystemDeferredShading = std::make_unique<VK_RenderSystemDeferredShading>(
-            m_RenderPass->Get3DRenderPass(), descriptorSetLayoutsLighting, m_LightingDescriptorSets.data(),
-            m_ShadowMapDescriptorSets.data());
+        {
+            PROFILE_SCOPE("VK_Renderer::Init() pipelines (descriptor sets)");
+            CreateInParallel({
+                [&]()
+                {
+                    m_RenderSystemDeferredShading = std::make_unique<VK_RenderSystemDeferredShading>(
+                        m_RenderPass->Get3DRenderPass(), descriptorSetLayoutsLighting, m_LightingDescriptorSets.data(),
+                        m_ShadowMapDescriptorSets.data());
+                },
+                [&]()
+                {
+                    m_RenderSystemPostProcessing = std::make_unique<VK_RenderSystemPostProcessing>(
+                        m_RenderPass->GetPostProcessingRenderPass(), descriptorSetLayoutsPostProcessing,
+                        m_PostProcessingDescriptorSets.data());
+                },
+                [&]()
+                {
+                    m_RenderSystemDebug = std::make_unique<VK_RenderSystemDebug>(
+                        m_RenderPass->Get3DRenderPass(), descriptorSetLayoutsDebug, m_ShadowMapDescriptorSets.data());
+                },
+            });
+        }
+        // bloom also creates attachments, render passes, and descriptor sets
         CreateRenderSystemBloom();
 
-        m_RenderSystemPostProcessing = std::make_unique<VK_RenderSystemPostProcessing>(
-            m_RenderPass->GetPostProcessingRenderPass(), descriptorSetLayoutsPostProcessing,
-            m_PostProcessingDescriptorSets.data());
-
-        m_RenderSystemDebug = std::make_unique<VK_RenderSystemDebug>(
-            m_RenderPass->Get3DRenderPass(), descriptorSetLayoutsDebug, m_ShadowMapDescriptorSets.data());
+        // names in the order of RecordedSystems
+        m_ParallelRecorder = std::make_unique<VK_ParallelRecorder>(std::vector<char const*>{
+            "pbr", "pbr SA", "grass", "grass2", "pbr multi material", "shadow", "shadow animated"});
 
         m_Imgui = Imgui::Create(m_RenderPass->GetGUIRenderPass(), static_cast<uint>(m_SwapChain->ImageCount()));
         return m_ShadersCompiled;
@@ -414,6 +476,27 @@ namespace GfxRenderEngine
         m_RenderSystemBloom = std::make_unique<VK_RenderSystemBloom>(*m_RenderPass);
     }
 
+    void VK_Renderer::CreateInParallel(std::vector<std::function<void()>> const& tasks)
+    {
+        ThreadPool& threadPool = Engine::m_Engine->m_PoolPrimary;
+        std::vector<std::future<bool>> futures;
+        futures.reserve(tasks.size());
+        for (auto& task : tasks)
+        {
+            futures.push_back(threadPool.SubmitTask(
+                [&task]() -> bool
+                {
+                    ZoneScopedN("VK_Renderer::CreateInParallel()");
+                    task();
+                    return true;
+                }));
+        }
+        for (auto& future : futures)
+        {
+            threadPool.GetResult(future);
+        }
+    }
+
     void VK_Renderer::CreateShadowMapDescriptorSets()
     {
         for (uint i = 0; i < VK_SwapChain::MAX_FRAMES_IN_FLIGHT; i++)
@@ -569,13 +652,6 @@ namespace GfxRenderEngine
 
     void VK_Renderer::RecreateRenderpass()
     {
-        // 3D renderpass
-        m_RenderPass = std::make_unique<VK_RenderPass>(m_SwapChain.get());
-        VK_Core::m_ColorAttachmentFormat = m_SwapChain->GetSwapChainImageFormat();
-        VK_Core::m_DepthAttachmentFormat = m_RenderPass->GetDepthFormat();
-
-        // water renderpasses
-
         // --- Determine water renderpass extent ---
         VkExtent2D swapExtent = m_SwapChain->GetSwapChainExtent();
 
@@ -594,9 +670,19 @@ namespace GfxRenderEngine
         waterExtent.width = static_cast<uint32_t>(std::max(1.0f, scaledWidth));
         waterExtent.height = static_cast<uint32_t>(std::max(1.0f, scaledHeight));
 
+        // the frame graph places the attachments of the render passes in memory
+        CompileFrameGraph(waterExtent);
+
+        // 3D renderpass
+        m_RenderPass = std::make_unique<VK_RenderPass>(m_SwapChain.get(), m_TransientImages);
+        VK_Core::m_ColorAttachmentFormat = m_SwapChain->GetSwapChainImageFormat();
+        VK_Core::m_DepthAttachmentFormat = m_RenderPass->GetDepthFormat();
+
         // --- Create water renderpasses ---
-        m_WaterRenderPass[WaterPasses::REFRACTION] = std::make_unique<VK_WaterRenderPass>(*m_SwapChain.get(), waterExtent);
-        m_WaterRenderPass[WaterPasses::REFLECTION] = std::make_unique<VK_WaterRenderPass>(*m_SwapChain.get(), waterExtent);
+        m_WaterRenderPass[WaterPasses::REFRACTION] = std::make_unique<VK_WaterRenderPass>(
+            *m_SwapChain.get(), waterExtent, "water refraction", m_TransientImages);
+        m_WaterRenderPass[WaterPasses::REFLECTION] = std::make_unique<VK_WaterRenderPass>(
+            *m_SwapChain.get(), waterExtent, "water reflection", m_TransientImages);
     }
 
     void VK_Renderer::RecreateShadowMaps()
@@ -714,6 +800,8 @@ namespace GfxRenderEngine
 
     void VK_Renderer::Recreate()
     {
+        ZoneScopedN("VK_Renderer::Recreate()");
+        PROFILE_SCOPE("VK_Renderer::Recreate()");
         RecreateSwapChain();
         RecreateRenderpass();
         CreateLightingDescriptorSets();
@@ -724,39 +812,191 @@ namespace GfxRenderEngine
         m_Window->ResetWindowResizedFlag();
     }
 
+    // describes the passes of a frame as the Begin*RenderPass() methods and the render systems run them,
+    // called before the render passes are created, they allocate their attachments from m_TransientImages
+    void VK_Renderer::CompileFrameGraph(VkExtent2D waterExtent)
+    {
+        ZoneScopedN("VK_Renderer::CompileFrameGraph()");
+        using Format = RenderGraph::Format;
+        using Usage = RenderGraph::Usage;
+        using Layout = RenderGraph::Layout;
+        m_FrameGraph.Clear();
+
+        // shadow maps
+        std::array<RenderGraph::ResourceHandle, NUMBER_OF_SHADOW_MAPS> shadowMaps;
+        std::array<uint, NUMBER_OF_SHADOW_MAPS> shadowMapResolutions = {SHADOW_MAP_HIGH_RES, SHADOW_MAP_LOW_RES};
+        for (uint shadowMap = 0; shadowMap < NUMBER_OF_SHADOW_MAPS; ++shadowMap)
+        {
+            uint resolution = shadowMapResolutions[shadowMap];
+            std::string name = "shadow map " + std::to_string(shadowMap);
+            shadowMaps[shadowMap] = m_FrameGraph.ImportImage(name, {resolution, resolution, 1, Format::DEPTH32},
+                                                             Layout::UNDEFINED, Layout::DEPTH_READ_ONLY);
+            auto pass = m_FrameGraph.AddPass(name);
+            m_FrameGraph.Write(pass, shadowMaps[shadowMap], Usage::DEPTH_ATTACHMENT);
+        }
+
+        // geometry, lighting, and transparency subpasses of the water and 3D render passes
+        auto addDeferredPasses = [&](std::string const& prefix, VkExtent2D extent, uint emissionMipLevels,
+                                     std::vector<RenderGraph::ResourceHandle> const& sampledInTransparency)
+        {
+            uint width = extent.width;
+            uint height = extent.height;
+            auto depth = m_FrameGraph.CreateImage(prefix + " depth", {width, height, 1, Format::DEPTH32});
+            auto color = m_FrameGraph.CreateImage(prefix + " color", {width, height, 1, Format::RGBA8});
+            std::array<RenderGraph::ResourceHandle, 5> gBuffer = {
+                m_FrameGraph.CreateImage(prefix + " g-buffer position", {width, height, 1, Format::RGBA16F}),
+                m_FrameGraph.CreateImage(prefix + " g-buffer normal", {width, height, 1, Format::RGBA16F}),
+                m_FrameGraph.CreateImage(prefix + " g-buffer color", {width, height, 1, Format::RGBA8}),
+                m_FrameGraph.CreateImage(prefix + " g-buffer material", {width, height, 1, Format::RGBA16F}),
+                m_FrameGraph.CreateImage(prefix + " g-buffer emission",
+                                         {width, height, emissionMipLevels, Format::RGBA16F})};
+
+            auto geometry = m_FrameGraph.AddPass(prefix + " geometry");
+            m_FrameGraph.Write(geometry, depth, Usage::DEPTH_ATTACHMENT);
+            for (auto image : gBuffer)
+            {
+                m_FrameGraph.Write(geometry, image, Usage::COLOR_ATTACHMENT);
+            }
+
+            auto lighting = m_FrameGraph.AddPass(prefix + " lighting");
+            for (auto image : gBuffer)
+            {
+                m_FrameGraph.Read(lighting, image, Usage::INPUT_ATTACHMENT);
+            }
+            for (auto shadowMap : shadowMaps)
+            {
+                m_FrameGraph.Read(lighting, shadowMap, Usage::SAMPLED);
+            }
+            m_FrameGraph.Write(lighting, color, Usage::COLOR_ATTACHMENT);
+
+            auto transparency = m_FrameGraph.AddPass(prefix + " transparency");
+            m_FrameGraph.Read(transparency, depth, Usage::DEPTH_READ);
+            for (auto image : sampledInTransparency)
+            {
+                m_FrameGraph.Read(transparency, image, Usage::SAMPLED);
+            }
+            m_FrameGraph.Write(transparency, color, Usage::COLOR_ATTACHMENT);
+            return std::make_pair(color, gBuffer[4]);
+        };
+
+        auto refraction = addDeferredPasses("water refraction", waterExtent, 1, {}).first;
+        auto reflection = addDeferredPasses("water reflection", waterExtent, 1, {}).first;
+        auto [color, emission] = addDeferredPasses("3D", m_SwapChain->GetSwapChainExtent(),
+                                                   VK_RenderSystemBloom::NUMBER_OF_MIPMAPS, {refraction, reflection});
+
+        // bloom renders into the mip levels of the emission g-buffer that it samples
+        auto bloom = m_FrameGraph.AddPass("bloom");
+        m_FrameGraph.Read(bloom, emission, Usage::SAMPLED);
+        m_FrameGraph.Write(bloom, emission, Usage::COLOR_ATTACHMENT);
+
+        VkExtent2D swapChainExtent = m_SwapChain->GetSwapChainExtent();
+        auto swapChainImage = m_FrameGraph.ImportImage(
+            "swapchain image", {swapChainExtent.width, swapChainExtent.height, 1, Format::RGBA8}, Layout::UNDEFINED,
+            Layout::PRESENT);
+        auto postProcessing = m_FrameGraph.AddPass("post processing");
+        m_FrameGraph.Read(postProcessing, color, Usage::INPUT_ATTACHMENT);
+        m_FrameGraph.Read(postProcessing, emission, Usage::INPUT_ATTACHMENT);
+        m_FrameGraph.Write(postProcessing, swapChainImage, Usage::COLOR_ATTACHMENT);
+
+        auto gui = m_FrameGraph.AddPass("gui");
+        m_FrameGraph.Write(gui, swapChainImage, Usage::COLOR_ATTACHMENT);
+
+        VK_TransientImages::SetMemoryRequirements(m_FrameGraph);
+        bool compiled = m_FrameGraph.Compile();
+        // without placements, the render passes get memory for each attachment
+        m_TransientImages = std::make_shared<VK_TransientImages>(m_FrameGraph);
+        if (!compiled)
+        {
+            LOG_CORE_ERROR("VK_Renderer::CompileFrameGraph: the frame graph is invalid");
+            return;
+        }
+
+        for (auto const& renderPass : m_FrameGraph.GetRenderPasses())
+        {
+            if (renderPass.m_Subpasses.size() > 1)
+            {
+                std::string subpasses;
+                for (auto pass : renderPass.m_Subpasses)
+                {
+                    subpasses += (subpasses.empty() ? "" : ", ") + m_FrameGraph.GetPassName(pass);
+                }
+                LOG_CORE_INFO("frame graph: render pass with subpasses {0}", subpasses);
+            }
+        }
+        constexpr float MEGABYTE = 1024.0f * 1024.0f;
+        LOG_CORE_INFO("frame graph: {0} passes ({1} culled) in {2} render passes, transient images {3:.1f} MB aliased, "
+                      "{4:.1f} MB without aliasing",
+                      m_FrameGraph.GetNumberOfPasses(), m_FrameGraph.GetNumberOfCulledPasses(),
+                      m_FrameGraph.GetRenderPasses().size(), m_FrameGraph.GetTransientMemory(true) / MEGABYTE,
+                      m_FrameGraph.GetTransientMemory(false) / MEGABYTE);
+    }
+
+    VK_ParallelRecorder::Target VK_Renderer::GetShadowTarget(uint shadowMap) const
+    {
+        VK_ShadowMap& map = *m_ShadowMap[shadowMap];
+        VkExtent2D extent = map.GetShadowMapExtent();
+
+        VK_ParallelRecorder::Target target{};
+        target.m_RenderPass = map.GetShadowRenderPass();
+        target.m_Subpass = static_cast<uint>(VK_ShadowMap::SubPassesShadow::SUBPASS_SHADOW);
+        target.m_Framebuffer = map.GetShadowFrameBuffer();
+        target.m_Viewport = {0.0f, 0.0f, static_cast<float>(extent.width), static_cast<float>(extent.height), 0.0f, 1.0f};
+        target.m_Scissor = {{0, 0}, extent};
+        return target;
+    }
+
+    VK_ParallelRecorder::Target VK_Renderer::GetWaterTarget(WaterPasses pass) const
+    {
+        VK_WaterRenderPass& renderPass = *m_WaterRenderPass[static_cast<uint>(pass)];
+        VkExtent2D extent = renderPass.GetExtent();
+
+        VK_ParallelRecorder::Target target{};
+        target.m_RenderPass = renderPass.Get3DRenderPass();
+        target.m_Subpass = static_cast<uint>(VK_WaterRenderPass::SubPasses3D::SUBPASS_GEOMETRY);
+        target.m_Framebuffer = renderPass.Get3DFrameBuffer();
+        target.m_Viewport = {0.0f, 0.0f, static_cast<float>(extent.width), static_cast<float>(extent.height), 0.0f, 1.0f};
+        target.m_Scissor = {{0, 0}, m_SwapChain->GetSwapChainExtent()};
+        return target;
+    }
+
+    VK_ParallelRecorder::Target VK_Renderer::Get3DTarget() const
+    {
+        VkExtent2D extent = m_SwapChain->GetSwapChainExtent();
+
+        VK_ParallelRecorder::Target target{};
+        target.m_RenderPass = m_RenderPass->Get3DRenderPass();
+        target.m_Subpass = static_cast<uint>(VK_RenderPass::SubPasses3D::SUBPASS_GEOMETRY);
+        target.m_Framebuffer = m_RenderPass->Get3DFrameBuffer(m_CurrentImageIndex);
+        target.m_Viewport = {0.0f, 0.0f, static_cast<float>(extent.width), static_cast<float>(extent.height), 0.0f, 1.0f};
+        target.m_Scissor = {{0, 0}, extent};
+        return target;
+    }
+
     void VK_Renderer::BeginShadowRenderPass0(VkCommandBuffer commandBuffer)
     {
         CORE_ASSERT(m_FrameInProgress, "frame must be in progress");
         CORE_ASSERT(commandBuffer == GetCurrentCommandBuffer(), "command buffer must be current command buffer");
 
+        m_CurrentTarget = GetShadowTarget(ShadowMaps::HIGH_RES);
         VkRenderPassBeginInfo renderPassInfo{};
         renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        renderPassInfo.renderPass = m_ShadowMap[ShadowMaps::HIGH_RES]->GetShadowRenderPass();
-        renderPassInfo.framebuffer = m_ShadowMap[ShadowMaps::HIGH_RES]->GetShadowFrameBuffer();
+        renderPassInfo.renderPass = m_CurrentTarget.m_RenderPass;
+        renderPassInfo.framebuffer = m_CurrentTarget.m_Framebuffer;
 
         renderPassInfo.renderArea.offset = {0, 0};
-        renderPassInfo.renderArea.extent = m_ShadowMap[ShadowMaps::HIGH_RES]->GetShadowMapExtent();
+        renderPassInfo.renderArea.extent = m_CurrentTarget.m_Scissor.extent;
 
         std::array<VkClearValue, static_cast<uint>(VK_ShadowMap::ShadowRenderTargets::NUMBER_OF_ATTACHMENTS)> clearValues{};
         clearValues[0].depthStencil = {1.0f, 0};
         renderPassInfo.clearValueCount = static_cast<uint>(clearValues.size());
         renderPassInfo.pClearValues = clearValues.data();
 
+        // the shadow render systems are recorded into secondary command buffers,
+        // which set viewport and scissor themselves
         {
             std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-            vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+            vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
         }
-
-        VkViewport viewport{};
-        viewport.x = 0.0f;
-        viewport.y = 0.0f;
-        viewport.width = static_cast<float>(m_ShadowMap[ShadowMaps::HIGH_RES]->GetShadowMapExtent().width);
-        viewport.height = static_cast<float>(m_ShadowMap[ShadowMaps::HIGH_RES]->GetShadowMapExtent().height);
-        viewport.minDepth = 0.0f;
-        viewport.maxDepth = 1.0f;
-        VkRect2D scissor{{0, 0}, m_ShadowMap[ShadowMaps::HIGH_RES]->GetShadowMapExtent()};
-        vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
-        vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
     }
 
     void VK_Renderer::BeginShadowRenderPass1(VkCommandBuffer commandBuffer)
@@ -764,34 +1004,26 @@ namespace GfxRenderEngine
         CORE_ASSERT(m_FrameInProgress, "frame must be in progress");
         CORE_ASSERT(commandBuffer == GetCurrentCommandBuffer(), "command buffer must be current command buffer");
 
+        m_CurrentTarget = GetShadowTarget(ShadowMaps::LOW_RES);
         VkRenderPassBeginInfo renderPassInfo{};
         renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        renderPassInfo.renderPass = m_ShadowMap[ShadowMaps::LOW_RES]->GetShadowRenderPass();
-        renderPassInfo.framebuffer = m_ShadowMap[ShadowMaps::LOW_RES]->GetShadowFrameBuffer();
+        renderPassInfo.renderPass = m_CurrentTarget.m_RenderPass;
+        renderPassInfo.framebuffer = m_CurrentTarget.m_Framebuffer;
 
         renderPassInfo.renderArea.offset = {0, 0};
-        renderPassInfo.renderArea.extent = m_ShadowMap[ShadowMaps::LOW_RES]->GetShadowMapExtent();
+        renderPassInfo.renderArea.extent = m_CurrentTarget.m_Scissor.extent;
 
         std::array<VkClearValue, static_cast<uint>(VK_ShadowMap::ShadowRenderTargets::NUMBER_OF_ATTACHMENTS)> clearValues{};
         clearValues[0].depthStencil = {1.0f, 0};
         renderPassInfo.clearValueCount = static_cast<uint>(clearValues.size());
         renderPassInfo.pClearValues = clearValues.data();
 
+        // the shadow render systems are recorded into secondary command buffers,
+        // which set viewport and scissor themselves
         {
             std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-            vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+            vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
         }
-
-        VkViewport viewport{};
-        viewport.x = 0.0f;
-        viewport.y = 0.0f;
-        viewport.width = static_cast<float>(m_ShadowMap[ShadowMaps::LOW_RES]->GetShadowMapExtent().width);
-        viewport.height = static_cast<float>(m_ShadowMap[ShadowMaps::LOW_RES]->GetShadowMapExtent().height);
-        viewport.minDepth = 0.0f;
-        viewport.maxDepth = 1.0f;
-        VkRect2D scissor{{0, 0}, m_ShadowMap[ShadowMaps::LOW_RES]->GetShadowMapExtent()};
-        vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
-        vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
     }
 
     void VK_Renderer::SubmitShadows(Registry& registry, const std::vector<DirectionalLightComponent*>& directionalLights)
@@ -819,21 +1051,49 @@ namespace GfxRenderEngine
                 m_ShadowUniformBuffers1[m_CurrentFrameIndex]->Flush();
             }
 
-            BeginShadowRenderPass0(m_CurrentCommandBuffer);
+            for (uint cascade = 0; cascade < directionalLights.size(); ++cascade)
+            {
+                auto lightView = directionalLights[cascade]->m_LightView;
+                auto visibilityPass = static_cast<FrustumCuller::Pass>(FrustumCuller::SHADOW_CASCADE_0 + cascade);
+                glm::mat4 viewProjection = lightView->GetProjectionMatrix() * lightView->GetViewMatrix();
+                m_FrustumCuller.Cull(registry, visibilityPass, viewProjection, m_CurrentFrameIndex);
+            }
 
-            m_RenderSystemShadowInstanced->RenderEntities(m_FrameInfo, registry, directionalLights[0], 0 /* shadow pass 0*/,
-                                                          m_ShadowDescriptorSets0[m_CurrentFrameIndex]);
-            m_RenderSystemShadowAnimatedInstanced->RenderEntities(m_FrameInfo, registry, directionalLights[0],
-                                                                  0 /* shadow pass 0*/,
-                                                                  m_ShadowDescriptorSets0[m_CurrentFrameIndex]);
+            // record both cascades in parallel, two secondary command buffers per cascade
+            PrepareParallelRecording(registry);
+            std::array<VK_ParallelRecorder::Target, NUMBER_OF_SHADOW_MAPS> targets = {
+                GetShadowTarget(ShadowMaps::HIGH_RES), GetShadowTarget(ShadowMaps::LOW_RES)};
+            std::array<VkDescriptorSet, NUMBER_OF_SHADOW_MAPS> shadowDescriptorSets = {
+                m_ShadowDescriptorSets0[m_CurrentFrameIndex], m_ShadowDescriptorSets1[m_CurrentFrameIndex]};
+
+            std::vector<VK_ParallelRecorder::Task> tasks;
+            for (int cascade = 0; cascade < NUMBER_OF_SHADOW_MAPS; ++cascade)
+            {
+                DirectionalLightComponent* directionalLight = directionalLights[cascade];
+                VkDescriptorSet const& shadowDescriptorSet = shadowDescriptorSets[cascade];
+                tasks.push_back(CreateRecordTask(
+                    targets[cascade], RECORD_SHADOW, m_FrameInfo,
+                    [&, directionalLight, cascade](VK_FrameInfo const& frameInfo)
+                    {
+                        m_RenderSystemShadowInstanced->RenderEntities(frameInfo, registry, directionalLight, cascade,
+                                                                      shadowDescriptorSet);
+                    }));
+                tasks.push_back(CreateRecordTask(
+                    targets[cascade], RECORD_SHADOW_ANIMATED, m_FrameInfo,
+                    [&, directionalLight, cascade](VK_FrameInfo const& frameInfo)
+                    {
+                        m_RenderSystemShadowAnimatedInstanced->RenderEntities(frameInfo, registry, directionalLight,
+                                                                              cascade, shadowDescriptorSet);
+                    }));
+            }
+            m_ParallelRecorder->Record(tasks, m_SecondaryCommandBuffers);
+
+            BeginShadowRenderPass0(m_CurrentCommandBuffer);
+            VK_ParallelRecorder::Execute(m_CurrentCommandBuffer, &m_SecondaryCommandBuffers[0], 2);
             EndRenderPass(m_CurrentCommandBuffer);
 
             BeginShadowRenderPass1(m_CurrentCommandBuffer);
-            m_RenderSystemShadowInstanced->RenderEntities(m_FrameInfo, registry, directionalLights[1], 1 /* shadow pass 1*/,
-                                                          m_ShadowDescriptorSets1[m_CurrentFrameIndex]);
-            m_RenderSystemShadowAnimatedInstanced->RenderEntities(m_FrameInfo, registry, directionalLights[1],
-                                                                  1 /* shadow pass 1*/,
-                                                                  m_ShadowDescriptorSets1[m_CurrentFrameIndex]);
+            VK_ParallelRecorder::Execute(m_CurrentCommandBuffer, &m_SecondaryCommandBuffers[2], 2);
             EndRenderPass(m_CurrentCommandBuffer);
         }
         else
@@ -852,14 +1112,14 @@ namespace GfxRenderEngine
         CORE_ASSERT(m_FrameInProgress, "frame must be in progress");
         CORE_ASSERT(commandBuffer == GetCurrentCommandBuffer(), "command buffer must be current command buffer");
 
-        VK_WaterRenderPass& renderPass = *m_WaterRenderPass[static_cast<uint>(pass)].get();
+        m_CurrentTarget = GetWaterTarget(pass);
         VkRenderPassBeginInfo renderPassInfo{};
         renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        renderPassInfo.renderPass = renderPass.Get3DRenderPass();
-        renderPassInfo.framebuffer = renderPass.Get3DFrameBuffer();
+        renderPassInfo.renderPass = m_CurrentTarget.m_RenderPass;
+        renderPassInfo.framebuffer = m_CurrentTarget.m_Framebuffer;
 
         renderPassInfo.renderArea.offset = {0, 0};
-        renderPassInfo.renderArea.extent = renderPass.GetExtent();
+        renderPassInfo.renderArea.extent = m_WaterRenderPass[static_cast<uint>(pass)]->GetExtent();
 
         std::array<VkClearValue, static_cast<uint>(VK_WaterRenderPass::RenderTargets3D::NUMBER_OF_ATTACHMENTS)>
             clearValues{};
@@ -873,21 +1133,11 @@ namespace GfxRenderEngine
         renderPassInfo.clearValueCount = static_cast<uint>(clearValues.size());
         renderPassInfo.pClearValues = clearValues.data();
 
+        // the geometry subpass is recorded into secondary command buffers, see NextSubpass()
         {
             std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-            vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+            vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
         }
-
-        VkViewport viewport{};
-        viewport.x = 0.0f;
-        viewport.y = 0.0f;
-        viewport.width = static_cast<float>(renderPass.GetExtent().width);
-        viewport.height = static_cast<float>(renderPass.GetExtent().height);
-        viewport.minDepth = 0.0f;
-        viewport.maxDepth = 1.0f;
-        VkRect2D scissor{{0, 0}, m_SwapChain->GetSwapChainExtent()};
-        vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
-        vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
     }
 
     void VK_Renderer::EndRenderpassWater()
@@ -908,10 +1158,11 @@ namespace GfxRenderEngine
         CORE_ASSERT(m_FrameInProgress, "frame must be in progress");
         CORE_ASSERT(commandBuffer == GetCurrentCommandBuffer(), "command buffer must be current command buffer");
 
+        m_CurrentTarget = Get3DTarget();
         VkRenderPassBeginInfo renderPassInfo{};
         renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        renderPassInfo.renderPass = m_RenderPass->Get3DRenderPass();
-        renderPassInfo.framebuffer = m_RenderPass->Get3DFrameBuffer(m_CurrentImageIndex);
+        renderPassInfo.renderPass = m_CurrentTarget.m_RenderPass;
+        renderPassInfo.framebuffer = m_CurrentTarget.m_Framebuffer;
 
         renderPassInfo.renderArea.offset = {0, 0};
         renderPassInfo.renderArea.extent = m_SwapChain->GetSwapChainExtent();
@@ -927,21 +1178,11 @@ namespace GfxRenderEngine
         renderPassInfo.clearValueCount = static_cast<uint>(clearValues.size());
         renderPassInfo.pClearValues = clearValues.data();
 
+        // the geometry subpass is recorded into secondary command buffers, see NextSubpass()
         {
             std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-            vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+            vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
         }
-
-        VkViewport viewport{};
-        viewport.x = 0.0f;
-        viewport.y = 0.0f;
-        viewport.width = static_cast<float>(m_SwapChain->GetSwapChainExtent().width);
-        viewport.height = static_cast<float>(m_SwapChain->GetSwapChainExtent().height);
-        viewport.minDepth = 0.0f;
-        viewport.maxDepth = 1.0f;
-        VkRect2D scissor{{0, 0}, m_SwapChain->GetSwapChainExtent()};
-        vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
-        vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
     }
 
     void VK_Renderer::BeginPostProcessingRenderPass(VkCommandBuffer commandBuffer)
@@ -1040,6 +1281,9 @@ namespace GfxRenderEngine
                        m_CurrentCommandBuffer,
                        camera,
                        m_GlobalDescriptorSets[m_CurrentFrameIndex]};
+        m_FrustumCuller.BeginFrame();
+        m_ParallelRecorder->BeginFrame(m_CurrentFrameIndex);
+        m_RenderSystemGUIRenderer->BeginFrame(m_FrameInfo);
         return true;
     }
 
@@ -1062,6 +1306,12 @@ namespace GfxRenderEngine
                                              &camera,
                                              m_GlobalDescriptorSetsWater[renderpassIndex]};
 
+        auto visibilityPass =
+            static_cast<FrustumCuller::Pass>(static_cast<uint>(FrustumCuller::WATER_REFRACTION) + renderpassIndex);
+        m_FrameInfoWater[renderpassIndex].m_VisibilityPass = visibilityPass;
+        m_FrustumCuller.Cull(registry, visibilityPass, camera.GetProjectionMatrix() * camera.GetViewMatrix(),
+                             m_CurrentFrameIndex);
+
         VertexCtrl vertexCtrl = {};
         vertexCtrl.m_ClippingPlane = clippingPlane;
         vertexCtrl.m_Features = GLSL_ENABLE_CLIPPING_PLANE;
@@ -1087,63 +1337,84 @@ namespace GfxRenderEngine
         m_UniformBuffers[m_CurrentFrameIndex]->WriteToBuffer(&ubo);
         m_UniformBuffers[m_CurrentFrameIndex]->Flush();
 
+        m_FrustumCuller.Cull(registry, FrustumCuller::CAMERA, ubo.m_Projection * ubo.m_View, m_CurrentFrameIndex);
+
         Begin3DRenderPass(m_CurrentCommandBuffer);
     }
 
-    void VK_Renderer::UpdateTransformCache(Scene& scene, uint const nodeIndex, glm::mat4 const& parentMat4,
-                                           bool parentDirtyFlag)
+    void VK_Renderer::UpdateTransformCache(Scene& scene)
     {
-        auto& node = scene.GetTreeNode(nodeIndex);
-        entt::entity gameObject = node.GetGameObject();
+        ZoneScopedN("VK_Renderer::UpdateTransformCache()");
+        Camera const* camera = m_FrameInProgress ? m_FrameInfo.m_Camera : nullptr;
+        FrameUpdate::UpdateTransformCache(scene, camera, m_CurrentFrameIndex);
+    }
 
-        auto& transform = scene.GetRegistry().get<TransformComponent>(gameObject);
-        bool dirtyFlag = transform.GetDirtyFlag() || parentDirtyFlag;
+    void VK_Renderer::PrepareParallelRecording(Registry& registry)
+    {
+        // the render systems share the bindless descriptor sets, update them before recording
+        m_BindlessTexture->UpdateBindlessDescriptorSets();
+        m_BindlessImage->UpdateBindlessDescriptorSets();
 
-        if (dirtyFlag)
-        {
-            transform.SetMat4Global(parentMat4);
-        }
+        // component types viewed by the render systems that are recorded in parallel
+        registry.Assure<MeshComponent, TransformComponent, PbrMaterialTag, InstanceTag, PlainPBRTag,
+                        SkeletalAnimationTag, Grass1Tag, Grass2Tag, PbrMultiMaterialTag>();
+    }
 
-        const glm::mat4& mat4Global = transform.GetMat4Global();
-        for (uint index = 0; index < node.Children(); index++)
-        {
-            UpdateTransformCache(scene, node.GetChild(index), mat4Global, dirtyFlag);
-        }
+    VK_ParallelRecorder::Task VK_Renderer::CreateRecordTask(VK_ParallelRecorder::Target const& target, uint system,
+                                                            VK_FrameInfo const& frameInfo,
+                                                            std::function<void(VK_FrameInfo const&)>&& record) const
+    {
+        return {&target, system,
+                [frameInfo, record = std::move(record)](VkCommandBuffer commandBuffer)
+                {
+                    VK_FrameInfo secondaryFrameInfo = frameInfo;
+                    secondaryFrameInfo.m_CommandBuffer = commandBuffer;
+                    record(secondaryFrameInfo);
+                }};
+    }
+
+    // records the geometry subpass of the current render pass, one secondary command buffer per render system
+    void VK_Renderer::RecordGeometry(VK_FrameInfo const& frameInfo, Registry& registry)
+    {
+        PrepareParallelRecording(registry);
+        auto bindlessTexture = m_BindlessTexture.get();
+        auto bindlessImage = m_BindlessImage.get();
+
+        // clang-format off
+        std::vector<VK_ParallelRecorder::Task> tasks;
+        tasks.push_back(CreateRecordTask(m_CurrentTarget, RECORD_PBR, frameInfo, [&](VK_FrameInfo const& secondaryFrameInfo)
+            { m_RenderSystemPbr->RenderEntities(secondaryFrameInfo, registry, bindlessTexture, bindlessImage); }));
+        tasks.push_back(CreateRecordTask(m_CurrentTarget, RECORD_PBR_SA, frameInfo, [&](VK_FrameInfo const& secondaryFrameInfo)
+            { m_RenderSystemPbrSA->RenderEntities(secondaryFrameInfo, registry, bindlessTexture, bindlessImage); }));
+        tasks.push_back(CreateRecordTask(m_CurrentTarget, RECORD_GRASS, frameInfo, [&](VK_FrameInfo const& secondaryFrameInfo)
+            { m_RenderSystemGrass->RenderEntities(secondaryFrameInfo, registry, bindlessTexture, bindlessImage); }));
+        tasks.push_back(CreateRecordTask(m_CurrentTarget, RECORD_GRASS2, frameInfo, [&](VK_FrameInfo const& secondaryFrameInfo)
+            { m_RenderSystemGrass2->RenderEntities(secondaryFrameInfo, registry, bindlessTexture, bindlessImage); }));
+        tasks.push_back(CreateRecordTask(m_CurrentTarget, RECORD_PBR_MULTI_MATERIAL, frameInfo, [&](VK_FrameInfo const& secondaryFrameInfo)
+            { m_RenderSystemPbrMultiMaterial->RenderEntities(secondaryFrameInfo, registry, bindlessTexture, bindlessImage); }));
+        // clang-format on
+
+        m_ParallelRecorder->Record(tasks, m_SecondaryCommandBuffers);
+        VK_ParallelRecorder::Execute(m_CurrentCommandBuffer, m_SecondaryCommandBuffers.data(),
+                                     static_cast<uint>(m_SecondaryCommandBuffers.size()));
     }
 
     void VK_Renderer::Submit(Scene& scene)
     {
         CHECK_VALID_CMD_BUFFER();
 
-        auto& registry = scene.GetRegistry();
-
         // 3D objects
-        m_RenderSystemPbr->RenderEntities(m_FrameInfo, registry, m_BindlessTexture.get(), m_BindlessImage.get());
-        m_RenderSystemPbrSA->RenderEntities(m_FrameInfo, registry, m_BindlessTexture.get(), m_BindlessImage.get());
-        m_RenderSystemGrass->RenderEntities(m_FrameInfo, registry, m_BindlessTexture.get(), m_BindlessImage.get());
-        m_RenderSystemGrass2->RenderEntities(m_FrameInfo, registry, m_BindlessTexture.get(), m_BindlessImage.get());
-        m_RenderSystemPbrMultiMaterial->RenderEntities(m_FrameInfo, registry, m_BindlessTexture.get(),
-                                                       m_BindlessImage.get());
+        RecordGeometry(m_FrameInfo, scene.GetRegistry());
     }
 
     void VK_Renderer::SubmitWater(Scene& scene, bool reflection)
     {
         CHECK_VALID_CMD_BUFFER();
 
-        auto& registry = scene.GetRegistry();
         auto renderpassIndex = reflection ? WaterPasses::REFLECTION : WaterPasses::REFRACTION;
 
         // 3D objects
-        m_RenderSystemPbr->RenderEntities(m_FrameInfoWater[renderpassIndex], registry, m_BindlessTexture.get(),
-                                          m_BindlessImage.get());
-        m_RenderSystemPbrSA->RenderEntities(m_FrameInfoWater[renderpassIndex], registry, m_BindlessTexture.get(),
-                                            m_BindlessImage.get());
-        m_RenderSystemGrass->RenderEntities(m_FrameInfoWater[renderpassIndex], registry, m_BindlessTexture.get(),
-                                            m_BindlessImage.get());
-        m_RenderSystemGrass2->RenderEntities(m_FrameInfoWater[renderpassIndex], registry, m_BindlessTexture.get(),
-                                             m_BindlessImage.get());
-        m_RenderSystemPbrMultiMaterial->RenderEntities(m_FrameInfoWater[renderpassIndex], registry, m_BindlessTexture.get(),
-                                                       m_BindlessImage.get());
+        RecordGeometry(m_FrameInfoWater[renderpassIndex], scene.GetRegistry());
     }
 
     void VK_Renderer::LightingPass()
@@ -1161,7 +1432,7 @@ namespace GfxRenderEngine
         m_RenderSystemDeferredShading->LightingPassIBL(m_FrameInfo, uMaxPrefilterMip, resourceDescriptorIBL);
     }
 
-    void VK_Renderer::TransparencyPass(Registry& registry, ParticleSystem* particleSystem)
+    void VK_Renderer::TransparencyPass(Registry& registry, std::vector<ParticleSystem*> const& particleSystems)
     {
         CHECK_VALID_CMD_BUFFER();
 
@@ -1170,9 +1441,13 @@ namespace GfxRenderEngine
         m_RenderSystemCubemap->RenderEntities(m_FrameInfo, registry);
         m_RenderSystemSkyboxHDRI->RenderEntities(m_FrameInfo, registry);
         m_RenderSystemSpriteRenderer->RenderEntities(m_FrameInfo, registry);
-        if (particleSystem)
+        // one instanced draw call per particle system
+        for (auto particleSystem : particleSystems)
         {
-            m_RenderSystemSpriteRenderer->DrawParticles(m_FrameInfo, particleSystem);
+            if (particleSystem)
+            {
+                m_RenderSystemSpriteRenderer->DrawParticles(m_FrameInfo, particleSystem);
+            }
         }
         m_LightSystem->Render(m_FrameInfo, registry);
         m_RenderSystemDebug->RenderEntities(m_FrameInfo, m_ShowDebugShadowMap);
@@ -1214,6 +1489,9 @@ namespace GfxRenderEngine
             std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
             vkCmdNextSubpass(m_CurrentCommandBuffer, VK_SUBPASS_CONTENTS_INLINE);
         }
+        // the dynamic state is undefined after executing the secondary command buffers of the geometry subpass
+        vkCmdSetViewport(m_CurrentCommandBuffer, 0, 1, &m_CurrentTarget.m_Viewport);
+        vkCmdSetScissor(m_CurrentCommandBuffer, 0, 1, &m_CurrentTarget.m_Scissor);
     }
 
     void VK_Renderer::GUIRenderpass(Camera* camera)
@@ -1231,6 +1509,7 @@ namespace GfxRenderEngine
     {
         CHECK_VALID_CMD_BUFFER();
 
+        m_RenderSystemGUIRenderer->Flush(m_FrameInfo); // keep the draw order of the GUI render pass
         m_RenderSystemSpriteRenderer2D->RenderEntities(m_FrameInfo, registry, camera);
     }
 
@@ -1238,6 +1517,8 @@ namespace GfxRenderEngine
     {
         CHECK_VALID_CMD_BUFFER();
 
+        m_RenderSystemGUIRenderer->Flush(m_FrameInfo);
+
         // built-in editor GUI runs last
         m_Imgui->NewFrame();
         m_Imgui->Run();
@@ -1255,14 +1536,28 @@ namespace GfxRenderEngine
 
     void VK_Renderer::UpdateAnimations(Registry& registry, const Timestep& timestep)
     {
-        auto view = registry.view<MeshComponent, TransformComponent, SkeletalAnimationTag>();
-        for (auto entity : view)
+        ZoneScopedN("VK_Renderer::UpdateAnimations()");
+        auto& jointMatricesBuffer = m_JointMatricesBuffers[m_CurrentFrameIndex];
+        auto allocateJointMatrices = [&](uint numberOfJoints)
         {
-            auto& mesh = view.get<MeshComponent>(entity);
-            if (mesh.m_Enabled)
+            uint bufferSize = numberOfJoints * sizeof(glm::mat4); // in bytes
+            if (!jointMatricesBuffer || (jointMatricesBuffer->GetBufferSize() < bufferSize))
             {
-                static_cast<VK_Model*>(mesh.m_Model.get())->UpdateAnimation(timestep, m_FrameCounter);
+                // BeginFrame() waited for the fence of this frame, the GPU no longer reads the old buffer
+                jointMatricesBuffer =
+                    std::make_unique<VK_Buffer>(bufferSize, Buffer::BufferUsage::STORAGE_BUFFER_VISIBLE_TO_CPU);
+                jointMatricesBuffer->Map();
             }
+            return static_cast<glm::mat4*>(jointMatricesBuffer->GetMappedMemory());
+        };
+        FrameUpdate::UpdateAnimations(registry, timestep, m_FrameCounter, allocateJointMatrices);
+
+        if (jointMatricesBuffer)
+        {
+            jointMatricesBuffer->Flush();
+            Buffer::BufferDeviceAddress jointMatrices = jointMatricesBuffer->GetBufferDeviceAddress();
+            m_RenderSystemPbrSA->SetJointMatrices(jointMatrices);
+            m_RenderSystemShadowAnimatedInstanced->SetJointMatrices(jointMatrices);
         }
     }
 
@@ -1279,12 +1574,12 @@ namespace GfxRenderEngine
             // 2D
             "spriteRenderer.vert",
             "spriteRenderer.frag",
+            "spriteRendererInstanced.vert",
+            "spriteRendererInstanced.frag",
             "spriteRenderer2D.frag",
             "spriteRenderer2D.vert",
-            "guiShader.frag",
-            "guiShader.vert",
-            "guiShader2.frag",
-            "guiShader2.vert",
+            "guiBatch.frag",
+            "guiBatch.vert",
             // 3D
             "pointLight.vert",
             "pointLight.frag",
@@ -1332,12 +1627,18 @@ namespace GfxRenderEngine
                 ZoneTransientN(variableName, std::string(std::to_string(futureCounter)).c_str(), true);
                 bool isOk = true;
                 std::string spirvFilename = std::string("bin-int/") + filename + std::string(".spv");
-                if (!EngineCore::FileExists(spirvFilename))
+                std::string name = std::string("engine/platform/Vulkan/shaders/") + filename;
+                // the shader cache recompiles only if the source or its includes changed,
+                // without sources, pre-built SPIR-V files are used as is
+                if (EngineCore::FileExists(name))
                 {
-                    std::string name = std::string("engine/platform/Vulkan/shaders/") + filename;
                     VK_Shader shader{name, spirvFilename};
                     isOk = shader.IsOk();
                 }
+                else
+                {
+                    isOk = EngineCore::FileExists(spirvFilename);
+                }
                 return isOk;
             };
             futures[futureCounter] = threadPool.SubmitTask(compileThread);
@@ -1345,7 +1646,7 @@ namespace GfxRenderEngine
         }
         for (auto& future : futures)
         {
-            future.get();
+            threadPool.GetResult(future);
         }
         m_ShadersCompiled = true;
     }
@@ -1354,7 +1655,7 @@ namespace GfxRenderEngine
     {
         if (m_CurrentCommandBuffer)
         {
-            m_RenderSystemGUIRenderer->RenderSprite(m_FrameInfo, sprite, m_GUIViewProjectionMatrix * transform);
+            m_RenderSystemGUIRenderer->RenderSprite(sprite, m_GUIViewProjectionMatrix * transform);
         }
     }
 
@@ -1362,7 +1663,7 @@ namespace GfxRenderEngine
     {
         if (m_CurrentCommandBuffer)
         {
-            m_RenderSystemGUIRenderer->RenderSprite(m_FrameInfo, sprite, position, color, textureID);
+            m_RenderSystemGUIRenderer->RenderSprite(sprite, position, color, textureID);
         }
     }
 
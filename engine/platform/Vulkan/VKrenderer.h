@@ -22,12 +22,14 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <vector>
 #include <vulkan/vulkan.h>
 
 #include "engine.h"
 #include "renderer/renderer.h"
+#include "renderer/renderGraph.h"
 #include "renderer/materialDescriptor.h"
 #include "renderer/resourceDescriptor.h"
 #include "platform/Vulkan/imguiEngine/imgui.h"
@@ -58,9 +60,11 @@
 #include "VKswapChain.h"
 #include "VKrenderPass.h"
 #include "VKshadowMap.h"
+#include "VKtransientImages.h"
 #include "VKdescriptor.h"
 #include "VKtexture.h"
 #include "VKbuffer.h"
+#include "VKparallelRecorder.h"
 #include "bindless/VKbindlessImage.h"
 #include "bindless/VKbindlessBuffer.h"
 #include "bindless/VKbindlessTexture.h"
@@ -113,12 +117,20 @@ namespace GfxRenderEngine
                                      std::shared_ptr<ResourceDescriptor> const& resourceDescriptorIBL) override;
         virtual void LightingPassWater(bool reflection) override;
         virtual void PostProcessingRenderpass() override;
-        virtual void TransparencyPass(Registry& registry, ParticleSystem* particleSystem) override;
+        virtual void TransparencyPass(Registry& registry, std::vector<ParticleSystem*> const& particleSystems) override;
         virtual void TransparencyPassWater(Registry& registry, bool reflection) override;
         virtual void Submit2D(Camera* camera, Registry& registry) override;
         virtual void GUIRenderpass(Camera* camera) override;
         virtual void EndScene() override;
         virtual uint GetFrameCounter() override { return m_FrameCounter; }
+        virtual FrustumCuller::Statistics const& GetCullingStatistics(FrustumCuller::Pass pass) const override
+        {
+            return m_FrustumCuller.GetStatistics(pass);
+        }
+        virtual std::vector<RecordTime> const& GetRecordTimes() const override
+        {
+            return m_ParallelRecorder->GetRecordTimes();
+        }
         virtual void SetAmbientLightIntensity(float ambientLightIntensity) override
         {
             m_AmbientLightIntensity = ambientLightIntensity;
@@ -128,8 +140,7 @@ namespace GfxRenderEngine
         virtual void Draw(const Sprite& sprite, const glm::mat4& position, const glm::vec4& color,
                           const float textureID = 1.0f) override;
         virtual void ShowDebugShadowMap(bool showDebugShadowMap) override { m_ShowDebugShadowMap = showDebugShadowMap; }
-        virtual void UpdateTransformCache(Scene& scene, uint const nodeIndex, glm::mat4 const& parentMat4,
-                                          bool parentDirtyFlag) override;
+        virtual void UpdateTransformCache(Scene& scene) override;
         virtual void UpdateAnimations(Registry& registry, const Timestep& timestep) override;
         virtual float& Exposure() override { return m_RenderSystemDeferredShading->Exposure(); }
         virtual std::bitset<32>& ShaderSettings0() override { return m_RenderSystemDeferredShading->ShaderSettings0(); }
@@ -147,6 +158,20 @@ namespace GfxRenderEngine
         std::shared_ptr<Texture> gTextureFontAtlas;
         std::shared_ptr<Buffer> gDummyBuffer;
 
+    private:
+        // render systems recorded into secondary command buffers, see VK_ParallelRecorder
+        enum RecordedSystems
+        {
+            RECORD_PBR = 0,
+            RECORD_PBR_SA,
+            RECORD_GRASS,
+            RECORD_GRASS2,
+            RECORD_PBR_MULTI_MATERIAL,
+            RECORD_SHADOW,
+            RECORD_SHADOW_ANIMATED,
+            NUMBER_OF_RECORDED_SYSTEMS
+        };
+
     private:
         void CreateCommandBuffers();
         void FreeCommandBuffers();
@@ -160,7 +185,17 @@ namespace GfxRenderEngine
         void CreateDescriptorSetRefractionReflection();
         void CreatePostProcessingDescriptorSets();
         void CreateRenderSystemBloom();
+        void CreateInParallel(std::vector<std::function<void()>> const& tasks);
         void Recreate();
+        VK_ParallelRecorder::Target GetShadowTarget(uint shadowMap) const;
+        VK_ParallelRecorder::Target GetWaterTarget(WaterPasses pass) const;
+        VK_ParallelRecorder::Target Get3DTarget() const;
+        void PrepareParallelRecording(Registry& registry);
+        VK_ParallelRecorder::Task CreateRecordTask(VK_ParallelRecorder::Target const& target, uint system,
+                                                   VK_FrameInfo const& frameInfo,
+                                                   std::function<void(VK_FrameInfo const&)>&& record) const;
+        void RecordGeometry(VK_FrameInfo const& frameInfo, Registry& registry);
+        void CompileFrameGraph(VkExtent2D waterExtent);
 
     private:
         bool m_ShadersCompiled;
@@ -201,6 +236,14 @@ namespace GfxRenderEngine
 
         std::vector<VkCommandBuffer> m_CommandBuffers;
         VkCommandBuffer m_CurrentCommandBuffer{nullptr};
+        std::unique_ptr<VK_ParallelRecorder> m_ParallelRecorder;
+        std::vector<VkCommandBuffer> m_SecondaryCommandBuffers;
+        // render pass and subpass in progress, its first subpass is recorded into secondary command buffers
+        VK_ParallelRecorder::Target m_CurrentTarget{};
+        // reads and writes of the passes of a frame, compiled when the render passes are (re)created
+        RenderGraph m_FrameGraph;
+        // memory of the render pass attachments as placed by the frame graph, shared with the render passes
+        std::shared_ptr<VK_TransientImages> m_TransientImages;
         std::unique_ptr<VK_DescriptorSetLayout> m_GlobalDescriptorSetLayout;
 
         uint m_CurrentImageIndex{0};
@@ -208,6 +251,7 @@ namespace GfxRenderEngine
         uint m_FrameCounter;
         bool m_FrameInProgress;
         VK_FrameInfo m_FrameInfo{};
+        FrustumCuller m_FrustumCuller;
 
         // bindless
         std::unique_ptr<VK_BindlessTexture> m_BindlessTexture;
@@ -233,6 +277,8 @@ namespace GfxRenderEngine
         std::array<std::unique_ptr<VK_Buffer>, VK_SwapChain::MAX_FRAMES_IN_FLIGHT> m_UniformBuffers;
         std::array<std::unique_ptr<VK_Buffer>, VK_SwapChain::MAX_FRAMES_IN_FLIGHT> m_ShadowUniformBuffers0;
         std::array<std::unique_ptr<VK_Buffer>, VK_SwapChain::MAX_FRAMES_IN_FLIGHT> m_ShadowUniformBuffers1;
+        // final joint matrices of all animated skeletons, see FrameUpdate::UpdateAnimations()
+        std::array<std::unique_ptr<VK_Buffer>, VK_SwapChain::MAX_FRAMES_IN_FLIGHT> m_JointMatricesBuffers;
         std::array<VkDescriptorSet, VK_SwapChain::MAX_FRAMES_IN_FLIGHT> m_ShadowMapDescriptorSets;
         std::array<VkDescriptorSet, VK_SwapChain::MAX_FRAMES_IN_FLIGHT> m_LightingDescriptorSets;
         std::array<VkDescriptorSet, VK_SwapChain::MAX_FRAMES_IN_FLIGHT> m_PostProcessingDescriptorSets;
@@ -37,7 +37,6 @@ namespace GfxRenderEngine
         auto gDummyBuffer = renderer->gDummyBuffer;
 
         auto& instBuffer = buffers[Resources::INSTANCE_BUFFER_INDEX];
-        auto& skelBuffer = buffers[Resources::SKELETAL_ANIMATION_BUFFER_INDEX];
         auto& hBuffer = buffers[Resources::HEIGHTMAP];
         auto& mPurposeBuffer = buffers[Resources::MULTI_PURPOSE_BUFFER];
 
@@ -46,10 +45,8 @@ namespace GfxRenderEngine
         VK_Buffer* instanceBuffer = static_cast<VK_Buffer*>(instanceUbo.get());
         VkDescriptorBufferInfo instanceBufferInfo = instanceBuffer->DescriptorInfo();
 
-        // joint/bone matrices
-        std::shared_ptr<Buffer>& skeletalAnimationUbo = skelBuffer ? skelBuffer : gDummyBuffer;
-        VK_Buffer* skeletalAnimationBuffer = static_cast<VK_Buffer*>(skeletalAnimationUbo.get());
-        VkDescriptorBufferInfo skeletalAnimationBufferInfo = skeletalAnimationBuffer->DescriptorInfo();
+        // unused binding of the grass shader
+        VkDescriptorBufferInfo dummyBufferInfo = static_cast<VK_Buffer*>(gDummyBuffer.get())->DescriptorInfo();
 
         // height map
         std::shared_ptr<Buffer>& heightmapUbo = hBuffer ? hBuffer : gDummyBuffer;
@@ -67,10 +64,6 @@ namespace GfxRenderEngine
             {
                 resourceType = ResourceDescriptor::ResourceType::RtGrass;
             }
-            else if (buffers[Resources::SKELETAL_ANIMATION_BUFFER_INDEX])
-            {
-                resourceType = ResourceDescriptor::ResourceType::RtInstanceSA;
-            }
             else if (buffers[Resources::INSTANCE_BUFFER_INDEX])
             {
                 resourceType = ResourceDescriptor::ResourceType::RtInstance;
@@ -81,16 +74,13 @@ namespace GfxRenderEngine
                 CORE_HARD_STOP("resource type was not found");
             }
             VK_DescriptorWriter descriptorWriter(GetResourceDescriptorSetLayout(resourceType));
-            if (instBuffer || skelBuffer || hBuffer || mPurposeBuffer)
+            if (instBuffer || hBuffer || mPurposeBuffer)
             {
                 descriptorWriter.WriteBuffer(0, instanceBufferInfo);
             }
-            if (skelBuffer || hBuffer || mPurposeBuffer)
-            {
-                descriptorWriter.WriteBuffer(1, skeletalAnimationBufferInfo);
-            }
             if (hBuffer || mPurposeBuffer)
             {
+                descriptorWriter.WriteBuffer(1, dummyBufferInfo);
                 descriptorWriter.WriteBuffer(2, heightmapBufferInfo);
             }
             if (mPurposeBuffer)
@@ -20,11 +20,18 @@
    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
+#include <algorithm>
 #include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
 #include <shaderc/shaderc.hpp>
 
+#include "yaml-cpp/yaml.h"
+
 #include "engine.h"
 #include "auxiliary/file.h"
+#include "auxiliary/hash.h"
 
 #include "VKshader.h"
 
@@ -39,10 +46,96 @@ namespace GfxRenderEngine
         static std::string ReadFile(const std::string& filepath);
     };
 
+    namespace
+    {
+        struct ShaderReflection
+        {
+            std::string m_EntryPoint;
+            std::vector<std::pair<uint, uint>> m_DescriptorBindings; // descriptor set, binding
+            bool m_PushConstants{false};
+        };
+
+        // minimal SPIR-V parser for the entry point, descriptor set/binding decorations, and push constant blocks
+        ShaderReflection Reflect(std::vector<uint> const& spirv)
+        {
+            constexpr uint SPIRV_MAGIC_NUMBER = 0x07230203;
+            constexpr size_t HEADER_SIZE = 5; // words
+            constexpr uint OP_ENTRY_POINT = 15;
+            constexpr uint OP_VARIABLE = 59;
+            constexpr uint OP_DECORATE = 71;
+            constexpr uint DECORATION_BINDING = 33;
+            constexpr uint DECORATION_DESCRIPTOR_SET = 34;
+            constexpr uint STORAGE_CLASS_PUSH_CONSTANT = 9;
+
+            ShaderReflection reflection;
+            if ((spirv.size() < HEADER_SIZE) || (spirv[0] != SPIRV_MAGIC_NUMBER))
+            {
+                return reflection;
+            }
+
+            std::map<uint, uint> descriptorSets; // result id -> descriptor set
+            std::map<uint, uint> bindings;       // result id -> binding
+            size_t index = HEADER_SIZE;
+            while (index < spirv.size())
+            {
+                uint opcode = spirv[index] & 0xffff;
+                uint wordCount = spirv[index] >> 16;
+                if (!wordCount || ((index + wordCount) > spirv.size()))
+                {
+                    break;
+                }
+                uint const* operands = &spirv[index + 1];
+                switch (opcode)
+                {
+                    case OP_ENTRY_POINT: // execution model, function id, name
+                    {
+                        if (wordCount > 3)
+                        {
+                            reflection.m_EntryPoint = reinterpret_cast<char const*>(&operands[2]);
+                        }
+                        break;
+                    }
+                    case OP_DECORATE: // target id, decoration, literal
+                    {
+                        if ((wordCount > 3) && (operands[1] == DECORATION_BINDING))
+                        {
+                            bindings[operands[0]] = operands[2];
+                        }
+                        else if ((wordCount > 3) && (operands[1] == DECORATION_DESCRIPTOR_SET))
+                        {
+                            descriptorSets[operands[0]] = operands[2];
+                        }
+                        break;
+                    }
+                    case OP_VARIABLE: // result type, result id, storage class
+                    {
+                        if ((wordCount > 3) && (operands[2] == STORAGE_CLASS_PUSH_CONSTANT))
+                        {
+                            reflection.m_PushConstants = true;
+                        }
+                        break;
+                    }
+                    default:
+                        break;
+                }
+                index += wordCount;
+            }
+
+            for (auto const& [id, binding] : bindings)
+            {
+                auto iterator = descriptorSets.find(id);
+                uint descriptorSet = (iterator != descriptorSets.end()) ? iterator->second : 0;
+                reflection.m_DescriptorBindings.push_back({descriptorSet, binding});
+            }
+            std::sort(reflection.m_DescriptorBindings.begin(), reflection.m_DescriptorBindings.end());
+            return reflection;
+        }
+    } // namespace
+
     VK_Shader::VK_Shader(const std::string& sourceFilepath, const std::string& spirvFilepath, bool optimize)
-        : m_SourceFilepath(sourceFilepath), m_SpirvFilepath(spirvFilepath), m_Optimize(optimize)
+        : m_Optimize(optimize), m_SourceFilepath(sourceFilepath), m_SpirvFilepath(spirvFilepath),
+          m_MetadataFilepath(spirvFilepath + std::string(".meta")), m_Ok(false), m_Cached(false)
     {
-        LOG_CORE_INFO("compiling {0}", sourceFilepath);
         ReadFile();
         Compile();
     }
@@ -116,6 +209,25 @@ namespace GfxRenderEngine
             return;
         }
 
+        // cache key: the preprocessed source contains all includes
+        std::string compileOptions = std::string("vulkan1.2 ") + (m_Optimize ? "performance " : "zero ") + extension;
+        std::string cacheKey;
+        {
+            std::string_view preprocessedSource(precompileResult.cbegin(),
+                                                static_cast<size_t>(precompileResult.cend() - precompileResult.cbegin()));
+            std::stringstream stream;
+            stream << std::hex << std::setw(16) << std::setfill('0')
+                   << HashFNV1a(compileOptions, HashFNV1a(preprocessedSource));
+            cacheKey = stream.str();
+        }
+        if (IsUpToDate(cacheKey))
+        {
+            m_Ok = true;
+            m_Cached = true;
+            return;
+        }
+        LOG_CORE_INFO("compiling {0}", m_SourceFilepath);
+
         // compile
         // shaderc::SpvCompilationResult compileResult
         auto compileResult = compiler.CompileGlslToSpv(m_SourceCode, shaderType, m_SourceFilepath.c_str(), options);
@@ -133,6 +245,59 @@ namespace GfxRenderEngine
             outputFile.write((char*)buffer.data(), buffer.size() * sizeof(uint));
             outputFile.flush();
             m_Ok = true;
+
+            // written last, an interrupted compile leaves no valid cache entry
+            WriteMetadata(cacheKey, compileOptions, buffer);
+        }
+    }
+
+    bool VK_Shader::IsUpToDate(std::string const& cacheKey) const
+    {
+        if (!EngineCore::FileExists(m_SpirvFilepath) || !EngineCore::FileExists(m_MetadataFilepath))
+        {
+            return false;
+        }
+        try
+        {
+            YAML::Node metadata = YAML::LoadFile(m_MetadataFilepath);
+            return metadata["key"] && (metadata["key"].as<std::string>() == cacheKey);
+        }
+        catch (YAML::Exception const& exception)
+        {
+            LOG_CORE_WARN("VK_Shader: ignoring cache entry '{0}', {1}", m_MetadataFilepath, exception.what());
+            return false;
+        }
+    }
+
+    void VK_Shader::WriteMetadata(std::string const& cacheKey, std::string const& compileOptions,
+                                  std::vector<uint> const& spirv) const
+    {
+        ShaderReflection reflection = Reflect(spirv);
+
+        YAML::Emitter out;
+        out << YAML::BeginMap;
+        out << YAML::Key << "source" << YAML::Value << m_SourceFilepath;
+        out << YAML::Key << "key" << YAML::Value << cacheKey;
+        out << YAML::Key << "options" << YAML::Value << compileOptions;
+        out << YAML::Key << "spirvSize" << YAML::Value << spirv.size() * sizeof(uint);
+        out << YAML::Key << "entryPoint" << YAML::Value << reflection.m_EntryPoint;
+        out << YAML::Key << "pushConstants" << YAML::Value << reflection.m_PushConstants;
+        out << YAML::Key << "descriptorBindings" << YAML::Value << YAML::BeginSeq;
+        for (auto const& [descriptorSet, binding] : reflection.m_DescriptorBindings)
+        {
+            out << YAML::Flow << YAML::BeginSeq << descriptorSet << binding << YAML::EndSeq;
+        }
+        out << YAML::EndSeq;
+        out << YAML::EndMap;
+
+        std::ofstream metadataFile(m_MetadataFilepath, std::ios::out);
+        if (metadataFile.is_open())
+        {
+            metadataFile << out.c_str() << std::endl;
+        }
+        else
+        {
+            LOG_CORE_WARN("VK_Shader: could not write '{0}'", m_MetadataFilepath);
         }
     }
 
@@ -23,9 +23,16 @@
 #pragma once
 
 #include <string>
+#include <vector>
+
+#include "engine.h"
 
 namespace GfxRenderEngine
 {
+    // Compiles GLSL to SPIR-V through a content-addressed cache:
+    // the cache key hashes the preprocessed source (including all #include files) and the compile options.
+    // It is stored with reflection data next to the SPIR-V file in <spirv>.meta,
+    // the shader is only recompiled if the key changed or one of the files is missing.
     class VK_Shader
     {
     public:
@@ -33,16 +40,21 @@ namespace GfxRenderEngine
         ~VK_Shader() {}
 
         bool IsOk() const { return m_Ok; }
+        bool IsCached() const { return m_Cached; }
 
     private:
         void ReadFile();
         void Compile();
+        bool IsUpToDate(std::string const& cacheKey) const;
+        void WriteMetadata(std::string const& cacheKey, std::string const& options, std::vector<uint> const& spirv) const;
 
     private:
         bool m_Optimize;
         std::string m_SourceFilepath;
         std::string m_SpirvFilepath;
+        std::string m_MetadataFilepath;
         std::string m_SourceCode;
         bool m_Ok;
+        bool m_Cached;
     };
 } // namespace GfxRenderEngine
@@ -47,7 +47,7 @@ namespace GfxRenderEngine
         std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
         vkDestroyImageView(m_Device->Device(), m_ShadowDepthImageView, nullptr);
         vkDestroyImage(m_Device->Device(), m_ShadowDepthImage, nullptr);
-        vkFreeMemory(m_Device->Device(), m_ShadowDepthImageMemory, nullptr);
+        m_Device->FreeMemory(m_ShadowDepthImageMemory);
         vkDestroySampler(m_Device->Device(), m_ShadowDepthSampler, nullptr);
         vkDestroyRenderPass(m_Device->Device(), m_ShadowRenderPass, nullptr);
         vkDestroyFramebuffer(m_Device->Device(), m_ShadowFramebuffer, nullptr);
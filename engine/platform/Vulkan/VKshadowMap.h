@@ -74,7 +74,7 @@ namespace GfxRenderEngine
         VkImage m_ShadowDepthImage{nullptr};
         VkImageLayout m_ImageLayout{};
         VkImageView m_ShadowDepthImageView{nullptr};
-        VkDeviceMemory m_ShadowDepthImageMemory{nullptr};
+        VK_Allocation m_ShadowDepthImageMemory{};
         VkSampler m_ShadowDepthSampler{nullptr};
 
         VkDescriptorImageInfo m_DescriptorImageInfo{};
@@ -67,37 +67,11 @@ namespace GfxRenderEngine
         imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
         imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
+        // create image, allocate and bind memory
+        VK_Core::m_Device->CreateImageWithInfo(imageInfo, properties, m_StorageImage, m_StorageImageMemory);
+        if (!m_StorageImageMemory.IsValid())
         {
-            auto result = vkCreateImage(device, &imageInfo, nullptr, &m_StorageImage);
-            if (result != VK_SUCCESS)
-            {
-                VK_Core::m_Device->PrintError(result);
-                LOG_CORE_CRITICAL("failed to create image!");
-                return false;
-            }
-        }
-
-        // allocate and bind memory
-        VkMemoryRequirements memReq;
-        vkGetImageMemoryRequirements(device, m_StorageImage, &memReq);
-
-        VkMemoryAllocateInfo allocInfo{};
-        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocInfo.allocationSize = memReq.size;
-        allocInfo.memoryTypeIndex = VK_Core::m_Device->FindMemoryType(memReq.memoryTypeBits, properties);
-        {
-            auto result = vkAllocateMemory(device, &allocInfo, nullptr, &m_StorageImageMemory);
-            if (result != VK_SUCCESS)
-            {
-                VK_Core::m_Device->PrintError(result);
-                LOG_CORE_CRITICAL("failed to allocate memory!");
-                return false;
-            }
-        }
-
-        {
-            std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-            vkBindImageMemory(device, m_StorageImage, m_StorageImageMemory, 0);
+            return false;
         }
 
         // create image view
@@ -161,14 +135,13 @@ namespace GfxRenderEngine
 
         std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
         vkDestroyImageView(device, m_StorageImageView, nullptr);
-        vkFreeMemory(device, m_StorageImageMemory, nullptr);
         vkDestroyImage(device, m_StorageImage, nullptr);
+        VK_Core::m_Device->FreeMemory(m_StorageImageMemory);
 
         m_StorageImageFormat = VK_FORMAT_UNDEFINED;
         m_StorageImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
         m_StorageImage = nullptr;
         m_StorageImageView = nullptr;
-        m_StorageImageMemory = nullptr;
     }
 
     void VK_StorageImage::Resize(uint width, uint height)
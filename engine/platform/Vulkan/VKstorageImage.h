@@ -56,7 +56,7 @@ namespace GfxRenderEngine
         VkFormat m_StorageImageFormat{VkFormat::VK_FORMAT_UNDEFINED};
         VkImageLayout m_StorageImageLayout{VkImageLayout::VK_IMAGE_LAYOUT_UNDEFINED};
         VkImage m_StorageImage{nullptr};
-        VkDeviceMemory m_StorageImageMemory{nullptr};
+        VK_Allocation m_StorageImageMemory{};
         VkImageView m_StorageImageView{nullptr};
 
         VkDescriptorImageInfo m_DescriptorImageInfo{};
@@ -106,15 +106,35 @@ namespace GfxRenderEngine
         }
         m_ImagesInFlight[imageIndex] = m_InFlightFences[m_CurrentFrame];
 
+        // resources used by this frame may still have uploads in an open batch
+        VK_Uploader* uploader = m_Device->GetUploader();
+        uploader->FlushAll();
+        uint64 transferWaitValue = 0;
+        VkSemaphore transferSemaphore = uploader->GetTransferSemaphore(transferWaitValue);
+
         VkSubmitInfo submitInfo = {};
         submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 
-        VkSemaphore waitSemaphores[] = {m_ImageAvailableSemaphores[m_CurrentFrame]};
-        VkPipelineStageFlags waitStages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
-        submitInfo.waitSemaphoreCount = 1;
+        // the binary image-available semaphore ignores its wait value
+        VkSemaphore waitSemaphores[] = {m_ImageAvailableSemaphores[m_CurrentFrame], transferSemaphore};
+        uint64 waitValues[] = {0, transferWaitValue};
+        VkPipelineStageFlags waitStages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                                             VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT |
+                                                 VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
+                                                 VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT};
+        submitInfo.waitSemaphoreCount = transferSemaphore ? 2 : 1;
         submitInfo.pWaitSemaphores = waitSemaphores;
         submitInfo.pWaitDstStageMask = waitStages;
 
+        VkTimelineSemaphoreSubmitInfo timelineSemaphoreSubmitInfo{};
+        timelineSemaphoreSubmitInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        timelineSemaphoreSubmitInfo.waitSemaphoreValueCount = submitInfo.waitSemaphoreCount;
+        timelineSemaphoreSubmitInfo.pWaitSemaphoreValues = waitValues;
+        if (transferSemaphore)
+        {
+            submitInfo.pNext = &timelineSemaphoreSubmitInfo;
+        }
+
         submitInfo.commandBufferCount = 1;
         submitInfo.pCommandBuffers = buffers;
 
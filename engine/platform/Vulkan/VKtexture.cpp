@@ -24,6 +24,7 @@
 
 #include "core.h"
 #include "stb_image.h"
+#include "auxiliary/file.h"
 
 #include "VKcore.h"
 #include "VKtexture.h"
@@ -54,15 +55,14 @@ namespace GfxRenderEngine
         std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
         vkDestroySampler(device, m_Sampler, nullptr);
         vkDestroyImageView(device, m_ImageView, nullptr);
-        vkFreeMemory(device, m_TextureImageMemory, nullptr);
         vkDestroyImage(device, m_TextureImage, nullptr);
+        VK_Core::m_Device->FreeMemory(m_TextureImageMemory);
 
         m_ImageFormat = VK_FORMAT_UNDEFINED;
         m_ImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
         m_TextureImage = nullptr;
         m_ImageView = nullptr;
         m_Sampler = nullptr;
-        m_TextureImageMemory = nullptr;
     }
 
     // create texture from raw memory
@@ -88,8 +88,21 @@ namespace GfxRenderEngine
     }
 
     // create texture from file on disk
+    // a cooked texture next to the file (see CookedTexture) is used instead of decoding the file,
+    // unless it was cooked from a different version of the file
     bool VK_Texture::Init(const std::string& fileName, bool sRGB, bool flip)
     {
+        if (CookedTexture::IsCookedFilename(fileName))
+        {
+            return InitCooked(fileName, sRGB, flip, 0);
+        }
+        std::string cookedFileName = CookedTexture::GetCookedFilename(fileName);
+        if (EngineCore::FileExists(cookedFileName) &&
+            InitCooked(cookedFileName, sRGB, flip, CookedTexture::HashSource(fileName)))
+        {
+            return true;
+        }
+
         bool ok = false;
         stbi_set_flip_vertically_on_load(flip);
         m_FileName = fileName;
@@ -108,9 +121,30 @@ namespace GfxRenderEngine
         return ok;
     }
 
+    // create texture from file on disk with the sampler filters of a glTF texture
+    bool VK_Texture::Init(const std::string& fileName, bool sRGB, bool flip, int minFilter, int magFilter)
+    {
+        m_MinFilter = SetFilter(minFilter);
+        m_MagFilter = SetFilter(magFilter);
+        m_MinFilterMip = SetFilterMip(minFilter);
+        return Init(fileName, sRGB, flip);
+    }
+
     // create texture from file in memory
+    // the file can be a cooked texture, e.g. an embedded resource, it must have been cooked flipped
     bool VK_Texture::Init(const unsigned char* data, int length, bool sRGB)
     {
+        if (CookedTexture::IsCooked(data, length))
+        {
+            CookedTexture cookedTexture;
+            if (!cookedTexture.Open(data, length))
+            {
+                LOG_CORE_CRITICAL("Texture: couldn't open cooked texture in memory: {0}", cookedTexture.GetError());
+                return false;
+            }
+            return InitCooked(cookedTexture, "cooked texture in memory", sRGB, true);
+        }
+
         bool ok = false;
         stbi_set_flip_vertically_on_load(true);
         m_FileName = "file in memory";
@@ -174,37 +208,12 @@ namespace GfxRenderEngine
         imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
         imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 
+        // create image, allocate and bind memory
+        VK_Core::m_Device->CreateImageWithInfo(imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_TextureImage,
+                                               m_TextureImageMemory);
+        if (!m_TextureImageMemory.IsValid())
         {
-            auto result = vkCreateImage(device, &imageInfo, nullptr, &m_TextureImage);
-            if (result != VK_SUCCESS)
-            {
-                VK_Core::m_Device->PrintError(result);
-                LOG_CORE_CRITICAL("failed to create image!");
-                return false;
-            }
-        }
-
-        // allocate and bind memory
-        VkMemoryRequirements memReq;
-        vkGetImageMemoryRequirements(device, m_TextureImage, &memReq);
-
-        VkMemoryAllocateInfo allocInfo{};
-        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocInfo.allocationSize = memReq.size;
-        allocInfo.memoryTypeIndex =
-            VK_Core::m_Device->FindMemoryType(memReq.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-        {
-            auto result = vkAllocateMemory(device, &allocInfo, nullptr, &m_TextureImageMemory);
-            if (result != VK_SUCCESS)
-            {
-                VK_Core::m_Device->PrintError(result);
-                LOG_CORE_CRITICAL("failed to allocate memory!");
-                return false;
-            }
-        }
-        {
-            std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-            vkBindImageMemory(device, m_TextureImage, m_TextureImageMemory, 0);
+            return false;
         }
 
         // copy regions
@@ -234,56 +243,25 @@ namespace GfxRenderEngine
             ++mipLevel;
         }
 
-        // create staging buffer for all mip levels
-        VkDeviceSize totalSize = 0;
-        std::vector<VkDeviceSize> levelSizes(m_MipLevels);
-        for (uint mipLevel = 0; mipLevel < m_MipLevels; ++mipLevel)
+        VK_Uploader::ImageUpload imageUpload{};
+        imageUpload.m_Image = m_TextureImage;
+        imageUpload.m_Format = VK_FORMAT_R32G32B32A32_SFLOAT;
+        imageUpload.m_Width = baseWidth;
+        imageUpload.m_Height = baseHeight;
+        imageUpload.m_MipLevels = m_MipLevels;
+        imageUpload.m_Size = offset;
+        // copy mip data straight into the staging ring
+        imageUpload.m_WriteStaging = [&](uchar* staging)
         {
-            uint mipW = std::max(1u, baseWidth >> mipLevel);
-            uint mipH = std::max(1u, baseHeight >> mipLevel);
-            levelSizes[mipLevel] = mipW * mipH * 4 * sizeof(float);
-            totalSize += levelSizes[mipLevel];
-        }
-
-        VkBuffer stagingBuffer;
-        VkDeviceMemory stagingBufferMemory;
-        CreateBuffer(totalSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                     VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingBuffer,
-                     stagingBufferMemory);
-
-        // copy mip data into staging buffer
-        void* data;
-        {
-            std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-            vkMapMemory(device, stagingBufferMemory, 0, totalSize, 0, &data);
-        }
-        uint8_t* dst = reinterpret_cast<uint8_t*>(data);
-        for (uint mipLevel = 0; mipLevel < m_MipLevels; ++mipLevel)
-        {
-            memcpy(dst, hiResImages[mipLevel].GetBuffer(), static_cast<size_t>(levelSizes[mipLevel]));
-            dst += levelSizes[mipLevel];
-        }
-        {
-            std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-            vkUnmapMemory(device, stagingBufferMemory);
-        }
-
-        // copy buffer to image
-        TransitionImageLayout(VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-        VkCommandBuffer commandBuffer = VK_Core::m_Device->BeginSingleTimeCommands();
-        {
-            std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-            vkCmdCopyBufferToImage(commandBuffer, stagingBuffer, m_TextureImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                                   static_cast<uint>(regions.size()), regions.data());
-        }
-        VK_Core::m_Device->EndSingleTimeCommands(commandBuffer);
-        TransitionImageLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-
-        {
-            std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-            vkDestroyBuffer(device, stagingBuffer, nullptr);
-            vkFreeMemory(device, stagingBufferMemory, nullptr);
-        }
+            for (uint mipLevel = 0; auto const& region : regions)
+            {
+                VkDeviceSize levelSize = region.imageExtent.width * region.imageExtent.height * m_BytesPerPixel;
+                memcpy(staging + region.bufferOffset, hiResImages[mipLevel].GetBuffer(), static_cast<size_t>(levelSize));
+                ++mipLevel;
+            }
+        };
+        imageUpload.m_Regions = regions;
+        VK_Core::m_Device->GetUploader()->UploadImage(imageUpload);
 
         // create image view
         VkImageViewCreateInfo viewInfo{};
@@ -334,61 +312,132 @@ namespace GfxRenderEngine
         return true;
     }
 
-    void VK_Texture::TransitionImageLayout(VkImageLayout oldLayout, VkImageLayout newLayout)
+    VkFormat VK_Texture::GetCookedFormat(CookedTexture::Format format, bool sRGB)
+    {
+        switch (format)
+        {
+            case CookedTexture::Format::BC1:
+                return sRGB ? VK_FORMAT_BC1_RGBA_SRGB_BLOCK : VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+            case CookedTexture::Format::BC3:
+                return sRGB ? VK_FORMAT_BC3_SRGB_BLOCK : VK_FORMAT_BC3_UNORM_BLOCK;
+            case CookedTexture::Format::BC4:
+                return VK_FORMAT_BC4_UNORM_BLOCK;
+            case CookedTexture::Format::BC5:
+                return VK_FORMAT_BC5_UNORM_BLOCK;
+            case CookedTexture::Format::BC6H:
+                return VK_FORMAT_BC6H_UFLOAT_BLOCK;
+            case CookedTexture::Format::BC7:
+                return sRGB ? VK_FORMAT_BC7_SRGB_BLOCK : VK_FORMAT_BC7_UNORM_BLOCK;
+            default:
+                return VK_FORMAT_UNDEFINED;
+        }
+    }
+
+    // create texture from a cooked file: all mip levels are copied from the mapped file to staging memory as they are
+    // returns false without creating anything if the file cannot be used, so that the caller can fall back to the source
+    bool VK_Texture::InitCooked(const std::string& cookedFileName, bool sRGB, bool flip, uint64 sourceHash)
     {
-        VkCommandBuffer commandBuffer = VK_Core::m_Device->BeginSingleTimeCommands();
-
-        VkImageMemoryBarrier barrier{};
-        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-        barrier.oldLayout = oldLayout;
-        barrier.newLayout = newLayout;
-        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier.image = m_TextureImage;
-        barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-        barrier.subresourceRange.baseMipLevel = 0;
-        barrier.subresourceRange.levelCount = m_MipLevels;
-        barrier.subresourceRange.baseArrayLayer = 0;
-        barrier.subresourceRange.layerCount = 1;
-
-        VkPipelineStageFlags sourceStage;
-        VkPipelineStageFlags destinationStage;
-
-        if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED && newLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL)
-        {
-            barrier.srcAccessMask = 0;
-            barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-
-            sourceStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-            destinationStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        ZoneScopedNC("VK_Texture::InitCooked", 0xffff00);
+        CookedTexture cookedTexture;
+        if (!cookedTexture.Open(cookedFileName))
+        {
+            LOG_CORE_WARN("Texture: couldn't open cooked texture {0}", cookedTexture.GetError());
+            return false;
         }
-        else if (oldLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
+        if (sourceHash && (cookedTexture.GetSourceHash() != sourceHash))
         {
-            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-            barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+            LOG_CORE_WARN("Texture: {0} is out of date, its source changed since it was cooked, ignoring it",
+                          cookedFileName);
+            return false;
+        }
+        return InitCooked(cookedTexture, cookedFileName, sRGB, flip);
+    }
 
-            sourceStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-            destinationStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+    // cooked texture with the sampler filters of a glTF texture
+    bool VK_Texture::InitCooked(const std::string& cookedFileName, bool sRGB, bool flip, uint64 sourceHash, int minFilter,
+                                int magFilter)
+    {
+        m_MinFilter = SetFilter(minFilter);
+        m_MagFilter = SetFilter(magFilter);
+        m_MinFilterMip = SetFilterMip(minFilter);
+        return InitCooked(cookedFileName, sRGB, flip, sourceHash);
+    }
+
+    bool VK_Texture::InitCooked(CookedTexture const& cookedTexture, const std::string& name, bool sRGB, bool flip)
+    {
+        bool cookedFlipped = cookedTexture.GetFlags() & CookedTexture::FLAG_FLIPPED;
+        if (cookedFlipped != flip)
+        {
+            LOG_CORE_WARN("Texture: {0} was cooked {1}, ignoring it", name, cookedFlipped ? "flipped" : "not flipped");
+            return false;
         }
-        else
+        CookedTexture::Format cookedFormat = cookedTexture.GetFormat();
+        if (CookedTexture::IsBlockCompressed(cookedFormat) && !VK_Core::m_Device->SupportsTextureCompressionBC())
         {
-            LOG_APP_CRITICAL("unsupported layout transition!");
-            return;
+            LOG_CORE_WARN("Texture: no BC texture support on this device, ignoring {0}", name);
+            return false;
         }
 
+        m_FileName = name;
+        m_sRGB = sRGB;
+        m_Width = static_cast<int>(cookedTexture.GetWidth());
+        m_Height = static_cast<int>(cookedTexture.GetHeight());
+        m_BytesPerPixel = 4;
+        CreateImage(GetCookedFormat(cookedFormat, sRGB), VK_IMAGE_TILING_OPTIMAL,
+                    VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                    cookedTexture.GetLevelCount());
+        if (!m_TextureImageMemory.IsValid())
         {
-            std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-            vkCmdPipelineBarrier(commandBuffer, sourceStage, destinationStage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+            return false;
         }
 
-        VK_Core::m_Device->EndSingleTimeCommands(commandBuffer);
+        std::vector<VkBufferImageCopy> regions(m_MipLevels);
+        VkDeviceSize offset = 0;
+        for (uint mipLevel = 0; auto& region : regions)
+        {
+            CookedTexture::Level const& level = cookedTexture.GetLevel(mipLevel);
+            region.bufferOffset = offset;
+            region.bufferRowLength = 0;
+            region.bufferImageHeight = 0;
+            region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            region.imageSubresource.mipLevel = mipLevel;
+            region.imageSubresource.baseArrayLayer = 0;
+            region.imageSubresource.layerCount = 1;
+            region.imageOffset = {0, 0, 0};
+            region.imageExtent = {level.m_Width, level.m_Height, 1};
+
+            // copy offsets of compressed data must be a multiple of the block size
+            offset += (level.m_Size + 15) & ~VkDeviceSize(15);
+            ++mipLevel;
+        }
+
+        VK_Uploader::ImageUpload imageUpload{};
+        imageUpload.m_Image = m_TextureImage;
+        imageUpload.m_Format = m_ImageFormat;
+        imageUpload.m_Width = static_cast<uint>(m_Width);
+        imageUpload.m_Height = static_cast<uint>(m_Height);
+        imageUpload.m_MipLevels = m_MipLevels;
+        imageUpload.m_Size = offset;
+        // the only copy on the CPU: from the page cache straight into the staging ring
+        imageUpload.m_WriteStaging = [&](uchar* staging)
+        {
+            for (uint mipLevel = 0; auto const& region : regions)
+            {
+                CookedTexture::Level const& level = cookedTexture.GetLevel(mipLevel);
+                memcpy(staging + region.bufferOffset, level.m_Data, level.m_Size);
+                ++mipLevel;
+            }
+        };
+        imageUpload.m_Regions = regions;
+        VK_Core::m_Device->GetUploader()->UploadImage(imageUpload);
+
+        return CreateSamplerAndImageView();
     }
 
     void VK_Texture::CreateImage(VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage,
                                  VkMemoryPropertyFlags properties, const uint mipLevels)
     {
         CORE_ASSERT(mipLevels, "VK_Texture::CreateImage: mipLevels must be set");
-        auto device = VK_Core::m_Device->Device();
         if (mipLevels == AUTO_MIP_LEVEL)
         {
             m_MipLevels = static_cast<uint32_t>(std::floor(std::log2(std::max(m_Width, m_Height)))) + 1;
@@ -414,78 +463,7 @@ namespace GfxRenderEngine
         imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
         imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
-        {
-            auto result = vkCreateImage(device, &imageInfo, nullptr, &m_TextureImage);
-            if (result != VK_SUCCESS)
-            {
-                VK_Core::m_Device->PrintError(result);
-                LOG_CORE_CRITICAL("failed to create image!");
-            }
-        }
-
-        VkMemoryRequirements memRequirements;
-        vkGetImageMemoryRequirements(device, m_TextureImage, &memRequirements);
-
-        VkMemoryAllocateInfo allocInfo{};
-        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocInfo.allocationSize = memRequirements.size;
-        allocInfo.memoryTypeIndex = VK_Core::m_Device->FindMemoryType(memRequirements.memoryTypeBits, properties);
-
-        {
-            auto result = vkAllocateMemory(device, &allocInfo, nullptr, &m_TextureImageMemory);
-            if (result != VK_SUCCESS)
-            {
-                VK_Core::m_Device->PrintError(result);
-                LOG_CORE_CRITICAL("failed to allocate image memory in 'void "
-                                  "VK_Texture::CreateImage'");
-            }
-        }
-        {
-            std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-            vkBindImageMemory(device, m_TextureImage, m_TextureImageMemory, 0);
-        }
-    }
-
-    void VK_Texture::CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties,
-                                  VkBuffer& buffer, VkDeviceMemory& bufferMemory)
-    {
-        auto device = VK_Core::m_Device->Device();
-
-        VkBufferCreateInfo bufferInfo{};
-        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-        bufferInfo.size = size;
-        bufferInfo.usage = usage;
-        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-
-        {
-            auto result = vkCreateBuffer(device, &bufferInfo, nullptr, &buffer);
-            if (result != VK_SUCCESS)
-            {
-                VK_Core::m_Device->PrintError(result);
-                LOG_CORE_CRITICAL("failed to create buffer!");
-            }
-        }
-
-        VkMemoryRequirements memRequirements;
-        vkGetBufferMemoryRequirements(device, buffer, &memRequirements);
-
-        VkMemoryAllocateInfo allocInfo{};
-        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocInfo.allocationSize = memRequirements.size;
-        allocInfo.memoryTypeIndex = VK_Core::m_Device->FindMemoryType(memRequirements.memoryTypeBits, properties);
-
-        {
-            auto result = vkAllocateMemory(device, &allocInfo, nullptr, &bufferMemory);
-            if (result != VK_SUCCESS)
-            {
-                VK_Core::m_Device->PrintError(result);
-                LOG_CORE_CRITICAL("failed to allocate buffer memory!");
-            }
-        }
-        {
-            std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-            vkBindBufferMemory(device, buffer, bufferMemory, 0);
-        }
+        VK_Core::m_Device->CreateImageWithInfo(imageInfo, properties, m_TextureImage, m_TextureImageMemory);
     }
 
     bool VK_Texture::Create(const uint mipLevels, const uint bytesPerChannel)
@@ -496,27 +474,8 @@ namespace GfxRenderEngine
             return false;
         }
 
-        auto device = VK_Core::m_Device->Device();
-
         VkDeviceSize imageSize = m_Width * m_Height * 4 * bytesPerChannel;
 
-        VkBuffer stagingBuffer;
-        VkDeviceMemory stagingBufferMemory;
-        CreateBuffer(imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                     VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingBuffer,
-                     stagingBufferMemory);
-
-        void* data;
-        {
-            std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-            vkMapMemory(device, stagingBufferMemory, 0, imageSize, 0, &data);
-        }
-        memcpy(data, m_LocalBuffer, static_cast<size_t>(imageSize));
-        {
-            std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-            vkUnmapMemory(device, stagingBufferMemory);
-        }
-
         VkFormat format;
         switch (bytesPerChannel)
         {
@@ -540,25 +499,28 @@ namespace GfxRenderEngine
                     VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
                     VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mipLevels);
 
-        TransitionImageLayout(VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-
-        VK_Core::m_Device->CopyBufferToImage(stagingBuffer, m_TextureImage, static_cast<uint>(m_Width),
-                                             static_cast<uint>(m_Height), 1 /*layerCount*/
-        );
-
-        if (m_MipLevels != 1)
-        {
-            GenerateMipmaps();
-        }
+        // asynchronous: the pixels are copied to the uploader's staging ring right away,
+        // copy and mip map generation run on the GPU ahead of the first frame that samples this texture
+        VK_Uploader::ImageUpload imageUpload{};
+        imageUpload.m_Image = m_TextureImage;
+        imageUpload.m_Format = m_ImageFormat;
+        imageUpload.m_Width = static_cast<uint>(m_Width);
+        imageUpload.m_Height = static_cast<uint>(m_Height);
+        imageUpload.m_MipLevels = m_MipLevels;
+        imageUpload.m_Data = m_LocalBuffer;
+        imageUpload.m_Size = imageSize;
+        imageUpload.m_GenerateMipmaps = true;
+        imageUpload.m_MipFilter = m_MinFilterMip;
+        VK_Core::m_Device->GetUploader()->UploadImage(imageUpload);
+
+        return CreateSamplerAndImageView();
+    }
 
+    bool VK_Texture::CreateSamplerAndImageView()
+    {
+        auto device = VK_Core::m_Device->Device();
         m_ImageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 
-        {
-            std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-            vkDestroyBuffer(device, stagingBuffer, nullptr);
-            vkFreeMemory(device, stagingBufferMemory, nullptr);
-        }
-
         // Create a texture sampler
         // In Vulkan, textures are accessed by samplers
         // This separates sampling information from texture data.
@@ -647,100 +609,6 @@ namespace GfxRenderEngine
         LOG_CORE_CRITICAL("not implemented void VK_Texture::Resize(uint width, uint height)");
     }
 
-    void VK_Texture::GenerateMipmaps()
-    {
-        VkFormatProperties formatProperties;
-        vkGetPhysicalDeviceFormatProperties(VK_Core::m_Device->PhysicalDevice(), m_ImageFormat, &formatProperties);
-
-        if (!(formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT))
-        {
-            LOG_CORE_WARN("texture image format does not support linear blitting!");
-            return;
-        }
-
-        VkCommandBuffer commandBuffer = VK_Core::m_Device->BeginSingleTimeCommands();
-
-        VkImageMemoryBarrier barrier{};
-        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-        barrier.image = m_TextureImage;
-        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-        barrier.subresourceRange.baseArrayLayer = 0;
-        barrier.subresourceRange.layerCount = 1;
-        barrier.subresourceRange.levelCount = 1;
-
-        int32_t mipWidth = m_Width;
-        int32_t mipHeight = m_Height;
-
-        for (uint i = 1; i < m_MipLevels; i++)
-        {
-            barrier.subresourceRange.baseMipLevel = i - 1;
-            barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-            barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-            barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
-
-            {
-                std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-                vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0,
-                                     nullptr, 0, nullptr, 1, &barrier);
-            }
-
-            VkImageBlit blit{};
-            blit.srcOffsets[0] = {0, 0, 0};
-            blit.srcOffsets[1] = {mipWidth, mipHeight, 1};
-            blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-            blit.srcSubresource.mipLevel = i - 1;
-            blit.srcSubresource.baseArrayLayer = 0;
-            blit.srcSubresource.layerCount = 1;
-            blit.dstOffsets[0] = {0, 0, 0};
-            blit.dstOffsets[1] = {mipWidth > 1 ? mipWidth / 2 : 1, mipHeight > 1 ? mipHeight / 2 : 1, 1};
-            blit.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-            blit.dstSubresource.mipLevel = i;
-            blit.dstSubresource.baseArrayLayer = 0;
-            blit.dstSubresource.layerCount = 1;
-            {
-                std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-                vkCmdBlitImage(commandBuffer, m_TextureImage, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, m_TextureImage,
-                               VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit, m_MinFilterMip);
-            }
-
-            barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-            barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-            barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
-            barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-            {
-                std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-                vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
-                                     0, nullptr, 0, nullptr, 1, &barrier);
-            }
-
-            if (mipWidth > 1)
-            {
-                mipWidth /= 2;
-            }
-            if (mipHeight > 1)
-            {
-                mipHeight /= 2;
-            }
-        }
-
-        barrier.subresourceRange.baseMipLevel = m_MipLevels - 1;
-        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-        barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-
-        {
-            std::lock_guard<std::mutex> guard(VK_Core::m_Device->m_DeviceAccessMutex);
-            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0,
-                                 nullptr, 0, nullptr, 1, &barrier);
-        }
-
-        VK_Core::m_Device->EndSingleTimeCommands(commandBuffer);
-    }
-
     VkFilter VK_Texture::SetFilter(int minMagFilter)
     {
         VkFilter filter = VK_FILTER_LINEAR;
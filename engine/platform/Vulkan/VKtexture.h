@@ -25,6 +25,7 @@
 #include <vulkan/vulkan.h>
 
 #include "engine.h"
+#include "renderer/cookedTexture.h"
 #include "renderer/texture.h"
 
 #include "VKdevice.h"
@@ -41,8 +42,12 @@ namespace GfxRenderEngine
         virtual bool Init(const uint width, const uint height, bool sRGB, const void* data, int minFilter,
                           int magFilter) override;
         virtual bool Init(const std::string& fileName, bool sRGB, bool flip = true) override;
+        virtual bool Init(const std::string& fileName, bool sRGB, bool flip, int minFilter, int magFilter) override;
         virtual bool Init(const unsigned char* data, int length, bool sRGB) override;
         virtual bool Init(std::vector<HiResImage> const& hiResImages, bool linearFilter = true) override;
+        virtual bool InitCooked(const std::string& cookedFileName, bool sRGB, bool flip, uint64 sourceHash) override;
+        virtual bool InitCooked(const std::string& cookedFileName, bool sRGB, bool flip, uint64 sourceHash, int minFilter,
+                                int magFilter) override;
         virtual int GetWidth() const override { return m_Width; }
         virtual int GetHeight() const override { return m_Height; }
         virtual TextureID GetTextureID() const override { return m_TextureID; }
@@ -56,12 +61,11 @@ namespace GfxRenderEngine
     private:
         static constexpr uint AUTO_MIP_LEVEL = 0xffffffff;
         bool Create(const uint mipLevels = AUTO_MIP_LEVEL, const uint bytesPerChannel = 1);
-        void CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer,
-                          VkDeviceMemory& bufferMemory);
+        bool CreateSamplerAndImageView();
+        bool InitCooked(CookedTexture const& cookedTexture, const std::string& name, bool sRGB, bool flip);
+        static VkFormat GetCookedFormat(CookedTexture::Format format, bool sRGB);
         void CreateImage(VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties,
                          const uint mipLevels = AUTO_MIP_LEVEL);
-        void TransitionImageLayout(VkImageLayout oldLayout, VkImageLayout newLayout);
-        void GenerateMipmaps();
 
         VkFilter SetFilter(int minMagFilter);
         VkFilter SetFilterMip(int minFilter);
@@ -81,7 +85,7 @@ namespace GfxRenderEngine
         VkFormat m_ImageFormat{VkFormat::VK_FORMAT_UNDEFINED};
         VkImageLayout m_ImageLayout{VkImageLayout::VK_IMAGE_LAYOUT_UNDEFINED};
         VkImage m_TextureImage{nullptr};
-        VkDeviceMemory m_TextureImageMemory{nullptr};
+        VK_Allocation m_TextureImageMemory{};
         VkImageView m_ImageView{nullptr};
         VkSampler m_Sampler{nullptr};
 
@@ -0,0 +1,197 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include <algorithm>
+#include <mutex>
+
+#include "VKcore.h"
+#include "VKtransientImages.h"
+
+namespace GfxRenderEngine
+{
+    void VK_TransientImages::SetMemoryRequirements(RenderGraph& graph)
+    {
+        VK_Device* device = VK_Core::m_Device;
+        for (RenderGraph::ResourceHandle handle = 0; handle < graph.GetNumberOfResources(); ++handle)
+        {
+            if (graph.IsImported(handle))
+            {
+                continue;
+            }
+            RenderGraph::ImageDescription const& description = graph.GetDescription(handle);
+
+            VkImageCreateInfo imageInfo{};
+            imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+            imageInfo.imageType = VK_IMAGE_TYPE_2D;
+            imageInfo.extent.width = description.m_Width;
+            imageInfo.extent.height = description.m_Height;
+            imageInfo.extent.depth = 1;
+            imageInfo.mipLevels = description.m_MipLevels;
+            imageInfo.arrayLayers = 1;
+            imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+            imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            imageInfo.usage =
+                VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+            imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+            imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+            switch (description.m_Format)
+            {
+                case RenderGraph::Format::RGBA8:
+                    imageInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+                    break;
+                case RenderGraph::Format::RGBA16F:
+                    imageInfo.format = VK_FORMAT_R16G16B16A16_SFLOAT;
+                    break;
+                case RenderGraph::Format::RGBA32F:
+                    imageInfo.format = VK_FORMAT_R32G32B32A32_SFLOAT;
+                    break;
+                case RenderGraph::Format::DEPTH32:
+                    imageInfo.format = device->FindDepthFormat();
+                    imageInfo.usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+                    break;
+            }
+
+            // a probe, the requirements depend on the driver's tiling and padding
+            VkImage image{VK_NULL_HANDLE};
+            auto result = vkCreateImage(device->Device(), &imageInfo, nullptr, &image);
+            if (result != VK_SUCCESS)
+            {
+                device->PrintError(result);
+                continue;
+            }
+            VkMemoryRequirements requirements;
+            vkGetImageMemoryRequirements(device->Device(), image, &requirements);
+            vkDestroyImage(device->Device(), image, nullptr);
+            graph.SetMemoryRequirements(handle, requirements.size, requirements.alignment);
+        }
+    }
+
+    VK_TransientImages::VK_TransientImages(RenderGraph const& graph)
+    {
+        m_Device = VK_Core::m_Device;
+        for (uint64 heapSize : graph.GetHeapSizes())
+        {
+            m_Heaps.push_back({heapSize, {}});
+        }
+        for (RenderGraph::ResourceHandle handle = 0; handle < graph.GetNumberOfResources(); ++handle)
+        {
+            RenderGraph::MemoryPlacement const& placement = graph.GetPlacement(handle);
+            if (placement.m_Heap != RenderGraph::INVALID_HANDLE)
+            {
+                m_Placements[graph.GetResourceName(handle)] = placement;
+            }
+        }
+    }
+
+    VK_TransientImages::~VK_TransientImages()
+    {
+        for (auto& heap : m_Heaps)
+        {
+            if (heap.m_Memory.IsValid())
+            {
+                m_Device->FreeMemory(heap.m_Memory);
+            }
+        }
+        for (auto& [image, allocation] : m_OwnMemory)
+        {
+            m_Device->FreeMemory(allocation);
+        }
+    }
+
+    void VK_TransientImages::CreateImage(std::string const& name, VkImageCreateInfo const& imageInfo, VkImage& image)
+    {
+        auto placement = m_Placements.find(name);
+        if (placement != m_Placements.end())
+        {
+            auto result = vkCreateImage(m_Device->Device(), &imageInfo, nullptr, &image);
+            if (result != VK_SUCCESS)
+            {
+                m_Device->PrintError(result);
+                LOG_CORE_CRITICAL("failed to create image!");
+            }
+            VkMemoryRequirements requirements;
+            vkGetImageMemoryRequirements(m_Device->Device(), image, &requirements);
+            if (Bind(placement->second, requirements, image))
+            {
+                return;
+            }
+            LOG_CORE_WARN("VK_TransientImages: image '{0}' does not fit its placement, it does not alias", name);
+            vkDestroyImage(m_Device->Device(), image, nullptr);
+        }
+
+        VK_Allocation allocation{};
+        m_Device->CreateImageWithInfo(imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, image, allocation);
+        m_OwnMemory[image] = allocation;
+    }
+
+    bool VK_TransientImages::Bind(RenderGraph::MemoryPlacement const& placement,
+                                  VkMemoryRequirements const& requirements, VkImage image)
+    {
+        if (requirements.size > placement.m_Size)
+        {
+            return false;
+        }
+
+        Heap& heap = m_Heaps[placement.m_Heap];
+        if (!heap.m_Memory.IsValid())
+        {
+            VkMemoryRequirements heapRequirements = requirements;
+            heapRequirements.size = heap.m_Size;
+            heapRequirements.alignment = std::max(HEAP_ALIGNMENT, requirements.alignment);
+            if (!m_Device->GetMemoryAllocator()->Allocate(heapRequirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                                                          VK_MemoryAllocator::ResourceType::Image, heap.m_Memory))
+            {
+                LOG_CORE_CRITICAL("failed to allocate a heap for transient images!");
+                return false;
+            }
+        }
+
+        VkDeviceSize offset = heap.m_Memory.m_Offset + placement.m_Offset;
+        bool compatible = (requirements.memoryTypeBits & (1u << heap.m_Memory.m_MemoryTypeIndex)) &&
+                          ((offset % requirements.alignment) == 0);
+        if (!compatible)
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> guard(m_Device->m_DeviceAccessMutex);
+        auto result = vkBindImageMemory(m_Device->Device(), image, heap.m_Memory.m_Memory, offset);
+        if (result != VK_SUCCESS)
+        {
+            m_Device->PrintError(result);
+            LOG_CORE_CRITICAL("failed to bind image memory!");
+        }
+        return true;
+    }
+
+    void VK_TransientImages::DestroyImage(VkImage image)
+    {
+        vkDestroyImage(m_Device->Device(), image, nullptr);
+        auto ownMemory = m_OwnMemory.find(image);
+        if (ownMemory != m_OwnMemory.end())
+        {
+            m_Device->FreeMemory(ownMemory->second);
+            m_OwnMemory.erase(ownMemory);
+        }
+    }
+} // namespace GfxRenderEngine
@@ -0,0 +1,75 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <vulkan/vulkan.h>
+
+#include "engine.h"
+#include "renderer/renderGraph.h"
+#include "VKdevice.h"
+
+namespace GfxRenderEngine
+{
+    // memory of the transient images of a compiled frame graph: one allocation per heap of the graph,
+    // an image is bound at the offset the graph placed it, so images with disjoint lifetimes alias;
+    // the external subpass dependencies of the 3D and water render passes order the aliased accesses
+    class VK_TransientImages
+    {
+
+    public:
+        // the device's size and alignment of each transient image, call before RenderGraph::Compile()
+        static void SetMemoryRequirements(RenderGraph& graph);
+
+        VK_TransientImages(RenderGraph const& graph);
+        ~VK_TransientImages();
+
+        VK_TransientImages(const VK_TransientImages&) = delete;
+        VK_TransientImages& operator=(const VK_TransientImages&) = delete;
+
+        // name: the name of the image in the graph, images without a placement get memory of their own
+        void CreateImage(std::string const& name, VkImageCreateInfo const& imageInfo, VkImage& image);
+        void DestroyImage(VkImage image);
+
+    private:
+        struct Heap
+        {
+            uint64 m_Size{0};
+            VK_Allocation m_Memory{}; // allocated for the first image placed in the heap
+        };
+
+        bool Bind(RenderGraph::MemoryPlacement const& placement, VkMemoryRequirements const& requirements,
+                  VkImage image);
+
+    private:
+        static constexpr VkDeviceSize HEAP_ALIGNMENT = 65536;
+
+        VK_Device* m_Device;
+        std::vector<Heap> m_Heaps;
+        std::unordered_map<std::string, RenderGraph::MemoryPlacement> m_Placements;
+        std::unordered_map<VkImage, VK_Allocation> m_OwnMemory; // images that did not fit their placement
+    };
+} // namespace GfxRenderEngine
@@ -0,0 +1,668 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <cstring>
+
+#include "engine.h"
+
+#include "VKdevice.h"
+#include "VKuploader.h"
+
+namespace GfxRenderEngine
+{
+    namespace
+    {
+        VkDeviceSize AlignUp(VkDeviceSize value, VkDeviceSize alignment)
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+    } // namespace
+
+    VK_Uploader::VK_Uploader(VK_Device* device) : m_Device{device}
+    {
+        m_DedicatedTransferQueue = device->HasDedicatedTransferQueue();
+
+        CreateLane(Lane::Graphics, device->GetGraphicsQueueFamily(), device->GraphicsQueue());
+        if (m_DedicatedTransferQueue)
+        {
+            CreateLane(Lane::Transfer, device->GetTransferQueueFamily(), device->TransferQueue());
+        }
+
+        m_Device->CreateBuffer(STAGING_RING_SIZE, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                               VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, m_RingBuffer,
+                               m_RingMemory);
+        CORE_ASSERT(m_RingMemory.m_Mapped, "VK_Uploader: staging ring is not host visible");
+
+        LOG_CORE_INFO("VK_Uploader: staging ring {0} MB, {1}", STAGING_RING_SIZE / (1024 * 1024),
+                      m_DedicatedTransferQueue ? "dedicated transfer queue" : "no dedicated transfer queue");
+    }
+
+    VK_Uploader::~VK_Uploader()
+    {
+        WaitIdle();
+        PrintStats();
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_RingRanges.clear(); // all batches have completed
+        for (int lane = 0; lane < static_cast<int>(Lane::NumberOfLanes); ++lane)
+        {
+            DestroyLane(static_cast<Lane>(lane));
+        }
+        vkDestroyBuffer(m_Device->Device(), m_RingBuffer, nullptr);
+        m_Device->FreeMemory(m_RingMemory);
+    }
+
+    void VK_Uploader::CreateLane(Lane lane, uint queueFamilyIndex, VkQueue queue)
+    {
+        LaneState& laneState = GetLaneState(lane);
+        laneState.m_Queue = queue;
+
+        VkCommandPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.queueFamilyIndex = queueFamilyIndex;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        {
+            auto result = vkCreateCommandPool(m_Device->Device(), &poolInfo, nullptr, &laneState.m_CommandPool);
+            if (result != VK_SUCCESS)
+            {
+                m_Device->PrintError(result);
+                CORE_HARD_STOP("VK_Uploader: failed to create command pool");
+            }
+        }
+
+        VkSemaphoreTypeCreateInfo timelineCreateInfo{};
+        timelineCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+        timelineCreateInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+        timelineCreateInfo.initialValue = 0;
+
+        VkSemaphoreCreateInfo semaphoreInfo{};
+        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphoreInfo.pNext = &timelineCreateInfo;
+        {
+            auto result = vkCreateSemaphore(m_Device->Device(), &semaphoreInfo, nullptr, &laneState.m_TimelineSemaphore);
+            if (result != VK_SUCCESS)
+            {
+                m_Device->PrintError(result);
+                CORE_HARD_STOP("VK_Uploader: failed to create timeline semaphore");
+            }
+        }
+    }
+
+    void VK_Uploader::DestroyLane(Lane lane)
+    {
+        LaneState& laneState = GetLaneState(lane);
+        if (!laneState.m_CommandPool)
+        {
+            return;
+        }
+        Collect(lane);
+        for (auto& temporaryStaging : laneState.m_TemporaryStaging)
+        {
+            vkDestroyBuffer(m_Device->Device(), temporaryStaging.m_Buffer, nullptr);
+            m_Device->FreeMemory(temporaryStaging.m_Memory);
+        }
+        laneState.m_TemporaryStaging.clear();
+        // destroying the pool frees all of its command buffers
+        vkDestroyCommandPool(m_Device->Device(), laneState.m_CommandPool, nullptr);
+        vkDestroySemaphore(m_Device->Device(), laneState.m_TimelineSemaphore, nullptr);
+        laneState = LaneState{};
+    }
+
+    VkCommandBuffer VK_Uploader::BeginBatch(Lane lane)
+    {
+        LaneState& laneState = GetLaneState(lane);
+        if (laneState.m_CommandBuffer)
+        {
+            return laneState.m_CommandBuffer;
+        }
+
+        if (laneState.m_FreeCommandBuffers.empty())
+        {
+            VkCommandBufferAllocateInfo allocInfo{};
+            allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            allocInfo.commandPool = laneState.m_CommandPool;
+            allocInfo.commandBufferCount = 1;
+            vkAllocateCommandBuffers(m_Device->Device(), &allocInfo, &laneState.m_CommandBuffer);
+        }
+        else
+        {
+            laneState.m_CommandBuffer = laneState.m_FreeCommandBuffers.back();
+            laneState.m_FreeCommandBuffers.pop_back();
+        }
+
+        // implicitly resets a recycled command buffer
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        vkBeginCommandBuffer(laneState.m_CommandBuffer, &beginInfo);
+
+        return laneState.m_CommandBuffer;
+    }
+
+    void VK_Uploader::Submit(Lane lane, std::unique_lock<std::mutex>& lock)
+    {
+        ZoneScopedN("VK_Uploader::Submit");
+        LaneState& laneState = GetLaneState(lane);
+        // the batch must not reach the GPU before its staging memory has been written
+        m_StagingWritten.wait(lock, [&laneState]() { return laneState.m_PendingWrites == 0; });
+        if (!laneState.m_CommandBuffer)
+        {
+            return;
+        }
+
+        if (lane == Lane::Graphics)
+        {
+            // buffers copied on the graphics queue: make them visible to subsequent draws and dispatches
+            // (images carry their own barriers, and the transfer lane is synchronized via its semaphore)
+            VkMemoryBarrier barrier{};
+            barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT |
+                                    VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_UNIFORM_READ_BIT;
+            vkCmdPipelineBarrier(laneState.m_CommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                 VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT |
+                                     VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                 0, 1, &barrier, 0, nullptr, 0, nullptr);
+        }
+        vkEndCommandBuffer(laneState.m_CommandBuffer);
+
+        const uint64 signalValue = laneState.m_SubmittedValue + 1;
+        VkTimelineSemaphoreSubmitInfo timelineSemaphoreSubmitInfo{};
+        timelineSemaphoreSubmitInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        timelineSemaphoreSubmitInfo.signalSemaphoreValueCount = 1;
+        timelineSemaphoreSubmitInfo.pSignalSemaphoreValues = &signalValue;
+
+        VkSubmitInfo submitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext = &timelineSemaphoreSubmitInfo;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &laneState.m_CommandBuffer;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores = &laneState.m_TimelineSemaphore;
+        {
+            std::lock_guard<std::mutex> guard(m_Device->m_DeviceAccessMutex);
+            auto result = vkQueueSubmit(laneState.m_Queue, 1, &submitInfo, VK_NULL_HANDLE);
+            if (result != VK_SUCCESS)
+            {
+                m_Device->PrintError(result);
+                LOG_CORE_CRITICAL("VK_Uploader: failed to submit upload batch!");
+            }
+        }
+
+        laneState.m_SubmittedValue = signalValue;
+        laneState.m_InFlight.push_back({signalValue, laneState.m_CommandBuffer});
+        laneState.m_CommandBuffer = VK_NULL_HANDLE;
+        laneState.m_BatchBytes = 0;
+        ++m_BatchCount;
+
+        Collect(lane);
+    }
+
+    uint64 VK_Uploader::GetCompletedValue(Lane lane)
+    {
+        uint64 completedValue = 0;
+        vkGetSemaphoreCounterValue(m_Device->Device(), GetLaneState(lane).m_TimelineSemaphore, &completedValue);
+        return completedValue;
+    }
+
+    void VK_Uploader::WaitForValue(Lane lane, uint64 value)
+    {
+        ZoneScopedN("VK_Uploader::WaitForValue");
+        VkSemaphoreWaitInfo waitInfo{};
+        waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+        waitInfo.semaphoreCount = 1;
+        waitInfo.pSemaphores = &GetLaneState(lane).m_TimelineSemaphore;
+        waitInfo.pValues = &value;
+        vkWaitSemaphores(m_Device->Device(), &waitInfo, UINT64_MAX);
+    }
+
+    // recycle everything that belongs to completed batches, never blocks
+    void VK_Uploader::Collect(Lane lane)
+    {
+        LaneState& laneState = GetLaneState(lane);
+        const uint64 completedValue = GetCompletedValue(lane);
+
+        while (!laneState.m_InFlight.empty() && (laneState.m_InFlight.front().m_Value <= completedValue))
+        {
+            laneState.m_FreeCommandBuffers.push_back(laneState.m_InFlight.front().m_CommandBuffer);
+            laneState.m_InFlight.pop_front();
+        }
+
+        auto& temporaryStaging = laneState.m_TemporaryStaging;
+        for (auto iterator = temporaryStaging.begin(); iterator != temporaryStaging.end();)
+        {
+            if (iterator->m_Value <= completedValue)
+            {
+                vkDestroyBuffer(m_Device->Device(), iterator->m_Buffer, nullptr);
+                m_Device->FreeMemory(iterator->m_Memory);
+                iterator = temporaryStaging.erase(iterator);
+            }
+            else
+            {
+                ++iterator;
+            }
+        }
+
+        // ring ranges of both lanes are interleaved, query the other lane only when needed
+        uint64 completedValues[static_cast<int>(Lane::NumberOfLanes)] = {};
+        bool queried[static_cast<int>(Lane::NumberOfLanes)] = {};
+        completedValues[static_cast<int>(lane)] = completedValue;
+        queried[static_cast<int>(lane)] = true;
+        while (!m_RingRanges.empty())
+        {
+            const int rangeLane = static_cast<int>(m_RingRanges.front().m_Lane);
+            if (!queried[rangeLane])
+            {
+                completedValues[rangeLane] = GetCompletedValue(m_RingRanges.front().m_Lane);
+                queried[rangeLane] = true;
+            }
+            if (m_RingRanges.front().m_Value > completedValues[rangeLane])
+            {
+                break;
+            }
+            m_RingRanges.pop_front();
+        }
+    }
+
+    bool VK_Uploader::TryAllocateFromRing(VkDeviceSize size, VkDeviceSize& offset)
+    {
+        if (m_RingRanges.empty())
+        {
+            m_RingHead = 0;
+            offset = 0;
+            return size <= STAGING_RING_SIZE;
+        }
+
+        // ranges are retired in FIFO order: the used part of the ring starts at the oldest range
+        const VkDeviceSize tail = m_RingRanges.front().m_Begin;
+        const VkDeviceSize alignedHead = AlignUp(m_RingHead, STAGING_ALIGNMENT);
+        if (m_RingHead > tail)
+        {
+            // used: [tail, head), free: [head, end) and [0, tail)
+            if (alignedHead + size <= STAGING_RING_SIZE)
+            {
+                offset = alignedHead;
+                return true;
+            }
+            if (size <= tail)
+            {
+                offset = 0;
+                return true;
+            }
+            return false;
+        }
+
+        // wrapped around, free: [head, tail)
+        if (alignedHead + size <= tail)
+        {
+            offset = alignedHead;
+            return true;
+        }
+        return false;
+    }
+
+    void VK_Uploader::RetireOldestRingRange(std::unique_lock<std::mutex>& lock)
+    {
+        ZoneScopedN("VK_Uploader::RetireOldestRingRange");
+        RingRange const oldest = m_RingRanges.front();
+        LaneState& laneState = GetLaneState(oldest.m_Lane);
+        if (oldest.m_Value > laneState.m_SubmittedValue)
+        {
+            Submit(oldest.m_Lane, lock);
+        }
+        ++m_RingStalls;
+        // other threads may keep recording and writing staging memory while this one waits for the GPU
+        lock.unlock();
+        WaitForValue(oldest.m_Lane, oldest.m_Value);
+        lock.lock();
+        // pops the range, unless another thread already did
+        Collect(oldest.m_Lane);
+    }
+
+    // called by uploads after they wrote their staging memory outside the lock
+    void VK_Uploader::EndStagingWrite(Lane lane, std::unique_lock<std::mutex>& lock)
+    {
+        LaneState& laneState = GetLaneState(lane);
+        --laneState.m_PendingWrites;
+        if (laneState.m_PendingWrites == 0)
+        {
+            m_StagingWritten.notify_all();
+        }
+        if (laneState.m_BatchBytes >= FLUSH_THRESHOLD)
+        {
+            Submit(lane, lock);
+        }
+    }
+
+    VK_Uploader::Staging VK_Uploader::AcquireStaging(Lane lane, VkDeviceSize size, std::unique_lock<std::mutex>& lock)
+    {
+        LaneState& laneState = GetLaneState(lane);
+        const uint64 batchValue = laneState.m_SubmittedValue + 1;
+
+        if (size > MAX_RING_UPLOAD_SIZE)
+        {
+            TemporaryStaging temporaryStaging{batchValue, VK_NULL_HANDLE, {}};
+            m_Device->CreateBuffer(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                                   VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                   temporaryStaging.m_Buffer, temporaryStaging.m_Memory);
+            laneState.m_TemporaryStaging.push_back(temporaryStaging);
+            return {temporaryStaging.m_Buffer, 0, static_cast<uchar*>(temporaryStaging.m_Memory.m_Mapped)};
+        }
+
+        VkDeviceSize offset = 0;
+        while (!TryAllocateFromRing(size, offset))
+        {
+            RetireOldestRingRange(lock);
+        }
+        // the batch value may have changed while RetireOldestRingRange() released the lock
+        m_RingRanges.push_back({offset, offset + size, lane, laneState.m_SubmittedValue + 1});
+        m_RingHead = offset + size;
+        return {m_RingBuffer, offset, static_cast<uchar*>(m_RingMemory.m_Mapped) + offset};
+    }
+
+    VK_Uploader::Ticket VK_Uploader::UploadBuffer(VkBuffer dst, void const* data, VkDeviceSize size, VkDeviceSize dstOffset)
+    {
+        ZoneScopedN("VK_Uploader::UploadBuffer");
+        if (!size)
+        {
+            return Ticket{};
+        }
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        const Lane lane = Resolve(Lane::Transfer);
+        LaneState& laneState = GetLaneState(lane);
+
+        // reserve staging memory and record the copy under the lock,
+        // the open batch is not submitted until the memcpy below has finished
+        Staging staging = AcquireStaging(lane, size, lock);
+        VkCommandBuffer commandBuffer = BeginBatch(lane);
+        VkBufferCopy copyRegion{};
+        copyRegion.srcOffset = staging.m_Offset;
+        copyRegion.dstOffset = dstOffset;
+        copyRegion.size = size;
+        vkCmdCopyBuffer(commandBuffer, staging.m_Buffer, dst, 1, &copyRegion);
+
+        Ticket ticket{lane, laneState.m_SubmittedValue + 1};
+        ++m_UploadCount;
+        m_UploadedBytes += size;
+        laneState.m_BatchBytes += size;
+        ++laneState.m_PendingWrites;
+
+        lock.unlock();
+        memcpy(staging.m_Mapped, data, static_cast<size_t>(size));
+        lock.lock();
+
+        EndStagingWrite(lane, lock);
+        return ticket;
+    }
+
+    VK_Uploader::Ticket VK_Uploader::UploadImage(ImageUpload const& upload)
+    {
+        ZoneScopedN("VK_Uploader::UploadImage");
+        CORE_ASSERT((upload.m_Data || upload.m_WriteStaging) && upload.m_Size, "VK_Uploader::UploadImage: no data");
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        const Lane lane = Lane::Graphics; // layout transitions and blits
+        LaneState& laneState = GetLaneState(lane);
+
+        // see UploadBuffer(): the staging memory is written after recording, outside the lock
+        Staging staging = AcquireStaging(lane, upload.m_Size, lock);
+        VkCommandBuffer commandBuffer = BeginBatch(lane);
+
+        VkImageMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = upload.m_Image;
+        barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.baseMipLevel = 0;
+        barrier.subresourceRange.levelCount = upload.m_MipLevels;
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount = upload.m_LayerCount;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0,
+                             nullptr, 0, nullptr, 1, &barrier);
+
+        std::vector<VkBufferImageCopy> regions = upload.m_Regions;
+        if (regions.empty())
+        {
+            VkBufferImageCopy region{};
+            region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            region.imageSubresource.mipLevel = 0;
+            region.imageSubresource.baseArrayLayer = 0;
+            region.imageSubresource.layerCount = upload.m_LayerCount;
+            region.imageOffset = {0, 0, 0};
+            region.imageExtent = {upload.m_Width, upload.m_Height, 1};
+            regions.push_back(region);
+        }
+        for (auto& region : regions)
+        {
+            region.bufferOffset += staging.m_Offset;
+        }
+        vkCmdCopyBufferToImage(commandBuffer, staging.m_Buffer, upload.m_Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                               static_cast<uint>(regions.size()), regions.data());
+
+        bool generateMipmaps = upload.m_GenerateMipmaps && (upload.m_MipLevels > 1);
+        if (generateMipmaps)
+        {
+            VkFormatProperties formatProperties;
+            vkGetPhysicalDeviceFormatProperties(m_Device->PhysicalDevice(), upload.m_Format, &formatProperties);
+            if (!(formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT))
+            {
+                LOG_CORE_WARN("texture image format does not support linear blitting!");
+                generateMipmaps = false;
+            }
+        }
+
+        if (generateMipmaps)
+        {
+            RecordMipmaps(commandBuffer, upload);
+        }
+        else
+        {
+            barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                 VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0,
+                                 nullptr, 0, nullptr, 1, &barrier);
+        }
+
+        Ticket ticket{lane, laneState.m_SubmittedValue + 1};
+        ++m_UploadCount;
+        m_UploadedBytes += upload.m_Size;
+        laneState.m_BatchBytes += upload.m_Size;
+        ++laneState.m_PendingWrites;
+
+        lock.unlock();
+        if (upload.m_WriteStaging)
+        {
+            upload.m_WriteStaging(staging.m_Mapped);
+        }
+        else
+        {
+            memcpy(staging.m_Mapped, upload.m_Data, static_cast<size_t>(upload.m_Size));
+        }
+        lock.lock();
+
+        EndStagingWrite(lane, lock);
+        return ticket;
+    }
+
+    // expects all mip levels in VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL with level 0 filled in,
+    // leaves all mip levels in VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+    void VK_Uploader::RecordMipmaps(VkCommandBuffer commandBuffer, ImageUpload const& upload)
+    {
+        VkImageMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.image = upload.m_Image;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount = upload.m_LayerCount;
+        barrier.subresourceRange.levelCount = 1;
+
+        int32_t mipWidth = upload.m_Width;
+        int32_t mipHeight = upload.m_Height;
+
+        for (uint mipLevel = 1; mipLevel < upload.m_MipLevels; ++mipLevel)
+        {
+            barrier.subresourceRange.baseMipLevel = mipLevel - 1;
+            barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0,
+                                 nullptr, 0, nullptr, 1, &barrier);
+
+            VkImageBlit blit{};
+            blit.srcOffsets[0] = {0, 0, 0};
+            blit.srcOffsets[1] = {mipWidth, mipHeight, 1};
+            blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            blit.srcSubresource.mipLevel = mipLevel - 1;
+            blit.srcSubresource.baseArrayLayer = 0;
+            blit.srcSubresource.layerCount = upload.m_LayerCount;
+            blit.dstOffsets[0] = {0, 0, 0};
+            blit.dstOffsets[1] = {mipWidth > 1 ? mipWidth / 2 : 1, mipHeight > 1 ? mipHeight / 2 : 1, 1};
+            blit.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            blit.dstSubresource.mipLevel = mipLevel;
+            blit.dstSubresource.baseArrayLayer = 0;
+            blit.dstSubresource.layerCount = upload.m_LayerCount;
+            vkCmdBlitImage(commandBuffer, upload.m_Image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, upload.m_Image,
+                           VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit, upload.m_MipFilter);
+
+            barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                 VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0,
+                                 nullptr, 0, nullptr, 1, &barrier);
+
+            if (mipWidth > 1)
+            {
+                mipWidth /= 2;
+            }
+            if (mipHeight > 1)
+            {
+                mipHeight /= 2;
+            }
+        }
+
+        barrier.subresourceRange.baseMipLevel = upload.m_MipLevels - 1;
+        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr,
+                             0, nullptr, 1, &barrier);
+    }
+
+    void VK_Uploader::Flush(Lane lane)
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        Submit(Resolve(lane), lock);
+    }
+
+    void VK_Uploader::FlushAll()
+    {
+        ZoneScopedN("VK_Uploader::FlushAll");
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        for (int lane = 0; lane < static_cast<int>(Lane::NumberOfLanes); ++lane)
+        {
+            if (GetLaneState(static_cast<Lane>(lane)).m_CommandPool)
+            {
+                Submit(static_cast<Lane>(lane), lock);
+            }
+        }
+    }
+
+    bool VK_Uploader::IsComplete(Ticket const& ticket)
+    {
+        if (!ticket.IsValid())
+        {
+            return true;
+        }
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return GetCompletedValue(ticket.m_Lane) >= ticket.m_Value;
+    }
+
+    void VK_Uploader::Wait(Ticket const& ticket)
+    {
+        if (!ticket.IsValid())
+        {
+            return;
+        }
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            if (ticket.m_Value > GetLaneState(ticket.m_Lane).m_SubmittedValue)
+            {
+                Submit(ticket.m_Lane, lock);
+            }
+        }
+        // the semaphore handle is stable for the lifetime of the uploader, no need to hold the lock while waiting
+        WaitForValue(ticket.m_Lane, ticket.m_Value);
+    }
+
+    void VK_Uploader::WaitIdle()
+    {
+        FlushAll();
+        for (int lane = 0; lane < static_cast<int>(Lane::NumberOfLanes); ++lane)
+        {
+            Ticket ticket{static_cast<Lane>(lane), 0};
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                ticket.m_Value = GetLaneState(ticket.m_Lane).m_SubmittedValue;
+            }
+            if (ticket.IsValid())
+            {
+                WaitForValue(ticket.m_Lane, ticket.m_Value);
+            }
+        }
+    }
+
+    VkSemaphore VK_Uploader::GetTransferSemaphore(uint64& waitValue)
+    {
+        if (!m_DedicatedTransferQueue)
+        {
+            return VK_NULL_HANDLE;
+        }
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        LaneState& laneState = GetLaneState(Lane::Transfer);
+        waitValue = laneState.m_SubmittedValue;
+        return waitValue ? laneState.m_TimelineSemaphore : VK_NULL_HANDLE;
+    }
+
+    void VK_Uploader::PrintStats()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        LOG_CORE_INFO("VK_Uploader: {0} uploads, {1} MB, {2} batches, {3} staging ring stalls", m_UploadCount,
+                      m_UploadedBytes / (1024 * 1024), m_BatchCount, m_RingStalls);
+    }
+} // namespace GfxRenderEngine
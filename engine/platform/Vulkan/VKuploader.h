@@ -0,0 +1,189 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+#include <functional>
+#include <vulkan/vulkan.h>
+
+#include "engine.h"
+#include "VKmemoryAllocator.h"
+
+namespace GfxRenderEngine
+{
+    class VK_Device;
+
+    // batches buffer and image uploads into a shared, persistently mapped staging ring;
+    // buffer copies go to a dedicated transfer queue if the device has one,
+    // image copies (layout transitions, mip map blits) always go to the graphics queue;
+    // every upload returns a timeline-semaphore ticket, callers only wait when they need the result on the CPU
+    class VK_Uploader
+    {
+
+    public:
+        enum class Lane
+        {
+            Transfer = 0,
+            Graphics,
+            NumberOfLanes
+        };
+
+        struct Ticket
+        {
+            Lane m_Lane{Lane::Graphics};
+            uint64 m_Value{0}; // timeline value signaled when the batch containing the upload has completed
+            bool IsValid() const { return m_Value != 0; }
+        };
+
+        struct ImageUpload
+        {
+            VkImage m_Image{VK_NULL_HANDLE};
+            VkFormat m_Format{VK_FORMAT_UNDEFINED};
+            uint m_Width{0};
+            uint m_Height{0};
+            uint m_MipLevels{1};
+            uint m_LayerCount{1};
+            void const* m_Data{nullptr};
+            VkDeviceSize m_Size{0};
+            // alternative to m_Data for scattered sources: writes m_Size bytes directly into staging memory
+            std::function<void(uchar* staging)> m_WriteStaging;
+            // bufferOffset is relative to m_Data; if empty, m_Data is copied to mip level 0 of all layers
+            std::vector<VkBufferImageCopy> m_Regions;
+            bool m_GenerateMipmaps{false};
+            VkFilter m_MipFilter{VK_FILTER_LINEAR};
+        };
+
+        static constexpr VkDeviceSize STAGING_RING_SIZE = 64 * 1024 * 1024;
+        // larger uploads get a temporary staging buffer instead of monopolizing the ring
+        static constexpr VkDeviceSize MAX_RING_UPLOAD_SIZE = STAGING_RING_SIZE / 4;
+        // an open batch is submitted automatically once it has recorded this many bytes
+        static constexpr VkDeviceSize FLUSH_THRESHOLD = 16 * 1024 * 1024;
+        static constexpr VkDeviceSize STAGING_ALIGNMENT = 16;
+
+    public:
+        VK_Uploader(VK_Device* device);
+        ~VK_Uploader();
+
+        VK_Uploader(const VK_Uploader&) = delete;
+        VK_Uploader& operator=(const VK_Uploader&) = delete;
+
+        // dst must have been created with VK_BUFFER_USAGE_TRANSFER_DST_BIT
+        Ticket UploadBuffer(VkBuffer dst, void const* data, VkDeviceSize size, VkDeviceSize dstOffset = 0);
+        // leaves all mip levels and layers in VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+        Ticket UploadImage(ImageUpload const& upload);
+
+        void Flush(Lane lane);
+        void FlushAll();
+        bool IsComplete(Ticket const& ticket);
+        void Wait(Ticket const& ticket);
+        void WaitIdle();
+
+        // for graphics queue submissions that consume buffers uploaded on the transfer queue;
+        // returns VK_NULL_HANDLE if there is no dedicated transfer queue or nothing was submitted to it yet
+        VkSemaphore GetTransferSemaphore(uint64& waitValue);
+        bool HasDedicatedTransferQueue() const { return m_DedicatedTransferQueue; }
+        void PrintStats();
+
+    private:
+        struct InFlightCommandBuffer
+        {
+            uint64 m_Value;
+            VkCommandBuffer m_CommandBuffer;
+        };
+
+        struct TemporaryStaging
+        {
+            uint64 m_Value;
+            VkBuffer m_Buffer;
+            VK_Allocation m_Memory;
+        };
+
+        struct LaneState
+        {
+            VkQueue m_Queue{VK_NULL_HANDLE};
+            VkCommandPool m_CommandPool{VK_NULL_HANDLE};
+            VkSemaphore m_TimelineSemaphore{VK_NULL_HANDLE};
+            VkCommandBuffer m_CommandBuffer{VK_NULL_HANDLE}; // open batch, signals m_SubmittedValue + 1
+            uint64 m_SubmittedValue{0};
+            VkDeviceSize m_BatchBytes{0};
+            uint m_PendingWrites{0}; // staging copies of the open batch still in progress outside the lock
+            std::deque<InFlightCommandBuffer> m_InFlight;
+            std::vector<VkCommandBuffer> m_FreeCommandBuffers;
+            std::vector<TemporaryStaging> m_TemporaryStaging;
+        };
+
+        // a sub-range of the staging ring, reusable once its batch has completed
+        struct RingRange
+        {
+            VkDeviceSize m_Begin;
+            VkDeviceSize m_End;
+            Lane m_Lane;
+            uint64 m_Value;
+        };
+
+        struct Staging
+        {
+            VkBuffer m_Buffer;
+            VkDeviceSize m_Offset;
+            uchar* m_Mapped;
+        };
+
+        // all private functions expect m_Mutex to be held,
+        // the ones taking the lock drop it while they wait for staging writes or the GPU
+        LaneState& GetLaneState(Lane lane) { return m_Lanes[static_cast<int>(lane)]; }
+        Lane Resolve(Lane lane) const { return m_DedicatedTransferQueue ? lane : Lane::Graphics; }
+        void CreateLane(Lane lane, uint queueFamilyIndex, VkQueue queue);
+        void DestroyLane(Lane lane);
+        VkCommandBuffer BeginBatch(Lane lane);
+        void Submit(Lane lane, std::unique_lock<std::mutex>& lock);
+        void Collect(Lane lane);
+        uint64 GetCompletedValue(Lane lane);
+        void WaitForValue(Lane lane, uint64 value);
+        Staging AcquireStaging(Lane lane, VkDeviceSize size, std::unique_lock<std::mutex>& lock);
+        bool TryAllocateFromRing(VkDeviceSize size, VkDeviceSize& offset);
+        void RetireOldestRingRange(std::unique_lock<std::mutex>& lock);
+        void EndStagingWrite(Lane lane, std::unique_lock<std::mutex>& lock);
+        void RecordMipmaps(VkCommandBuffer commandBuffer, ImageUpload const& upload);
+
+    private:
+        VK_Device* m_Device;
+        bool m_DedicatedTransferQueue{false};
+        std::mutex m_Mutex;
+        std::condition_variable m_StagingWritten;
+        LaneState m_Lanes[static_cast<int>(Lane::NumberOfLanes)];
+
+        VkBuffer m_RingBuffer{VK_NULL_HANDLE};
+        VK_Allocation m_RingMemory{};
+        VkDeviceSize m_RingHead{0};
+        std::deque<RingRange> m_RingRanges;
+
+        // statistics
+        uint64 m_UploadCount{0};
+        uint64 m_UploadedBytes{0};
+        uint64 m_BatchCount{0};
+        uint64 m_RingStalls{0};
+    };
+} // namespace GfxRenderEngine
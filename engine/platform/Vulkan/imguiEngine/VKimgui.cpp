@@ -148,6 +148,22 @@ namespace GfxRenderEngine
 
         ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate,
                     ImGui::GetIO().Framerate);
+        if (auto renderer = Engine::m_Engine->GetRenderer())
+        {
+            auto& camera = renderer->GetCullingStatistics(FrustumCuller::CAMERA);
+            auto& shadow0 = renderer->GetCullingStatistics(FrustumCuller::SHADOW_CASCADE_0);
+            auto& shadow1 = renderer->GetCullingStatistics(FrustumCuller::SHADOW_CASCADE_1);
+            ImGui::Text("culling (drawn/culled): camera %u/%u, shadow %u/%u, %u/%u", camera.m_Drawn, camera.m_Culled,
+                        shadow0.m_Drawn, shadow0.m_Culled, shadow1.m_Drawn, shadow1.m_Culled);
+            auto& refraction = renderer->GetCullingStatistics(FrustumCuller::WATER_REFRACTION);
+            auto& reflection = renderer->GetCullingStatistics(FrustumCuller::WATER_REFLECTION);
+            ImGui::Text("culling (drawn/culled): water refraction %u/%u, reflection %u/%u", refraction.m_Drawn,
+                        refraction.m_Culled, reflection.m_Drawn, reflection.m_Culled);
+            for (auto& recordTime : renderer->GetRecordTimes())
+            {
+                ImGui::Text("record %s: %.3f ms", recordTime.m_Name, recordTime.m_Milliseconds);
+            }
+        }
         ImGui::End();
         ImGui::PopStyleColor();
     }
@@ -22,6 +22,10 @@
 
 #define GLSL_ENABLE_CLIPPING_PLANE (0x1 << 0x0)
 
+// vertex format of the PBR vertex streams (MeshBufferData::m_VertexFormat), see VertexStreams
+#define GLSL_VERTEX_FORMAT_SKINNED (0x1 << 0x0)
+#define GLSL_VERTEX_FORMAT_FLOAT_UV (0x1 << 0x1)
+
 // shader settings 0
 #define SHADER_SETTINGS0_USE_NEW_ACES (0x1 << 0x0)
 #define SHADER_SETTINGS0_DO_NOT_MULTIPLY_COLOR_OUT_WITH_ALBEDO (0x1 << 0x1)
@@ -80,6 +80,9 @@ struct DrawCallInfoGrass
     
     // byte 48 to 71
     GrassParameters m_GrassParameters;
+
+    // byte 72 to 75
+    uint m_InstanceBase; // slice of this frame in the instance buffer of the base model
 };
 
 layout(push_constant, scalar) uniform Push
@@ -99,7 +102,6 @@ void main()
     InstanceBuffer instanceBuffer;
     InstanceData instanceData;
     mat4 baseModelMatrix;
-    mat4 normalMatrix;
 
     {
         // mesh buffer has BDAs for vertex, index, and instance buffers
@@ -111,8 +113,7 @@ void main()
         index += push.m_Constants.m_SubmeshInfo.m_VertexOffset;
 
         // Vertex fetch
-        VertexBuffer vertexBuffer = VertexBuffer(mesh.m_Data.m_VertexBufferDeviceAddress);
-        Vertex vertex = vertexBuffer.m_Vertices[index];
+        Vertex vertex = FetchVertex(mesh.m_Data, index);
 
         position = vertex.m_Position;
         color    = vertex.m_Color;
@@ -126,10 +127,9 @@ void main()
         instanceBuffer = InstanceBuffer(mesh.m_Data.m_InstanceBufferDeviceAddress);
 
         // this is used for the base model
-        instanceData = instanceBuffer.m_Data[0];
+        instanceData = instanceBuffer.m_Data[push.m_Constants.m_InstanceBase];
 
-        baseModelMatrix = instanceData.m_ModelMatrix;
-        normalMatrix    = instanceData.m_NormalMatrix;
+        baseModelMatrix = GetModelMatrix(instanceData);
     }
 
     GrassParameters parameters = push.m_Constants.m_GrassParameters;
@@ -138,7 +138,8 @@ void main()
     vec3 rotVec3 = grassMask.m_GrassShaderData[gl_InstanceIndex].m_Rotation.xyz;
     vec3 translVec3 = grassMask.m_GrassShaderData[gl_InstanceIndex].m_Translation.xyz;
 
-    float theta = sin(gl_InstanceIndex); // random
+    // random, stored per blade because culled instances are compacted
+    float theta = grassMask.m_GrassShaderData[gl_InstanceIndex].m_Rotation.w;
     float s = sin(theta); // sine
     float c = cos(theta); // cosine
     float sclXZ = parameters.m_ScaleXZ;
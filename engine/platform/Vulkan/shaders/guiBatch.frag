@@ -1,4 +1,4 @@
-/* Engine Copyright (c) 2022 Engine Development Team 
+/* Engine Copyright (c) 2025 Engine Development Team 
    https://github.com/beaumanvienna/vulkan
 
    Permission is hereby granted, free of charge, to any person
@@ -22,10 +22,14 @@
 
 #version 450
 
-// inputs: UVs + color + sammpler
+// flags, see GUIBatch::Flags
+#define USE_TEXTURE2 1
+#define REMOVE_GAMMA 2
+
+// inputs: UVs + color + flags + samplers
 layout(location = 0)      in vec2  fragUV;
 layout(location = 1)      in vec4  fragColor;
-layout(location = 2)      in float textureID;
+layout(location = 2) flat in uint  fragFlags;
 
 layout(set = 0, binding = 1) uniform sampler2D tex1;
 layout(set = 0, binding = 2) uniform sampler2D tex2;
@@ -36,17 +40,20 @@ layout (location = 0) out vec4 outColor;
 void main()
 {
     vec4 pixel;
-    if (textureID == 2.0)
+    if ((fragFlags & USE_TEXTURE2) != 0)
     {
-        pixel = texture(tex2,fragUV);
+        pixel = texture(tex2, fragUV);
     }
     else
     {
-        pixel = texture(tex1,fragUV);
+        pixel = texture(tex1, fragUV);
     }
     if (pixel.w == 0.0) discard;
     outColor = pixel * fragColor;
-    // remove gamma correction
-    float gamma = 2.2;
-    outColor.rgb = pow(outColor.rgb, vec3(gamma));
+    if ((fragFlags & REMOVE_GAMMA) != 0)
+    {
+        // remove gamma correction
+        float gamma = 2.2;
+        outColor.rgb = pow(outColor.rgb, vec3(gamma));
+    }
 }
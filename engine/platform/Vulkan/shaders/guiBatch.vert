@@ -1,4 +1,4 @@
-/* Engine Copyright (c) 2022 Engine Development Team 
+/* Engine Copyright (c) 2025 Engine Development Team 
    https://github.com/beaumanvienna/vulkan
 
    Permission is hereby granted, free of charge, to any person
@@ -22,54 +22,47 @@
 
 #version 450
 
-// inputs 
-layout(push_constant, std430) uniform Push
-{
-    mat4 m_MVP;
-    vec2 m_UV[2];
-} push;
+// inputs: one instance per quad, see GUIBatch::QuadInstance
+layout(location = 0) in vec4  corners01;
+layout(location = 1) in vec4  corners23;
+layout(location = 2) in vec4  uvRect;
+layout(location = 3) in vec4  color;
+layout(location = 4) in uint  flags;
 
 // outputs
-layout(location = 0) out vec2  fragUV;
+layout(location = 0)      out vec2  fragUV;
+layout(location = 1)      out vec4  fragColor;
+layout(location = 2) flat out uint  fragFlags;
 
 // 0 - 1
 // | / |
 // 3 - 2
-vec2 positions[6] = vec2[]
-(
-    vec2(-1.0,  1.0), // 0
-    vec2( 1.0,  1.0), // 1
-    vec2(-1.0, -1.0), // 3
-
-    vec2( 1.0,  1.0), // 1
-    vec2( 1.0, -1.0), // 2
-    vec2(-1.0, -1.0)  // 3
-);
+const int corners[6] = int[](0, 1, 3, 1, 2, 3);
 
 void main()
 {
-    vec2 position = positions[gl_VertexIndex];
-    switch (gl_VertexIndex)
+    int corner = corners[gl_VertexIndex];
+    vec2 position;
+    switch (corner)
     {
         case 0:
-            fragUV = vec2(push.m_UV[0].x, push.m_UV[0].y);
+            position = corners01.xy;
+            fragUV = vec2(uvRect.x, uvRect.y);
             break;
         case 1:
-            fragUV = vec2(push.m_UV[1].x, push.m_UV[0].y);
+            position = corners01.zw;
+            fragUV = vec2(uvRect.z, uvRect.y);
             break;
         case 2:
-            fragUV = vec2(push.m_UV[0].x, push.m_UV[1].y);
+            position = corners23.xy;
+            fragUV = vec2(uvRect.z, uvRect.w);
             break;
         case 3:
-            fragUV = vec2(push.m_UV[1].x, push.m_UV[0].y);
-            break;
-        case 4:
-            fragUV = vec2(push.m_UV[1].x, push.m_UV[1].y);
-            break;
-        case 5:
-            fragUV = vec2(push.m_UV[0].x, push.m_UV[1].y);
+            position = corners23.zw;
+            fragUV = vec2(uvRect.x, uvRect.w);
             break;
     }
-
-    gl_Position = push.m_MVP * vec4(position, 0.0, 1.0);
+    fragColor = color;
+    fragFlags = flags;
+    gl_Position = vec4(position, 0.0, 1.0);
 }
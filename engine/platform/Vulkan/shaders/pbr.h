@@ -22,6 +22,7 @@
 
 #define BDA uint64_t // buffer device address
 
+// decoded vertex, see FetchVertex()
 struct Vertex
 {
     vec3 m_Position;
@@ -45,12 +46,30 @@ struct DirectionalLight
     vec4 m_Color;     // w is intensity
 };
 
+// see VK_InstanceBuffer: rows 0 to 2 of the model matrix (row 3 is always 0, 0, 0, 1),
+// the normal matrix is derived from the model matrix in the shader
 struct InstanceData
 {
-    mat4 m_ModelMatrix;
-    mat4 m_NormalMatrix;
+    vec4 m_ModelMatrixRows[3];
 };
 
+mat4 GetModelMatrix(InstanceData instanceData)
+{
+    return transpose(mat4(instanceData.m_ModelMatrixRows[0], instanceData.m_ModelMatrixRows[1],
+                          instanceData.m_ModelMatrixRows[2], vec4(0.0, 0.0, 0.0, 1.0)));
+}
+
+// cofactor matrix: the inverse transpose scaled by the determinant,
+// normals and tangents are normalized in the fragment shader
+mat3 GetNormalMatrix(mat4 modelMatrix)
+{
+    vec3 x = modelMatrix[0].xyz;
+    vec3 y = modelMatrix[1].xyz;
+    vec3 z = modelMatrix[2].xyz;
+    mat3 cofactor = mat3(cross(y, z), cross(z, x), cross(x, y));
+    return (dot(x, cross(y, z)) < 0.0) ? -cofactor : cofactor;
+}
+
 struct VertexCtrl
 {
     // byte 0 to 15
@@ -74,7 +93,11 @@ struct MeshBufferData
     BDA m_VertexBufferDeviceAddress;
     BDA m_IndexBufferDeviceAddress;
     BDA m_InstanceBufferDeviceAddress;
-    BDA m_SkeletalAnimationBufferDeviceAddress;
+    BDA m_PositionBufferDeviceAddress;
+
+    // byte 32 to 39
+    uint m_VertexFormat; // GLSL_VERTEX_FORMAT_*
+    uint m_Reserve0;
 };
 
 struct PbrMaterialProperties
@@ -125,9 +148,10 @@ struct DrawCallInfo
     SubmeshInfo m_SubmeshInfo;
 };
 
-layout(buffer_reference, scalar) readonly buffer VertexBuffer
+// compact vertex streams, see VertexStreams (vertexStreams.h)
+layout(buffer_reference, scalar) readonly buffer VertexStream
 {
-    Vertex m_Vertices[];
+    uint m_Words[];
 };
 
 layout(buffer_reference, scalar) readonly buffer IndexBuffer
@@ -163,3 +187,49 @@ layout(set = 0, binding = 0) uniform GlobalUniformBuffer
     int m_NumberOfActiveDirectionalLights;
 } ubo;
 
+vec3 UnpackOctahedral(uint packed)
+{
+    vec2 octahedral = unpackSnorm2x16(packed);
+    vec3 direction = vec3(octahedral, 1.0 - abs(octahedral.x) - abs(octahedral.y));
+    float fold = max(-direction.z, 0.0);
+    direction.x += (direction.x >= 0.0) ? -fold : fold;
+    direction.y += (direction.y >= 0.0) ? -fold : fold;
+    return normalize(direction);
+}
+
+Vertex FetchVertex(MeshBufferData meshBufferData, uint index)
+{
+    Vertex vertex;
+    uint vertexFormat = meshBufferData.m_VertexFormat;
+    bool skinned = bool(vertexFormat & GLSL_VERTEX_FORMAT_SKINNED);
+    bool floatUV = bool(vertexFormat & GLSL_VERTEX_FORMAT_FLOAT_UV);
+
+    // position stream: position, (skinned: joint ids, weights)
+    VertexStream positionStream = VertexStream(meshBufferData.m_PositionBufferDeviceAddress);
+    uint word = index * (skinned ? 6 : 3);
+    vertex.m_Position = uintBitsToFloat(uvec3(positionStream.m_Words[word],
+                                              positionStream.m_Words[word + 1],
+                                              positionStream.m_Words[word + 2]));
+    if (skinned)
+    {
+        uint jointIds = positionStream.m_Words[word + 3];
+        vertex.m_JointIds = ivec4(jointIds & 0xff, (jointIds >> 8) & 0xff, (jointIds >> 16) & 0xff, jointIds >> 24);
+        vertex.m_Weights = vec4(unpackUnorm2x16(positionStream.m_Words[word + 4]),
+                                unpackUnorm2x16(positionStream.m_Words[word + 5]));
+    }
+    else
+    {
+        vertex.m_JointIds = ivec4(0);
+        vertex.m_Weights = vec4(0.0);
+    }
+
+    // attribute stream: normal, tangent, color, uv
+    VertexStream attributeStream = VertexStream(meshBufferData.m_VertexBufferDeviceAddress);
+    word = index * (floatUV ? 5 : 4);
+    vertex.m_Normal = UnpackOctahedral(attributeStream.m_Words[word]);
+    vertex.m_Tangent = UnpackOctahedral(attributeStream.m_Words[word + 1]);
+    vertex.m_Color = unpackUnorm4x8(attributeStream.m_Words[word + 2]);
+    vertex.m_UV = floatUV ? uintBitsToFloat(uvec2(attributeStream.m_Words[word + 3], attributeStream.m_Words[word + 4]))
+                          : unpackHalf2x16(attributeStream.m_Words[word + 3]);
+    return vertex;
+}
@@ -28,6 +28,7 @@
 
 #include "engine/platform/Vulkan/pointlights.h"
 #include "engine/platform/Vulkan/material.h"
+#include "engine/platform/Vulkan/shader.h"
 
 // pbrBindless.h contains the declartion of the types
 // and the definition of buffers and push constants
@@ -86,8 +86,7 @@ void main()
         index += push.m_Constants.m_SubmeshInfo.m_VertexOffset;
 
         // Vertex fetch
-        VertexBuffer vertexBuffer = VertexBuffer(mesh.m_Data.m_VertexBufferDeviceAddress);
-        Vertex vertex = vertexBuffer.m_Vertices[index];
+        Vertex vertex = FetchVertex(mesh.m_Data, index);
 
         position = vertex.m_Position;
         color    = vertex.m_Color;
@@ -103,8 +102,8 @@ void main()
         // Index into it using gl_InstanceIndex
         instanceData = instanceBuffer.m_Data[gl_InstanceIndex];
 
-        modelMatrix  = instanceData.m_ModelMatrix;
-        normalMatrix = instanceData.m_NormalMatrix;
+        modelMatrix  = GetModelMatrix(instanceData);
+        normalMatrix = mat4(GetNormalMatrix(modelMatrix));
     }
 
     // projection * view * model * position
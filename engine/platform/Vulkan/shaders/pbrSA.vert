@@ -47,6 +47,8 @@ layout(buffer_reference, scalar) readonly buffer SkeletalAnimationShaderData
 layout(push_constant, scalar) uniform Push
 {
     layout(offset = 0) DrawCallInfo m_Constants;
+    // byte 48 to 55
+    layout(offset = 48) BDA m_JointMatricesDeviceAddress; // first joint of the skeleton in the joint matrices of this frame
 } push;
 
 void main()
@@ -74,8 +76,7 @@ void main()
         index += push.m_Constants.m_SubmeshInfo.m_VertexOffset;
 
         // Vertex fetch
-        VertexBuffer vertexBuffer = VertexBuffer(mesh.m_Data.m_VertexBufferDeviceAddress);
-        Vertex vertex = vertexBuffer.m_Vertices[index];
+        Vertex vertex = FetchVertex(mesh.m_Data, index);
 
         position = vertex.m_Position;
         color    = vertex.m_Color;
@@ -87,12 +88,12 @@ void main()
 
         // Create a reference to the buffer from the BDA
         instanceBuffer = InstanceBuffer(mesh.m_Data.m_InstanceBufferDeviceAddress);
-        skeletalAnimation = SkeletalAnimationShaderData(mesh.m_Data.m_SkeletalAnimationBufferDeviceAddress);
+        skeletalAnimation = SkeletalAnimationShaderData(push.m_JointMatricesDeviceAddress);
 
         // Index into it using gl_InstanceIndex
         instanceData = instanceBuffer.m_Data[gl_InstanceIndex];
 
-        modelMatrix  = instanceData.m_ModelMatrix;
+        modelMatrix  = GetModelMatrix(instanceData);
     }
     
     vec4 animatedPosition = vec4(0.0f);
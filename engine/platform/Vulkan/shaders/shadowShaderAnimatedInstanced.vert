@@ -20,18 +20,21 @@
    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 #version 450
+#extension GL_ARB_gpu_shader_int64 : require
+#extension GL_EXT_buffer_reference : require
+#extension GL_EXT_scalar_block_layout : require
 
 #include "engine/renderer/skeletalAnimation/joints.h"
 #include "engine/platform/Vulkan/resource.h"
 
 layout(location = 0) in vec3  position;
-layout(location = 5) in ivec4 jointIds;
+layout(location = 5) in uvec4 jointIds;
 layout(location = 6) in vec4  weights;
 
+// see VK_InstanceBuffer: rows 0 to 2 of the model matrix
 struct InstanceData
 {
-    mat4 m_ModelMatrix;
-    mat4 m_NormalMatrix;
+    vec4 m_ModelMatrixRows[3];
 };
 
 layout(set = 0, binding = 0) uniform ShadowUniformBuffer
@@ -40,18 +43,25 @@ layout(set = 0, binding = 0) uniform ShadowUniformBuffer
     mat4 m_View;
 } ubo;
 
-layout(set = 1, binding = 1) uniform SkeletalAnimationShaderData
+layout(buffer_reference, scalar) readonly buffer SkeletalAnimationShaderData
 {
-    mat4 m_FinalJointsMatrices[MAX_JOINTS];
-} skeletalAnimation;
+    mat4 m_FinalJointsMatrices[];
+};
+
+layout(push_constant, scalar) uniform Push
+{
+    uint64_t m_JointMatricesDeviceAddress; // first joint of the skeleton in the joint matrices of this frame
+} push;
 
 layout(set = 1, binding = 0) readonly buffer InstanceUniformBuffer
 {
-    InstanceData m_InstanceData[MAX_INSTANCE];
+    InstanceData m_InstanceData[];
 } uboInstanced;
 
 void main()
 {
+    SkeletalAnimationShaderData skeletalAnimation = SkeletalAnimationShaderData(push.m_JointMatricesDeviceAddress);
+
     vec4 animatedPosition = vec4(0.0f);
     mat4 jointTransform    = mat4(0.0f);
     for (int i = 0 ; i < MAX_JOINT_INFLUENCE ; i++)
@@ -70,7 +80,9 @@ void main()
     }
 
     // projection * view * model * position
-    mat4 modelMatrix = uboInstanced.m_InstanceData[gl_InstanceIndex].m_ModelMatrix;
+    InstanceData instanceData = uboInstanced.m_InstanceData[gl_InstanceIndex];
+    mat4 modelMatrix = transpose(mat4(instanceData.m_ModelMatrixRows[0], instanceData.m_ModelMatrixRows[1],
+                                      instanceData.m_ModelMatrixRows[2], vec4(0.0, 0.0, 0.0, 1.0)));
     vec4 positionWorld = modelMatrix * animatedPosition;
     gl_Position        = ubo.m_Projection * ubo.m_View * positionWorld;
 }
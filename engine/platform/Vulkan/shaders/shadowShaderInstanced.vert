@@ -30,20 +30,22 @@ layout(set = 0, binding = 0) uniform ShadowUniformBuffer
     mat4 m_View;
 } ubo;
 
+// see VK_InstanceBuffer: rows 0 to 2 of the model matrix
 struct InstanceData
 {
-    mat4 m_ModelMatrix;
-    mat4 m_NormalMatrix;
+    vec4 m_ModelMatrixRows[3];
 };
 
 layout(set = 1, binding = 0) readonly buffer InstanceUniformBuffer
 {
-    InstanceData m_InstanceData[MAX_INSTANCE];
+    InstanceData m_InstanceData[];
 } uboInstanced;
 
 void main()
 {
-    mat4 modelMatrix = uboInstanced.m_InstanceData[gl_InstanceIndex].m_ModelMatrix;
+    InstanceData instanceData = uboInstanced.m_InstanceData[gl_InstanceIndex];
+    mat4 modelMatrix = transpose(mat4(instanceData.m_ModelMatrixRows[0], instanceData.m_ModelMatrixRows[1],
+                                      instanceData.m_ModelMatrixRows[2], vec4(0.0, 0.0, 0.0, 1.0)));
 
     // projection * view * model * position
     gl_Position = ubo.m_Projection * ubo.m_View * modelMatrix * vec4(position, 1.0);
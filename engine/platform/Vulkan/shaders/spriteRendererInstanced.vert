@@ -0,0 +1,137 @@
+/* Engine Copyright (c) 2025 Engine Development Team 
+   https://github.com/beaumanvienna/vulkan
+   * 
+   * instanced particles: one shared quad, per-instance data from ParticleSystem
+   * lighting is done in spriteRendererInstanced.frag
+   * 
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS 
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY 
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+#version 450
+#extension GL_ARB_gpu_shader_int64 : require
+#extension GL_EXT_buffer_reference : require
+#extension GL_EXT_scalar_block_layout : require
+
+#include "engine/platform/Vulkan/pointlights.h"
+
+#define BDA uint64_t // buffer device address
+
+// the shared quad, positions are in [-1, 1]
+layout(location = 0) in vec3  position;
+layout(location = 1) in vec4  color;
+layout(location = 2) in vec3  normal;
+layout(location = 3) in vec2  uv;
+
+// see ParticleSystem::Instance
+struct ParticleInstance
+{
+    vec4 m_PositionSize; // xyz: position, w: size
+    vec4 m_Rotation;     // xyz: euler angles
+    vec4 m_Color;
+    vec4 m_UV;           // sprite in sprite sheet: x1, y1, x2, y2
+};
+
+layout(buffer_reference, scalar) readonly buffer ParticleBuffer
+{
+    ParticleInstance m_Instances[];
+};
+
+struct PointLight
+{
+    vec4 m_Position;  // ignore w
+    vec4 m_Color;     // w is intensity
+};
+
+struct DirectionalLight
+{
+    vec4 m_Direction;  // ignore w
+    vec4 m_Color;     // w is intensity
+};
+
+layout(set = 0, binding = 0) uniform GlobalUniformBuffer
+{
+    mat4 m_Projection;
+    mat4 m_View;
+
+    // point light
+    vec4 m_AmbientLightColor;
+    PointLight m_PointLights[MAX_LIGHTS];
+    DirectionalLight m_DirectionalLight;
+    int m_NumberOfActivePointLights;
+    int m_NumberOfActiveDirectionalLights;
+} ubo;
+
+layout(push_constant, scalar) uniform Push
+{
+    layout(offset = 0) BDA m_ParticleBufferDeviceAddress;
+} push;
+
+layout(location = 0) out vec4  fragColor;
+layout(location = 1) out vec3  fragPositionWorld;
+layout(location = 2) out vec3  fragMormalWorld;
+layout(location = 3) out vec2  fragUV;
+layout(location = 4) out vec3  toCameraDirection;
+
+// same convention as glm::toMat3(glm::quat(eulerAngles)) in TransformComponent
+mat3 EulerToMat3(vec3 eulerAngles)
+{
+    vec3 c = cos(eulerAngles * 0.5);
+    vec3 s = sin(eulerAngles * 0.5);
+
+    vec4 q;
+    q.w = c.x * c.y * c.z + s.x * s.y * s.z;
+    q.x = s.x * c.y * c.z - c.x * s.y * s.z;
+    q.y = c.x * s.y * c.z + s.x * c.y * s.z;
+    q.z = c.x * c.y * s.z - s.x * s.y * c.z;
+
+    float xx = q.x * q.x; float yy = q.y * q.y; float zz = q.z * q.z;
+    float xy = q.x * q.y; float xz = q.x * q.z; float yz = q.y * q.z;
+    float wx = q.w * q.x; float wy = q.w * q.y; float wz = q.w * q.z;
+
+    // column major
+    return mat3(
+        vec3(1.0 - 2.0 * (yy + zz), 2.0 * (xy + wz), 2.0 * (xz - wy)),
+        vec3(2.0 * (xy - wz), 1.0 - 2.0 * (xx + zz), 2.0 * (yz + wx)),
+        vec3(2.0 * (xz + wy), 2.0 * (yz - wx), 1.0 - 2.0 * (xx + yy))
+    );
+}
+
+void main()
+{
+    ParticleBuffer particleBuffer = ParticleBuffer(push.m_ParticleBufferDeviceAddress);
+    ParticleInstance instance = particleBuffer.m_Instances[gl_InstanceIndex];
+
+    mat3 rotation = EulerToMat3(instance.m_Rotation.xyz);
+    vec3 positionWorld = rotation * (position * instance.m_PositionSize.w) + instance.m_PositionSize.xyz;
+
+    // lighting
+    fragPositionWorld = positionWorld;
+    fragMormalWorld = normalize(rotation * normal);
+    fragColor = instance.m_Color;
+
+    gl_Position = ubo.m_Projection * ubo.m_View * vec4(positionWorld, 1.0);
+
+    // map the quad corner to the current frame in the sprite sheet
+    vec2 corner = position.xy * 0.5 + 0.5;
+    fragUV = vec2(mix(instance.m_UV.x, instance.m_UV.z, corner.x), mix(instance.m_UV.w, instance.m_UV.y, corner.y));
+
+    vec3 cameraPosWorld = (inverse(ubo.m_View) * vec4(0.0,0.0,0.0,1.0)).xyz;
+    toCameraDirection = cameraPosWorld - positionWorld;
+}
@@ -111,8 +111,6 @@ namespace GfxRenderEngine
     void VK_RenderSystemGrass2::RenderEntities(const VK_FrameInfo& frameInfo, Registry& registry,
                                                VK_BindlessTexture* bindlessTexture, VK_BindlessImage* bindlessImage)
     {
-        bindlessTexture->UpdateBindlessDescriptorSets();
-        bindlessImage->UpdateBindlessDescriptorSets();
         m_Pipeline->Bind(frameInfo.m_CommandBuffer);
         { // bind descriptor sets
             auto descriptorSets = std::to_array(
@@ -135,11 +133,11 @@ namespace GfxRenderEngine
             // update instance buffer on the GPU
             InstanceTag& instanced = view.get<InstanceTag>(mainInstance);
             VK_InstanceBuffer* instanceBuffer = static_cast<VK_InstanceBuffer*>(instanced.m_InstanceBuffer.get());
-            instanceBuffer->Update();
+            instanceBuffer->Update(frameInfo.m_FrameIndex);
 
-            if (mesh.m_Enabled)
+            int instanceCount = view.get<Grass2Tag>(mainInstance).m_InstanceCount;
+            if (mesh.m_Enabled && instanceCount)
             {
-                int instanceCount = view.get<Grass2Tag>(mainInstance).m_InstanceCount;
                 auto model = static_cast<VK_Model*>(mesh.m_Model.get());
                 m_DrawCallInfoGrass.m_MeshBufferDeviceAddress = model->GetMeshBufferDeviceAddress();
                 m_DrawCallInfoGrass.m_GrassParameters = view.get<Grass2Tag>(mainInstance).m_GrassParameters;
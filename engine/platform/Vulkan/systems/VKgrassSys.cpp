@@ -108,8 +108,6 @@ namespace GfxRenderEngine
     void VK_RenderSystemGrass::RenderEntities(const VK_FrameInfo& frameInfo, Registry& registry,
                                               VK_BindlessTexture* bindlessTexture, VK_BindlessImage* bindlessImage)
     {
-        bindlessTexture->UpdateBindlessDescriptorSets();
-        bindlessImage->UpdateBindlessDescriptorSets();
         m_Pipeline->Bind(frameInfo.m_CommandBuffer);
         { // bind descriptor sets
             auto descriptorSets = std::to_array(
@@ -132,7 +130,7 @@ namespace GfxRenderEngine
             // update instance buffer on the GPU
             InstanceTag& instanced = view.get<InstanceTag>(mainInstance);
             VK_InstanceBuffer* instanceBuffer = static_cast<VK_InstanceBuffer*>(instanced.m_InstanceBuffer.get());
-            instanceBuffer->Update();
+            instanceBuffer->Update(frameInfo.m_FrameIndex);
 
             if (mesh.m_Enabled)
             {
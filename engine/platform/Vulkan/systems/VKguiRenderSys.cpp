@@ -46,19 +46,14 @@ namespace GfxRenderEngine
 
     void VK_RenderSystemGUIRenderer::CreatePipelineLayout(VkDescriptorSetLayout globalDescriptorSetLayout)
     {
-        VkPushConstantRange pushConstantRange{};
-        pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
-        pushConstantRange.offset = 0;
-        pushConstantRange.size = sizeof(VK_PushConstantDataGUIRenderer);
-
         std::vector<VkDescriptorSetLayout> descriptorSetLayouts{globalDescriptorSetLayout};
 
         VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
         pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
         pipelineLayoutInfo.setLayoutCount = static_cast<uint>(descriptorSetLayouts.size());
         pipelineLayoutInfo.pSetLayouts = descriptorSetLayouts.data();
-        pipelineLayoutInfo.pushConstantRangeCount = 1;
-        pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+        pipelineLayoutInfo.pushConstantRangeCount = 0;
+        pipelineLayoutInfo.pPushConstantRanges = nullptr;
         auto result = vkCreatePipelineLayout(VK_Core::m_Device->Device(), &pipelineLayoutInfo, nullptr, &m_PipelineLayout);
         if (result != VK_SUCCESS)
         {
@@ -74,79 +69,87 @@ namespace GfxRenderEngine
         PipelineConfigInfo pipelineConfig{};
 
         VK_Pipeline::DefaultPipelineConfigInfo(pipelineConfig);
-        pipelineConfig.m_BindingDescriptions.clear();
-        pipelineConfig.m_AttributeDescriptions.clear();
         pipelineConfig.renderPass = renderPass;
         pipelineConfig.pipelineLayout = m_PipelineLayout;
         pipelineConfig.subpass = static_cast<uint>(VK_RenderPass::SubPassesGUI::SUBPASS_GUI);
 
-        // create pipelines
-        m_Pipeline = std::make_unique<VK_Pipeline>(VK_Core::m_Device, "bin-int/guiShader.vert.spv",
-                                                   "bin-int/guiShader.frag.spv", pipelineConfig);
-
-        m_Pipeline2 = std::make_unique<VK_Pipeline>(VK_Core::m_Device, "bin-int/guiShader2.vert.spv",
-                                                    "bin-int/guiShader2.frag.spv", pipelineConfig);
+        // one instance per quad, the six vertices of a quad are generated from gl_VertexIndex
+        using QuadInstance = GUIBatch::QuadInstance;
+        pipelineConfig.m_BindingDescriptions = {{0, sizeof(QuadInstance), VK_VERTEX_INPUT_RATE_INSTANCE}};
+        pipelineConfig.m_AttributeDescriptions = {
+            {0, 0, VK_FORMAT_R32G32B32A32_SFLOAT, static_cast<uint>(offsetof(QuadInstance, m_Corners01))},
+            {1, 0, VK_FORMAT_R32G32B32A32_SFLOAT, static_cast<uint>(offsetof(QuadInstance, m_Corners23))},
+            {2, 0, VK_FORMAT_R32G32B32A32_SFLOAT, static_cast<uint>(offsetof(QuadInstance, m_UV))},
+            {3, 0, VK_FORMAT_R8G8B8A8_UNORM, static_cast<uint>(offsetof(QuadInstance, m_Color))},
+            {4, 0, VK_FORMAT_R32_UINT, static_cast<uint>(offsetof(QuadInstance, m_Flags))}};
+
+        // create pipeline
+        m_Pipeline = std::make_unique<VK_Pipeline>(VK_Core::m_Device, "bin-int/guiBatch.vert.spv",
+                                                   "bin-int/guiBatch.frag.spv", pipelineConfig);
     }
 
-    // uses guiShader
-    void VK_RenderSystemGUIRenderer::RenderSprite(const VK_FrameInfo& frameInfo, const Sprite& sprite,
-                                                  const glm::mat4& modelViewProjectionMatrix)
+    void VK_RenderSystemGUIRenderer::BeginFrame(const VK_FrameInfo& frameInfo)
     {
-        // this function takes in a sprite and transformation matrix to be applied to the normalized device coordinates
-        vkCmdBindDescriptorSets(frameInfo.m_CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_PipelineLayout, 0, 1,
-                                &frameInfo.m_GlobalDescriptorSet, 0, nullptr);
-        m_Pipeline->Bind(frameInfo.m_CommandBuffer);
-
-        VK_PushConstantDataGUIRenderer push{};
-        push.m_MVP = modelViewProjectionMatrix;
-
-        push.m_UV[0] = {sprite.m_Pos1X, sprite.m_Pos1Y};
-        push.m_UV[1] = {sprite.m_Pos2X, sprite.m_Pos2Y};
+        m_RetiredBuffers[frameInfo.m_FrameIndex].clear();
+        m_Batch.Begin(static_cast<float>(Engine::m_Engine->GetWindowWidth()),
+                      static_cast<float>(Engine::m_Engine->GetWindowHeight()));
+    }
 
-        vkCmdPushConstants(frameInfo.m_CommandBuffer, m_PipelineLayout,
-                           VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0,
-                           sizeof(VK_PushConstantDataGUIRenderer), &push);
+    // transformation matrix to be applied to the normalized device coordinates of a quad
+    void VK_RenderSystemGUIRenderer::RenderSprite(const Sprite& sprite, const glm::mat4& modelViewProjectionMatrix)
+    {
+        m_Batch.AddQuad({sprite.m_Pos1X, sprite.m_Pos1Y, sprite.m_Pos2X, sprite.m_Pos2Y}, modelViewProjectionMatrix);
+    }
 
-        vkCmdDraw(frameInfo.m_CommandBuffer, // VkCommandBuffer commandBuffer
-                  m_VertexCount,             // uint32_t        vertexCount
-                  1,                         // uint32_t        instanceCount
-                  0,                         // uint32_t        firstVertex
-                  0                          // uint32_t        firstInstance
-        );
+    // four 2D positions in pixels and a color
+    void VK_RenderSystemGUIRenderer::RenderSprite(const Sprite& sprite, const glm::mat4& position,
+                                                  const glm::vec4& color, const float textureID)
+    {
+        m_Batch.AddQuad({sprite.m_Pos1X, sprite.m_Pos1Y, sprite.m_Pos2X, sprite.m_Pos2Y}, position, color, textureID);
     }
 
-    // uses guiShader2
-    void VK_RenderSystemGUIRenderer::RenderSprite(const VK_FrameInfo& frameInfo, const Sprite& sprite,
-                                                  const glm::mat4& position, const glm::vec4& color, const float textureID)
+    void VK_RenderSystemGUIRenderer::Flush(const VK_FrameInfo& frameInfo)
     {
-        // this function takes in a sprite, four 2D positions, and a color
+        GUIBatch::DrawRange range = m_Batch.Flush();
+        if (!range.m_InstanceCount)
+        {
+            return;
+        }
+        ZoneScopedN("VK_RenderSystemGUIRenderer::Flush()");
+
+        auto& instanceBuffer = m_InstanceBuffers[frameInfo.m_FrameIndex];
+        uint requiredCapacity = range.m_FirstInstance + range.m_InstanceCount;
+        if (!instanceBuffer || (instanceBuffer->GetInstanceCount() < requiredCapacity))
+        {
+            if (instanceBuffer)
+            {
+                m_RetiredBuffers[frameInfo.m_FrameIndex].push_back(std::move(instanceBuffer));
+            }
+            uint capacity = std::max(MIN_INSTANCE_CAPACITY, 2 * requiredCapacity);
+            instanceBuffer =
+                std::make_unique<VK_Buffer>(sizeof(GUIBatch::QuadInstance), capacity, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+                                            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+            instanceBuffer->Map();
+        }
+
+        // only the instances of this draw call, earlier draws of this frame may use a retired buffer
+        VkDeviceSize offset = range.m_FirstInstance * sizeof(GUIBatch::QuadInstance);
+        instanceBuffer->WriteToBuffer(&m_Batch.GetInstances()[range.m_FirstInstance],
+                                      range.m_InstanceCount * sizeof(GUIBatch::QuadInstance), offset);
 
         vkCmdBindDescriptorSets(frameInfo.m_CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_PipelineLayout, 0, 1,
                                 &frameInfo.m_GlobalDescriptorSet, 0, nullptr);
-        m_Pipeline2->Bind(frameInfo.m_CommandBuffer);
-
-        VK_PushConstantDataGUIRenderer2 push{};
-        push.m_Mat4 = position;
-        push.m_Mat4[2][0] = color.r;
-        push.m_Mat4[3][0] = color.g;
-        push.m_Mat4[2][1] = color.b;
-        push.m_Mat4[3][1] = color.a;
-        push.m_Mat4[2][2] = Engine::m_Engine->GetWindowWidth();
-        push.m_Mat4[2][3] = Engine::m_Engine->GetWindowHeight();
-        push.m_Mat4[3][2] = textureID;
-
-        push.m_UV[0] = {sprite.m_Pos1X, sprite.m_Pos1Y};
-        push.m_UV[1] = {sprite.m_Pos2X, sprite.m_Pos2Y};
-
-        vkCmdPushConstants(frameInfo.m_CommandBuffer, m_PipelineLayout,
-                           VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0,
-                           sizeof(VK_PushConstantDataGUIRenderer), &push);
-
-        vkCmdDraw(frameInfo.m_CommandBuffer, // VkCommandBuffer commandBuffer
-                  m_VertexCount,             // uint32_t        vertexCount
-                  1,                         // uint32_t        instanceCount
-                  0,                         // uint32_t        firstVertex
-                  0                          // uint32_t        firstInstance
+        m_Pipeline->Bind(frameInfo.m_CommandBuffer);
+
+        VkBuffer buffers[] = {instanceBuffer->GetBuffer()};
+        VkDeviceSize offsets[] = {0};
+        vkCmdBindVertexBuffers(frameInfo.m_CommandBuffer, 0, 1, buffers, offsets);
+
+        vkCmdDraw(frameInfo.m_CommandBuffer,  // VkCommandBuffer commandBuffer
+                  VERTEX_COUNT,               // uint32_t        vertexCount
+                  range.m_InstanceCount,      // uint32_t        instanceCount
+                  0,                          // uint32_t        firstVertex
+                  range.m_FirstInstance       // uint32_t        firstInstance
         );
     }
 } // namespace GfxRenderEngine
@@ -30,27 +30,18 @@
 #include "engine.h"
 #include "renderer/camera.h"
 #include "scene/scene.h"
+#include "renderer/guiBatch.h"
 
 #include "VKdevice.h"
 #include "VKbuffer.h"
 #include "VKpipeline.h"
 #include "VKframeInfo.h"
 #include "VKdescriptor.h"
+#include "VKswapChain.h"
 
 namespace GfxRenderEngine
 {
-    struct VK_PushConstantDataGUIRenderer
-    {
-        glm::mat4 m_MVP{1.0f};
-        glm::vec2 m_UV[2];
-    };
-
-    struct VK_PushConstantDataGUIRenderer2
-    {
-        glm::mat4 m_Mat4{1.0f};
-        glm::vec2 m_UV[2];
-    };
-
+    // draws the quads of the GUI batched per frame, see GUIBatch
     class VK_RenderSystemGUIRenderer
     {
 
@@ -61,18 +52,29 @@ namespace GfxRenderEngine
         VK_RenderSystemGUIRenderer(const VK_RenderSystemGUIRenderer&) = delete;
         VK_RenderSystemGUIRenderer& operator=(const VK_RenderSystemGUIRenderer&) = delete;
 
-        void RenderSprite(const VK_FrameInfo& frameInfo, const Sprite& sprite, const glm::mat4& modelViewProjectionMatrix);
-        void RenderSprite(const VK_FrameInfo& frameInfo, const Sprite& sprite, const glm::mat4& position,
-                          const glm::vec4& color, const float textureID = 1.0f);
+        void BeginFrame(const VK_FrameInfo& frameInfo);
+        void RenderSprite(const Sprite& sprite, const glm::mat4& modelViewProjectionMatrix);
+        void RenderSprite(const Sprite& sprite, const glm::mat4& position, const glm::vec4& color,
+                          const float textureID = 1.0f);
+
+        // draws all sprites submitted since the last flush with one instanced draw call,
+        // must be called before anything else is recorded into the GUI render pass
+        void Flush(const VK_FrameInfo& frameInfo);
 
     private:
         void CreatePipelineLayout(VkDescriptorSetLayout globalDescriptorSetLayout);
         void CreatePipeline(VkRenderPass renderPass);
 
     private:
-        const uint m_VertexCount = 6;
+        static constexpr uint VERTEX_COUNT = 6;
+        static constexpr uint MIN_INSTANCE_CAPACITY = 4096;
+
         VkPipelineLayout m_PipelineLayout;
         std::unique_ptr<VK_Pipeline> m_Pipeline;
-        std::unique_ptr<VK_Pipeline> m_Pipeline2;
+
+        GUIBatch m_Batch;
+        std::unique_ptr<VK_Buffer> m_InstanceBuffers[VK_SwapChain::MAX_FRAMES_IN_FLIGHT];
+        // outgrown buffers may still be referenced by draw calls of their frame
+        std::vector<std::unique_ptr<VK_Buffer>> m_RetiredBuffers[VK_SwapChain::MAX_FRAMES_IN_FLIGHT];
     };
 } // namespace GfxRenderEngine
@@ -109,8 +109,6 @@ namespace GfxRenderEngine
                                                          VK_BindlessTexture* bindlessTexture,
                                                          VK_BindlessImage* bindlessImage)
     {
-        bindlessTexture->UpdateBindlessDescriptorSets();
-        bindlessImage->UpdateBindlessDescriptorSets();
         m_Pipeline->Bind(frameInfo.m_CommandBuffer);
         { // bind descriptor sets
             auto descriptorSets = std::to_array(
@@ -126,21 +124,21 @@ namespace GfxRenderEngine
             );
         }
 
-        auto view = registry.Get().view<MeshComponent, TransformComponent, PbrMultiMaterialTag, InstanceTag>();
+        auto view = registry.view<MeshComponent, TransformComponent, PbrMultiMaterialTag, InstanceTag>();
         for (auto mainInstance : view)
         {
             auto& mesh = view.get<MeshComponent>(mainInstance);
             // update instance buffer on the GPU
             InstanceTag& instanced = view.get<InstanceTag>(mainInstance);
             VK_InstanceBuffer* instanceBuffer = static_cast<VK_InstanceBuffer*>(instanced.m_InstanceBuffer.get());
-            instanceBuffer->Update();
+            instanceBuffer->Update(frameInfo.m_FrameIndex);
 
-            if (mesh.m_Enabled)
+            if (mesh.m_Enabled && instanced.IsVisible(frameInfo.m_VisibilityPass))
             {
                 auto model = static_cast<VK_Model*>(mesh.m_Model.get());
                 m_DrawCallInfoMultiMaterial.m_MeshBufferDeviceAddress = model->GetMeshBufferDeviceAddress();
-                static_cast<VK_Model*>(mesh.m_Model.get())
-                    ->DrawPbr(frameInfo, m_PipelineLayout, m_DrawCallInfoMultiMaterial);
+                model->DrawPbr(frameInfo, m_PipelineLayout, m_DrawCallInfoMultiMaterial,
+                               instanceBuffer->GetInstanceRange(frameInfo.m_FrameIndex, frameInfo.m_VisibilityPass));
             }
         }
     }
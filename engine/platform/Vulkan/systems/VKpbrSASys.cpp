@@ -27,6 +27,7 @@
 #include "VKmodel.h"
 
 #include "systems/VKpbrSASys.h"
+#include "systems/pushConstantData.h"
 
 namespace GfxRenderEngine
 {
@@ -49,7 +50,13 @@ namespace GfxRenderEngine
         pushConstantRange0.offset = 0;
         pushConstantRange0.size = sizeof(m_DrawCallInfo);
 
-        auto pushConstantRanges = std::to_array({pushConstantRange0});
+        // joint matrices of the skeleton, behind the draw call info
+        VkPushConstantRange pushConstantRange1{};
+        pushConstantRange1.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+        pushConstantRange1.offset = sizeof(m_DrawCallInfo);
+        pushConstantRange1.size = sizeof(VK_PushConstantDataJointMatrices);
+
+        auto pushConstantRanges = std::to_array({pushConstantRange0, pushConstantRange1});
 
         VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
         pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
@@ -102,11 +109,14 @@ namespace GfxRenderEngine
 
     void VK_RenderSystemPbrSA::SetVertexCtrl(VertexCtrl const& vertexCtrl) { m_DrawCallInfo.m_VertexCtrl = vertexCtrl; }
 
+    void VK_RenderSystemPbrSA::SetJointMatrices(Buffer::BufferDeviceAddress jointMatrices)
+    {
+        m_JointMatrices = jointMatrices;
+    }
+
     void VK_RenderSystemPbrSA::RenderEntities(const VK_FrameInfo& frameInfo, Registry& registry,
                                               VK_BindlessTexture* bindlessTexture, VK_BindlessImage* bindlessImage)
     {
-        bindlessTexture->UpdateBindlessDescriptorSets();
-        bindlessImage->UpdateBindlessDescriptorSets();
         m_Pipeline->Bind(frameInfo.m_CommandBuffer);
         { // bind descriptor sets
             auto descriptorSets = std::to_array(
@@ -129,13 +139,20 @@ namespace GfxRenderEngine
             // update instance buffer on the GPU
             InstanceTag& instanced = view.get<InstanceTag>(mainInstance);
             VK_InstanceBuffer* instanceBuffer = static_cast<VK_InstanceBuffer*>(instanced.m_InstanceBuffer.get());
-            instanceBuffer->Update();
+            instanceBuffer->Update(frameInfo.m_FrameIndex);
 
             if (mesh.m_Enabled)
             {
                 auto model = static_cast<VK_Model*>(mesh.m_Model.get());
+                VK_PushConstantDataJointMatrices push{};
+                push.m_JointMatricesDeviceAddress =
+                    m_JointMatrices + model->GetSkeleton()->m_ShaderData.m_FirstJoint * sizeof(glm::mat4);
+                vkCmdPushConstants(frameInfo.m_CommandBuffer, m_PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT,
+                                   sizeof(m_DrawCallInfo), sizeof(VK_PushConstantDataJointMatrices), &push);
+
                 m_DrawCallInfo.m_MeshBufferDeviceAddress = model->GetMeshBufferDeviceAddress();
-                model->DrawPbr(frameInfo, m_PipelineLayout, m_DrawCallInfo);
+                model->DrawPbr(frameInfo, m_PipelineLayout, m_DrawCallInfo,
+                               instanceBuffer->GetInstanceRange(frameInfo.m_FrameIndex, frameInfo.m_VisibilityPass));
             }
         }
     }
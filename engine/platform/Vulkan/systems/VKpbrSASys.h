@@ -54,6 +54,8 @@ namespace GfxRenderEngine
         void RenderEntities(const VK_FrameInfo& frameInfo, Registry& registry, VK_BindlessTexture* bindlessTexture,
                             VK_BindlessImage* bindlessImage);
         void SetVertexCtrl(VertexCtrl const& vertexCtrl);
+        // device address of the joint matrices of this frame, see VK_Renderer::UpdateAnimations()
+        void SetJointMatrices(Buffer::BufferDeviceAddress jointMatrices);
 
     private:
         void CreatePipelineLayout(std::vector<VkDescriptorSetLayout>& descriptorSetLayouts);
@@ -63,5 +65,6 @@ namespace GfxRenderEngine
         VkPipelineLayout m_PipelineLayout;
         std::unique_ptr<VK_Pipeline> m_Pipeline;
         DrawCallInfo m_DrawCallInfo{};
+        Buffer::BufferDeviceAddress m_JointMatrices{0};
     };
 } // namespace GfxRenderEngine
@@ -104,8 +104,6 @@ namespace GfxRenderEngine
     void VK_RenderSystemPbr::RenderEntities(const VK_FrameInfo& frameInfo, Registry& registry,
                                             VK_BindlessTexture* bindlessTexture, VK_BindlessImage* bindlessImage)
     {
-        bindlessTexture->UpdateBindlessDescriptorSets();
-        bindlessImage->UpdateBindlessDescriptorSets();
         m_Pipeline->Bind(frameInfo.m_CommandBuffer);
         { // bind descriptor sets
             auto descriptorSets = std::to_array(
@@ -128,13 +126,14 @@ namespace GfxRenderEngine
             // update instance buffer on the GPU
             InstanceTag& instanced = view.get<InstanceTag>(mainInstance);
             VK_InstanceBuffer* instanceBuffer = static_cast<VK_InstanceBuffer*>(instanced.m_InstanceBuffer.get());
-            instanceBuffer->Update();
+            instanceBuffer->Update(frameInfo.m_FrameIndex);
 
-            if (mesh.m_Enabled)
+            if (mesh.m_Enabled && instanced.IsVisible(frameInfo.m_VisibilityPass))
             {
                 auto model = static_cast<VK_Model*>(mesh.m_Model.get());
                 m_DrawCallInfo.m_MeshBufferDeviceAddress = model->GetMeshBufferDeviceAddress();
-                model->DrawPbr(frameInfo, m_PipelineLayout, m_DrawCallInfo);
+                model->DrawPbr(frameInfo, m_PipelineLayout, m_DrawCallInfo,
+                               instanceBuffer->GetInstanceRange(frameInfo.m_FrameIndex, frameInfo.m_VisibilityPass));
             }
         }
     }
@@ -47,10 +47,17 @@ namespace GfxRenderEngine
     void
     VK_RenderSystemShadowAnimatedInstanced::CreatePipelineLayout(std::vector<VkDescriptorSetLayout>& descriptorSetLayouts)
     {
+        VkPushConstantRange pushConstantRange{};
+        pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+        pushConstantRange.offset = 0;
+        pushConstantRange.size = sizeof(VK_PushConstantDataJointMatrices);
+
         VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
         pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
         pipelineLayoutInfo.setLayoutCount = static_cast<uint>(descriptorSetLayouts.size());
         pipelineLayoutInfo.pSetLayouts = descriptorSetLayouts.data();
+        pipelineLayoutInfo.pushConstantRangeCount = 1;
+        pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
 
         auto result = vkCreatePipelineLayout(VK_Core::m_Device->Device(), &pipelineLayoutInfo, nullptr, &m_PipelineLayout);
         if (result != VK_SUCCESS)
@@ -72,6 +79,10 @@ namespace GfxRenderEngine
         pipelineConfig.pipelineLayout = m_PipelineLayout;
         pipelineConfig.subpass = static_cast<uint>(VK_ShadowMap::SubPassesShadow::SUBPASS_SHADOW);
 
+        // only the position stream of the PBR vertex streams is read
+        pipelineConfig.m_BindingDescriptions = VK_Model::VK_PositionStream::GetBindingDescriptions(/*skinned*/ true);
+        pipelineConfig.m_AttributeDescriptions = VK_Model::VK_PositionStream::GetAttributeDescriptions(/*skinned*/ true);
+
         pipelineConfig.rasterizationInfo.depthBiasEnable = VK_TRUE;
         pipelineConfig.rasterizationInfo.depthBiasConstantFactor = 8.0f; // Optional
         pipelineConfig.rasterizationInfo.depthBiasClamp = 0.0f;          // Optional
@@ -82,6 +93,11 @@ namespace GfxRenderEngine
                                                  "bin-int/shadowShaderAnimatedInstanced.frag.spv", pipelineConfig);
     }
 
+    void VK_RenderSystemShadowAnimatedInstanced::SetJointMatrices(Buffer::BufferDeviceAddress jointMatrices)
+    {
+        m_JointMatrices = jointMatrices;
+    }
+
     void VK_RenderSystemShadowAnimatedInstanced::RenderEntities(const VK_FrameInfo& frameInfo, Registry& registry,
                                                                 DirectionalLightComponent* directionalLight, int renderpass,
                                                                 const VkDescriptorSet& shadowDescriptorSet)
@@ -103,17 +119,22 @@ namespace GfxRenderEngine
             auto& mesh = view.get<MeshComponent>(mainInstance);
             if (mesh.m_Enabled)
             {
-                { // update instance buffer on the GPU
-                    InstanceTag& instanced = view.get<InstanceTag>(mainInstance);
-                    VK_InstanceBuffer* instanceBuffer = static_cast<VK_InstanceBuffer*>(instanced.m_InstanceBuffer.get());
-                    instanceBuffer->Update();
-                }
-                if (mesh.m_Enabled)
-                {
-                    static_cast<VK_Model*>(mesh.m_Model.get())->Bind(frameInfo.m_CommandBuffer);
-                    static_cast<VK_Model*>(mesh.m_Model.get())
-                        ->DrawShadowInstanced(frameInfo, m_PipelineLayout, shadowDescriptorSet);
-                }
+                // update instance buffer on the GPU
+                InstanceTag& instanced = view.get<InstanceTag>(mainInstance);
+                VK_InstanceBuffer* instanceBuffer = static_cast<VK_InstanceBuffer*>(instanced.m_InstanceBuffer.get());
+                instanceBuffer->Update(frameInfo.m_FrameIndex);
+
+                // skinned meshes are not culled, the range is the whole slice
+                uint visibilityPass = FrustumCuller::SHADOW_CASCADE_0 + renderpass;
+                auto model = static_cast<VK_Model*>(mesh.m_Model.get());
+                VK_PushConstantDataJointMatrices push{};
+                push.m_JointMatricesDeviceAddress =
+                    m_JointMatrices + model->GetSkeleton()->m_ShaderData.m_FirstJoint * sizeof(glm::mat4);
+                vkCmdPushConstants(frameInfo.m_CommandBuffer, m_PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0,
+                                   sizeof(VK_PushConstantDataJointMatrices), &push);
+                model->Bind(frameInfo.m_CommandBuffer);
+                model->DrawShadowInstanced(frameInfo, m_PipelineLayout, shadowDescriptorSet,
+                                          instanceBuffer->GetInstanceRange(frameInfo.m_FrameIndex, visibilityPass));
             }
         }
     }
@@ -52,6 +52,8 @@ namespace GfxRenderEngine
         void RenderEntities(const VK_FrameInfo& frameInfo, Registry& registry,
                             DirectionalLightComponent* directionalLight, int renderpass,
                             const VkDescriptorSet& shadowDescriptorSet);
+        // device address of the joint matrices of this frame, see VK_Renderer::UpdateAnimations()
+        void SetJointMatrices(Buffer::BufferDeviceAddress jointMatrices);
 
     private:
         void CreatePipelineLayout(std::vector<VkDescriptorSetLayout>& descriptorSetLayouts);
@@ -61,5 +63,6 @@ namespace GfxRenderEngine
         VkPipelineLayout m_PipelineLayout;
         std::unique_ptr<VK_Pipeline> m_Pipeline0;
         std::unique_ptr<VK_Pipeline> m_Pipeline1;
+        Buffer::BufferDeviceAddress m_JointMatrices{0};
     };
 } // namespace GfxRenderEngine
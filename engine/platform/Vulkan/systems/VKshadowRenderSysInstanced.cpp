@@ -68,6 +68,10 @@ namespace GfxRenderEngine
         pipelineConfig.pipelineLayout = m_PipelineLayout;
         pipelineConfig.subpass = static_cast<uint>(VK_ShadowMap::SubPassesShadow::SUBPASS_SHADOW);
 
+        // only the position stream of the PBR vertex streams is read
+        pipelineConfig.m_BindingDescriptions = VK_Model::VK_PositionStream::GetBindingDescriptions(/*skinned*/ false);
+        pipelineConfig.m_AttributeDescriptions = VK_Model::VK_PositionStream::GetAttributeDescriptions(/*skinned*/ false);
+
         pipelineConfig.rasterizationInfo.depthBiasEnable = VK_TRUE;
         pipelineConfig.rasterizationInfo.depthBiasConstantFactor = 8.0f; // Optional
         pipelineConfig.rasterizationInfo.depthBiasClamp = 0.0f;          // Optional
@@ -92,15 +96,19 @@ namespace GfxRenderEngine
             m_Pipeline1->Bind(frameInfo.m_CommandBuffer);
         }
 
-        auto meshView = registry.Get().view<MeshComponent, TransformComponent, InstanceTag, PlainPBRTag>();
+        uint visibilityPass = FrustumCuller::SHADOW_CASCADE_0 + renderpass;
+        auto meshView = registry.view<MeshComponent, TransformComponent, InstanceTag, PlainPBRTag>();
         for (auto entity : meshView)
         {
             auto& mesh = meshView.get<MeshComponent>(entity);
-            if (mesh.m_Enabled)
+            auto& instanced = meshView.get<InstanceTag>(entity);
+            if (mesh.m_Enabled && instanced.IsVisible(visibilityPass))
             {
+                auto instanceBuffer = static_cast<VK_InstanceBuffer*>(instanced.m_InstanceBuffer.get());
                 static_cast<VK_Model*>(mesh.m_Model.get())->Bind(frameInfo.m_CommandBuffer);
                 static_cast<VK_Model*>(mesh.m_Model.get())
-                    ->DrawShadowInstanced(frameInfo, m_PipelineLayout, shadowDescriptorSet);
+                    ->DrawShadowInstanced(frameInfo, m_PipelineLayout, shadowDescriptorSet,
+                                          instanceBuffer->GetInstanceRange(frameInfo.m_FrameIndex, visibilityPass));
             }
         }
     }
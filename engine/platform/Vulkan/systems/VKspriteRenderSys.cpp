@@ -24,6 +24,8 @@
 #include "VKswapChain.h"
 #include "VKrenderPass.h"
 #include "VKmodel.h"
+#include "VKbuffer.h"
+#include "VKmaterialDescriptor.h"
 
 #include "systems/VKspriteRenderSys.h"
 #include "systems/pushConstantData.h"
@@ -33,21 +35,24 @@ namespace GfxRenderEngine
     VK_RenderSystemSpriteRenderer::VK_RenderSystemSpriteRenderer(VkRenderPass renderPass,
                                                                  std::vector<VkDescriptorSetLayout>& descriptorSetLayouts)
     {
-        CreatePipelineLayout(descriptorSetLayouts);
+        CreatePipelineLayout(descriptorSetLayouts, sizeof(VK_PushConstantDataGeneric), m_PipelineLayout);
+        CreatePipelineLayout(descriptorSetLayouts, sizeof(VK_PushConstantDataParticles), m_PipelineLayoutParticles);
         CreatePipeline(renderPass);
     }
 
     VK_RenderSystemSpriteRenderer::~VK_RenderSystemSpriteRenderer()
     {
         vkDestroyPipelineLayout(VK_Core::m_Device->Device(), m_PipelineLayout, nullptr);
+        vkDestroyPipelineLayout(VK_Core::m_Device->Device(), m_PipelineLayoutParticles, nullptr);
     }
 
-    void VK_RenderSystemSpriteRenderer::CreatePipelineLayout(std::vector<VkDescriptorSetLayout>& descriptorSetLayouts)
+    void VK_RenderSystemSpriteRenderer::CreatePipelineLayout(std::vector<VkDescriptorSetLayout>& descriptorSetLayouts,
+                                                             uint pushConstantSize, VkPipelineLayout& pipelineLayout)
     {
         VkPushConstantRange pushConstantRange{};
         pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
         pushConstantRange.offset = 0;
-        pushConstantRange.size = sizeof(VK_PushConstantDataGeneric);
+        pushConstantRange.size = pushConstantSize;
 
         VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
         pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
@@ -55,7 +60,7 @@ namespace GfxRenderEngine
         pipelineLayoutInfo.pSetLayouts = descriptorSetLayouts.data();
         pipelineLayoutInfo.pushConstantRangeCount = 1;
         pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
-        auto result = vkCreatePipelineLayout(VK_Core::m_Device->Device(), &pipelineLayoutInfo, nullptr, &m_PipelineLayout);
+        auto result = vkCreatePipelineLayout(VK_Core::m_Device->Device(), &pipelineLayoutInfo, nullptr, &pipelineLayout);
         if (result != VK_SUCCESS)
         {
             VK_Core::m_Device->PrintError(result);
@@ -77,6 +82,11 @@ namespace GfxRenderEngine
         // create a pipeline
         m_Pipeline = std::make_unique<VK_Pipeline>(VK_Core::m_Device, "bin-int/spriteRenderer.vert.spv",
                                                    "bin-int/spriteRenderer.frag.spv", pipelineConfig);
+
+        // particles: one instanced draw call per particle system
+        pipelineConfig.pipelineLayout = m_PipelineLayoutParticles;
+        m_PipelineParticles = std::make_unique<VK_Pipeline>(VK_Core::m_Device, "bin-int/spriteRendererInstanced.vert.spv",
+                                                            "bin-int/spriteRendererInstanced.frag.spv", pipelineConfig);
     }
 
     void VK_RenderSystemSpriteRenderer::RenderEntities(const VK_FrameInfo& frameInfo, Registry& registry)
@@ -110,29 +120,37 @@ namespace GfxRenderEngine
 
     void VK_RenderSystemSpriteRenderer::DrawParticles(const VK_FrameInfo& frameInfo, ParticleSystem* particleSystem)
     {
-        vkCmdBindDescriptorSets(frameInfo.m_CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_PipelineLayout, 0, 1,
-                                &frameInfo.m_GlobalDescriptorSet, 0, nullptr);
-
-        m_Pipeline->Bind(frameInfo.m_CommandBuffer);
-
-        for (auto& particle : particleSystem->m_ParticlePool)
+        uint aliveCount = particleSystem->GetAliveCount();
+        if (!aliveCount)
         {
-            if (!particle.m_Enabled)
-            {
-                continue;
-            }
-
-            auto& transform = particleSystem->m_Registry.get<TransformComponent>(particle.m_Entity);
-            VK_PushConstantDataGeneric push{};
-            push.m_ModelMatrix = transform.GetMat4Local();
-            push.m_NormalMatrix = transform.GetNormalMatrix();
-            vkCmdPushConstants(frameInfo.m_CommandBuffer, m_PipelineLayout,
-                               VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0,
-                               sizeof(VK_PushConstantDataGeneric), &push);
-
-            auto& mesh = particleSystem->m_Registry.get<MeshComponent>(particle.m_SpriteEntity);
-            static_cast<VK_Model*>(mesh.m_Model.get())->Bind(frameInfo.m_CommandBuffer);
-            static_cast<VK_Model*>(mesh.m_Model.get())->Draw(frameInfo.m_CommandBuffer);
+            return;
         }
+
+        static_assert(ParticleSystem::NUMBER_OF_SLICES >= VK_SwapChain::MAX_FRAMES_IN_FLIGHT);
+        // only the slice of this frame is written, the GPU may still read the other ones
+        auto instanceBuffer = static_cast<VK_Buffer*>(particleSystem->GetInstanceBuffer().get());
+        VkDeviceSize sliceOffset = particleSystem->GetSliceOffset(frameInfo.m_FrameIndex);
+        VkDeviceSize size = aliveCount * sizeof(ParticleSystem::Instance);
+        instanceBuffer->WriteToBuffer(particleSystem->GetInstances().data(), size, sliceOffset);
+        instanceBuffer->Flush(size, sliceOffset);
+
+        // set 0: global, set 1: sprite sheet of the particle system
+        auto materialDescriptor = static_cast<VK_MaterialDescriptor*>(particleSystem->GetSpritesheetDescriptor().get());
+        std::vector<VkDescriptorSet> descriptorSets = {frameInfo.m_GlobalDescriptorSet,
+                                                       materialDescriptor->GetDescriptorSet()};
+        vkCmdBindDescriptorSets(frameInfo.m_CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_PipelineLayoutParticles, 0,
+                                static_cast<uint>(descriptorSets.size()), descriptorSets.data(), 0, nullptr);
+
+        m_PipelineParticles->Bind(frameInfo.m_CommandBuffer);
+
+        VK_PushConstantDataParticles push{};
+        push.m_ParticleBufferDeviceAddress = instanceBuffer->GetBufferDeviceAddress() + sliceOffset;
+        vkCmdPushConstants(frameInfo.m_CommandBuffer, m_PipelineLayoutParticles,
+                           VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0,
+                           sizeof(VK_PushConstantDataParticles), &push);
+
+        auto quad = static_cast<VK_Model*>(particleSystem->GetQuad().get());
+        quad->Bind(frameInfo.m_CommandBuffer);
+        quad->Draw(frameInfo.m_CommandBuffer, aliveCount);
     }
 } // namespace GfxRenderEngine
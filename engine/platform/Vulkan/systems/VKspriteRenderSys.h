@@ -53,11 +53,14 @@ namespace GfxRenderEngine
         void DrawParticles(const VK_FrameInfo& frameInfo, ParticleSystem* particleSystem);
 
     private:
-        void CreatePipelineLayout(std::vector<VkDescriptorSetLayout>& descriptorSetLayouts);
+        void CreatePipelineLayout(std::vector<VkDescriptorSetLayout>& descriptorSetLayouts, uint pushConstantSize,
+                                  VkPipelineLayout& pipelineLayout);
         void CreatePipeline(VkRenderPass renderPass);
 
     private:
         VkPipelineLayout m_PipelineLayout;
+        VkPipelineLayout m_PipelineLayoutParticles;
         std::unique_ptr<VK_Pipeline> m_Pipeline;
+        std::unique_ptr<VK_Pipeline> m_PipelineParticles;
     };
 } // namespace GfxRenderEngine
@@ -31,4 +31,15 @@ namespace GfxRenderEngine
         glm::mat4 m_ModelMatrix{1.0f};
         glm::mat4 m_NormalMatrix{1.0f}; // 4x4 because of alignment
     };
+
+    struct VK_PushConstantDataParticles
+    {
+        uint64 m_ParticleBufferDeviceAddress{0};
+    };
+
+    // first joint matrix of a skeleton, see FrameUpdate::UpdateAnimations()
+    struct VK_PushConstantDataJointMatrices
+    {
+        uint64 m_JointMatricesDeviceAddress{0};
+    };
 } // namespace GfxRenderEngine
\ No newline at end of file
@@ -22,6 +22,8 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
 #include <vulkan/vulkan.h>
 
 #include "engine.h"
@@ -30,6 +32,7 @@
 namespace GfxRenderEngine
 {
     class VK_SwapChain;
+    class VK_TransientImages;
     class VK_WaterRenderPass
     {
 
@@ -58,7 +61,9 @@ namespace GfxRenderEngine
                                                              static_cast<int>(RenderTargets3D::ATTACHMENT_GBUFFER_POSITION);
 
     public:
-        VK_WaterRenderPass(VK_SwapChain& swapChain, VkExtent2D extent2D);
+        // name: the prefix of the images of the render pass in the frame graph
+        VK_WaterRenderPass(VK_SwapChain& swapChain, VkExtent2D extent2D, std::string const& name,
+                           std::shared_ptr<VK_TransientImages> const& transientImages);
         ~VK_WaterRenderPass();
 
         VK_WaterRenderPass(const VK_WaterRenderPass&) = delete;
@@ -97,6 +102,8 @@ namespace GfxRenderEngine
         VK_Device* m_Device;
         VK_SwapChain& m_SwapChain;     // constructor initialized
         VkExtent2D m_RenderPassExtent; // constructor initialized
+        std::string m_Name;            // constructor initialized
+        std::shared_ptr<VK_TransientImages> m_TransientImages; // constructor initialized, owns the image memory
 
         VkFormat m_DepthFormat{VkFormat::VK_FORMAT_UNDEFINED};
         VkFormat m_BufferPositionFormat{VkFormat::VK_FORMAT_UNDEFINED};
@@ -121,14 +128,6 @@ namespace GfxRenderEngine
         VkImageView m_GBufferMaterialView{nullptr};
         VkImageView m_GBufferEmissionView{nullptr};
 
-        VkDeviceMemory m_DepthImageMemory{nullptr};
-        VkDeviceMemory m_ColorAttachmentImageMemory{nullptr};
-        VkDeviceMemory m_GBufferPositionImageMemory{nullptr};
-        VkDeviceMemory m_GBufferNormalImageMemory{nullptr};
-        VkDeviceMemory m_GBufferColorImageMemory{nullptr};
-        VkDeviceMemory m_GBufferMaterialImageMemory{nullptr};
-        VkDeviceMemory m_GBufferEmissionImageMemory{nullptr};
-
         VkFramebuffer m_3DFramebuffer;
 
         VkRenderPass m_3DRenderPass{nullptr};
@@ -25,6 +25,7 @@
 #include "renderer/rendererAPI.h"
 
 #include "VKwindow.h"
+#include "HLwindow.h"
 
 namespace GfxRenderEngine
 {
@@ -38,6 +39,9 @@ namespace GfxRenderEngine
             case RendererAPI::VULKAN:
                 m_Window = std::make_unique<VK_Window>(props);
                 break;
+            case RendererAPI::HEADLESS:
+                m_Window = std::make_unique<HL_Window>(props);
+                break;
             default:
                 m_Window = nullptr;
                 break;
@@ -0,0 +1,592 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "gtc/packing.hpp"
+
+#include "renderer/blockCompression.h"
+
+namespace GfxRenderEngine
+{
+    namespace BlockCompression
+    {
+        namespace
+        {
+            constexpr uint TEXELS_PER_BLOCK = 16;
+
+            uint16 PackRGB565(glm::vec3 const& color)
+            {
+                glm::vec3 clamped = glm::clamp(color, glm::vec3(0.0f), glm::vec3(255.0f));
+                uint red = static_cast<uint>(clamped.r * 31.0f / 255.0f + 0.5f);
+                uint green = static_cast<uint>(clamped.g * 63.0f / 255.0f + 0.5f);
+                uint blue = static_cast<uint>(clamped.b * 31.0f / 255.0f + 0.5f);
+                return static_cast<uint16>((red << 11) | (green << 5) | blue);
+            }
+
+            // the same expansion as the decoder
+            glm::vec3 UnpackRGB565(uint16 packed)
+            {
+                uint red = (packed >> 11) & 0x1f;
+                uint green = (packed >> 5) & 0x3f;
+                uint blue = packed & 0x1f;
+                return glm::vec3((red << 3) | (red >> 2), (green << 2) | (green >> 4), (blue << 3) | (blue >> 2));
+            }
+
+            // principal axis of the colors of a block via power iteration on the covariance matrix
+            template <glm::length_t N>
+            glm::vec<N, float> PrincipalAxis(glm::vec<N, float> const* colors, glm::vec<N, float> const& mean)
+            {
+                glm::mat<N, N, float> covariance{0.0f};
+                for (uint index = 0; index < TEXELS_PER_BLOCK; ++index)
+                {
+                    glm::vec<N, float> delta = colors[index] - mean;
+                    covariance += glm::outerProduct(delta, delta);
+                }
+                glm::vec<N, float> axis{1.0f};
+                for (uint iteration = 0; iteration < 8; ++iteration)
+                {
+                    glm::vec<N, float> next = covariance * axis;
+                    float length = glm::length(next);
+                    if (length < 1e-6f)
+                    {
+                        break; // flat block, any axis works
+                    }
+                    axis = next / length;
+                }
+                return glm::normalize(axis);
+            }
+
+            // endpoints at the extremes of the projection of the colors onto their principal axis
+            template <glm::length_t N>
+            void FitEndpoints(glm::vec<N, float> const* colors, glm::vec<N, float>& endpoint0,
+                              glm::vec<N, float>& endpoint1)
+            {
+                glm::vec<N, float> mean{0.0f};
+                for (uint index = 0; index < TEXELS_PER_BLOCK; ++index)
+                {
+                    mean += colors[index];
+                }
+                mean /= static_cast<float>(TEXELS_PER_BLOCK);
+
+                glm::vec<N, float> axis = PrincipalAxis(colors, mean);
+                float minProjection = std::numeric_limits<float>::max();
+                float maxProjection = std::numeric_limits<float>::lowest();
+                for (uint index = 0; index < TEXELS_PER_BLOCK; ++index)
+                {
+                    float projection = glm::dot(colors[index] - mean, axis);
+                    minProjection = std::min(minProjection, projection);
+                    maxProjection = std::max(maxProjection, projection);
+                }
+                endpoint0 = mean + axis * minProjection;
+                endpoint1 = mean + axis * maxProjection;
+            }
+
+            // BC6H and BC7 interpolate with 6-bit weights, for 4-bit indices these are
+            constexpr uint WEIGHTS4[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+            uint Interpolate(uint value0, uint value1, uint weight)
+            {
+                return ((64 - weight) * value0 + weight * value1 + 32) >> 6;
+            }
+
+            // least squares fit of the endpoints for the given indices, false if the system is singular
+            template <glm::length_t N>
+            bool RefitEndpoints(glm::vec<N, float> const* colors, uint const* indices, glm::vec<N, float>& endpoint0,
+                                glm::vec<N, float>& endpoint1)
+            {
+                float a = 0.0f, b = 0.0f, c = 0.0f;
+                glm::vec<N, float> sum0{0.0f};
+                glm::vec<N, float> sum1{0.0f};
+                for (uint index = 0; index < TEXELS_PER_BLOCK; ++index)
+                {
+                    float t = static_cast<float>(WEIGHTS4[indices[index]]) / 64.0f;
+                    a += (1.0f - t) * (1.0f - t);
+                    b += (1.0f - t) * t;
+                    c += t * t;
+                    sum0 += (1.0f - t) * colors[index];
+                    sum1 += t * colors[index];
+                }
+                float determinant = a * c - b * b;
+                if (std::abs(determinant) < 1e-6f)
+                {
+                    return false;
+                }
+                endpoint0 = (c * sum0 - b * sum1) / determinant;
+                endpoint1 = (a * sum1 - b * sum0) / determinant;
+                return true;
+            }
+
+            // writes the block from its least significant bit up, the block must be zeroed
+            void WriteBits(uchar* block, uint& position, uint value, uint count)
+            {
+                for (uint bit = 0; bit < count; ++bit, ++position)
+                {
+                    if ((value >> bit) & 1)
+                    {
+                        block[position >> 3] |= static_cast<uchar>(1 << (position & 7));
+                    }
+                }
+            }
+
+            // writes 4-bit indices, the anchor index of texel 0 has its most significant bit implied zero
+            void WriteIndices(uchar* block, uint& position, uint const* indices)
+            {
+                WriteBits(block, position, indices[0], 3);
+                for (uint index = 1; index < TEXELS_PER_BLOCK; ++index)
+                {
+                    WriteBits(block, position, indices[index], 4);
+                }
+            }
+
+            // BC7 mode 6: 7-bit RGBA endpoints with one p-bit each, the p-bit is the least significant bit
+            struct BC7Endpoints
+            {
+                glm::uvec4 m_Color[2]; // 7 bits
+                uint m_PBit[2];
+
+                glm::uvec4 Expand(uint endpoint) const { return (m_Color[endpoint] << 1u) | m_PBit[endpoint]; }
+            };
+
+            void QuantizeBC7(glm::vec4 const& endpoint, glm::uvec4& color, uint& pBit)
+            {
+                float bestError = std::numeric_limits<float>::max();
+                for (uint candidatePBit = 0; candidatePBit < 2; ++candidatePBit)
+                {
+                    glm::vec4 scaled = glm::round((endpoint - static_cast<float>(candidatePBit)) / 2.0f);
+                    glm::uvec4 candidate{glm::clamp(scaled, glm::vec4(0.0f), glm::vec4(127.0f))};
+                    glm::vec4 delta = glm::vec4((candidate << 1u) | candidatePBit) - endpoint;
+                    float error = glm::dot(delta, delta);
+                    if (error < bestError)
+                    {
+                        bestError = error;
+                        color = candidate;
+                        pBit = candidatePBit;
+                    }
+                }
+            }
+
+            float SelectIndicesBC7(glm::vec4 const* colors, BC7Endpoints const& endpoints, uint* indices)
+            {
+                glm::uvec4 expanded0 = endpoints.Expand(0);
+                glm::uvec4 expanded1 = endpoints.Expand(1);
+                glm::vec4 palette[16];
+                for (uint entry = 0; entry < 16; ++entry)
+                {
+                    for (glm::length_t channel = 0; channel < 4; ++channel)
+                    {
+                        palette[entry][channel] =
+                            static_cast<float>(Interpolate(expanded0[channel], expanded1[channel], WEIGHTS4[entry]));
+                    }
+                }
+                float totalError = 0.0f;
+                for (uint index = 0; index < TEXELS_PER_BLOCK; ++index)
+                {
+                    float bestDistance = std::numeric_limits<float>::max();
+                    for (uint entry = 0; entry < 16; ++entry)
+                    {
+                        glm::vec4 delta = colors[index] - palette[entry];
+                        float distance = glm::dot(delta, delta);
+                        if (distance < bestDistance)
+                        {
+                            bestDistance = distance;
+                            indices[index] = entry;
+                        }
+                    }
+                    totalError += bestDistance;
+                }
+                return totalError;
+            }
+
+            float FitBC7(glm::vec4 const* colors, glm::vec4 const& endpoint0, glm::vec4 const& endpoint1,
+                         BC7Endpoints& endpoints, uint* indices)
+            {
+                QuantizeBC7(endpoint0, endpoints.m_Color[0], endpoints.m_PBit[0]);
+                QuantizeBC7(endpoint1, endpoints.m_Color[1], endpoints.m_PBit[1]);
+                return SelectIndicesBC7(colors, endpoints, indices);
+            }
+
+            // BC6H unsigned: 10-bit endpoints are expanded to 16 bits, interpolated,
+            // and scaled by 31/64 to the bits of a half float
+            uint UnquantizeBC6H(uint value)
+            {
+                if (value == 0)
+                {
+                    return 0;
+                }
+                if (value == 1023)
+                {
+                    return 0xffff;
+                }
+                return ((value << 16) + 0x8000) >> 10;
+            }
+
+            uint FinishBC6H(uint value) { return (value * 31) >> 6; }
+
+            // the encoder works on the bits of the half floats, the domain the hardware interpolates in
+            uint QuantizeBC6H(float halfBits)
+            {
+                int estimate = static_cast<int>((halfBits - 15.0f) / 31.0f + 0.5f);
+                uint best = 0;
+                float bestError = std::numeric_limits<float>::max();
+                for (int candidate = estimate - 1; candidate <= estimate + 1; ++candidate)
+                {
+                    uint value = static_cast<uint>(std::clamp(candidate, 0, 1023));
+                    float error = std::abs(static_cast<float>(FinishBC6H(UnquantizeBC6H(value))) - halfBits);
+                    if (error < bestError)
+                    {
+                        bestError = error;
+                        best = value;
+                    }
+                }
+                return best;
+            }
+
+            float FitBC6H(glm::vec3 const* colors, glm::vec3 const& endpoint0, glm::vec3 const& endpoint1,
+                          glm::uvec3* endpoints, uint* indices)
+            {
+                glm::vec3 clamped0 = glm::clamp(endpoint0, glm::vec3(0.0f), glm::vec3(31743.0f));
+                glm::vec3 clamped1 = glm::clamp(endpoint1, glm::vec3(0.0f), glm::vec3(31743.0f));
+                glm::uvec3 unquantized[2];
+                for (glm::length_t channel = 0; channel < 3; ++channel)
+                {
+                    endpoints[0][channel] = QuantizeBC6H(clamped0[channel]);
+                    endpoints[1][channel] = QuantizeBC6H(clamped1[channel]);
+                    unquantized[0][channel] = UnquantizeBC6H(endpoints[0][channel]);
+                    unquantized[1][channel] = UnquantizeBC6H(endpoints[1][channel]);
+                }
+                glm::vec3 palette[16];
+                for (uint entry = 0; entry < 16; ++entry)
+                {
+                    for (glm::length_t channel = 0; channel < 3; ++channel)
+                    {
+                        palette[entry][channel] = static_cast<float>(FinishBC6H(
+                            Interpolate(unquantized[0][channel], unquantized[1][channel], WEIGHTS4[entry])));
+                    }
+                }
+                float totalError = 0.0f;
+                for (uint index = 0; index < TEXELS_PER_BLOCK; ++index)
+                {
+                    float bestDistance = std::numeric_limits<float>::max();
+                    for (uint entry = 0; entry < 16; ++entry)
+                    {
+                        glm::vec3 delta = colors[index] - palette[entry];
+                        float distance = glm::dot(delta, delta);
+                        if (distance < bestDistance)
+                        {
+                            bestDistance = distance;
+                            indices[index] = entry;
+                        }
+                    }
+                    totalError += bestDistance;
+                }
+                return totalError;
+            }
+
+            // gathers 4x4 blocks, partial blocks at the right and bottom edge are padded with edge texels
+            template <typename Texel, typename Encoder>
+            void EncodeBlocks(Texel const* rgba, uint width, uint height, size_t blockSize, uchar* destination,
+                              Encoder encode)
+            {
+                uint blocksX = (width + 3) / 4;
+                uint blocksY = (height + 3) / 4;
+
+                Texel texels[TEXELS_PER_BLOCK * 4];
+                uchar* block = destination;
+                for (uint blockY = 0; blockY < blocksY; ++blockY)
+                {
+                    for (uint blockX = 0; blockX < blocksX; ++blockX)
+                    {
+                        for (uint row = 0; row < 4; ++row)
+                        {
+                            uint y = std::min(blockY * 4 + row, height - 1);
+                            for (uint column = 0; column < 4; ++column)
+                            {
+                                uint x = std::min(blockX * 4 + column, width - 1);
+                                memcpy(texels + (row * 4 + column) * 4, rgba + (size_t(y) * width + x) * 4,
+                                       4 * sizeof(Texel));
+                            }
+                        }
+                        encode(texels, block);
+                        block += blockSize;
+                    }
+                }
+            }
+
+            // 4-color mode: color0 > color1, indices 0, 1, 2/3 * c0 + 1/3 * c1, 1/3 * c0 + 2/3 * c1
+            void EncodeColor(uchar const* texels, uchar* block)
+            {
+                glm::vec3 colors[TEXELS_PER_BLOCK];
+                glm::vec3 mean{0.0f};
+                for (uint index = 0; index < TEXELS_PER_BLOCK; ++index)
+                {
+                    colors[index] = glm::vec3(texels[index * 4 + 0], texels[index * 4 + 1], texels[index * 4 + 2]);
+                    mean += colors[index];
+                }
+                mean /= static_cast<float>(TEXELS_PER_BLOCK);
+
+                glm::vec3 axis = PrincipalAxis(colors, mean);
+                float minProjection = std::numeric_limits<float>::max();
+                float maxProjection = std::numeric_limits<float>::lowest();
+                for (uint index = 0; index < TEXELS_PER_BLOCK; ++index)
+                {
+                    float projection = glm::dot(colors[index] - mean, axis);
+                    minProjection = std::min(minProjection, projection);
+                    maxProjection = std::max(maxProjection, projection);
+                }
+                // inset the endpoints to reduce the error of the interpolated colors
+                float inset = (maxProjection - minProjection) / 16.0f;
+                uint16 color0 = PackRGB565(mean + axis * (maxProjection - inset));
+                uint16 color1 = PackRGB565(mean + axis * (minProjection + inset));
+                if (color0 < color1)
+                {
+                    std::swap(color0, color1);
+                }
+
+                uint indices = 0;
+                if (color0 != color1)
+                {
+                    glm::vec3 palette[4];
+                    palette[0] = UnpackRGB565(color0);
+                    palette[1] = UnpackRGB565(color1);
+                    palette[2] = (2.0f * palette[0] + palette[1]) / 3.0f;
+                    palette[3] = (palette[0] + 2.0f * palette[1]) / 3.0f;
+                    for (uint index = 0; index < TEXELS_PER_BLOCK; ++index)
+                    {
+                        uint bestEntry = 0;
+                        float bestDistance = std::numeric_limits<float>::max();
+                        for (uint entry = 0; entry < 4; ++entry)
+                        {
+                            glm::vec3 delta = colors[index] - palette[entry];
+                            float distance = glm::dot(delta, delta);
+                            if (distance < bestDistance)
+                            {
+                                bestDistance = distance;
+                                bestEntry = entry;
+                            }
+                        }
+                        indices |= bestEntry << (2 * index);
+                    }
+                }
+                // else: a single color, all indices select color0
+
+                block[0] = static_cast<uchar>(color0 & 0xff);
+                block[1] = static_cast<uchar>(color0 >> 8);
+                block[2] = static_cast<uchar>(color1 & 0xff);
+                block[3] = static_cast<uchar>(color1 >> 8);
+                for (uint byte = 0; byte < 4; ++byte)
+                {
+                    block[4 + byte] = static_cast<uchar>((indices >> (8 * byte)) & 0xff);
+                }
+            }
+        } // namespace
+
+        void EncodeBC1(uchar const* texels, uchar* block) { EncodeColor(texels, block); }
+
+        void EncodeBC3(uchar const* texels, uchar* block)
+        {
+            EncodeBC4(texels, 3, block); // alpha
+            EncodeColor(texels, block + 8);
+        }
+
+        // 8-value mode: value0 > value1, index 0 selects value0, index 1 value1,
+        // indices 2 to 7 the values in between, starting next to value0
+        void EncodeBC4(uchar const* texels, uint channel, uchar* block)
+        {
+            uchar minValue = 255;
+            uchar maxValue = 0;
+            for (uint index = 0; index < TEXELS_PER_BLOCK; ++index)
+            {
+                uchar value = texels[index * 4 + channel];
+                minValue = std::min(minValue, value);
+                maxValue = std::max(maxValue, value);
+            }
+
+            uint64 indices = 0;
+            if (maxValue != minValue)
+            {
+                float range = static_cast<float>(maxValue - minValue);
+                for (uint index = 0; index < TEXELS_PER_BLOCK; ++index)
+                {
+                    float value = static_cast<float>(texels[index * 4 + channel]);
+                    // 0: value0 (max), 7: value1 (min)
+                    uint step = static_cast<uint>((maxValue - value) * 7.0f / range + 0.5f);
+                    uint64 paletteIndex = (step == 0) ? 0 : (step == 7) ? 1 : step + 1;
+                    indices |= paletteIndex << (3 * index);
+                }
+            }
+            // else: a single value, all indices select value0
+
+            block[0] = maxValue;
+            block[1] = minValue;
+            for (uint byte = 0; byte < 6; ++byte)
+            {
+                block[2 + byte] = static_cast<uchar>((indices >> (8 * byte)) & 0xff);
+            }
+        }
+
+        void EncodeBC5(uchar const* texels, uchar* block)
+        {
+            EncodeBC4(texels, 0, block);
+            EncodeBC4(texels, 1, block + 8);
+        }
+
+        // mode 6: one subset, RGBA endpoints and 4-bit indices
+        void EncodeBC7(uchar const* texels, uchar* block)
+        {
+            glm::vec4 colors[TEXELS_PER_BLOCK];
+            for (uint index = 0; index < TEXELS_PER_BLOCK; ++index)
+            {
+                colors[index] = glm::vec4(texels[index * 4 + 0], texels[index * 4 + 1], texels[index * 4 + 2],
+                                          texels[index * 4 + 3]);
+            }
+            glm::vec4 endpoint0, endpoint1;
+            FitEndpoints(colors, endpoint0, endpoint1);
+
+            BC7Endpoints endpoints;
+            uint indices[TEXELS_PER_BLOCK];
+            float error = FitBC7(colors, endpoint0, endpoint1, endpoints, indices);
+            if (RefitEndpoints(colors, indices, endpoint0, endpoint1))
+            {
+                BC7Endpoints refitted;
+                uint refittedIndices[TEXELS_PER_BLOCK];
+                if (FitBC7(colors, endpoint0, endpoint1, refitted, refittedIndices) < error)
+                {
+                    endpoints = refitted;
+                    memcpy(indices, refittedIndices, sizeof(indices));
+                }
+            }
+            // the anchor index must fit into 3 bits
+            if (indices[0] & 0x8)
+            {
+                std::swap(endpoints.m_Color[0], endpoints.m_Color[1]);
+                std::swap(endpoints.m_PBit[0], endpoints.m_PBit[1]);
+                for (uint& index : indices)
+                {
+                    index = 15 - index;
+                }
+            }
+
+            memset(block, 0, 16);
+            uint position = 0;
+            WriteBits(block, position, 1 << 6, 7); // mode 6
+            for (glm::length_t channel = 0; channel < 4; ++channel)
+            {
+                WriteBits(block, position, endpoints.m_Color[0][channel], 7);
+                WriteBits(block, position, endpoints.m_Color[1][channel], 7);
+            }
+            WriteBits(block, position, endpoints.m_PBit[0], 1);
+            WriteBits(block, position, endpoints.m_PBit[1], 1);
+            WriteIndices(block, position, indices);
+        }
+
+        // mode 11: one region, 10-bit RGB endpoints without delta encoding and 4-bit indices
+        void EncodeBC6H(float const* texels, uchar* block)
+        {
+            glm::vec3 colors[TEXELS_PER_BLOCK];
+            for (uint index = 0; index < TEXELS_PER_BLOCK; ++index)
+            {
+                for (glm::length_t channel = 0; channel < 3; ++channel)
+                {
+                    float value = texels[index * 4 + channel];
+                    value = std::isnan(value) ? 0.0f : std::clamp(value, 0.0f, 65504.0f);
+                    colors[index][channel] = static_cast<float>(glm::packHalf1x16(value));
+                }
+            }
+            glm::vec3 endpoint0, endpoint1;
+            FitEndpoints(colors, endpoint0, endpoint1);
+
+            glm::uvec3 endpoints[2];
+            uint indices[TEXELS_PER_BLOCK];
+            float error = FitBC6H(colors, endpoint0, endpoint1, endpoints, indices);
+            if (RefitEndpoints(colors, indices, endpoint0, endpoint1))
+            {
+                glm::uvec3 refitted[2];
+                uint refittedIndices[TEXELS_PER_BLOCK];
+                if (FitBC6H(colors, endpoint0, endpoint1, refitted, refittedIndices) < error)
+                {
+                    endpoints[0] = refitted[0];
+                    endpoints[1] = refitted[1];
+                    memcpy(indices, refittedIndices, sizeof(indices));
+                }
+            }
+            // the anchor index must fit into 3 bits
+            if (indices[0] & 0x8)
+            {
+                std::swap(endpoints[0], endpoints[1]);
+                for (uint& index : indices)
+                {
+                    index = 15 - index;
+                }
+            }
+
+            memset(block, 0, 16);
+            uint position = 0;
+            WriteBits(block, position, 0x03, 5); // mode 11
+            for (uint endpoint = 0; endpoint < 2; ++endpoint)
+            {
+                for (glm::length_t channel = 0; channel < 3; ++channel)
+                {
+                    WriteBits(block, position, endpoints[endpoint][channel], 10);
+                }
+            }
+            WriteIndices(block, position, indices);
+        }
+
+        std::vector<uchar> Compress(CookedTexture::Format format, uchar const* rgba, uint width, uint height)
+        {
+            std::vector<uchar> compressed(CookedTexture::GetLevelSize(format, width, height));
+            size_t blockSize = (format == CookedTexture::Format::BC1 || format == CookedTexture::Format::BC4) ? 8 : 16;
+            switch (format)
+            {
+                case CookedTexture::Format::BC1:
+                    EncodeBlocks(rgba, width, height, blockSize, compressed.data(), EncodeBC1);
+                    break;
+                case CookedTexture::Format::BC3:
+                    EncodeBlocks(rgba, width, height, blockSize, compressed.data(), EncodeBC3);
+                    break;
+                case CookedTexture::Format::BC4:
+                    EncodeBlocks(rgba, width, height, blockSize, compressed.data(),
+                                 [](uchar const* texels, uchar* block) { EncodeBC4(texels, 0, block); });
+                    break;
+                case CookedTexture::Format::BC5:
+                    EncodeBlocks(rgba, width, height, blockSize, compressed.data(), EncodeBC5);
+                    break;
+                case CookedTexture::Format::BC7:
+                    EncodeBlocks(rgba, width, height, blockSize, compressed.data(), EncodeBC7);
+                    break;
+                default: // BC6H has a float input, see CompressBC6H()
+                    break;
+            }
+            return compressed;
+        }
+
+        std::vector<uchar> CompressBC6H(float const* rgba, uint width, uint height)
+        {
+            std::vector<uchar> compressed(CookedTexture::GetLevelSize(CookedTexture::Format::BC6H, width, height));
+            EncodeBlocks(rgba, width, height, 16, compressed.data(), EncodeBC6H);
+            return compressed;
+        }
+    } // namespace BlockCompression
+} // namespace GfxRenderEngine
@@ -0,0 +1,52 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <vector>
+
+#include "engine.h"
+#include "renderer/cookedTexture.h"
+
+namespace GfxRenderEngine
+{
+    // BlockCompression: encoders for the BCn formats of CookedTexture, used by the texture cooker
+    // Endpoints are fitted along the principal axis of each 4x4 block, quality is in the range
+    // of the fast modes of common offline compressors.
+    namespace BlockCompression
+    {
+        // texels: 4x4 RGBA8 texels, row by row
+        void EncodeBC1(uchar const* texels, uchar* block);               // 8 bytes, opaque
+        void EncodeBC3(uchar const* texels, uchar* block);               // 16 bytes
+        void EncodeBC4(uchar const* texels, uint channel, uchar* block); // 8 bytes, one channel
+        void EncodeBC5(uchar const* texels, uchar* block);               // 16 bytes, red and green
+        void EncodeBC7(uchar const* texels, uchar* block);               // 16 bytes, mode 6 only
+
+        // texels: 4x4 RGBA32F texels, alpha is ignored, negative values are clamped to zero
+        void EncodeBC6H(float const* texels, uchar* block); // 16 bytes, unsigned, mode 11 only
+
+        // compresses an RGBA8 image, partial blocks at the right and bottom edge are padded with edge texels
+        std::vector<uchar> Compress(CookedTexture::Format format, uchar const* rgba, uint width, uint height);
+        // compresses an RGBA32F image to BC6H
+        std::vector<uchar> CompressBC6H(float const* rgba, uint width, uint height);
+    } // namespace BlockCompression
+} // namespace GfxRenderEngine
@@ -0,0 +1,117 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "renderer/bounds.h"
+
+namespace GfxRenderEngine
+{
+    void AABB::Extend(glm::vec3 const& point)
+    {
+        m_Min = glm::min(m_Min, point);
+        m_Max = glm::max(m_Max, point);
+    }
+
+    void AABB::Extend(AABB const& aabb)
+    {
+        if (aabb.IsValid())
+        {
+            m_Min = glm::min(m_Min, aabb.m_Min);
+            m_Max = glm::max(m_Max, aabb.m_Max);
+        }
+    }
+
+    // Arvo: the extent is transformed by the absolute values of the rotation/scale part
+    AABB AABB::Transform(glm::mat4 const& mat4) const
+    {
+        if (!IsValid())
+        {
+            return *this;
+        }
+        glm::vec3 center = glm::vec3(mat4 * glm::vec4(GetCenter(), 1.0f));
+        glm::mat3 absolute{glm::abs(glm::vec3(mat4[0])), glm::abs(glm::vec3(mat4[1])), glm::abs(glm::vec3(mat4[2]))};
+        glm::vec3 extent = absolute * GetExtent();
+        return AABB{center - extent, center + extent};
+    }
+
+    BoundingSphere BoundingSphere::FromAABB(AABB const& aabb)
+    {
+        if (!aabb.IsValid())
+        {
+            return BoundingSphere{};
+        }
+        return BoundingSphere{aabb.GetCenter(), glm::length(aabb.GetExtent())};
+    }
+
+    // Gribb/Hartmann plane extraction from the rows of the view projection matrix
+    Frustum::Frustum(glm::mat4 const& viewProjection)
+    {
+        glm::vec4 row0{viewProjection[0][0], viewProjection[1][0], viewProjection[2][0], viewProjection[3][0]};
+        glm::vec4 row1{viewProjection[0][1], viewProjection[1][1], viewProjection[2][1], viewProjection[3][1]};
+        glm::vec4 row2{viewProjection[0][2], viewProjection[1][2], viewProjection[2][2], viewProjection[3][2]};
+        glm::vec4 row3{viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3]};
+
+        m_Planes[LEFT_PLANE] = row3 + row0;
+        m_Planes[RIGHT_PLANE] = row3 - row0;
+        m_Planes[BOTTOM_PLANE] = row3 + row1;
+        m_Planes[TOP_PLANE] = row3 - row1;
+        m_Planes[NEAR_PLANE] = row2; // GLM_FORCE_DEPTH_ZERO_TO_ONE
+        m_Planes[FAR_PLANE] = row3 - row2;
+
+        for (auto& plane : m_Planes)
+        {
+            float length = glm::length(glm::vec3(plane));
+            if (length > 0.0f)
+            {
+                plane /= length;
+            }
+        }
+    }
+
+    bool Frustum::Intersects(AABB const& aabb) const
+    {
+        glm::vec3 center = aabb.GetCenter();
+        glm::vec3 extent = aabb.GetExtent();
+        for (auto& plane : m_Planes)
+        {
+            glm::vec3 normal{plane};
+            float distance = glm::dot(normal, center) + plane.w;
+            float radius = glm::dot(glm::abs(normal), extent);
+            if (distance + radius < 0.0f)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool Frustum::Intersects(BoundingSphere const& sphere) const
+    {
+        for (auto& plane : m_Planes)
+        {
+            if (glm::dot(glm::vec3(plane), sphere.m_Center) + plane.w < -sphere.m_Radius)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace GfxRenderEngine
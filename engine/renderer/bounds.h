@@ -0,0 +1,82 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include "engine.h"
+
+namespace GfxRenderEngine
+{
+    // axis-aligned bounding box
+    struct AABB
+    {
+        glm::vec3 m_Min{std::numeric_limits<float>::max()};
+        glm::vec3 m_Max{std::numeric_limits<float>::lowest()};
+
+        bool IsValid() const { return (m_Min.x <= m_Max.x) && (m_Min.y <= m_Max.y) && (m_Min.z <= m_Max.z); }
+        glm::vec3 GetCenter() const { return (m_Min + m_Max) * 0.5f; }
+        glm::vec3 GetExtent() const { return (m_Max - m_Min) * 0.5f; }
+
+        void Extend(glm::vec3 const& point);
+        void Extend(AABB const& aabb);
+
+        // bounds of the transformed box (not of the transformed geometry)
+        AABB Transform(glm::mat4 const& mat4) const;
+    };
+
+    struct BoundingSphere
+    {
+        glm::vec3 m_Center{0.0f};
+        float m_Radius{0.0f};
+
+        // sphere around a box (not the minimal sphere of the geometry)
+        static BoundingSphere FromAABB(AABB const& aabb);
+    };
+
+    // six planes in world space, normals pointing inwards
+    class Frustum
+    {
+
+    public:
+        enum Planes
+        {
+            LEFT_PLANE = 0,
+            RIGHT_PLANE,
+            BOTTOM_PLANE,
+            TOP_PLANE,
+            NEAR_PLANE,
+            FAR_PLANE,
+            NUMBER_OF_PLANES
+        };
+
+    public:
+        Frustum() = default;
+        Frustum(glm::mat4 const& viewProjection); // clip space z in [0, 1]
+
+        bool Intersects(AABB const& aabb) const;
+        bool Intersects(BoundingSphere const& sphere) const;
+        glm::vec4 const& GetPlane(uint index) const { return m_Planes[index]; }
+
+    private:
+        glm::vec4 m_Planes[NUMBER_OF_PLANES]{};
+    };
+} // namespace GfxRenderEngine
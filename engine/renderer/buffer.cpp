@@ -25,6 +25,7 @@
 #include "renderer/buffer.h"
 
 #include "VKbuffer.h"
+#include "HLbuffer.h"
 
 namespace GfxRenderEngine
 {
@@ -38,6 +39,9 @@ namespace GfxRenderEngine
             case RendererAPI::VULKAN:
                 buffer = std::make_shared<VK_Buffer>(size, bufferUsage);
                 break;
+            case RendererAPI::HEADLESS:
+                buffer = std::make_shared<HL_Buffer>(size, bufferUsage);
+                break;
             default:
                 buffer = nullptr;
                 break;
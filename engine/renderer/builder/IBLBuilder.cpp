@@ -23,8 +23,10 @@
 #include <future>
 
 #include "core.h"
+#include "auxiliary/file.h"
 #include "scene/skyboxHDRIMaterial.h"
 #include "renderer/builder/IBLBuilder.h"
+#include "renderer/cookedTexture.h"
 #include "renderer/hiResImage.h"
 
 namespace GfxRenderEngine
@@ -44,6 +46,17 @@ namespace GfxRenderEngine
                 auto& filename = filenames[ibltexture];
                 auto loadHiResImageAndCreateTexture = [&]()
                 {
+                    texture = Texture::Create();
+                    // a cooked texture (BC6H) next to the image is used instead of decoding it
+                    std::string cookedFilename = CookedTexture::GetCookedFilename(filename);
+                    if (EngineCore::FileExists(cookedFilename) &&
+                        texture->InitCooked(cookedFilename, Texture::USE_UNORM, false /*flip*/,
+                                            CookedTexture::HashSource(filename)))
+                    {
+                        LOG_APP_INFO("loaded {0}", cookedFilename);
+                        return true;
+                    }
+
                     // vector with size == 1 to satisfy the interface of Texture
                     std::vector<HiResImage> hiResImages(1 /* size = 1*/);
                     auto& hiResImage = hiResImages[0];
@@ -53,7 +66,6 @@ namespace GfxRenderEngine
                         return false;
                     }
 
-                    texture = Texture::Create();
                     bool textureOk = texture->Init(hiResImages);
                     if (!textureOk)
                     {
@@ -67,6 +79,31 @@ namespace GfxRenderEngine
             }
         }
 
+        // envPrefilteredSpecular with NUM_MIP_LEVELS_SPECULAR mip levels,
+        // the levels are cooked into one file next to level 0 (textureCooker --mip-chain)
+        bool specularCooked = false;
+        {
+            std::vector<std::string> specularFilenames(NUM_MIP_LEVELS_SPECULAR);
+            for (uint index = 0; auto& specularFilename : specularFilenames)
+            {
+                specularFilename = filenames[IBLTexture::envPrefilteredSpecularLevel0 + index];
+                ++index;
+            }
+            std::string cookedFilename = CookedTexture::GetCookedFilename(specularFilenames[0]);
+            if (EngineCore::FileExists(cookedFilename))
+            {
+                auto& texture = m_IBLTextures[IBLTexture::envPrefilteredSpecularLevel0];
+                texture = Texture::Create();
+                specularCooked = texture->InitCooked(cookedFilename, Texture::USE_UNORM, false /*flip*/,
+                                                     CookedTexture::HashSource(specularFilenames));
+                if (specularCooked)
+                {
+                    LOG_APP_INFO("loaded {0}", cookedFilename);
+                }
+            }
+        }
+
+        if (!specularCooked)
         { // envPrefilteredSpecular with NUM_MIP_LEVELS_SPECULAR mip levels
             std::vector<HiResImage> hiResImages(NUM_MIP_LEVELS_SPECULAR);
             std::vector<std::future<bool>> loadFuturesSpecularImages(NUM_MIP_LEVELS_SPECULAR);
@@ -91,7 +128,7 @@ namespace GfxRenderEngine
             // before creating the texture with mip levels
             for (auto& future : loadFuturesSpecularImages)
             {
-                if (!future.get())
+                if (!threadPool.GetResult(future))
                 {
                     return;
                 }
@@ -108,7 +145,7 @@ namespace GfxRenderEngine
 
         for (auto& future : loadFuturesOneMip)
         {
-            if (!future.get())
+            if (!threadPool.GetResult(future))
             {
                 return;
             }
@@ -28,6 +28,7 @@
 #include "renderer/shader.h"
 #include "renderer/instanceBuffer.h"
 #include "renderer/builder/fastgltfBuilder.h"
+#include "renderer/cookedTexture.h"
 #include "renderer/materialDescriptor.h"
 #include "auxiliary/instrumentation.h"
 #include "auxiliary/file.h"
@@ -218,7 +219,7 @@ namespace GfxRenderEngine
             ProcessNode(&scene, scene.nodeIndices[nodeIndex], parentNode, instanceIndex);
         }
 
-        auto wait = [](std::future<bool>&& future) { future.get(); };
+        auto wait = [](std::future<bool>&& future) { Engine::m_Engine->m_PoolSecondary.GetResult(future); };
         m_NodeFuturesQueue.DoAll(wait);
     }
 
@@ -302,7 +303,7 @@ namespace GfxRenderEngine
         {
             // create a model
             Model::ModelData modelData = {
-                .m_Skeleton = m_Skeleton, .m_ShaderData = m_ShaderData, .m_Animations = m_Animations};
+                .m_Skeleton = m_Skeleton, .m_Animations = m_Animations};
 
             // *** Instancing ***
             // create instance tag for first game object;
@@ -318,7 +319,7 @@ namespace GfxRenderEngine
 
                 auto& instanceBuffer = instanceTag.m_InstanceBuffer;
                 instanceBuffer = InstanceBuffer::Create(m_InstanceCount);
-                instanceBuffer->SetInstanceData(instanceIndex, transform.GetMat4Global(), transform.GetNormalMatrix());
+                instanceBuffer->SetInstanceData(instanceIndex, transform.GetMat4Global());
 
                 m_Registry.emplace<InstanceTag>(entity, instanceTag);
                 transform.SetInstance(instanceBuffer, instanceIndex);
@@ -378,8 +379,8 @@ namespace GfxRenderEngine
                         .m_VertexBufferDeviceAddress = m_Models[gltfNodeIndex].get()->GetVertexBufferDeviceAddress(),
                         .m_IndexBufferDeviceAddress = m_Models[gltfNodeIndex].get()->GetIndexBufferDeviceAddress(),
                         .m_InstanceBufferDeviceAddress = instanceBuffer.get()->GetBufferDeviceAddress(),
-                        .m_SkeletalAnimationBufferDeviceAddress =
-                            m_ShaderData ? m_ShaderData.get()->GetBufferDeviceAddress() : 0};
+                        .m_PositionBufferDeviceAddress = m_Models[gltfNodeIndex].get()->GetPositionBufferDeviceAddress(),
+                        .m_VertexFormat = m_Models[gltfNodeIndex].get()->GetVertexFormat()};
                     auto& buffer = m_Models[gltfNodeIndex].get()->GetMeshBuffer();
                     buffer = Buffer::Create(sizeof(meshBufferData), Buffer::BufferUsage::STORAGE_BUFFER_VISIBLE_TO_CPU);
                     buffer.get()->MapBuffer();
@@ -395,8 +396,7 @@ namespace GfxRenderEngine
                 entt::entity instance = m_InstancedObjects[gltfNodeIndex];
                 InstanceTag& instanceTag = m_Registry.get<InstanceTag>(instance);
                 instanceTag.m_Instances[instanceIndex] = entity;
-                instanceTag.m_InstanceBuffer->SetInstanceData(instanceIndex, transform.GetMat4Global(),
-                                                              transform.GetNormalMatrix());
+                instanceTag.m_InstanceBuffer->SetInstanceData(instanceIndex, transform.GetMat4Global());
                 transform.SetInstance(instanceTag.m_InstanceBuffer, instanceIndex);
             }
 
@@ -550,21 +550,19 @@ namespace GfxRenderEngine
                             CORE_ASSERT(filePath.fileByteOffset == 0, "no offset data support with stbi " + glTFImage.name);
                             CORE_ASSERT(filePath.uri.isLocalPath(), "no local file " + glTFImage.name);
 
-                            int width = 0, height = 0, nrChannels = 0;
-                            unsigned char* buffer =
-                                stbi_load(imageFilepath.c_str(), &width, &height, &nrChannels, 4 /*int desired_channels*/);
-                            CORE_ASSERT(buffer, "stbi failed (image data = URI) " + glTFImage.name);
-                            CORE_ASSERT(nrChannels == 4, "wrong number of channels");
-
+                            // picks up a cooked texture next to the image (cooked with --no-flip),
+                            // the sampler filters still come from the glTF file
                             int minFilter = GetMinFilter(imageIndex);
                             int magFilter = GetMagFilter(imageIndex);
                             bool imageFormat = GetImageFormat(imageIndex);
-                            texture->Init(width, height, imageFormat, buffer, minFilter, magFilter);
-
-                            stbi_image_free(buffer);
+                            texture->Init(imageFilepath, imageFormat, false /*flip*/, minFilter, magFilter);
                         },
                         [&](fastgltf::sources::Array& vector) // load from memory
                         {
+                            if (LoadCookedImage(*texture, imageIndex, vector.bytes.data(), vector.bytes.size()))
+                            {
+                                return;
+                            }
                             int width = 0, height = 0, nrChannels = 0;
 
                             using byte = unsigned char;
@@ -593,6 +591,11 @@ namespace GfxRenderEngine
                                     },
                                     [&](fastgltf::sources::Array& vector) // load from memory
                                     {
+                                        auto imageData = vector.bytes.data() + bufferView.byteOffset;
+                                        if (LoadCookedImage(*texture, imageIndex, imageData, bufferView.byteLength))
+                                        {
+                                            return;
+                                        }
                                         int width = 0, height = 0, nrChannels = 0;
                                         using byte = unsigned char;
                                         byte* buffer = stbi_load_from_memory(vector.bytes.data() + bufferView.byteOffset,
@@ -619,10 +622,26 @@ namespace GfxRenderEngine
         }
         for (uint imageIndex = 0; imageIndex < numTextures; ++imageIndex)
         {
-            m_Textures[imageIndex] = futures[imageIndex].get();
+            m_Textures[imageIndex] = Engine::m_Engine->m_PoolSecondary.GetResult(futures[imageIndex]);
         }
     }
 
+    // embedded images are cooked next to the model, "model.glb" with image 2 to "model.glb.image2.ctex"
+    // (textureCooker --gltf), the cooked texture is ignored if the image data changed
+    bool FastgltfBuilder::LoadCookedImage(Texture& texture, uint const imageIndex, uchar const* data, size_t size)
+    {
+        std::string cookedFilename = CookedTexture::GetCookedFilename(m_Filepath, imageIndex);
+        if (!EngineCore::FileExists(cookedFilename))
+        {
+            return false;
+        }
+        int minFilter = GetMinFilter(imageIndex);
+        int magFilter = GetMagFilter(imageIndex);
+        bool imageFormat = GetImageFormat(imageIndex);
+        return texture.InitCooked(cookedFilename, imageFormat, false /*flip*/, CookedTexture::HashData(data, size),
+                                  minFilter, magFilter);
+    }
+
     void FastgltfBuilder::LoadMaterials()
     {
         Renderer* renderer = Engine::m_Engine->GetRenderer();
@@ -787,16 +806,22 @@ namespace GfxRenderEngine
                 const uint* jointsBuffer = nullptr;
                 const float* weightsBuffer = nullptr;
 
+                // storage for dequantized attributes (KHR_mesh_quantization)
+                std::vector<float> positionStorage;
+                std::vector<float> normalsStorage;
+                std::vector<float> tangentsStorage;
+                std::vector<float> texCoordsStorage;
+                std::vector<float> weightsStorage;
+
                 fastgltf::ComponentType jointsBufferComponentType = fastgltf::ComponentType::Invalid;
                 fastgltf::ComponentType colorBufferComponentType = fastgltf::ComponentType::Invalid;
 
                 // Get buffer data for vertex positions
                 if (glTFPrimitive.findAttribute("POSITION") != glTFPrimitive.attributes.end())
                 {
-                    auto componentType =
-                        LoadAccessor<float>(m_GltfAsset.accessors[glTFPrimitive.findAttribute("POSITION")->second],
-                                            positionBuffer, &vertexCount);
-                    CORE_ASSERT(fastgltf::getGLComponentType(componentType) == GL_FLOAT, "unexpected component type");
+                    positionBuffer = LoadAccessorAsFloat<glm::vec3>(
+                        m_GltfAsset.accessors[glTFPrimitive.findAttribute("POSITION")->second], positionStorage,
+                        &vertexCount);
                 }
                 // Get buffer data for vertex color
                 if (glTFPrimitive.findAttribute("COLOR_0") != glTFPrimitive.attributes.end())
@@ -841,24 +866,21 @@ namespace GfxRenderEngine
                 // Get buffer data for vertex normals
                 if (glTFPrimitive.findAttribute("NORMAL") != glTFPrimitive.attributes.end())
                 {
-                    auto componentType = LoadAccessor<float>(
-                        m_GltfAsset.accessors[glTFPrimitive.findAttribute("NORMAL")->second], normalsBuffer);
-                    CORE_ASSERT(fastgltf::getGLComponentType(componentType) == GL_FLOAT, "unexpected component type");
+                    normalsBuffer = LoadAccessorAsFloat<glm::vec3>(
+                        m_GltfAsset.accessors[glTFPrimitive.findAttribute("NORMAL")->second], normalsStorage);
                 }
                 // Get buffer data for vertex tangents
                 if (glTFPrimitive.findAttribute("TANGENT") != glTFPrimitive.attributes.end())
                 {
-                    auto componentType = LoadAccessor<float>(
-                        m_GltfAsset.accessors[glTFPrimitive.findAttribute("TANGENT")->second], tangentsBuffer);
-                    CORE_ASSERT(fastgltf::getGLComponentType(componentType) == GL_FLOAT, "unexpected component type");
+                    tangentsBuffer = LoadAccessorAsFloat<glm::vec4>(
+                        m_GltfAsset.accessors[glTFPrimitive.findAttribute("TANGENT")->second], tangentsStorage);
                 }
                 // Get buffer data for vertex texture coordinates
                 // glTF supports multiple sets, we only load the first one
                 if (glTFPrimitive.findAttribute("TEXCOORD_0") != glTFPrimitive.attributes.end())
                 {
-                    auto componentType = LoadAccessor<float>(
-                        m_GltfAsset.accessors[glTFPrimitive.findAttribute("TEXCOORD_0")->second], texCoordsBuffer);
-                    CORE_ASSERT(fastgltf::getGLComponentType(componentType) == GL_FLOAT, "unexpected component type");
+                    texCoordsBuffer = LoadAccessorAsFloat<glm::vec2>(
+                        m_GltfAsset.accessors[glTFPrimitive.findAttribute("TEXCOORD_0")->second], texCoordsStorage);
                 }
 
                 // Get buffer data for joints
@@ -873,9 +895,8 @@ namespace GfxRenderEngine
                 // Get buffer data for joint weights
                 if (glTFPrimitive.findAttribute("WEIGHTS_0") != glTFPrimitive.attributes.end())
                 {
-                    auto componentType = LoadAccessor<float>(
-                        m_GltfAsset.accessors[glTFPrimitive.findAttribute("WEIGHTS_0")->second], weightsBuffer);
-                    CORE_ASSERT(fastgltf::getGLComponentType(componentType) == GL_FLOAT, "unexpected component type");
+                    weightsBuffer = LoadAccessorAsFloat<glm::vec4>(
+                        m_GltfAsset.accessors[glTFPrimitive.findAttribute("WEIGHTS_0")->second], weightsStorage);
                 }
 
                 // Append data to model's vertex buffer
@@ -988,6 +1009,7 @@ namespace GfxRenderEngine
 
             submesh.m_VertexCount = vertexCount;
             submesh.m_IndexCount = indexCount;
+            submesh.CalculateBounds(vertices);
         }
     }
 
@@ -1076,10 +1098,6 @@ namespace GfxRenderEngine
             resourceBuffers = m_ResourceBuffersPre;
             std::shared_ptr<Buffer> instanceUbo{instanceBuffer->GetBuffer()};
             resourceBuffers[Resources::INSTANCE_BUFFER_INDEX] = instanceUbo;
-            if (m_SkeletalAnimation)
-            {
-                resourceBuffers[Resources::SKELETAL_ANIMATION_BUFFER_INDEX] = m_ShaderData;
-            }
             submesh.m_Resources.m_ResourceDescriptor = ResourceDescriptor::Create(resourceBuffers);
         }
 
@@ -23,6 +23,7 @@
 #pragma once
 
 #include <future>
+#include <cstring>
 
 #include <fastgltf/core.hpp>
 #include <fastgltf/types.hpp>
@@ -70,6 +71,7 @@ namespace GfxRenderEngine
 
     private:
         void LoadTextures();
+        bool LoadCookedImage(Texture& texture, uint const imageIndex, uchar const* data, size_t size);
         void LoadMaterials();
         void LoadVertexData(uint const, Model::ModelData&);
         bool GetImageFormat(uint const imageIndex);
@@ -114,6 +116,30 @@ namespace GfxRenderEngine
             return accessor.componentType;
         }
 
+        // KHR_mesh_quantization: float accessors are used in place, integer accessors
+        // (normalized or not) are converted to float in the provided storage
+        template <typename T>
+        const float* LoadAccessorAsFloat(const fastgltf::Accessor& accessor, std::vector<float>& storage,
+                                         size_t* count = nullptr)
+        {
+            if (accessor.componentType == fastgltf::ComponentType::Float)
+            {
+                const float* pointer = nullptr;
+                LoadAccessor<float>(accessor, pointer, count);
+                return pointer;
+            }
+
+            storage.resize(accessor.count * T::length());
+            auto convert = [&](T const& element, size_t index)
+            { std::memcpy(&storage[index * T::length()], &element, sizeof(T)); };
+            fastgltf::iterateAccessorWithIndex<T>(m_GltfAsset, accessor, convert);
+            if (count)
+            {
+                *count = accessor.count;
+            }
+            return storage.data();
+        }
+
     private:
         std::string m_Filepath;
         std::string m_Basepath;
@@ -150,7 +176,6 @@ namespace GfxRenderEngine
 
     public:
         std::shared_ptr<Armature::Skeleton> m_Skeleton;
-        std::shared_ptr<Buffer> m_ShaderData;
         std::shared_ptr<SkeletalAnimations> m_Animations;
     };
 } // namespace GfxRenderEngine
@@ -97,7 +97,6 @@ namespace GfxRenderEngine
 
     public:
         std::shared_ptr<Armature::Skeleton> m_Skeleton;
-        std::shared_ptr<Buffer> m_ShaderData;
         std::shared_ptr<SkeletalAnimations> m_Animations;
     };
 } // namespace GfxRenderEngine
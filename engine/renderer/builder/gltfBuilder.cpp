@@ -252,8 +252,7 @@ namespace GfxRenderEngine
             instanceTag.m_Instances.push_back(entity);
             m_InstanceBuffer = InstanceBuffer::Create(m_InstanceCount);
             instanceTag.m_InstanceBuffer = m_InstanceBuffer;
-            instanceTag.m_InstanceBuffer->SetInstanceData(m_InstanceIndex, transform.GetMat4Global(),
-                                                          transform.GetNormalMatrix());
+            instanceTag.m_InstanceBuffer->SetInstanceData(m_InstanceIndex, transform.GetMat4Global());
             m_Registry.emplace<InstanceTag>(entity, instanceTag);
             transform.SetInstance(m_InstanceBuffer, m_InstanceIndex);
             m_InstancedObjects.push_back(entity);
@@ -297,8 +296,8 @@ namespace GfxRenderEngine
                     .m_VertexBufferDeviceAddress = m_Model.get()->GetVertexBufferDeviceAddress(),
                     .m_IndexBufferDeviceAddress = m_Model.get()->GetIndexBufferDeviceAddress(),
                     .m_InstanceBufferDeviceAddress = m_InstanceBuffer.get()->GetBufferDeviceAddress(),
-                    .m_SkeletalAnimationBufferDeviceAddress =
-                        m_ShaderData ? m_ShaderData.get()->GetBufferDeviceAddress() : 0};
+                    .m_PositionBufferDeviceAddress = m_Model.get()->GetPositionBufferDeviceAddress(),
+                    .m_VertexFormat = m_Model.get()->GetVertexFormat()};
                 auto& buffer = m_Model.get()->GetMeshBuffer();
                 buffer = Buffer::Create(sizeof(meshBufferData), Buffer::BufferUsage::STORAGE_BUFFER_VISIBLE_TO_CPU);
                 buffer.get()->MapBuffer();
@@ -311,8 +310,7 @@ namespace GfxRenderEngine
             entt::entity instance = m_InstancedObjects[m_RenderObject++];
             InstanceTag& instanceTag = m_Registry.get<InstanceTag>(instance);
             instanceTag.m_Instances.push_back(entity);
-            instanceTag.m_InstanceBuffer->SetInstanceData(m_InstanceIndex, transform.GetMat4Global(),
-                                                          transform.GetNormalMatrix());
+            instanceTag.m_InstanceBuffer->SetInstanceData(m_InstanceIndex, transform.GetMat4Global());
             transform.SetInstance(instanceTag.m_InstanceBuffer, m_InstanceIndex);
         }
 
@@ -802,6 +800,7 @@ namespace GfxRenderEngine
 
             submesh.m_VertexCount = vertexCount;
             submesh.m_IndexCount = indexCount;
+            submesh.CalculateBounds(m_Vertices);
         }
     }
 
@@ -862,10 +861,6 @@ namespace GfxRenderEngine
             Resources::ResourceBuffers& resourceBuffers = submesh.m_Resources.m_ResourceBuffers;
             std::shared_ptr<Buffer> instanceUbo{m_InstanceBuffer->GetBuffer()};
             resourceBuffers[Resources::INSTANCE_BUFFER_INDEX] = instanceUbo;
-            if (m_SkeletalAnimation)
-            {
-                resourceBuffers[Resources::SKELETAL_ANIMATION_BUFFER_INDEX] = m_ShaderData;
-            }
             submesh.m_Resources.m_ResourceDescriptor = ResourceDescriptor::Create(resourceBuffers);
         }
 
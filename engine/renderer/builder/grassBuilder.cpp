@@ -22,9 +22,6 @@
    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "gtc/type_ptr.hpp"
-#include <cstdlib>
-#include <ctime>
-#include <random>
 
 #include "engine.h"
 #include "renderer/builder/grassBuilder.h"
@@ -32,6 +29,7 @@
 #include "auxiliary/file.h"
 #include "scene/scene.h"
 #include "scene/gltf.h"
+#include "scene/grassField.h"
 
 namespace GfxRenderEngine
 {
@@ -129,70 +127,23 @@ namespace GfxRenderEngine
             return Gltf::GLTF_LOAD_FAILURE;
         }
 
-        std::srand(std::time(0));
-
         for (auto& maskData : m_MaskData)
         {
-            Resources::ResourceBuffers resourceBuffers;
-            uint grassInstances = maskData.m_Quads.size();
-            { // instance buffer
-                std::vector<Grass::GrassShaderData2> bufferData(grassInstances);
-                for (uint quadIndex{0}; auto& quad : maskData.m_Quads)
-                {
-                    Vertex& v0 = maskData.m_Vertices[quad.m_Indices[0]];
-                    Vertex& v1 = maskData.m_Vertices[quad.m_Indices[1]];
-                    Vertex& v2 = maskData.m_Vertices[quad.m_Indices[2]];
-                    Vertex& v3 = maskData.m_Vertices[quad.m_Indices[3]];
-
-                    { // translation
-                        glm::vec3& p0 = v0.m_Position;
-                        glm::vec3& p1 = v1.m_Position;
-                        glm::vec3& p2 = v2.m_Position;
-                        glm::vec3& p3 = v3.m_Position;
-                        float& translationX = bufferData[quadIndex].m_Translation.x;
-                        float& translationY = bufferData[quadIndex].m_Translation.y;
-                        float& translationZ = bufferData[quadIndex].m_Translation.z;
-                        translationX = (p0.x + p1.x + p2.x + p3.x) / 4.0f;
-                        translationY = (p0.y + p1.y + p2.y + p3.y) / 4.0f;
-                        translationZ = (p0.z + p1.z + p2.z + p3.z) / 4.0f;
-
-                        { // randomize X
-                            float randomValue = (std::rand() / static_cast<float>(RAND_MAX)) - 0.5f;
-                            translationX += randomValue * 0.01f;
-                        }
-
-                        { // randomize Z
-                            float randomValue = (std::rand() / static_cast<float>(RAND_MAX)) - 0.5f;
-                            translationZ += randomValue * 0.01f;
-                        }
-                    }
-
-                    { // rotation
-                        float& rotationX = bufferData[quadIndex].m_Rotation.x;
-                        float& rotationY = bufferData[quadIndex].m_Rotation.y;
-                        float& rotationZ = bufferData[quadIndex].m_Rotation.z;
-                        rotationX = 0.0f;
-                        rotationY = 0.0f;
-                        rotationZ = 0.0f;
-
-                        { // randomize Y
-                            float randomValue = std::rand() / static_cast<float>(RAND_MAX);
-                            rotationY += randomValue * 0.1f;
-                        }
-                    }
-                    ++quadIndex;
-                }
-
-                size_t sizeOfBufferDataElement =
-                    sizeof(decltype(bufferData)::value_type); // type-safe version of sizeof(Grass::GrassShaderData2)
-                auto& ubo = resourceBuffers[Resources::HEIGHTMAP];
-                ubo = Buffer::Create(grassInstances * sizeOfBufferDataElement,
-                                     Buffer::BufferUsage::STORAGE_BUFFER_VISIBLE_TO_CPU);
-                ubo->MapBuffer();
-                // update ubo
-                ubo->WriteToBuffer(bufferData.data());
-                ubo->Flush();
+            // one blade in the center of each quad, the instance data is generated per tile by the grass field
+            std::vector<glm::vec3> bladePositions(maskData.m_Quads.size());
+            for (uint quadIndex{0}; auto& quad : maskData.m_Quads)
+            {
+                glm::vec3& p0 = maskData.m_Vertices[quad.m_Indices[0]].m_Position;
+                glm::vec3& p1 = maskData.m_Vertices[quad.m_Indices[1]].m_Position;
+                glm::vec3& p2 = maskData.m_Vertices[quad.m_Indices[2]].m_Position;
+                glm::vec3& p3 = maskData.m_Vertices[quad.m_Indices[3]].m_Position;
+                bladePositions[quadIndex] = (p0 + p1 + p2 + p3) / 4.0f;
+                ++quadIndex;
             }
+            auto grassField = std::make_shared<GrassField>(m_GrassSpec, bladePositions);
+
+            Resources::ResourceBuffers resourceBuffers;
+            resourceBuffers[Resources::HEIGHTMAP] = grassField->GetBuffer(0);
 
             FastgltfBuilder builder(m_GrassSpec.m_FilepathGrassModel, m_Scene, &resourceBuffers);
             builder.SetDictionaryPrefix("grass");
@@ -205,13 +156,14 @@ namespace GfxRenderEngine
                 auto rootNode = sceneGraph.GetNodeByGameObject(grassEntityRoot);
                 auto& grassNode = sceneGraph.GetNode(rootNode.GetChild(0)); // grass model must be single game object
                 Grass2Tag grass2Tag{
-                    .m_InstanceCount = grassInstances,
+                    .m_InstanceCount = 0, // set per frame by the grass field
                     .m_GrassParameters = {.m_Width = 1,  // not used
                                           .m_Height = 1, // not used
                                           .m_ScaleXZ = m_GrassSpec.m_ScaleXZ,
                                           .m_ScaleY = m_GrassSpec.m_ScaleY,
                                           .m_GrassBufferDeviceAddress =
-                                              resourceBuffers[Resources::HEIGHTMAP]->GetBufferDeviceAddress()}};
+                                              resourceBuffers[Resources::HEIGHTMAP]->GetBufferDeviceAddress()},
+                    .m_GrassField = grassField};
                 registry.emplace<Grass2Tag>(grassNode.GetGameObject(), grass2Tag);
                 registry.remove<PlainPBRTag>(grassNode.GetGameObject());
 
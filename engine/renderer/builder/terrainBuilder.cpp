@@ -21,69 +21,165 @@
    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <future>
+
 #include "core.h"
 #include "renderer/image.h"
 #include "renderer/model.h"
 #include "renderer/shader.h"
 #include "renderer/instanceBuffer.h"
 #include "renderer/builder/terrainBuilder.h"
+#include "renderer/builder/terrainKernels.h"
 #include "auxiliary/file.h"
 #include "scene/scene.h"
 #include "scene/grass.h"
+#include "scene/terrainQuadtree.h"
 
 namespace GfxRenderEngine
 {
-    void TerrainBuilder::ColorTerrain(Terrain::TerrainSpec const& terrainSpec, Image const& heightMap)
+    std::shared_ptr<Image> TerrainBuilder::LoadColorMap(Terrain::TerrainSpec const& terrainSpec, Image const& heightMap)
     {
         if (!EngineCore::FileExists(terrainSpec.m_FilepathColorMap))
         {
-            return;
+            return nullptr;
         }
-        Image colorMap{terrainSpec.m_FilepathColorMap};
+        auto colorMap = std::make_shared<Image>(terrainSpec.m_FilepathColorMap);
 
-        if (!colorMap.IsValid())
+        if (!colorMap->IsValid())
         {
             LOG_CORE_CRITICAL("color map did not load: {0}", terrainSpec.m_FilepathColorMap);
-            return;
+            return nullptr;
         }
 
-        if (!(colorMap.BytesPerPixel() == 4))
+        if (!(colorMap->BytesPerPixel() == 4))
         {
-            LOG_CORE_CRITICAL("color map must be rgba (got {0} bytes per pixel) from {1}", colorMap.BytesPerPixel(),
+            LOG_CORE_CRITICAL("color map must be rgba (got {0} bytes per pixel) from {1}", colorMap->BytesPerPixel(),
                               terrainSpec.m_FilepathColorMap);
-            return;
+            return nullptr;
         }
 
-        if (!((colorMap.Width() == heightMap.Width()) && (colorMap.Height()) == heightMap.Height()))
+        if (!((colorMap->Width() == heightMap.Width()) && (colorMap->Height()) == heightMap.Height()))
         {
             LOG_CORE_CRITICAL("color map  and height map dimensions must match: color map width: {0}, color map height: "
                               "{1}, height map width: {2}, height map height: {3}, color map: {4}, heigh map: {5}",
-                              colorMap.Width(), colorMap.Height(), heightMap.Width(), heightMap.Height(),
+                              colorMap->Width(), colorMap->Height(), heightMap.Width(), heightMap.Height(),
                               terrainSpec.m_FilepathColorMap, terrainSpec.m_FilepathHeightMap);
+            return nullptr;
+        }
+        return colorMap;
+    }
+
+    namespace
+    {
+        // image format is rgba in reverse
+        glm::vec4 ConvertColor(uint abgr)
+        {
+            float r = (0xff & (abgr >> 0)) / 255.0f;
+            float g = (0xff & (abgr >> 8)) / 255.0f;
+            float b = (0xff & (abgr >> 16)) / 255.0f;
+            float a = (0xff & (abgr >> 24)) / 255.0f;
+            return glm::vec4(r, g, b, a);
+        }
+
+        float ByteToFloat(uchar const& byte) { return static_cast<uint>(byte) / 255.0f; }
+
+        // splits the rows of the height map into ranges and runs them on the streaming thread pool
+        // (terrains are loaded from tasks of this pool, so GetResult() keeps the worker busy while waiting)
+        template <typename FunctionType> void ParallelForRows(int rows, FunctionType&& function)
+        {
+            constexpr int ROWS_PER_TASK = 64;
+            if (rows <= ROWS_PER_TASK)
+            {
+                function(0, rows);
+                return;
+            }
+
+            ThreadPool& threadPool = Engine::m_Engine->m_PoolSecondary;
+            std::vector<std::future<bool>> futures;
+            futures.reserve((rows + ROWS_PER_TASK - 1) / ROWS_PER_TASK);
+            for (int begin = 0; begin < rows; begin += ROWS_PER_TASK)
+            {
+                int end = std::min(begin + ROWS_PER_TASK, rows);
+                auto task = [&function, begin, end]()
+                {
+                    function(begin, end);
+                    return true;
+                };
+                futures.push_back(threadPool.SubmitTask(task));
+            }
+            for (auto& future : futures)
+            {
+                threadPool.GetResult(future);
+            }
+        }
+    } // namespace
+
+    void TerrainBuilder::ColorTerrain(Terrain::TerrainSpec const& terrainSpec, Image const& heightMap)
+    {
+        ZoneScopedN("TerrainBuilder::ColorTerrain");
+        std::shared_ptr<Image> colorMap = LoadColorMap(terrainSpec, heightMap);
+        if (!colorMap)
+        {
             return;
         }
 
-        uint* imageData = reinterpret_cast<uint*>(colorMap.Get());
-        size_t vertexCounter = 0;
-        for (int y = 0; y < colorMap.Height(); ++y)
+        int cols = colorMap->Width();
+        uchar const* imageData = colorMap->Get();
+        auto colorRows = [&](int begin, int end)
         {
-            int yOffset = y * colorMap.Width();
-            for (int x = 0; x < colorMap.Width(); ++x)
-            { // image format is rgba in reverse
-                uint abgr = imageData[yOffset + x];
-                float r = (0xff & (abgr >> 0)) / 255.0f;
-                float g = (0xff & (abgr >> 8)) / 255.0f;
-                float b = (0xff & (abgr >> 16)) / 255.0f;
-                float a = (0xff & (abgr >> 24)) / 255.0f;
-                m_Vertices[vertexCounter].m_Color = glm::vec4(r, g, b, a);
-                ++vertexCounter;
+            for (int row = begin; row < end; ++row)
+            {
+                float* colors = &m_Vertices[row * cols].m_Color[0];
+                TerrainKernels::UnpackColorsOfRow(imageData + row * cols * 4, cols, colors, sizeof(Vertex));
             }
+        };
+        ParallelForRows(colorMap->Height(), colorRows);
+    }
+
+    glm::vec3 TerrainBuilder::CalculateNormal(Image const& heightMap, int col, int row)
+    {
+        int cols = heightMap.Width();
+        int rows = heightMap.Height();
+        if (!(col > 0 && row > 0 && col < cols - 1 && row < rows - 1))
+        {
+            return glm::vec3(0.0f, 1.0f, 0.0f);
         }
+
+        // compute normals via neighbors
+        //     up
+        // left O right
+        //    down
+        // smooth shading: the sum of the cross products of the four faces around O
+        // is 2 * (left - right, 2, down - up), the height of O cancels out
+        int index = row * cols + col;
+        float leftY = ByteToFloat(heightMap[index - 1]);
+        float rightY = ByteToFloat(heightMap[index + 1]);
+        float upY = ByteToFloat(heightMap[index + cols]);
+        float downY = ByteToFloat(heightMap[index - cols]);
+
+        return glm::normalize(glm::vec3(leftY - rightY, 2.0f, downY - upY));
     }
 
-    bool TerrainBuilder::PopulateTerrainData(Image const& heightMap)
+    // tangent along +x, orthogonal to CalculateNormal()
+    glm::vec3 TerrainBuilder::CalculateTangent(Image const& heightMap, int col, int row)
     {
+        int cols = heightMap.Width();
+        int rows = heightMap.Height();
+        if (!(col > 0 && row > 0 && col < cols - 1 && row < rows - 1))
+        {
+            return glm::vec3(1.0f, 0.0f, 0.0f);
+        }
+
+        int index = row * cols + col;
+        float leftY = ByteToFloat(heightMap[index - 1]);
+        float rightY = ByteToFloat(heightMap[index + 1]);
 
+        return glm::normalize(glm::vec3(2.0f, rightY - leftY, 0.0f));
+    }
+
+    bool TerrainBuilder::PopulateTerrainData(Image const& heightMap)
+    {
+        ZoneScopedN("TerrainBuilder::PopulateTerrainData");
         int const& cols = heightMap.Width();
         int const& rows = heightMap.Height();
         if (!(rows > 0 && cols > 0))
@@ -92,97 +188,288 @@ namespace GfxRenderEngine
             return false;
         }
 
-        { // vertices
-            m_Vertices.resize(rows * cols);
-            int vertexCounter = 0;
-            for (int row = 0; row < rows; ++row)
+        m_Vertices.resize(rows * cols);
+        m_Indices.resize((rows - 1) * (cols - 1) * 6 /*six indices per quad*/);
+        uchar const* heights = heightMap.Get();
+
+        // each task writes the vertices of its rows and the indices of the quads below them
+        auto populateRows = [&](int begin, int end)
+        {
+            TerrainKernels::RowScratch scratch;
+            scratch.Resize(cols);
+            for (int row = begin; row < end; ++row)
             {
-                int rowOffset = row * cols;
-                int rowPlusOneOffset = (row + 1) * cols;
-                int rowMinusOneOffset = (row - 1) * cols;
+                uchar const* center = heights + row * cols;
+                if ((row > 0) && (row < rows - 1) && (cols > 2))
+                {
+                    TerrainKernels::NormalsAndTangentsOfRow(center - cols, center, center + cols, cols, scratch);
+                    TerrainKernels::FlatNormalsAndTangents(0, 1, scratch);
+                    TerrainKernels::FlatNormalsAndTangents(cols - 1, cols, scratch);
+                }
+                else
+                {
+                    TerrainKernels::FlatNormalsAndTangents(0, cols, scratch);
+                }
 
+                Vertex* vertices = &m_Vertices[row * cols];
                 for (int col = 0; col < cols; ++col)
                 {
-                    Vertex& vertex = m_Vertices[vertexCounter];
-                    auto byteToFloat = [](uchar const& byte) { return static_cast<uint>(byte) / 255.0f; };
-
-                    float originY = byteToFloat(heightMap[vertexCounter]);
-
+                    Vertex& vertex = vertices[col];
+                    float originY = ByteToFloat(center[col]);
                     vertex.m_Position = glm::vec3(col, originY, row);
                     vertex.m_Color = glm::vec4(0.f, 0.f, originY / 3.0f, 1.0f);
+                    vertex.m_Normal = glm::vec3(scratch.m_NormalX[col], scratch.m_NormalY[col], scratch.m_NormalZ[col]);
+                    vertex.m_Tangent = glm::vec3(scratch.m_TangentX[col], scratch.m_TangentY[col], 0.0f);
+                }
 
-                    // compute normals via neighbors
-                    //     up
-                    // left O right
-                    //    down
-                    glm::vec3 sumNormals(0.0f);
-                    float leftY = col > 0 ? byteToFloat(heightMap[rowOffset + col - 1]) : 0.0f;
-                    float rightY = col < cols - 1 ? byteToFloat(heightMap[rowOffset + col + 1]) : 0.0f;
-                    float upY = row < rows - 1 ? byteToFloat(heightMap[rowPlusOneOffset + col]) : 0.0f;
-                    float downY = row > 0 ? byteToFloat(heightMap[rowMinusOneOffset + col]) : 0.0f;
-
-                    float dx = 1.0f;
-                    float dz = 1.0f;
-
-                    glm::vec3 left = glm::vec3(-dx, leftY - originY, 0.0f);
-                    glm::vec3 right = glm::vec3(dx, rightY - originY, 0.0f);
-                    glm::vec3 up = glm::vec3(0.0f, upY - originY, dz);
-                    glm::vec3 down = glm::vec3(0.0f, downY - originY, -dz);
-
-                    auto normalComponent = [&](glm::vec3 a, glm::vec3 b)
+                if (row < rows - 1)
+                {
+                    uint rowOffset = row * cols;
+                    uint rowPlusOneOffset = (row + 1) * cols;
+                    uint* indices = &m_Indices[row * (cols - 1) * 6];
+                    for (int col = 0; col < cols - 1; ++col)
                     {
-                        glm::vec3 normal;
-                        if (col > 0 && row > 0 && col < cols - 1 && row < rows - 1)
-                        {
-                            // Cross products to compute normals
-                            normal = glm::cross(a, b);
-                        }
-                        else
-                        {
-                            normal = glm::vec3(0.0f, 1.0f, 0.0f);
-                        }
-                        return normal;
-                    };
+                        uint topLeft = rowOffset + col;
+                        uint topRight = topLeft + 1;
+                        uint bottomLeft = rowPlusOneOffset + col;
+                        uint bottomRight = bottomLeft + 1;
+
+                        *indices++ = topLeft;
+                        *indices++ = bottomLeft;
+                        *indices++ = topRight;
+                        *indices++ = topRight;
+                        *indices++ = bottomLeft;
+                        *indices++ = bottomRight;
+                    }
+                }
+            }
+        };
+        ParallelForRows(rows, populateRows);
+        return true;
+    }
 
-                    // smoothshading
-                    sumNormals = normalComponent(left, -down);
-                    sumNormals += normalComponent(-down, right);
-                    sumNormals += normalComponent(right, -up);
-                    sumNormals += normalComponent(-up, left);
+    float TerrainBuilder::CalculateGeometricError(Image const& heightMap, Terrain::ChunkArea const& area) const
+    {
+        if (area.m_Stride == 1)
+        {
+            return 0.0f; // full resolution
+        }
+
+        int cols = heightMap.Width();
+        int rows = heightMap.Height();
+        int verticesX = area.m_QuadsX + 1;
+        auto heightOfTile = [&](int x, int z) { return m_Vertices[z * verticesX + x].m_Position.y; };
+
+        // compare every pixel of the height map with the triangles of the tile
+        float maxError = 0.0f;
+        for (int z = 0; z < area.m_QuadsZ; ++z)
+        {
+            int row0 = area.m_Row + z * area.m_Stride;
+            int row1 = std::min(row0 + area.m_Stride, rows - 1);
+            for (int x = 0; x < area.m_QuadsX; ++x)
+            {
+                int col0 = area.m_Col + x * area.m_Stride;
+                int col1 = std::min(col0 + area.m_Stride, cols - 1);
+                float topLeft = heightOfTile(x, z);
+                float topRight = heightOfTile(x + 1, z);
+                float bottomLeft = heightOfTile(x, z + 1);
+                float bottomRight = heightOfTile(x + 1, z + 1);
+                for (int row = row0; row <= row1; ++row)
+                {
+                    float fz = static_cast<float>(row - row0) / static_cast<float>(row1 - row0);
+                    for (int col = col0; col <= col1; ++col)
+                    {
+                        float fx = static_cast<float>(col - col0) / static_cast<float>(col1 - col0);
+                        // the quad is split along the diagonal from top right to bottom left
+                        float interpolated = (fx + fz <= 1.0f)
+                                                 ? topLeft + fx * (topRight - topLeft) + fz * (bottomLeft - topLeft)
+                                                 : bottomRight + (1.0f - fx) * (bottomLeft - bottomRight) +
+                                                       (1.0f - fz) * (topRight - bottomRight);
+                        float error = std::abs(ByteToFloat(heightMap[row * cols + col]) - interpolated);
+                        maxError = std::max(maxError, error);
+                    }
+                }
+            }
+        }
+        return maxError;
+    }
+
+    bool TerrainBuilder::PopulateChunkData(Image const& heightMap, Image* colorMap, Terrain::ChunkArea const& area,
+                                           float minSkirtDepth)
+    {
+        ZoneScopedN("TerrainBuilder::PopulateChunkData");
+        int cols = heightMap.Width();
+        int rows = heightMap.Height();
+        if (!(area.m_QuadsX > 0 && area.m_QuadsZ > 0))
+        {
+            LOG_CORE_CRITICAL("TerrainBuilder::PopulateChunkData: empty tile");
+            return false;
+        }
 
-                    vertex.m_Normal = glm::normalize(sumNormals);
+        m_Vertices.clear();
+        m_Indices.clear();
+        m_Submeshes.clear();
+
+        int verticesX = area.m_QuadsX + 1;
+        int verticesZ = area.m_QuadsZ + 1;
+        uint* colorData = colorMap ? reinterpret_cast<uint*>(colorMap->Get()) : nullptr;
+
+        { // grid vertices, the last row and column are clamped to the border of the height map
+            m_Vertices.resize(verticesX * verticesZ);
+            int vertexCounter = 0;
+            for (int z = 0; z < verticesZ; ++z)
+            {
+                int row = std::min(area.m_Row + z * area.m_Stride, rows - 1);
+                for (int x = 0; x < verticesX; ++x)
+                {
+                    int col = std::min(area.m_Col + x * area.m_Stride, cols - 1);
+                    Vertex& vertex = m_Vertices[vertexCounter];
+                    int pixelIndex = row * cols + col;
+                    float originY = ByteToFloat(heightMap[pixelIndex]);
+
+                    vertex.m_Position = glm::vec3(col, originY, row);
+                    vertex.m_Color = colorData ? ConvertColor(colorData[pixelIndex])
+                                               : glm::vec4(0.f, 0.f, originY / 3.0f, 1.0f);
+                    vertex.m_Normal = CalculateNormal(heightMap, col, row);
+                    vertex.m_Tangent = CalculateTangent(heightMap, col, row);
                     ++vertexCounter;
                 }
             }
         }
 
-        { // indices
-            m_Indices.resize(rows * cols * 6 /*six indices per quad*/);
-            int index = 0;
-            for (int row = 0; row < rows - 1; ++row)
+        { // grid indices
+            m_Indices.reserve(area.m_QuadsX * area.m_QuadsZ * 6 /*six indices per quad*/);
+            for (int z = 0; z < area.m_QuadsZ; ++z)
             {
-                uint rowOffset = row * cols;
-                uint rowPlusOneOffset = (row + 1) * cols;
-                for (int col = 0; col < cols - 1; ++col)
+                uint rowOffset = z * verticesX;
+                uint rowPlusOneOffset = (z + 1) * verticesX;
+                for (int x = 0; x < area.m_QuadsX; ++x)
                 {
-                    uint topLeft = rowOffset + col;
+                    uint topLeft = rowOffset + x;
                     uint topRight = topLeft + 1;
-                    uint bottomLeft = rowPlusOneOffset + col;
+                    uint bottomLeft = rowPlusOneOffset + x;
                     uint bottomRight = bottomLeft + 1;
+                    m_Indices.insert(m_Indices.end(), {topLeft, bottomLeft, topRight, topRight, bottomLeft, bottomRight});
+                }
+            }
+        }
+
+        m_GeometricError = CalculateGeometricError(heightMap, area);
 
-                    m_Indices[index++] = topLeft;
-                    m_Indices[index++] = bottomLeft;
-                    m_Indices[index++] = topRight;
-                    m_Indices[index++] = topRight;
-                    m_Indices[index++] = bottomLeft;
-                    m_Indices[index++] = bottomRight;
+        { // skirts
+            // Neighboring tiles of different levels of detail deviate from each other by at most the sum of their
+            // geometric errors. Each tile hangs a vertical strip of its own error below its border, which closes
+            // the gap from both sides. Skirts are two-sided, they are seen from either side depending on the slope.
+            float skirtDepth = std::max(minSkirtDepth, m_GeometricError);
+            auto addSkirt = [&](std::vector<uint> const& border)
+            {
+                uint firstSkirtVertex = static_cast<uint>(m_Vertices.size());
+                for (uint borderVertex : border)
+                {
+                    Vertex vertex = m_Vertices[borderVertex];
+                    vertex.m_Position.y -= skirtDepth;
+                    m_Vertices.push_back(vertex);
+                }
+                for (uint index = 0; index + 1 < border.size(); ++index)
+                {
+                    uint top0 = border[index];
+                    uint top1 = border[index + 1];
+                    uint bottom0 = firstSkirtVertex + index;
+                    uint bottom1 = bottom0 + 1;
+                    m_Indices.insert(m_Indices.end(), {top0, bottom0, top1, top1, bottom0, bottom1});
+                    m_Indices.insert(m_Indices.end(), {top0, top1, bottom0, top1, bottom1, bottom0});
                 }
+            };
+
+            std::vector<uint> border;
+            border.resize(verticesX);
+            for (int x = 0; x < verticesX; ++x)
+            {
+                border[x] = x; // top
+            }
+            addSkirt(border);
+            for (int x = 0; x < verticesX; ++x)
+            {
+                border[x] = (verticesZ - 1) * verticesX + x; // bottom
             }
+            addSkirt(border);
+            border.resize(verticesZ);
+            for (int z = 0; z < verticesZ; ++z)
+            {
+                border[z] = z * verticesX; // left
+            }
+            addSkirt(border);
+            for (int z = 0; z < verticesZ; ++z)
+            {
+                border[z] = z * verticesX + verticesX - 1; // right
+            }
+            addSkirt(border);
         }
-        CalculateTangents();
+
         return true;
     }
 
+    std::shared_ptr<PbrMaterial> TerrainBuilder::CreateMaterial(Terrain::TerrainSpec const& terrainSpec)
+    {
+        auto material = std::make_shared<PbrMaterial>();
+        material->m_PbrMaterialProperties = terrainSpec.m_PbrMaterialProperties;
+
+        { // create material descriptor
+            PbrMaterial::MaterialTextures materialTextures;
+
+            auto materialDescriptor = MaterialDescriptor::Create(Material::MtPbr, materialTextures);
+            material->SetMaterialDescriptor(materialDescriptor);
+        }
+
+        { // create material buffer
+            auto& buffer = material->GetMaterialBuffer();
+            buffer = Buffer::Create(sizeof(material->m_PbrMaterialProperties),
+                                    Buffer::BufferUsage::STORAGE_BUFFER_VISIBLE_TO_CPU);
+            buffer.get()->MapBuffer();
+            buffer.get()->WriteToBuffer(&material->m_PbrMaterialProperties);
+            buffer.get()->Flush();
+        }
+        return material;
+    }
+
+    std::shared_ptr<Model> TerrainBuilder::CreateModel(std::shared_ptr<InstanceBuffer> const& instanceBuffer,
+                                                       std::shared_ptr<PbrMaterial> const& material, int instanceCount)
+    {
+        Submesh submesh{};
+        submesh.m_FirstIndex = 0;
+        submesh.m_FirstVertex = 0;
+        submesh.m_IndexCount = m_Indices.size();
+        submesh.m_VertexCount = m_Vertices.size();
+        submesh.m_InstanceCount = instanceCount;
+        submesh.CalculateBounds(m_Vertices);
+        submesh.m_Material = material;
+
+        { // create resource descriptor
+            Resources::ResourceBuffers resourceBuffers;
+
+            resourceBuffers[Resources::INSTANCE_BUFFER_INDEX] = instanceBuffer->GetBuffer();
+            auto resourceDescriptor = ResourceDescriptor::Create(resourceBuffers);
+            submesh.m_Resources.m_ResourceDescriptor = resourceDescriptor;
+        }
+        m_Submeshes.push_back(submesh);
+        std::shared_ptr<Model> model = Engine::m_Engine->LoadModel(*this);
+
+        { // create mesh buffer
+            MeshBufferData meshBufferData = {
+                .m_VertexBufferDeviceAddress = model.get()->GetVertexBufferDeviceAddress(),
+                .m_IndexBufferDeviceAddress = model.get()->GetIndexBufferDeviceAddress(),
+                .m_InstanceBufferDeviceAddress = instanceBuffer->GetBufferDeviceAddress(),
+                .m_PositionBufferDeviceAddress = model.get()->GetPositionBufferDeviceAddress(),
+                .m_VertexFormat = model.get()->GetVertexFormat()};
+            auto& buffer = model.get()->GetMeshBuffer();
+            buffer = Buffer::Create(sizeof(meshBufferData), Buffer::BufferUsage::STORAGE_BUFFER_VISIBLE_TO_CPU);
+            buffer.get()->MapBuffer();
+            buffer.get()->WriteToBuffer(&meshBufferData);
+            buffer.get()->Flush();
+        }
+        return model;
+    }
+
     bool TerrainBuilder::LoadMesh(Scene& scene, int instanceCount, Terrain::TerrainSpec const& terrainSpec)
     {
         bool meshFound = !terrainSpec.m_FilepathMesh.empty() && // 3D model for terrain provided?
@@ -221,6 +508,7 @@ namespace GfxRenderEngine
         m_Vertices.clear();
         m_Indices.clear();
         m_Submeshes.clear();
+        bool chunked = terrainSpec.m_ChunkSpec.m_Enabled;
 
         { // terrain data
             terrainComponent.m_HeightMap = std::make_shared<Image>(terrainSpec.m_FilepathHeightMap);
@@ -239,12 +527,15 @@ namespace GfxRenderEngine
                 return false;
             }
 
-            bool succesful = PopulateTerrainData(heightMap);
-            if (!succesful)
+            if (!chunked)
             {
-                return false;
+                bool succesful = PopulateTerrainData(heightMap);
+                if (!succesful)
+                {
+                    return false;
+                }
+                ColorTerrain(terrainSpec, heightMap);
             }
-            ColorTerrain(terrainSpec, heightMap);
         }
 
         { // create game objects for all instances
@@ -270,71 +561,37 @@ namespace GfxRenderEngine
                     instanceTag.m_InstanceBuffer = InstanceBuffer::Create(instanceCount);
                     registry.emplace<InstanceTag>(entity, instanceTag);
 
-                    Submesh submesh{};
-                    submesh.m_FirstIndex = 0;
-                    submesh.m_FirstVertex = 0;
-                    submesh.m_IndexCount = m_Indices.size();
-                    submesh.m_VertexCount = m_Vertices.size();
-                    submesh.m_InstanceCount = instanceCount;
-
-                    auto material = std::make_shared<PbrMaterial>();
-                    material->m_PbrMaterialProperties = terrainSpec.m_PbrMaterialProperties;
-                    submesh.m_Material = material;
-
-                    { // create material descriptor
-                        PbrMaterial::MaterialTextures materialTextures;
-
-                        auto materialDescriptor = MaterialDescriptor::Create(Material::MtPbr, materialTextures);
-                        material->SetMaterialDescriptor(materialDescriptor);
+                    if (chunked)
+                    {
+                        // tiles are built on demand by the quadtree
+                        terrainComponent.m_Quadtree = std::make_shared<TerrainQuadtree>(
+                            registry, terrainSpec, terrainComponent.m_HeightMap, instanceTag.m_InstanceBuffer,
+                            instanceCount);
                     }
-                    { // create resource descriptor
-                        Resources::ResourceBuffers resourceBuffers;
+                    else
+                    {
+                        model = CreateModel(instanceTag.m_InstanceBuffer, CreateMaterial(terrainSpec), instanceCount);
 
-                        resourceBuffers[Resources::INSTANCE_BUFFER_INDEX] = instanceTag.m_InstanceBuffer->GetBuffer();
-                        auto resourceDescriptor = ResourceDescriptor::Create(resourceBuffers);
-                        submesh.m_Resources.m_ResourceDescriptor = resourceDescriptor;
-                    }
-                    m_Submeshes.push_back(submesh);
-                    model = Engine::m_Engine->LoadModel(*this);
-
-                    PbrMaterialTag pbrMaterialTag{};
-                    registry.emplace<PbrMaterialTag>(entity, pbrMaterialTag);
-
-                    PlainPBRTag plainPBRTag{};
-                    registry.emplace<PlainPBRTag>(entity, plainPBRTag);
-
-                    { // create material buffer
-                        auto& buffer = material->GetMaterialBuffer();
-                        buffer = Buffer::Create(sizeof(material->m_PbrMaterialProperties),
-                                                Buffer::BufferUsage::STORAGE_BUFFER_VISIBLE_TO_CPU);
-                        buffer.get()->MapBuffer();
-                        buffer.get()->WriteToBuffer(&material->m_PbrMaterialProperties);
-                        buffer.get()->Flush();
-                    }
+                        PbrMaterialTag pbrMaterialTag{};
+                        registry.emplace<PbrMaterialTag>(entity, pbrMaterialTag);
 
-                    { // create mesh buffer
-                        MeshBufferData meshBufferData = {
-                            .m_VertexBufferDeviceAddress = model.get()->GetVertexBufferDeviceAddress(),
-                            .m_IndexBufferDeviceAddress = model.get()->GetIndexBufferDeviceAddress(),
-                            .m_InstanceBufferDeviceAddress = instanceTag.m_InstanceBuffer->GetBufferDeviceAddress(),
-                            .m_SkeletalAnimationBufferDeviceAddress = 0};
-                        auto& buffer = model.get()->GetMeshBuffer();
-                        buffer = Buffer::Create(sizeof(meshBufferData), Buffer::BufferUsage::STORAGE_BUFFER_VISIBLE_TO_CPU);
-                        buffer.get()->MapBuffer();
-                        buffer.get()->WriteToBuffer(&meshBufferData);
-                        buffer.get()->Flush();
+                        PlainPBRTag plainPBRTag{};
+                        registry.emplace<PlainPBRTag>(entity, plainPBRTag);
                     }
                 }
 
-                instanceTag.m_InstanceBuffer->SetInstanceData(instanceIndex, transform.GetMat4Global(),
-                                                              transform.GetNormalMatrix());
+                instanceTag.m_InstanceBuffer->SetInstanceData(instanceIndex, transform.GetMat4Global());
                 transform.SetInstance(instanceTag.m_InstanceBuffer, instanceIndex);
                 registry.emplace<TransformComponent>(entity, transform);
 
-                auto shortName = EngineCore::GetFilenameWithoutPathAndExtension(terrainSpec.m_FilepathTerrainDescription) +
-                                 std::string("::") + std::to_string(instanceIndex);
-                MeshComponent mesh{shortName, model};
-                registry.emplace<MeshComponent>(entity, mesh);
+                if (!chunked)
+                {
+                    auto shortName =
+                        EngineCore::GetFilenameWithoutPathAndExtension(terrainSpec.m_FilepathTerrainDescription) +
+                        std::string("::") + std::to_string(instanceIndex);
+                    MeshComponent mesh{shortName, model};
+                    registry.emplace<MeshComponent>(entity, mesh);
+                }
                 registry.emplace<TerrainComponent>(entity, terrainComponent);
             }
         }
@@ -415,106 +672,4 @@ namespace GfxRenderEngine
 
         return true;
     }
-
-    void TerrainBuilder::CalculateTangents()
-    {
-        if (m_Indices.size())
-        {
-            CalculateTangentsFromIndexBuffer(m_Indices);
-        }
-        else
-        {
-            uint vertexCount = m_Vertices.size();
-            if (vertexCount)
-            {
-                std::vector<uint> indices;
-                indices.resize(vertexCount);
-                for (uint i = 0; i < vertexCount; i++)
-                {
-                    indices[i] = i;
-                }
-                CalculateTangentsFromIndexBuffer(indices);
-            }
-        }
-    }
-
-    void TerrainBuilder::CalculateTangentsFromIndexBuffer(std::vector<uint> const& indices)
-    {
-        uint cnt = 0;
-        uint vertexIndex1 = 0;
-        uint vertexIndex2 = 0;
-        uint vertexIndex3 = 0;
-        glm::vec3 position1 = glm::vec3{0.0f};
-        glm::vec3 position2 = glm::vec3{0.0f};
-        glm::vec3 position3 = glm::vec3{0.0f};
-        glm::vec2 uv1 = glm::vec2{0.0f};
-        glm::vec2 uv2 = glm::vec2{0.0f};
-        glm::vec2 uv3 = glm::vec2{0.0f};
-
-        for (uint index : indices)
-        {
-            auto& vertex = m_Vertices[index];
-
-            switch (cnt)
-            {
-                case 0:
-                    position1 = vertex.m_Position;
-                    uv1 = vertex.m_UV;
-                    vertexIndex1 = index;
-                    break;
-                case 1:
-                    position2 = vertex.m_Position;
-                    uv2 = vertex.m_UV;
-                    vertexIndex2 = index;
-                    break;
-                case 2:
-                    position3 = vertex.m_Position;
-                    uv3 = vertex.m_UV;
-                    vertexIndex3 = index;
-
-                    glm::vec3 edge1 = position2 - position1;
-                    glm::vec3 edge2 = position3 - position1;
-                    glm::vec2 deltaUV1 = uv2 - uv1;
-                    glm::vec2 deltaUV2 = uv3 - uv1;
-
-                    float dU1 = deltaUV1.x;
-                    float dU2 = deltaUV2.x;
-                    float dV1 = deltaUV1.y;
-                    float dV2 = deltaUV2.y;
-                    float E1x = edge1.x;
-                    float E2x = edge2.x;
-                    float E1y = edge1.y;
-                    float E2y = edge2.y;
-                    float E1z = edge1.z;
-                    float E2z = edge2.z;
-
-                    float factor;
-                    if ((dU1 * dV2 - dU2 * dV1) > std::numeric_limits<float>::epsilon())
-                    {
-                        factor = 1.0f / (dU1 * dV2 - dU2 * dV1);
-                    }
-                    else
-                    {
-                        factor = 100000.0f;
-                    }
-
-                    glm::vec3 tangent;
-
-                    tangent.x = factor * (dV2 * E1x - dV1 * E2x);
-                    tangent.y = factor * (dV2 * E1y - dV1 * E2y);
-                    tangent.z = factor * (dV2 * E1z - dV1 * E2z);
-                    if (tangent.x == 0.0f && tangent.y == 0.0f && tangent.z == 0.0f)
-                    {
-                        tangent = glm::vec3(1.0f, 0.0f, 0.0f);
-                    }
-
-                    m_Vertices[vertexIndex1].m_Tangent = tangent;
-                    m_Vertices[vertexIndex2].m_Tangent = tangent;
-                    m_Vertices[vertexIndex3].m_Tangent = tangent;
-
-                    break;
-            }
-            cnt = (cnt + 1) % 3;
-        }
-    }
 } // namespace GfxRenderEngine
@@ -21,12 +21,16 @@
    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
+#include <memory>
+
+#include "renderer/model.h"
 #include "scene/terrain.h"
 
 namespace GfxRenderEngine
 {
     class Scene;
     class Image;
+    class InstanceBuffer;
 
     class TerrainBuilder
     {
@@ -37,15 +41,31 @@ namespace GfxRenderEngine
         bool LoadTerrain(Scene& scene, int instanceCount, Terrain::TerrainSpec const& terrainSpec);
         bool LoadMesh(Scene& scene, int instanceCount, Terrain::TerrainSpec const& terrainSpec);
 
+        // one tile of a chunked terrain (see TerrainQuadtree), with skirts to hide cracks between levels of detail
+        bool PopulateChunkData(Image const& heightMap, Image* colorMap, Terrain::ChunkArea const& area,
+                               float minSkirtDepth);
+        // max height difference between the tile and the full-resolution height map
+        float GetGeometricError() const { return m_GeometricError; }
+
+        std::shared_ptr<Model> CreateModel(std::shared_ptr<InstanceBuffer> const& instanceBuffer,
+                                           std::shared_ptr<PbrMaterial> const& material, int instanceCount);
+
+        static std::shared_ptr<PbrMaterial> CreateMaterial(Terrain::TerrainSpec const& terrainSpec);
+        static std::shared_ptr<Image> LoadColorMap(Terrain::TerrainSpec const& terrainSpec, Image const& heightMap);
+        static glm::vec3 CalculateNormal(Image const& heightMap, int col, int row);
+        static glm::vec3 CalculateTangent(Image const& heightMap, int col, int row);
+
     private:
         bool PopulateTerrainData(Image const& heightMap);
         void ColorTerrain(Terrain::TerrainSpec const& terrainSpec, Image const& heightMap);
-        void CalculateTangents();
-        void CalculateTangentsFromIndexBuffer(std::vector<uint> const& indices);
+        float CalculateGeometricError(Image const& heightMap, Terrain::ChunkArea const& area) const;
 
     public:
         std::vector<uint> m_Indices{};
         std::vector<Vertex> m_Vertices{};
         std::vector<Submesh> m_Submeshes{};
+
+    private:
+        float m_GeometricError{0.0f};
     };
 } // namespace GfxRenderEngine
@@ -0,0 +1,292 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include <cmath>
+#include <cstring>
+
+#include "renderer/builder/terrainKernels.h"
+
+// SSE2 is part of x86-64, AVX2 is compiled per function and selected at runtime (gcc, clang)
+#if defined(__x86_64__) || defined(_M_X64)
+#define TERRAIN_KERNELS_SSE2
+#include <emmintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define TERRAIN_KERNELS_AVX2
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
+#endif
+
+namespace GfxRenderEngine
+{
+    namespace TerrainKernels
+    {
+        namespace
+        {
+            constexpr float TWO_PIXELS = 2.0f * 255.0f;
+            constexpr float TWO_PIXELS_SQUARED = TWO_PIXELS * TWO_PIXELS;
+
+            // columns [begin, cols - 1), also the tail of the vector paths
+            void NormalsAndTangentsScalar(uchar const* __restrict down, uchar const* __restrict center,
+                                          uchar const* __restrict up, int begin, int cols, RowScratch& scratch)
+            {
+                float* __restrict normalX = scratch.m_NormalX.data();
+                float* __restrict normalY = scratch.m_NormalY.data();
+                float* __restrict normalZ = scratch.m_NormalZ.data();
+                float* __restrict tangentX = scratch.m_TangentX.data();
+                float* __restrict tangentY = scratch.m_TangentY.data();
+                for (int col = begin; col < cols - 1; ++col)
+                {
+                    float slopeX = static_cast<float>(static_cast<int>(center[col - 1]) - static_cast<int>(center[col + 1]));
+                    float slopeZ = static_cast<float>(static_cast<int>(down[col]) - static_cast<int>(up[col]));
+                    float inverseNormalLength = 1.0f / std::sqrt(slopeX * slopeX + TWO_PIXELS_SQUARED + slopeZ * slopeZ);
+                    float inverseTangentLength = 1.0f / std::sqrt(slopeX * slopeX + TWO_PIXELS_SQUARED);
+                    normalX[col] = slopeX * inverseNormalLength;
+                    normalY[col] = TWO_PIXELS * inverseNormalLength;
+                    normalZ[col] = slopeZ * inverseNormalLength;
+                    tangentX[col] = TWO_PIXELS * inverseTangentLength;
+                    tangentY[col] = -slopeX * inverseTangentLength;
+                }
+            }
+
+            float* ColorOfPixel(float* color, int col, size_t stride)
+            {
+                return reinterpret_cast<float*>(reinterpret_cast<char*>(color) + col * stride);
+            }
+
+            void UnpackColorsScalar(uchar const* rgba, int begin, int cols, float* color, size_t stride)
+            {
+                for (int col = begin; col < cols; ++col)
+                {
+                    float* pixel = ColorOfPixel(color, col, stride);
+                    for (int channel = 0; channel < 4; ++channel)
+                    {
+                        pixel[channel] = static_cast<float>(rgba[col * 4 + channel]) / 255.0f;
+                    }
+                }
+            }
+
+#ifdef TERRAIN_KERNELS_SSE2
+            // four bytes to four 32 bit integers
+            __m128i LoadBytesSSE2(uchar const* bytes)
+            {
+                int packed;
+                std::memcpy(&packed, bytes, sizeof(packed));
+                __m128i zero = _mm_setzero_si128();
+                return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(packed), zero), zero);
+            }
+
+            void NormalsAndTangentsSSE2(uchar const* __restrict down, uchar const* __restrict center,
+                                        uchar const* __restrict up, int cols, RowScratch& scratch)
+            {
+                __m128 const one = _mm_set1_ps(1.0f);
+                __m128 const twoPixels = _mm_set1_ps(TWO_PIXELS);
+                __m128 const twoPixelsSquared = _mm_set1_ps(TWO_PIXELS_SQUARED);
+                __m128 const signBit = _mm_set1_ps(-0.0f);
+
+                // center[col + 4] is the last byte read
+                int col = 1;
+                for (; col + 4 < cols; col += 4)
+                {
+                    __m128i left = LoadBytesSSE2(center + col - 1);
+                    __m128i right = LoadBytesSSE2(center + col + 1);
+                    __m128 slopeX = _mm_cvtepi32_ps(_mm_sub_epi32(left, right));
+                    __m128 slopeZ = _mm_cvtepi32_ps(_mm_sub_epi32(LoadBytesSSE2(down + col), LoadBytesSSE2(up + col)));
+                    __m128 slopeXSquared = _mm_mul_ps(slopeX, slopeX);
+                    __m128 normalLengthSquared =
+                        _mm_add_ps(_mm_add_ps(slopeXSquared, twoPixelsSquared), _mm_mul_ps(slopeZ, slopeZ));
+                    __m128 inverseNormalLength = _mm_div_ps(one, _mm_sqrt_ps(normalLengthSquared));
+                    __m128 inverseTangentLength = _mm_div_ps(one, _mm_sqrt_ps(_mm_add_ps(slopeXSquared, twoPixelsSquared)));
+                    _mm_storeu_ps(&scratch.m_NormalX[col], _mm_mul_ps(slopeX, inverseNormalLength));
+                    _mm_storeu_ps(&scratch.m_NormalY[col], _mm_mul_ps(twoPixels, inverseNormalLength));
+                    _mm_storeu_ps(&scratch.m_NormalZ[col], _mm_mul_ps(slopeZ, inverseNormalLength));
+                    _mm_storeu_ps(&scratch.m_TangentX[col], _mm_mul_ps(twoPixels, inverseTangentLength));
+                    _mm_storeu_ps(&scratch.m_TangentY[col], _mm_mul_ps(_mm_xor_ps(slopeX, signBit), inverseTangentLength));
+                }
+                NormalsAndTangentsScalar(down, center, up, col, cols, scratch);
+            }
+
+            // one pixel per vector
+            void UnpackColorsSSE2(uchar const* rgba, int cols, float* color, size_t stride)
+            {
+                __m128 const scale = _mm_set1_ps(255.0f);
+                for (int col = 0; col < cols; ++col)
+                {
+                    __m128 bytes = _mm_cvtepi32_ps(LoadBytesSSE2(rgba + col * 4));
+                    _mm_storeu_ps(ColorOfPixel(color, col, stride), _mm_div_ps(bytes, scale));
+                }
+            }
+#endif
+
+#ifdef TERRAIN_KERNELS_AVX2
+            // eight bytes to eight 32 bit integers
+            TARGET_AVX2 __m256i LoadBytesAVX2(uchar const* bytes)
+            {
+                return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(bytes)));
+            }
+
+            TARGET_AVX2 void NormalsAndTangentsAVX2(uchar const* __restrict down, uchar const* __restrict center,
+                                                    uchar const* __restrict up, int cols, RowScratch& scratch)
+            {
+                __m256 const one = _mm256_set1_ps(1.0f);
+                __m256 const twoPixels = _mm256_set1_ps(TWO_PIXELS);
+                __m256 const twoPixelsSquared = _mm256_set1_ps(TWO_PIXELS_SQUARED);
+                __m256 const signBit = _mm256_set1_ps(-0.0f);
+
+                // center[col + 8] is the last byte read
+                int col = 1;
+                for (; col + 8 < cols; col += 8)
+                {
+                    __m256i left = LoadBytesAVX2(center + col - 1);
+                    __m256i right = LoadBytesAVX2(center + col + 1);
+                    __m256 slopeX = _mm256_cvtepi32_ps(_mm256_sub_epi32(left, right));
+                    __m256 slopeZ = _mm256_cvtepi32_ps(_mm256_sub_epi32(LoadBytesAVX2(down + col), LoadBytesAVX2(up + col)));
+                    __m256 slopeXSquared = _mm256_mul_ps(slopeX, slopeX);
+                    __m256 normalLengthSquared =
+                        _mm256_add_ps(_mm256_add_ps(slopeXSquared, twoPixelsSquared), _mm256_mul_ps(slopeZ, slopeZ));
+                    __m256 inverseNormalLength = _mm256_div_ps(one, _mm256_sqrt_ps(normalLengthSquared));
+                    __m256 inverseTangentLength =
+                        _mm256_div_ps(one, _mm256_sqrt_ps(_mm256_add_ps(slopeXSquared, twoPixelsSquared)));
+                    _mm256_storeu_ps(&scratch.m_NormalX[col], _mm256_mul_ps(slopeX, inverseNormalLength));
+                    _mm256_storeu_ps(&scratch.m_NormalY[col], _mm256_mul_ps(twoPixels, inverseNormalLength));
+                    _mm256_storeu_ps(&scratch.m_NormalZ[col], _mm256_mul_ps(slopeZ, inverseNormalLength));
+                    _mm256_storeu_ps(&scratch.m_TangentX[col], _mm256_mul_ps(twoPixels, inverseTangentLength));
+                    _mm256_storeu_ps(&scratch.m_TangentY[col],
+                                     _mm256_mul_ps(_mm256_xor_ps(slopeX, signBit), inverseTangentLength));
+                }
+                NormalsAndTangentsScalar(down, center, up, col, cols, scratch);
+            }
+
+            // two pixels per vector
+            TARGET_AVX2 void UnpackColorsAVX2(uchar const* rgba, int cols, float* color, size_t stride)
+            {
+                __m256 const scale = _mm256_set1_ps(255.0f);
+                int col = 0;
+                for (; col + 2 <= cols; col += 2)
+                {
+                    __m256 bytes = _mm256_cvtepi32_ps(LoadBytesAVX2(rgba + col * 4));
+                    __m256 pixels = _mm256_div_ps(bytes, scale);
+                    _mm_storeu_ps(ColorOfPixel(color, col, stride), _mm256_castps256_ps128(pixels));
+                    _mm_storeu_ps(ColorOfPixel(color, col + 1, stride), _mm256_extractf128_ps(pixels, 1));
+                }
+                UnpackColorsScalar(rgba, col, cols, color, stride);
+            }
+#endif
+        } // namespace
+
+        InstructionSet GetInstructionSet()
+        {
+            static InstructionSet const instructionSet = []()
+            {
+#ifdef TERRAIN_KERNELS_AVX2
+                if (__builtin_cpu_supports("avx2"))
+                {
+                    return InstructionSet::AVX2;
+                }
+#endif
+#ifdef TERRAIN_KERNELS_SSE2
+                return InstructionSet::SSE2;
+#else
+                return InstructionSet::Scalar;
+#endif
+            }();
+            return instructionSet;
+        }
+
+        char const* GetInstructionSetName(InstructionSet instructionSet)
+        {
+            switch (instructionSet)
+            {
+                case InstructionSet::SSE2:
+                    return "SSE2";
+                case InstructionSet::AVX2:
+                    return "AVX2";
+                default:
+                    return "scalar";
+            }
+        }
+
+        void RowScratch::Resize(int cols)
+        {
+            m_NormalX.resize(cols);
+            m_NormalY.resize(cols);
+            m_NormalZ.resize(cols);
+            m_TangentX.resize(cols);
+            m_TangentY.resize(cols);
+        }
+
+        // paths that are not compiled in fall back to the scalar code
+        void NormalsAndTangentsOfRow(uchar const* down, uchar const* center, uchar const* up, int cols, RowScratch& scratch,
+                                     InstructionSet instructionSet)
+        {
+            switch (instructionSet)
+            {
+#ifdef TERRAIN_KERNELS_AVX2
+                case InstructionSet::AVX2:
+                    NormalsAndTangentsAVX2(down, center, up, cols, scratch);
+                    break;
+#endif
+#ifdef TERRAIN_KERNELS_SSE2
+                case InstructionSet::SSE2:
+                    NormalsAndTangentsSSE2(down, center, up, cols, scratch);
+                    break;
+#endif
+                default:
+                    NormalsAndTangentsScalar(down, center, up, 1, cols, scratch);
+                    break;
+            }
+        }
+
+        void FlatNormalsAndTangents(int begin, int end, RowScratch& scratch)
+        {
+            for (int col = begin; col < end; ++col)
+            {
+                scratch.m_NormalX[col] = 0.0f;
+                scratch.m_NormalY[col] = 1.0f;
+                scratch.m_NormalZ[col] = 0.0f;
+                scratch.m_TangentX[col] = 1.0f;
+                scratch.m_TangentY[col] = 0.0f;
+            }
+        }
+
+        void UnpackColorsOfRow(uchar const* rgba, int cols, float* color, size_t stride, InstructionSet instructionSet)
+        {
+            switch (instructionSet)
+            {
+#ifdef TERRAIN_KERNELS_AVX2
+                case InstructionSet::AVX2:
+                    UnpackColorsAVX2(rgba, cols, color, stride);
+                    break;
+#endif
+#ifdef TERRAIN_KERNELS_SSE2
+                case InstructionSet::SSE2:
+                    UnpackColorsSSE2(rgba, cols, color, stride);
+                    break;
+#endif
+                default:
+                    UnpackColorsScalar(rgba, 0, cols, color, stride);
+                    break;
+            }
+        }
+    } // namespace TerrainKernels
+} // namespace GfxRenderEngine
@@ -0,0 +1,72 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include <vector>
+
+#include "engine.h"
+
+namespace GfxRenderEngine
+{
+    // Per-row kernels of TerrainBuilder::PopulateTerrainData() and TerrainBuilder::ColorTerrain().
+    // Heights are used in 8 bit units: the smooth normal of a pixel (sum of the four face normals around it,
+    // see TerrainBuilder::CalculateNormal()) is (left - right, 2 * 255, down - up),
+    // the tangent along +x is (2 * 255, right - left, 0).
+    // The kernels have an AVX2 and an SSE2 path next to the scalar code, the best one is picked at runtime.
+    // All paths use the same operations in the same order and return identical results.
+    namespace TerrainKernels
+    {
+        enum class InstructionSet
+        {
+            Scalar,
+            SSE2,
+            AVX2
+        };
+
+        // best instruction set of this CPU
+        InstructionSet GetInstructionSet();
+        char const* GetInstructionSetName(InstructionSet instructionSet);
+
+        // structure of arrays for one row of the height map
+        struct RowScratch
+        {
+            std::vector<float> m_NormalX, m_NormalY, m_NormalZ;
+            std::vector<float> m_TangentX, m_TangentY;
+
+            void Resize(int cols);
+        };
+
+        // interior pixels of an interior row, columns [1, cols - 1)
+        void NormalsAndTangentsOfRow(uchar const* down, uchar const* center, uchar const* up, int cols, RowScratch& scratch,
+                                     InstructionSet instructionSet = GetInstructionSet());
+
+        // border pixels are flat, columns [begin, end)
+        void FlatNormalsAndTangents(int begin, int end, RowScratch& scratch);
+
+        // rgba bytes to four floats in [0, 1] per pixel, the colors of consecutive pixels are 'stride' bytes apart,
+        // so that they can be written into the vertices directly
+        void UnpackColorsOfRow(uchar const* rgba, int cols, float* color, size_t stride,
+                               InstructionSet instructionSet = GetInstructionSet());
+    } // namespace TerrainKernels
+} // namespace GfxRenderEngine
@@ -0,0 +1,275 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <cstring>
+#include <fstream>
+
+#include "auxiliary/hash.h"
+#include "renderer/cookedTexture.h"
+
+namespace GfxRenderEngine
+{
+    CookedTexture::~CookedTexture() { Close(); }
+
+    bool CookedTexture::Open(std::string const& filename)
+    {
+        Close();
+        if (!m_File.Open(filename))
+        {
+            return Fail(m_File.GetError());
+        }
+        m_MappedData = m_File.Data();
+        m_MappedSize = m_File.Size();
+        if (!Validate())
+        {
+            std::string error = m_Error;
+            Close();
+            m_Error = filename + ": " + error;
+            return false;
+        }
+        return true;
+    }
+
+    bool CookedTexture::Open(uchar const* data, size_t size)
+    {
+        Close();
+        m_MappedData = data;
+        m_MappedSize = size;
+        if (!Validate())
+        {
+            std::string error = m_Error;
+            Close();
+            m_Error = error;
+            return false;
+        }
+        return true;
+    }
+
+    void CookedTexture::Close()
+    {
+        m_File.Close();
+        m_MappedData = nullptr;
+        m_MappedSize = 0;
+        m_Format = Format::UNDEFINED;
+        m_Width = m_Height = m_Flags = 0;
+        m_SourceHash = 0;
+        m_Levels.clear();
+        m_Error.clear();
+    }
+
+    bool CookedTexture::Validate()
+    {
+        if (m_MappedSize < sizeof(Header))
+        {
+            return Fail("file too small");
+        }
+        Header header;
+        memcpy(&header, m_MappedData, sizeof(Header));
+        if (memcmp(header.m_Identifier, IDENTIFIER, sizeof(IDENTIFIER)) != 0)
+        {
+            return Fail("not a cooked texture");
+        }
+        Format format = static_cast<Format>(header.m_Format);
+        if ((format == Format::UNDEFINED) || (header.m_Format > static_cast<uint>(Format::BC7)))
+        {
+            return Fail("unknown format");
+        }
+        if (!header.m_Width || !header.m_Height || !header.m_LevelCount || (header.m_LevelCount > MAX_LEVELS))
+        {
+            return Fail("invalid dimensions");
+        }
+        size_t levelIndexEnd = sizeof(Header) + header.m_LevelCount * sizeof(LevelIndex);
+        if (m_MappedSize < levelIndexEnd)
+        {
+            return Fail("truncated level index");
+        }
+
+        m_Levels.resize(header.m_LevelCount);
+        for (uint level = 0; level < header.m_LevelCount; ++level)
+        {
+            LevelIndex levelIndex;
+            memcpy(&levelIndex, m_MappedData + sizeof(Header) + level * sizeof(LevelIndex), sizeof(LevelIndex));
+            uint width = std::max(1u, header.m_Width >> level);
+            uint height = std::max(1u, header.m_Height >> level);
+            if ((levelIndex.m_ByteLength != GetLevelSize(format, width, height)) ||
+                (levelIndex.m_ByteOffset < levelIndexEnd) || (levelIndex.m_ByteOffset > m_MappedSize) ||
+                (levelIndex.m_ByteLength > m_MappedSize - levelIndex.m_ByteOffset))
+            {
+                return Fail("invalid level " + std::to_string(level));
+            }
+            m_Levels[level] = {m_MappedData + levelIndex.m_ByteOffset, static_cast<size_t>(levelIndex.m_ByteLength),
+                               width, height};
+        }
+        m_Format = format;
+        m_Width = header.m_Width;
+        m_Height = header.m_Height;
+        m_Flags = header.m_Flags;
+        m_SourceHash = header.m_SourceHash;
+        return true;
+    }
+
+    bool CookedTexture::Fail(std::string const& error)
+    {
+        m_Error = error;
+        return false;
+    }
+
+    bool CookedTexture::Write(std::string const& filename, Format format, uint width, uint height, uint flags,
+                              uint64 sourceHash, std::vector<std::vector<uchar>> const& levels)
+    {
+        if (levels.empty() || (levels.size() > MAX_LEVELS))
+        {
+            return false;
+        }
+
+        Header header{};
+        memcpy(header.m_Identifier, IDENTIFIER, sizeof(IDENTIFIER));
+        header.m_Format = static_cast<uint>(format);
+        header.m_Width = width;
+        header.m_Height = height;
+        header.m_LevelCount = static_cast<uint>(levels.size());
+        header.m_Flags = flags;
+        header.m_SourceHash = sourceHash;
+
+        auto align = [](uint64 offset) { return (offset + DATA_ALIGNMENT - 1) & ~uint64(DATA_ALIGNMENT - 1); };
+        std::vector<LevelIndex> levelIndices(levels.size());
+        uint64 offset = align(sizeof(Header) + levels.size() * sizeof(LevelIndex));
+        for (size_t level = 0; level < levels.size(); ++level)
+        {
+            levelIndices[level] = {offset, levels[level].size()};
+            offset = align(offset + levels[level].size());
+        }
+
+        std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            return false;
+        }
+        file.write(reinterpret_cast<char const*>(&header), sizeof(Header));
+        file.write(reinterpret_cast<char const*>(levelIndices.data()), levelIndices.size() * sizeof(LevelIndex));
+        uint64 position = sizeof(Header) + levels.size() * sizeof(LevelIndex);
+        char const padding[DATA_ALIGNMENT]{};
+        for (size_t level = 0; level < levels.size(); ++level)
+        {
+            file.write(padding, levelIndices[level].m_ByteOffset - position);
+            file.write(reinterpret_cast<char const*>(levels[level].data()), levels[level].size());
+            position = levelIndices[level].m_ByteOffset + levels[level].size();
+        }
+        return file.good();
+    }
+
+    uint64 CookedTexture::HashSource(std::string const& sourceFilename)
+    {
+        MemoryMappedFile file;
+        if (!file.Open(sourceFilename))
+        {
+            return 0;
+        }
+        return HashData(file.Data(), file.Size());
+    }
+
+    uint64 CookedTexture::HashSource(std::vector<std::string> const& sourceFilenames)
+    {
+        uint64 hash = HashFNV1a(std::string_view{});
+        for (auto const& sourceFilename : sourceFilenames)
+        {
+            uint64 sourceHash = HashSource(sourceFilename);
+            if (!sourceHash)
+            {
+                return 0;
+            }
+            hash = HashFNV1a(std::string_view(reinterpret_cast<char const*>(&sourceHash), sizeof(sourceHash)), hash);
+        }
+        return hash;
+    }
+
+    uint64 CookedTexture::HashData(uchar const* data, size_t size)
+    {
+        return HashFNV1a(std::string_view(reinterpret_cast<char const*>(data), size));
+    }
+
+    bool CookedTexture::IsCooked(uchar const* data, size_t size)
+    {
+        return data && (size >= sizeof(Header)) && (memcmp(data, IDENTIFIER, sizeof(IDENTIFIER)) == 0);
+    }
+
+    std::string CookedTexture::GetCookedFilename(std::string const& sourceFilename)
+    {
+        return sourceFilename + FILE_EXTENSION;
+    }
+
+    std::string CookedTexture::GetCookedFilename(std::string const& containerFilename, uint imageIndex)
+    {
+        return containerFilename + ".image" + std::to_string(imageIndex) + FILE_EXTENSION;
+    }
+
+    bool CookedTexture::IsCookedFilename(std::string const& filename)
+    {
+        std::string extension{FILE_EXTENSION};
+        return (filename.size() > extension.size()) &&
+               (filename.compare(filename.size() - extension.size(), extension.size(), extension) == 0);
+    }
+
+    size_t CookedTexture::GetLevelSize(Format format, uint width, uint height)
+    {
+        size_t blocks = size_t((width + 3) / 4) * size_t((height + 3) / 4);
+        switch (format)
+        {
+            case Format::BC1:
+            case Format::BC4:
+                return blocks * 8;
+            case Format::BC3:
+            case Format::BC5:
+            case Format::BC6H:
+            case Format::BC7:
+                return blocks * 16;
+            default:
+                return 0;
+        }
+    }
+
+    bool CookedTexture::IsBlockCompressed(Format format)
+    {
+        return format != Format::UNDEFINED;
+    }
+
+    char const* CookedTexture::FormatToString(Format format)
+    {
+        switch (format)
+        {
+            case Format::BC1:
+                return "BC1";
+            case Format::BC3:
+                return "BC3";
+            case Format::BC4:
+                return "BC4";
+            case Format::BC5:
+                return "BC5";
+            case Format::BC6H:
+                return "BC6H";
+            case Format::BC7:
+                return "BC7";
+            default:
+                return "undefined";
+        }
+    }
+} // namespace GfxRenderEngine
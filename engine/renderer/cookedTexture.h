@@ -0,0 +1,145 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "engine.h"
+#include "auxiliary/memoryMappedFile.h"
+
+namespace GfxRenderEngine
+{
+
+    // CookedTexture: container for textures prepared offline by the texture cooker (tools/textureCooker)
+    // A header and a level index are followed by all mip levels in the GPU format, largest level first.
+    // The header stores a hash of the source image, a cooked texture whose hash does not match is stale.
+    // At runtime, the file is memory-mapped and the levels are copied straight into the staging memory
+    // of the uploader, there is no image decoding and no mip map generation.
+    class CookedTexture
+    {
+    public:
+        enum class Format : uint
+        {
+            UNDEFINED = 0,
+            BC1,    // RGB, 4 bits per texel
+            BC3,    // RGBA, 8 bits per texel
+            BC4,    // R, 4 bits per texel
+            BC5,    // RG, 8 bits per texel
+            BC6H,   // HDR RGB, unsigned half floats, 8 bits per texel
+            BC7     // RGBA, 8 bits per texel, higher quality than BC3
+        };
+
+        static constexpr uint FLAG_FLIPPED = 0x1; // rows were flipped vertically when cooking
+        static constexpr uint MAX_LEVELS = 16;
+        static constexpr uint DATA_ALIGNMENT = 16;
+        static constexpr char const* FILE_EXTENSION = ".ctex";
+
+        struct Level
+        {
+            uchar const* m_Data{nullptr};
+            size_t m_Size{0};
+            uint m_Width{0};
+            uint m_Height{0};
+        };
+
+    public:
+        CookedTexture() = default;
+        ~CookedTexture();
+
+        CookedTexture(const CookedTexture&) = delete;
+        CookedTexture& operator=(const CookedTexture&) = delete;
+
+        // maps the file and validates header and level index
+        bool Open(std::string const& filename);
+        // validates a cooked texture in memory, e.g. an embedded resource, the memory must outlive the object
+        bool Open(uchar const* data, size_t size);
+        void Close();
+
+        bool IsOpen() const { return m_MappedData != nullptr; }
+        Format GetFormat() const { return m_Format; }
+        uint GetWidth() const { return m_Width; }
+        uint GetHeight() const { return m_Height; }
+        uint GetFlags() const { return m_Flags; }
+        uint64 GetSourceHash() const { return m_SourceHash; }
+        uint GetLevelCount() const { return static_cast<uint>(m_Levels.size()); }
+        Level const& GetLevel(uint level) const { return m_Levels[level]; }
+        std::string const& GetError() const { return m_Error; }
+
+        static bool Write(std::string const& filename, Format format, uint width, uint height, uint flags,
+                          uint64 sourceHash, std::vector<std::vector<uchar>> const& levels);
+
+        // hash of the content of the source image, 0 if the file cannot be read
+        static uint64 HashSource(std::string const& sourceFilename);
+        // combined hash of several source images, e.g. the pre-filtered levels of an environment map
+        static uint64 HashSource(std::vector<std::string> const& sourceFilenames);
+        static uint64 HashData(uchar const* data, size_t size);
+        static bool IsCooked(uchar const* data, size_t size);
+
+        // "texture.png" is cooked to "texture.png.ctex"
+        static std::string GetCookedFilename(std::string const& sourceFilename);
+        // images embedded in a model: "model.glb" with image 2 is cooked to "model.glb.image2.ctex"
+        static std::string GetCookedFilename(std::string const& containerFilename, uint imageIndex);
+        static bool IsCookedFilename(std::string const& filename);
+        static size_t GetLevelSize(Format format, uint width, uint height);
+        static bool IsBlockCompressed(Format format);
+        static char const* FormatToString(Format format);
+
+    private:
+        static constexpr char IDENTIFIER[8] = {'C', 'T', 'E', 'X', ' ', '0', '2', '\n'};
+
+        struct Header
+        {
+            char m_Identifier[8];
+            uint m_Format;
+            uint m_Width;
+            uint m_Height;
+            uint m_LevelCount;
+            uint m_Flags;
+            uint m_Reserved;
+            uint64 m_SourceHash;
+        };
+
+        struct LevelIndex
+        {
+            uint64 m_ByteOffset; // from the start of the file
+            uint64 m_ByteLength;
+        };
+
+    private:
+        bool Validate();
+        bool Fail(std::string const& error);
+
+    private:
+        MemoryMappedFile m_File;
+        uchar const* m_MappedData{nullptr};
+        size_t m_MappedSize{0};
+        Format m_Format{Format::UNDEFINED};
+        uint m_Width{0};
+        uint m_Height{0};
+        uint m_Flags{0};
+        uint64 m_SourceHash{0};
+        std::vector<Level> m_Levels;
+        std::string m_Error;
+    };
+} // namespace GfxRenderEngine
@@ -25,6 +25,7 @@
 #include "renderer/cubemap.h"
 
 #include "VKcubemap.h"
+#include "HLcubemap.h"
 
 namespace GfxRenderEngine
 {
@@ -37,6 +38,9 @@ namespace GfxRenderEngine
             case RendererAPI::VULKAN:
                 cubemap = std::make_shared<VK_Cubemap>();
                 break;
+            case RendererAPI::HEADLESS:
+                cubemap = std::make_shared<HL_Cubemap>();
+                break;
             default:
                 cubemap = nullptr;
                 break;
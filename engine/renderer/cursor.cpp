@@ -24,6 +24,7 @@
 #include "renderer/cursor.h"
 
 #include "VKcursor.h"
+#include "HLcursor.h"
 
 namespace GfxRenderEngine
 {
@@ -37,6 +38,9 @@ namespace GfxRenderEngine
             case RendererAPI::VULKAN:
                 cursor = std::make_shared<VK_Cursor>();
                 break;
+            case RendererAPI::HEADLESS:
+                cursor = std::make_shared<HL_Cursor>();
+                break;
             default:
                 cursor = nullptr;
                 break;
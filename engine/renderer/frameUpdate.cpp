@@ -0,0 +1,123 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "core.h"
+#include "renderer/frameUpdate.h"
+#include "renderer/model.h"
+#include "scene/grassField.h"
+#include "scene/scene.h"
+#include "scene/terrainQuadtree.h"
+
+namespace GfxRenderEngine
+{
+    void FrameUpdate::UpdateTransformCache(Scene& scene, Camera const* camera, uint frameIndex)
+    {
+        ZoneScopedN("FrameUpdate::UpdateTransformCache()");
+        scene.GetTransformHierarchy().Update(scene.GetSceneGraph(), scene.GetRegistry());
+
+        // chunked terrain and grass: select and stream tiles for the camera of this frame
+        if (camera)
+        {
+            TerrainQuadtree::UpdateAll(scene.GetRegistry(), *camera);
+            GrassField::UpdateAll(scene.GetRegistry(), *camera, frameIndex);
+        }
+    }
+
+    void FrameUpdate::UpdateAnimations(Registry& registry, const Timestep& timestep, uint frameCounter,
+                                       JointMatricesAllocator const& allocateJointMatrices)
+    {
+        ZoneScopedN("FrameUpdate::UpdateAnimations()");
+
+        // models loaded from the same file share one skeleton, animate each skeleton once
+        std::vector<Model*> models;
+        {
+            std::unordered_set<Armature::Skeleton*> skeletons;
+            auto view = registry.view<MeshComponent, TransformComponent, SkeletalAnimationTag>();
+            for (auto entity : view)
+            {
+                auto& mesh = view.get<MeshComponent>(entity);
+                if (mesh.m_Enabled && skeletons.insert(mesh.m_Model->GetSkeleton()).second)
+                {
+                    models.push_back(mesh.m_Model.get());
+                }
+            }
+        }
+
+        uint numberOfModels = static_cast<uint>(models.size());
+        if (!numberOfModels)
+        {
+            return;
+        }
+
+        // each skeleton gets its range in the joint matrices of this frame
+        uint numberOfJoints = 0;
+        for (auto model : models)
+        {
+            Armature::ShaderData& shaderData = model->GetSkeleton()->m_ShaderData;
+            shaderData.m_FirstJoint = numberOfJoints;
+            numberOfJoints += static_cast<uint>(shaderData.m_FinalJointsMatrices.size());
+        }
+        glm::mat4* jointMatrices = allocateJointMatrices(numberOfJoints);
+
+        auto updateAnimation = [&](Model* model)
+        {
+            model->UpdateAnimation(timestep, frameCounter);
+            Armature::ShaderData const& shaderData = model->GetSkeleton()->m_ShaderData;
+            std::copy(shaderData.m_FinalJointsMatrices.begin(), shaderData.m_FinalJointsMatrices.end(),
+                      jointMatrices + shaderData.m_FirstJoint);
+        };
+
+        if (numberOfModels <= SKELETONS_PER_TASK)
+        {
+            for (auto model : models)
+            {
+                updateAnimation(model);
+            }
+            return;
+        }
+
+        // evaluate skeletons in parallel
+        ThreadPool& threadPool = Engine::m_Engine->m_PoolPrimary;
+        std::vector<std::future<bool>> futures;
+        futures.reserve((numberOfModels + SKELETONS_PER_TASK - 1) / SKELETONS_PER_TASK);
+        for (uint begin = 0; begin < numberOfModels; begin += SKELETONS_PER_TASK)
+        {
+            uint end = std::min(begin + SKELETONS_PER_TASK, numberOfModels);
+            auto task = [&, begin, end]()
+            {
+                for (uint index = begin; index < end; ++index)
+                {
+                    updateAnimation(models[index]);
+                }
+                return true;
+            };
+            futures.push_back(threadPool.SubmitTask(task));
+        }
+        for (auto& future : futures)
+        {
+            threadPool.GetResult(future);
+        }
+    }
+} // namespace GfxRenderEngine
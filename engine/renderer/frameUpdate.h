@@ -0,0 +1,56 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <functional>
+
+#include "engine.h"
+#include "scene/registry.h"
+
+namespace GfxRenderEngine
+{
+    class Camera;
+    class Scene;
+    class Timestep;
+
+    // FrameUpdate: the per-frame scene work that doesn't depend on the graphics backend,
+    // shared by all renderers (see Renderer::UpdateTransformCache() and Renderer::UpdateAnimations())
+    class FrameUpdate
+    {
+
+    public:
+        // global transforms of the scene graph, then terrain and grass tiles for the camera (if any)
+        static void UpdateTransformCache(Scene& scene, Camera const* camera, uint frameIndex);
+
+        // returns the joint matrices of this frame for all skeletons, with room for numberOfJoints matrices
+        typedef std::function<glm::mat4*(uint numberOfJoints)> JointMatricesAllocator;
+
+        // evaluates each enabled skeleton once, on the thread pool when there are many,
+        // and packs the joint matrices of all skeletons into one allocation (see Armature::ShaderData::m_FirstJoint)
+        static void UpdateAnimations(Registry& registry, const Timestep& timestep, uint frameCounter,
+                                     JointMatricesAllocator const& allocateJointMatrices);
+
+    private:
+        static constexpr uint SKELETONS_PER_TASK = 4;
+    };
+} // namespace GfxRenderEngine
@@ -0,0 +1,229 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <future>
+
+#include "core.h"
+#include "scene/components.h"
+#include "renderer/model.h"
+#include "renderer/instanceBuffer.h"
+#include "renderer/frustumCuller.h"
+
+namespace GfxRenderEngine
+{
+    namespace
+    {
+        // splits [0, count) into chunks and runs them on the primary thread pool
+        template <typename FunctionType> void ParallelFor(uint count, uint chunkSize, FunctionType&& function)
+        {
+            if (count <= chunkSize)
+            {
+                function(0, count);
+                return;
+            }
+
+            ThreadPool& threadPool = Engine::m_Engine->m_PoolPrimary;
+            std::vector<std::future<bool>> futures;
+            futures.reserve((count + chunkSize - 1) / chunkSize);
+            for (uint begin = 0; begin < count; begin += chunkSize)
+            {
+                uint end = std::min(begin + chunkSize, count);
+                auto task = [&function, begin, end]()
+                {
+                    function(begin, end);
+                    return true;
+                };
+                futures.push_back(threadPool.SubmitTask(task));
+            }
+            for (auto& future : futures)
+            {
+                threadPool.GetResult(future);
+            }
+        }
+    } // namespace
+
+    FrustumCuller::FrustumCuller() : m_BoundsGathered{false} {}
+
+    void FrustumCuller::BeginFrame()
+    {
+        m_BoundsGathered = false;
+        for (auto& statistics : m_Statistics)
+        {
+            statistics = Statistics{};
+        }
+    }
+
+    // skinned meshes (bind pose bounds) and grass (instances are in the grass buffer) are never culled
+    void FrustumCuller::GatherBounds(Registry& registry)
+    {
+        ZoneScopedN("FrustumCuller::GatherBounds");
+        m_BoundsGathered = true;
+        m_Objects.clear();
+
+        uint count = 0;
+        auto view = registry.view<MeshComponent, InstanceTag>(entt::exclude<SkeletalAnimationTag, Grass1Tag, Grass2Tag>);
+        for (auto entity : view)
+        {
+            auto& mesh = view.get<MeshComponent>(entity);
+            auto& instanceTag = view.get<InstanceTag>(entity);
+            if (!mesh.m_Model || !instanceTag.m_InstanceBuffer || !mesh.m_Model->GetLocalBounds().IsValid())
+            {
+                continue;
+            }
+            InstanceBuffer* instanceBuffer = instanceTag.m_InstanceBuffer.get();
+            uint instanceCount = instanceBuffer->GetInstanceCount();
+            m_Objects.push_back({.m_Entity = entity,
+                                 .m_InstanceBuffer = instanceBuffer,
+                                 .m_LocalBounds = mesh.m_Model->GetLocalBounds(),
+                                 .m_FirstInstance = count,
+                                 .m_InstanceCount = instanceCount,
+                                 .m_VisibleCount = 0});
+            count += instanceCount;
+        }
+
+        m_CenterX.resize(count);
+        m_CenterY.resize(count);
+        m_CenterZ.resize(count);
+        m_ExtentX.resize(count);
+        m_ExtentY.resize(count);
+        m_ExtentZ.resize(count);
+        m_Visible.resize(count);
+
+        auto updateBounds = [&](uint begin, uint end)
+        {
+            for (uint objectIndex = begin; objectIndex < end; ++objectIndex)
+            {
+                CulledObject const& object = m_Objects[objectIndex];
+                object.m_InstanceBuffer->UpdateWorldBounds(object.m_LocalBounds);
+                for (uint instance = 0; instance < object.m_InstanceCount; ++instance)
+                {
+                    AABB const& worldBounds = object.m_InstanceBuffer->GetWorldBounds(instance);
+
+                    // instances without bounds are always visible
+                    glm::vec3 center{0.0f};
+                    glm::vec3 extent{std::numeric_limits<float>::max()};
+                    if (worldBounds.IsValid())
+                    {
+                        center = worldBounds.GetCenter();
+                        extent = worldBounds.GetExtent();
+                    }
+                    uint index = object.m_FirstInstance + instance;
+                    m_CenterX[index] = center.x;
+                    m_CenterY[index] = center.y;
+                    m_CenterZ[index] = center.z;
+                    m_ExtentX[index] = extent.x;
+                    m_ExtentY[index] = extent.y;
+                    m_ExtentZ[index] = extent.z;
+                }
+            }
+        };
+        ParallelFor(static_cast<uint>(m_Objects.size()), OBJECTS_PER_TASK, updateBounds);
+    }
+
+    // one plane at a time over contiguous arrays, the compiler vectorizes the inner loop
+    void FrustumCuller::TestRange(Frustum const& frustum, uint begin, uint end)
+    {
+        float const* __restrict centerX = m_CenterX.data();
+        float const* __restrict centerY = m_CenterY.data();
+        float const* __restrict centerZ = m_CenterZ.data();
+        float const* __restrict extentX = m_ExtentX.data();
+        float const* __restrict extentY = m_ExtentY.data();
+        float const* __restrict extentZ = m_ExtentZ.data();
+        uchar* __restrict visible = m_Visible.data();
+
+        for (uint index = begin; index < end; ++index)
+        {
+            visible[index] = 1;
+        }
+
+        for (uint planeIndex = 0; planeIndex < Frustum::NUMBER_OF_PLANES; ++planeIndex)
+        {
+            glm::vec4 const& plane = frustum.GetPlane(planeIndex);
+            float normalX = plane.x;
+            float normalY = plane.y;
+            float normalZ = plane.z;
+            float absNormalX = std::abs(plane.x);
+            float absNormalY = std::abs(plane.y);
+            float absNormalZ = std::abs(plane.z);
+            float planeDistance = plane.w;
+            for (uint index = begin; index < end; ++index)
+            {
+                float distance =
+                    normalX * centerX[index] + normalY * centerY[index] + normalZ * centerZ[index] + planeDistance;
+                float radius = absNormalX * extentX[index] + absNormalY * extentY[index] + absNormalZ * extentZ[index];
+                visible[index] &= static_cast<uchar>(distance + radius >= 0.0f);
+            }
+        }
+    }
+
+    void FrustumCuller::Cull(Registry& registry, Pass pass, glm::mat4 const& viewProjection, uint frameIndex)
+    {
+        ZoneScopedN("FrustumCuller::Cull");
+        if (!m_BoundsGathered)
+        {
+            GatherBounds(registry);
+        }
+
+        Frustum frustum{viewProjection};
+        uint count = static_cast<uint>(m_Visible.size());
+        ParallelFor(count, INSTANCES_PER_TASK, [&](uint begin, uint end) { TestRange(frustum, begin, end); });
+
+        // pack the visible instances of each object for the draw call of this pass
+        auto packInstances = [&](uint begin, uint end)
+        {
+            for (uint objectIndex = begin; objectIndex < end; ++objectIndex)
+            {
+                CulledObject& object = m_Objects[objectIndex];
+                uchar const* visible = m_Visible.data() + object.m_FirstInstance;
+                object.m_VisibleCount = 0;
+                for (uint instance = 0; instance < object.m_InstanceCount; ++instance)
+                {
+                    object.m_VisibleCount += visible[instance];
+                }
+                object.m_InstanceBuffer->SetVisibleInstances(pass, frameIndex, visible);
+            }
+        };
+        ParallelFor(static_cast<uint>(m_Objects.size()), OBJECTS_PER_TASK, packInstances);
+
+        Statistics statistics{};
+        uint passBit = 1u << pass;
+        for (auto const& object : m_Objects)
+        {
+            auto instanceTag = registry.try_get<InstanceTag>(object.m_Entity);
+            if (!instanceTag)
+            {
+                continue;
+            }
+            if (object.m_VisibleCount)
+            {
+                instanceTag->m_VisibilityMask |= passBit;
+            }
+            else
+            {
+                instanceTag->m_VisibilityMask &= ~passBit;
+            }
+            statistics.m_Drawn += object.m_VisibleCount;
+            statistics.m_Culled += object.m_InstanceCount - object.m_VisibleCount;
+        }
+        m_Statistics[pass] = statistics;
+    }
+} // namespace GfxRenderEngine
@@ -0,0 +1,95 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <vector>
+
+#include "engine.h"
+#include "scene/registry.h"
+#include "renderer/bounds.h"
+
+namespace GfxRenderEngine
+{
+    class InstanceBuffer;
+
+    // CPU frustum culling of instanced meshes:
+    // gathers the world-space bounds of every instance once per frame, hands the visible instances
+    // of each render pass to the instance buffer (which repacks them for the draw call when they changed),
+    // and writes one visibility bit per render pass into the InstanceTag (0: all instances culled)
+    class FrustumCuller
+    {
+
+    public:
+        enum Pass
+        {
+            CAMERA = 0,
+            SHADOW_CASCADE_0,
+            SHADOW_CASCADE_1,
+            WATER_REFRACTION,
+            WATER_REFLECTION,
+            NUMBER_OF_PASSES
+        };
+
+        // counted in instances
+        struct Statistics
+        {
+            uint m_Drawn{0};
+            uint m_Culled{0};
+        };
+
+    public:
+        FrustumCuller();
+
+        void BeginFrame();
+        void Cull(Registry& registry, Pass pass, glm::mat4 const& viewProjection, uint frameIndex);
+        Statistics const& GetStatistics(Pass pass) const { return m_Statistics[pass]; }
+
+    private:
+        void GatherBounds(Registry& registry);
+        void TestRange(Frustum const& frustum, uint begin, uint end);
+
+    private:
+        static constexpr uint INSTANCES_PER_TASK = 1024;
+        static constexpr uint OBJECTS_PER_TASK = 32;
+
+        // an instanced mesh, its instances are stored from m_FirstInstance on in the arrays below
+        struct CulledObject
+        {
+            entt::entity m_Entity;
+            InstanceBuffer* m_InstanceBuffer;
+            AABB m_LocalBounds;
+            uint m_FirstInstance;
+            uint m_InstanceCount;
+            uint m_VisibleCount;
+        };
+
+        bool m_BoundsGathered;
+        Statistics m_Statistics[NUMBER_OF_PASSES];
+        std::vector<CulledObject> m_Objects;
+
+        // per instance, structure of arrays for the plane tests
+        std::vector<float> m_CenterX, m_CenterY, m_CenterZ;
+        std::vector<float> m_ExtentX, m_ExtentY, m_ExtentZ;
+        std::vector<uchar> m_Visible;
+    };
+} // namespace GfxRenderEngine
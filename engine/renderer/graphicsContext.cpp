@@ -27,6 +27,8 @@
 
 #include "VKgraphicsContext.h"
 #include "VKwindow.h"
+#include "HLgraphicsContext.h"
+#include "HLwindow.h"
 
 std::shared_ptr<GraphicsContext> GraphicsContext::Create(void* window, ThreadPool& threadPoolPrimary,
                                                          ThreadPool& threadPoolSecondary)
@@ -39,6 +41,10 @@ std::shared_ptr<GraphicsContext> GraphicsContext::Create(void* window, ThreadPoo
             graphicsContext =
                 std::make_shared<VK_Context>(static_cast<VK_Window*>(window), threadPoolPrimary, threadPoolSecondary);
             break;
+        case RendererAPI::HEADLESS:
+            graphicsContext =
+                std::make_shared<HL_Context>(static_cast<HL_Window*>(window), threadPoolPrimary, threadPoolSecondary);
+            break;
         default:
             graphicsContext = nullptr;
             break;
@@ -0,0 +1,86 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "renderer/guiBatch.h"
+
+namespace GfxRenderEngine
+{
+    void GUIBatch::Begin(float contextWidth, float contextHeight)
+    {
+        m_Instances.clear();
+        m_Flushed = 0;
+        m_ContextHalfSize = glm::vec2{contextWidth, contextHeight} * 0.5f;
+    }
+
+    void GUIBatch::AddQuad(glm::vec4 const& uv, glm::mat4 const& modelViewProjectionMatrix)
+    {
+        auto transform = [&modelViewProjectionMatrix](float x, float y)
+        {
+            glm::vec4 position = modelViewProjectionMatrix * glm::vec4(x, y, 0.0f, 1.0f);
+            return glm::vec2{position.x, position.y} / position.w;
+        };
+
+        // 0 - 1
+        // | / |
+        // 3 - 2
+        glm::vec2 corner0 = transform(-1.0f, 1.0f);
+        glm::vec2 corner1 = transform(1.0f, 1.0f);
+        glm::vec2 corner2 = transform(1.0f, -1.0f);
+        glm::vec2 corner3 = transform(-1.0f, -1.0f);
+
+        QuadInstance& instance = m_Instances.emplace_back();
+        instance.m_Corners01 = {corner0, corner1};
+        instance.m_Corners23 = {corner2, corner3};
+        instance.m_UV = uv;
+    }
+
+    void GUIBatch::AddQuad(glm::vec4 const& uv, glm::mat4 const& position, glm::vec4 const& color, float textureID)
+    {
+        // column 0 holds the x coordinates, column 1 the y coordinates of the corners
+        auto toNDC = [this, &position](int corner)
+        {
+            glm::vec2 pixel{position[0][corner], position[1][corner]};
+            return (pixel - m_ContextHalfSize) / m_ContextHalfSize;
+        };
+
+        QuadInstance& instance = m_Instances.emplace_back();
+        instance.m_Corners01 = {toNDC(0), toNDC(1)};
+        instance.m_Corners23 = {toNDC(2), toNDC(3)};
+        instance.m_UV = uv;
+        instance.m_Color = PackColor(color);
+        instance.m_Flags = REMOVE_GAMMA | ((textureID == 2.0f) ? static_cast<uint>(USE_TEXTURE2) : 0u);
+    }
+
+    GUIBatch::DrawRange GUIBatch::Flush()
+    {
+        DrawRange range{m_Flushed, GetInstanceCount() - m_Flushed};
+        m_Flushed = GetInstanceCount();
+        return range;
+    }
+
+    uint GUIBatch::PackColor(glm::vec4 const& color)
+    {
+        glm::vec4 clamped = glm::clamp(color, 0.0f, 1.0f) * 255.0f + 0.5f;
+        return static_cast<uint>(clamped.r) | (static_cast<uint>(clamped.g) << 8) |
+               (static_cast<uint>(clamped.b) << 16) | (static_cast<uint>(clamped.a) << 24);
+    }
+} // namespace GfxRenderEngine
@@ -0,0 +1,89 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <vector>
+
+#include "engine.h"
+
+namespace GfxRenderEngine
+{
+    // Collects the quads of the GUI (sprites, glyphs, images) for one frame.
+    // Each quad is one instance of guiBatch.vert, the corners are transformed on the CPU,
+    // so that consecutive quads can be drawn with one instanced draw call.
+    // Draw order is kept: GUI quads overlap and are blended in the order they were submitted.
+    // The batch has no dependency on the device, sprites are passed as their rectangle in the atlas.
+    class GUIBatch
+    {
+
+    public:
+        enum Flags : uint
+        {
+            USE_TEXTURE2 = 1 << 0,   // sample binding 2 instead of the atlas at binding 1
+            REMOVE_GAMMA = 1 << 1    // convert the output color to linear (as guiShader2 did)
+        };
+
+        // instance layout as read by guiBatch.vert (56 bytes)
+        struct QuadInstance
+        {
+            glm::vec4 m_Corners01{0.0f}; // corner 0 and 1 in normalized device coordinates
+            glm::vec4 m_Corners23{0.0f}; // corner 2 and 3 (0 - 1, 3 - 2 clockwise from top left)
+            glm::vec4 m_UV{0.0f};        // u1, v1, u2, v2
+            uint m_Color{0xffffffff};    // unorm8 x 4, red in the low byte
+            uint m_Flags{0};
+        };
+
+        // range of instances to be drawn with one call
+        struct DrawRange
+        {
+            uint m_FirstInstance{0};
+            uint m_InstanceCount{0};
+        };
+
+    public:
+        // starts a new frame with the size of the GUI context in pixels
+        void Begin(float contextWidth, float contextHeight);
+
+        // uv: rectangle of the sprite in its texture (u1, v1, u2, v2)
+
+        // sprite with a transform applied to a [-1, 1] quad (previously guiShader)
+        void AddQuad(glm::vec4 const& uv, glm::mat4 const& modelViewProjectionMatrix);
+
+        // sprite with four corners in pixels and a color (previously guiShader2),
+        // see SCREEN_DrawBuffer::DrawImageStretch() for the layout of 'position'
+        void AddQuad(glm::vec4 const& uv, glm::mat4 const& position, glm::vec4 const& color, float textureID);
+
+        // returns the instances added since the last call (may be empty)
+        DrawRange Flush();
+
+        std::vector<QuadInstance> const& GetInstances() const { return m_Instances; }
+        uint GetInstanceCount() const { return static_cast<uint>(m_Instances.size()); }
+
+        static uint PackColor(glm::vec4 const& color);
+
+    private:
+        std::vector<QuadInstance> m_Instances;
+        uint m_Flushed{0};
+        glm::vec2 m_ContextHalfSize{1.0f};
+    };
+} // namespace GfxRenderEngine
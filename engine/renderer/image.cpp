@@ -35,6 +35,7 @@ namespace GfxRenderEngine
     Image::~Image() { stbi_image_free(m_DataBuffer); }
 
     uchar* Image::Get() { return m_DataBuffer; }
+    uchar const* Image::Get() const { return m_DataBuffer; }
 
     int Image::Width() const { return m_Width; }
     int Image::Height() const { return m_Height; }
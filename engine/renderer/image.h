@@ -34,6 +34,7 @@ namespace GfxRenderEngine
         ~Image();
 
         uchar* Get();
+        uchar const* Get() const;
         int Width() const;
         int Height() const;
         int BytesPerPixel() const;
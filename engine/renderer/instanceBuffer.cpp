@@ -25,6 +25,7 @@
 #include "renderer/instanceBuffer.h"
 
 #include "VKinstanceBuffer.h"
+#include "HLinstanceBuffer.h"
 
 namespace GfxRenderEngine
 {
@@ -38,6 +39,9 @@ namespace GfxRenderEngine
             case RendererAPI::VULKAN:
                 instanceBuffer = std::make_shared<VK_InstanceBuffer>(numInstances);
                 break;
+            case RendererAPI::HEADLESS:
+                instanceBuffer = std::make_shared<HL_InstanceBuffer>(numInstances);
+                break;
             default:
                 instanceBuffer = nullptr;
                 break;
@@ -26,6 +26,7 @@
 
 #include "engine.h"
 #include "buffer.h"
+#include "bounds.h"
 
 namespace GfxRenderEngine
 {
@@ -36,12 +37,24 @@ namespace GfxRenderEngine
     public:
         virtual ~InstanceBuffer() = default;
 
-        virtual void SetInstanceData(uint index, glm::mat4 const& mat4Global, glm::mat4 const& normalMatrix) = 0;
+        // only the model matrix is stored, normal matrices are derived on the GPU
+        virtual void SetInstanceData(uint index, glm::mat4 const& mat4Global) = 0;
         virtual const glm::mat4& GetModelMatrix(uint index) = 0;
-        virtual const glm::mat4& GetNormalMatrix(uint index) = 0;
         virtual std::shared_ptr<Buffer> GetBuffer() = 0;
         virtual Buffer::BufferDeviceAddress GetBufferDeviceAddress() = 0;
 
+        virtual uint GetInstanceCount() const = 0;
+
+        // model bounds of each instance in world space,
+        // recalculated only when an instance has moved
+        virtual void UpdateWorldBounds(AABB const& localBounds) = 0;
+        virtual AABB const& GetWorldBounds(uint index) const = 0;
+
+        // result of the frustum culler for a render pass, one entry per instance (0: culled),
+        // the visible instances are packed into the range of the buffer that the pass draws,
+        // the range is repacked only when the visibility or the instances changed
+        virtual void SetVisibleInstances(uint pass, uint frameIndex, uchar const* visible) = 0;
+
         static std::shared_ptr<InstanceBuffer> Create(uint numInstances);
     };
 } // namespace GfxRenderEngine
@@ -24,6 +24,7 @@
 #include "renderer/materialDescriptor.h"
 
 #include "VKmaterialDescriptor.h"
+#include "HLmaterialDescriptor.h"
 
 namespace GfxRenderEngine
 {
@@ -37,6 +38,9 @@ namespace GfxRenderEngine
             case RendererAPI::VULKAN:
                 materialDescriptor = std::make_shared<VK_MaterialDescriptor>(materialTypes, textures);
                 break;
+            case RendererAPI::HEADLESS:
+                materialDescriptor = std::make_shared<HL_MaterialDescriptor>(materialTypes, textures);
+                break;
             default:
                 materialDescriptor = nullptr;
                 break;
@@ -55,6 +59,9 @@ namespace GfxRenderEngine
             case RendererAPI::VULKAN:
                 materialDescriptor = std::make_shared<VK_MaterialDescriptor>(materialTypes, multiTextures);
                 break;
+            case RendererAPI::HEADLESS:
+                materialDescriptor = std::make_shared<HL_MaterialDescriptor>(materialTypes, multiTextures);
+                break;
             default:
                 materialDescriptor = nullptr;
                 break;
@@ -73,6 +80,9 @@ namespace GfxRenderEngine
             case RendererAPI::VULKAN:
                 materialDescriptor = std::make_shared<VK_MaterialDescriptor>(materialTypes, cubemap);
                 break;
+            case RendererAPI::HEADLESS:
+                materialDescriptor = std::make_shared<HL_MaterialDescriptor>(materialTypes, cubemap);
+                break;
             default:
                 materialDescriptor = nullptr;
                 break;
@@ -91,6 +101,9 @@ namespace GfxRenderEngine
             case RendererAPI::VULKAN:
                 materialDescriptor = std::make_shared<VK_MaterialDescriptor>(materialTypes, texture);
                 break;
+            case RendererAPI::HEADLESS:
+                materialDescriptor = std::make_shared<HL_MaterialDescriptor>(materialTypes, texture);
+                break;
             default:
                 materialDescriptor = nullptr;
                 break;
@@ -55,6 +55,12 @@ namespace GfxRenderEngine
 
     SkeletalAnimations& Model::GetAnimations() { return *(m_Animations.get()); }
 
+    void Model::UpdateAnimation(const Timestep& timestep, uint frameCounter)
+    {
+        m_Animations->Update(timestep, *m_Skeleton, frameCounter);
+        m_Skeleton->Update();
+    }
+
     Buffer::BufferDeviceAddress Model::GetMeshBufferDeviceAddress() const
     {
         return m_MeshBuffer.get()->GetBufferDeviceAddress();
@@ -64,4 +70,16 @@ namespace GfxRenderEngine
     {
         return m_Material.get()->GetMaterialBufferDeviceAddress(index);
     }
+
+    void Submesh::CalculateBounds(std::vector<Vertex> const& vertices)
+    {
+        m_LocalBounds = AABB{};
+        uint firstVertex = static_cast<uint>(m_FirstVertex);
+        uint lastVertex = std::min(firstVertex + m_VertexCount, static_cast<uint>(vertices.size()));
+        for (uint index = firstVertex; index < lastVertex; ++index)
+        {
+            m_LocalBounds.Extend(vertices[index].m_Position);
+        }
+        m_LocalSphere = BoundingSphere::FromAABB(m_LocalBounds);
+    }
 } // namespace GfxRenderEngine
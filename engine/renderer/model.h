@@ -49,6 +49,7 @@
 #include "renderer/resourceDescriptor.h"
 #include "renderer/texture.h"
 #include "renderer/cubemap.h"
+#include "renderer/bounds.h"
 #include "sprite/sprite.h"
 #include "entt.hpp"
 
@@ -104,7 +105,10 @@ namespace GfxRenderEngine
         uint m_InstanceCount;
         std::shared_ptr<Material> m_Material;
         Resources m_Resources;
+        AABB m_LocalBounds;
+        BoundingSphere m_LocalSphere;
         Buffer::BufferDeviceAddress GetMaterialBufferDeviceAddress(uint index = 0) const;
+        void CalculateBounds(std::vector<Vertex> const& vertices);
     };
 
     class Model
@@ -117,7 +121,6 @@ namespace GfxRenderEngine
             std::vector<Vertex> m_Vertices{};
             std::vector<Submesh> m_Submeshes{};
             std::shared_ptr<Armature::Skeleton> m_Skeleton;
-            std::shared_ptr<Buffer> m_ShaderData;
             std::shared_ptr<SkeletalAnimations> m_Animations;
         };
 
@@ -131,11 +134,18 @@ namespace GfxRenderEngine
         virtual void CreateVertexBuffer(const std::vector<Vertex>& vertices) = 0;
         virtual void CreateIndexBuffer(const std::vector<uint>& indices) = 0;
 
+        // evaluates the animation of the skeleton, the renderer uploads the joint matrices
+        void UpdateAnimation(const Timestep& timestep, uint frameCounter);
+
         SkeletalAnimations& GetAnimations();
+        Armature::Skeleton* GetSkeleton() const { return m_Skeleton.get(); }
         Buffer::BufferDeviceAddress GetMeshBufferDeviceAddress() const;
         std::shared_ptr<Buffer>& GetMeshBuffer() { return m_MeshBuffer; }
         virtual Buffer::BufferDeviceAddress GetVertexBufferDeviceAddress() const = 0;
         virtual Buffer::BufferDeviceAddress GetIndexBufferDeviceAddress() const = 0;
+        virtual Buffer::BufferDeviceAddress GetPositionBufferDeviceAddress() const = 0;
+        uint GetVertexFormat() const { return m_VertexFormat; }
+        AABB const& GetLocalBounds() const { return m_LocalBounds; }
 
         static float m_NormalMapIntensity;
 
@@ -145,7 +155,12 @@ namespace GfxRenderEngine
         // skeletal animation
         std::shared_ptr<SkeletalAnimations> m_Animations;
         std::shared_ptr<Armature::Skeleton> m_Skeleton;
-        std::shared_ptr<Buffer> m_ShaderDataUbo;
         std::shared_ptr<Buffer> m_MeshBuffer;
+
+        // union of all submesh bounds in model space
+        AABB m_LocalBounds;
+
+        // PBR meshes use compact vertex streams, see VertexStreams
+        uint m_VertexFormat{0};
     };
 } // namespace GfxRenderEngine
@@ -0,0 +1,715 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <algorithm>
+
+#include "renderer/renderGraph.h"
+
+namespace GfxRenderEngine
+{
+    namespace
+    {
+        constexpr uint WRITE_ACCESS = RenderGraph::ACCESS_COLOR_ATTACHMENT_WRITE |
+                                      RenderGraph::ACCESS_DEPTH_ATTACHMENT_WRITE | RenderGraph::ACCESS_SHADER_WRITE |
+                                      RenderGraph::ACCESS_TRANSFER_WRITE;
+
+        bool IsWriteUsage(RenderGraph::Usage usage)
+        {
+            switch (usage)
+            {
+                case RenderGraph::Usage::COLOR_ATTACHMENT:
+                case RenderGraph::Usage::DEPTH_ATTACHMENT:
+                case RenderGraph::Usage::STORAGE:
+                case RenderGraph::Usage::TRANSFER_DESTINATION:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        uint GetBytesPerPixel(RenderGraph::Format format)
+        {
+            switch (format)
+            {
+                case RenderGraph::Format::RGBA16F:
+                    return 8;
+                case RenderGraph::Format::RGBA32F:
+                    return 16;
+                default:
+                    return 4;
+            }
+        }
+
+        uint64 AlignUp(uint64 value, uint64 alignment) { return (value + alignment - 1) / alignment * alignment; }
+    } // namespace
+
+    RenderGraph::ResourceHandle RenderGraph::CreateImage(std::string const& name, ImageDescription const& description)
+    {
+        Resource& resource = m_Resources.emplace_back();
+        resource.m_Name = name;
+        resource.m_Description = description;
+        return static_cast<ResourceHandle>(m_Resources.size() - 1);
+    }
+
+    RenderGraph::ResourceHandle RenderGraph::ImportImage(std::string const& name, ImageDescription const& description,
+                                                         Layout initialLayout, Layout finalLayout)
+    {
+        ResourceHandle handle = CreateImage(name, description);
+        Resource& resource = m_Resources[handle];
+        resource.m_Imported = true;
+        resource.m_InitialLayout = initialLayout;
+        resource.m_FinalLayout = finalLayout;
+        return handle;
+    }
+
+    RenderGraph::PassHandle RenderGraph::AddPass(std::string const& name, PassType type)
+    {
+        Pass& pass = m_Passes.emplace_back();
+        pass.m_Name = name;
+        pass.m_Type = type;
+        return static_cast<PassHandle>(m_Passes.size() - 1);
+    }
+
+    void RenderGraph::Read(PassHandle pass, ResourceHandle resource, Usage usage)
+    {
+        m_Passes[pass].m_Uses.push_back({resource, usage, false});
+    }
+
+    void RenderGraph::Write(PassHandle pass, ResourceHandle resource, Usage usage)
+    {
+        m_Passes[pass].m_Uses.push_back({resource, usage, true});
+    }
+
+    void RenderGraph::SetSideEffect(PassHandle pass) { m_Passes[pass].m_SideEffect = true; }
+
+    void RenderGraph::SetMemoryRequirements(ResourceHandle resource, uint64 size, uint64 alignment)
+    {
+        m_Resources[resource].m_RequiredSize = size;
+        m_Resources[resource].m_RequiredAlignment = std::max(alignment, uint64(1));
+    }
+
+    void RenderGraph::Clear()
+    {
+        m_Resources.clear();
+        m_Passes.clear();
+        m_Schedule.clear();
+        m_RenderPasses.clear();
+        m_FinalBarriers.clear();
+        m_HeapSizes.clear();
+        m_HeapIsDepth.clear();
+    }
+
+    uint RenderGraph::GetNumberOfCulledPasses() const
+    {
+        auto isCulled = [](Pass const& pass) { return pass.m_Culled; };
+        return static_cast<uint>(std::count_if(m_Passes.begin(), m_Passes.end(), isCulled));
+    }
+
+    uint64 RenderGraph::GetTransientMemory(bool aliased) const
+    {
+        uint64 memory = 0;
+        if (aliased)
+        {
+            for (uint64 heapSize : m_HeapSizes)
+            {
+                memory += heapSize;
+            }
+        }
+        else
+        {
+            for (auto const& resource : m_Resources)
+            {
+                memory += resource.m_Placement.m_Size;
+            }
+        }
+        return memory;
+    }
+
+    uint64 RenderGraph::GetImageSize(ImageDescription const& description)
+    {
+        uint64 size = 0;
+        for (uint mipLevel = 0; mipLevel < std::max(description.m_MipLevels, 1u); ++mipLevel)
+        {
+            uint64 width = std::max(description.m_Width >> mipLevel, 1u);
+            uint64 height = std::max(description.m_Height >> mipLevel, 1u);
+            size += width * height;
+        }
+        return size * GetBytesPerPixel(description.m_Format);
+    }
+
+    uint64 RenderGraph::GetRequiredSize(Resource const& resource) const
+    {
+        return resource.m_RequiredSize ? resource.m_RequiredSize : GetImageSize(resource.m_Description);
+    }
+
+    bool RenderGraph::IsAttachment(Usage usage)
+    {
+        return (usage == Usage::COLOR_ATTACHMENT) || (usage == Usage::DEPTH_ATTACHMENT) ||
+               (usage == Usage::DEPTH_READ) || (usage == Usage::INPUT_ATTACHMENT);
+    }
+
+    bool RenderGraph::IsDepth(Format format) { return format == Format::DEPTH32; }
+
+    bool RenderGraph::Compile(uint64 alignment)
+    {
+        m_Schedule.clear();
+        m_RenderPasses.clear();
+        m_FinalBarriers.clear();
+        m_HeapSizes.clear();
+        m_HeapIsDepth.clear();
+        for (auto& resource : m_Resources)
+        {
+            resource.m_Placement = MemoryPlacement();
+            resource.m_FirstUse = INVALID_HANDLE;
+            resource.m_LastUse = INVALID_HANDLE;
+        }
+
+        if (!Validate())
+        {
+            return false;
+        }
+        CullPasses();
+        BuildRenderPasses();
+        PlaceTransientImages(alignment);
+        ComputeBarriers();
+        return true;
+    }
+
+    bool RenderGraph::Validate() const
+    {
+        bool valid = true;
+        std::vector<bool> written(m_Resources.size(), false);
+        for (auto const& pass : m_Passes)
+        {
+            uint width = 0;
+            uint height = 0;
+            for (auto const& use : pass.m_Uses)
+            {
+                if (use.m_Resource >= m_Resources.size())
+                {
+                    LOG_CORE_ERROR("RenderGraph: pass '{0}' uses an invalid resource", pass.m_Name);
+                    valid = false;
+                    continue;
+                }
+                Resource const& resource = m_Resources[use.m_Resource];
+                // reading a write usage is fine, e.g. blending reads the color attachment
+                bool invalidUsage =
+                    use.m_Write ? !IsWriteUsage(use.m_Usage) : (use.m_Usage == Usage::TRANSFER_DESTINATION);
+                if (invalidUsage)
+                {
+                    LOG_CORE_ERROR("RenderGraph: pass '{0}' {1} '{2}' with a usage that does not allow it", pass.m_Name,
+                                   use.m_Write ? "writes" : "reads", resource.m_Name);
+                    valid = false;
+                }
+                if (!use.m_Write && !resource.m_Imported && !written[use.m_Resource])
+                {
+                    LOG_CORE_ERROR("RenderGraph: pass '{0}' reads '{1}' before it was written", pass.m_Name,
+                                   resource.m_Name);
+                    valid = false;
+                }
+                if ((pass.m_Type == PassType::GRAPHICS) && IsAttachment(use.m_Usage))
+                {
+                    if (!width)
+                    {
+                        width = resource.m_Description.m_Width;
+                        height = resource.m_Description.m_Height;
+                    }
+                    else if ((width != resource.m_Description.m_Width) || (height != resource.m_Description.m_Height))
+                    {
+                        LOG_CORE_ERROR("RenderGraph: attachments of pass '{0}' differ in size", pass.m_Name);
+                        valid = false;
+                    }
+                }
+            }
+            for (auto const& use : pass.m_Uses)
+            {
+                if (use.m_Write && (use.m_Resource < m_Resources.size()))
+                {
+                    written[use.m_Resource] = true;
+                }
+            }
+        }
+        return valid;
+    }
+
+    // a pass is needed if it has side effects or writes an imported image,
+    // then every pass that wrote an image before a needed pass used it is needed as well
+    void RenderGraph::CullPasses()
+    {
+        uint numberOfPasses = static_cast<uint>(m_Passes.size());
+        std::vector<bool> needed(numberOfPasses, false);
+        for (uint passIndex = 0; passIndex < numberOfPasses; ++passIndex)
+        {
+            Pass const& pass = m_Passes[passIndex];
+            needed[passIndex] = pass.m_SideEffect;
+            for (auto const& use : pass.m_Uses)
+            {
+                if (use.m_Write && m_Resources[use.m_Resource].m_Imported)
+                {
+                    needed[passIndex] = true;
+                }
+            }
+        }
+
+        for (uint passIndex = numberOfPasses; passIndex-- > 0;)
+        {
+            if (!needed[passIndex])
+            {
+                continue;
+            }
+            for (auto const& use : m_Passes[passIndex].m_Uses)
+            {
+                // writes keep the previous content, so the previous writer is needed for reads and writes
+                for (uint writerIndex = passIndex; writerIndex-- > 0;)
+                {
+                    auto& uses = m_Passes[writerIndex].m_Uses;
+                    bool writes = std::any_of(uses.begin(), uses.end(), [&use](ResourceUse const& writerUse)
+                                              { return writerUse.m_Write && (writerUse.m_Resource == use.m_Resource); });
+                    if (writes)
+                    {
+                        needed[writerIndex] = true;
+                        break;
+                    }
+                }
+            }
+        }
+
+        for (uint passIndex = 0; passIndex < numberOfPasses; ++passIndex)
+        {
+            m_Passes[passIndex].m_Culled = !needed[passIndex];
+            if (needed[passIndex])
+            {
+                CompiledPass& compiledPass = m_Schedule.emplace_back();
+                compiledPass.m_Pass = passIndex;
+            }
+        }
+    }
+
+    // a graphics pass joins the render pass of the previous pass if it has the same extent,
+    // continues an attachment of the render pass and uses the images written in the render pass
+    // only as attachments, i.e. pixel-locally
+    bool RenderGraph::CanMerge(CompiledRenderPass const& renderPass, PassHandle passHandle) const
+    {
+        Pass const& pass = m_Passes[passHandle];
+        bool sharesAttachment = false;
+        for (auto const& use : pass.m_Uses)
+        {
+            ImageDescription const& description = m_Resources[use.m_Resource].m_Description;
+            if (IsAttachment(use.m_Usage))
+            {
+                if ((description.m_Width != renderPass.m_Width) || (description.m_Height != renderPass.m_Height))
+                {
+                    return false;
+                }
+                auto& attachments = renderPass.m_Attachments;
+                sharesAttachment = sharesAttachment || (std::find(attachments.begin(), attachments.end(),
+                                                                  use.m_Resource) != attachments.end());
+            }
+            else
+            {
+                for (PassHandle subpass : renderPass.m_Subpasses)
+                {
+                    auto& uses = m_Passes[subpass].m_Uses;
+                    bool writtenInRenderPass =
+                        std::any_of(uses.begin(), uses.end(), [&use](ResourceUse const& subpassUse)
+                                    { return subpassUse.m_Write && (subpassUse.m_Resource == use.m_Resource); });
+                    if (writtenInRenderPass)
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+        return sharesAttachment;
+    }
+
+    // e.g. a pass that renders into the mip levels it samples, it needs render passes of its own
+    bool RenderGraph::UsesGeneralLayout(PassHandle passHandle) const
+    {
+        auto& uses = m_Passes[passHandle].m_Uses;
+        return std::any_of(uses.begin(), uses.end(), [this, passHandle](ResourceUse const& use)
+                           { return GetState(passHandle, use.m_Resource).m_Layout == Layout::GENERAL; });
+    }
+
+    void RenderGraph::BuildRenderPasses()
+    {
+        uint currentRenderPass = INVALID_HANDLE;
+        for (auto& compiledPass : m_Schedule)
+        {
+            Pass const& pass = m_Passes[compiledPass.m_Pass];
+            if (pass.m_Type != PassType::GRAPHICS)
+            {
+                currentRenderPass = INVALID_HANDLE;
+                continue;
+            }
+
+            bool standalone = UsesGeneralLayout(compiledPass.m_Pass);
+            if ((currentRenderPass == INVALID_HANDLE) || standalone ||
+                !CanMerge(m_RenderPasses[currentRenderPass], compiledPass.m_Pass))
+            {
+                currentRenderPass = static_cast<uint>(m_RenderPasses.size());
+                CompiledRenderPass& renderPass = m_RenderPasses.emplace_back();
+                for (auto const& use : pass.m_Uses)
+                {
+                    if (IsAttachment(use.m_Usage))
+                    {
+                        renderPass.m_Width = m_Resources[use.m_Resource].m_Description.m_Width;
+                        renderPass.m_Height = m_Resources[use.m_Resource].m_Description.m_Height;
+                        break;
+                    }
+                }
+            }
+
+            CompiledRenderPass& renderPass = m_RenderPasses[currentRenderPass];
+            compiledPass.m_RenderPass = currentRenderPass;
+            compiledPass.m_Subpass = static_cast<uint>(renderPass.m_Subpasses.size());
+            renderPass.m_Subpasses.push_back(compiledPass.m_Pass);
+            for (auto const& use : pass.m_Uses)
+            {
+                auto& attachments = renderPass.m_Attachments;
+                if (IsAttachment(use.m_Usage) &&
+                    (std::find(attachments.begin(), attachments.end(), use.m_Resource) == attachments.end()))
+                {
+                    attachments.push_back(use.m_Resource);
+                }
+            }
+            if (standalone)
+            {
+                currentRenderPass = INVALID_HANDLE;
+            }
+        }
+    }
+
+    // greedy placement, largest images first: an image goes to the lowest offset of a heap
+    // where it does not overlap in memory with an image that is alive at the same time
+    void RenderGraph::PlaceTransientImages(uint64 alignment)
+    {
+        // lifetimes in schedule indices, attachments stay alive for the whole render pass
+        std::vector<uint> renderPassBegin(m_RenderPasses.size(), INVALID_HANDLE);
+        std::vector<uint> renderPassEnd(m_RenderPasses.size(), 0);
+        for (uint scheduleIndex = 0; scheduleIndex < m_Schedule.size(); ++scheduleIndex)
+        {
+            uint renderPass = m_Schedule[scheduleIndex].m_RenderPass;
+            if (renderPass != INVALID_HANDLE)
+            {
+                renderPassBegin[renderPass] = std::min(renderPassBegin[renderPass], scheduleIndex);
+                renderPassEnd[renderPass] = std::max(renderPassEnd[renderPass], scheduleIndex);
+            }
+        }
+        for (uint scheduleIndex = 0; scheduleIndex < m_Schedule.size(); ++scheduleIndex)
+        {
+            CompiledPass const& compiledPass = m_Schedule[scheduleIndex];
+            uint first = scheduleIndex;
+            uint last = scheduleIndex;
+            if (compiledPass.m_RenderPass != INVALID_HANDLE)
+            {
+                first = renderPassBegin[compiledPass.m_RenderPass];
+                last = renderPassEnd[compiledPass.m_RenderPass];
+            }
+            for (auto const& use : m_Passes[compiledPass.m_Pass].m_Uses)
+            {
+                Resource& resource = m_Resources[use.m_Resource];
+                resource.m_FirstUse = (resource.m_FirstUse == INVALID_HANDLE) ? first : std::min(resource.m_FirstUse, first);
+                resource.m_LastUse = (resource.m_LastUse == INVALID_HANDLE) ? last : std::max(resource.m_LastUse, last);
+            }
+        }
+
+        std::vector<ResourceHandle> transientImages;
+        for (ResourceHandle handle = 0; handle < m_Resources.size(); ++handle)
+        {
+            Resource const& resource = m_Resources[handle];
+            if (!resource.m_Imported && (resource.m_FirstUse != INVALID_HANDLE))
+            {
+                transientImages.push_back(handle);
+            }
+        }
+        std::stable_sort(transientImages.begin(), transientImages.end(),
+                         [this](ResourceHandle left, ResourceHandle right)
+                         { return GetRequiredSize(m_Resources[left]) > GetRequiredSize(m_Resources[right]); });
+
+        std::vector<ResourceHandle> placedImages;
+        for (ResourceHandle handle : transientImages)
+        {
+            Resource& resource = m_Resources[handle];
+            uint64 size = AlignUp(GetRequiredSize(resource), alignment);
+            uint64 imageAlignment = std::max(alignment, resource.m_RequiredAlignment);
+            bool depth = IsDepth(resource.m_Description.m_Format);
+            resource.m_Placement.m_Size = size;
+
+            for (uint heap = 0; heap < m_HeapSizes.size(); ++heap)
+            {
+                // depth and color images go to different heaps, they may need different memory types
+                if (m_HeapIsDepth[heap] != depth)
+                {
+                    continue;
+                }
+                std::vector<MemoryPlacement const*> occupied;
+                for (ResourceHandle placedHandle : placedImages)
+                {
+                    Resource const& placed = m_Resources[placedHandle];
+                    bool aliveAtSameTime =
+                        (placed.m_FirstUse <= resource.m_LastUse) && (resource.m_FirstUse <= placed.m_LastUse);
+                    if ((placed.m_Placement.m_Heap == heap) && aliveAtSameTime)
+                    {
+                        occupied.push_back(&placed.m_Placement);
+                    }
+                }
+                std::sort(occupied.begin(), occupied.end(),
+                          [](MemoryPlacement const* left, MemoryPlacement const* right)
+                          { return left->m_Offset < right->m_Offset; });
+
+                uint64 offset = 0;
+                for (auto const* placement : occupied)
+                {
+                    if (offset + size <= placement->m_Offset)
+                    {
+                        break;
+                    }
+                    offset = std::max(offset, AlignUp(placement->m_Offset + placement->m_Size, imageAlignment));
+                }
+                if (offset + size <= m_HeapSizes[heap])
+                {
+                    resource.m_Placement.m_Heap = heap;
+                    resource.m_Placement.m_Offset = offset;
+                    break;
+                }
+            }
+
+            if (resource.m_Placement.m_Heap == INVALID_HANDLE)
+            {
+                resource.m_Placement.m_Heap = static_cast<uint>(m_HeapSizes.size());
+                resource.m_Placement.m_Offset = 0;
+                m_HeapSizes.push_back(size);
+                m_HeapIsDepth.push_back(depth);
+            }
+            placedImages.push_back(handle);
+        }
+    }
+
+    RenderGraph::State RenderGraph::GetState(PassHandle passHandle, ResourceHandle resourceHandle) const
+    {
+        Pass const& pass = m_Passes[passHandle];
+        bool depth = IsDepth(m_Resources[resourceHandle].m_Description.m_Format);
+        uint shaderStage = (pass.m_Type == PassType::COMPUTE) ? STAGE_COMPUTE_SHADER : STAGE_FRAGMENT_SHADER;
+
+        State state;
+        for (auto const& use : pass.m_Uses)
+        {
+            if (use.m_Resource != resourceHandle)
+            {
+                continue;
+            }
+            State useState;
+            switch (use.m_Usage)
+            {
+                case Usage::COLOR_ATTACHMENT:
+                    useState = {Layout::COLOR_ATTACHMENT,
+                                ACCESS_COLOR_ATTACHMENT_READ | (use.m_Write ? ACCESS_COLOR_ATTACHMENT_WRITE : 0u),
+                                STAGE_COLOR_ATTACHMENT_OUTPUT};
+                    break;
+                case Usage::DEPTH_ATTACHMENT:
+                    useState = {Layout::DEPTH_ATTACHMENT,
+                                ACCESS_DEPTH_ATTACHMENT_READ | (use.m_Write ? ACCESS_DEPTH_ATTACHMENT_WRITE : 0u),
+                                STAGE_FRAGMENT_TESTS};
+                    break;
+                case Usage::DEPTH_READ:
+                    useState = {Layout::DEPTH_READ_ONLY, ACCESS_DEPTH_ATTACHMENT_READ, STAGE_FRAGMENT_TESTS};
+                    break;
+                case Usage::INPUT_ATTACHMENT:
+                    useState = {depth ? Layout::DEPTH_READ_ONLY : Layout::SHADER_READ_ONLY, ACCESS_INPUT_ATTACHMENT_READ,
+                                STAGE_FRAGMENT_SHADER};
+                    break;
+                case Usage::SAMPLED:
+                    useState = {depth ? Layout::DEPTH_READ_ONLY : Layout::SHADER_READ_ONLY, ACCESS_SHADER_READ,
+                                shaderStage};
+                    break;
+                case Usage::STORAGE:
+                    useState = {Layout::GENERAL, ACCESS_SHADER_READ | (use.m_Write ? ACCESS_SHADER_WRITE : 0u),
+                                shaderStage};
+                    break;
+                case Usage::TRANSFER_SOURCE:
+                    useState = {Layout::TRANSFER_SOURCE, ACCESS_TRANSFER_READ, STAGE_TRANSFER};
+                    break;
+                case Usage::TRANSFER_DESTINATION:
+                    useState = {Layout::TRANSFER_DESTINATION, ACCESS_TRANSFER_WRITE, STAGE_TRANSFER};
+                    break;
+            }
+            useState.m_Write = use.m_Write;
+
+            // a pass that uses an image in two layouts (e.g. renders into the mips it samples) gets GENERAL
+            if (state.m_Layout == Layout::UNDEFINED)
+            {
+                state.m_Layout = useState.m_Layout;
+            }
+            else if (state.m_Layout != useState.m_Layout)
+            {
+                state.m_Layout = Layout::GENERAL;
+            }
+            state.m_Access |= useState.m_Access;
+            state.m_Stage |= useState.m_Stage;
+            state.m_Write = state.m_Write || useState.m_Write;
+        }
+        return state;
+    }
+
+    void RenderGraph::ComputeBarriers()
+    {
+        // per image: current layout, the last write and the stages that have seen it
+        struct Tracking
+        {
+            Layout m_Layout{Layout::UNDEFINED};
+            uint m_WriteAccess{ACCESS_NONE};
+            uint m_WriteStage{STAGE_NONE};
+            uint m_ReadStage{STAGE_NONE};
+            uint m_RenderPass{INVALID_HANDLE};
+        };
+        std::vector<Tracking> tracking(m_Resources.size());
+        for (ResourceHandle handle = 0; handle < m_Resources.size(); ++handle)
+        {
+            if (m_Resources[handle].m_Imported)
+            {
+                tracking[handle].m_Layout = m_Resources[handle].m_InitialLayout;
+            }
+        }
+
+        // the image that used the memory of a transient image last, before its first use
+        auto findAliasedResource = [this](ResourceHandle handle)
+        {
+            Resource const& resource = m_Resources[handle];
+            ResourceHandle aliased = INVALID_HANDLE;
+            for (ResourceHandle otherHandle = 0; otherHandle < m_Resources.size(); ++otherHandle)
+            {
+                Resource const& other = m_Resources[otherHandle];
+                MemoryPlacement const& placement = resource.m_Placement;
+                MemoryPlacement const& otherPlacement = other.m_Placement;
+                bool overlaps = (otherHandle != handle) && (otherPlacement.m_Heap == placement.m_Heap) &&
+                                (otherPlacement.m_Offset < placement.m_Offset + placement.m_Size) &&
+                                (placement.m_Offset < otherPlacement.m_Offset + otherPlacement.m_Size);
+                if (overlaps && (other.m_LastUse < resource.m_FirstUse) &&
+                    ((aliased == INVALID_HANDLE) || (m_Resources[aliased].m_LastUse < other.m_LastUse)))
+                {
+                    aliased = otherHandle;
+                }
+            }
+            return aliased;
+        };
+
+        for (uint scheduleIndex = 0; scheduleIndex < m_Schedule.size(); ++scheduleIndex)
+        {
+            CompiledPass& compiledPass = m_Schedule[scheduleIndex];
+            std::vector<ResourceHandle> handled;
+            for (auto const& use : m_Passes[compiledPass.m_Pass].m_Uses)
+            {
+                ResourceHandle handle = use.m_Resource;
+                if (std::find(handled.begin(), handled.end(), handle) != handled.end())
+                {
+                    continue;
+                }
+                handled.push_back(handle);
+
+                State state = GetState(compiledPass.m_Pass, handle);
+                Tracking& current = tracking[handle];
+                bool layoutChange = current.m_Layout != state.m_Layout;
+                bool needsBarrier = layoutChange;
+                if (state.m_Write)
+                {
+                    // write after write and write after read
+                    needsBarrier = needsBarrier || current.m_WriteStage || current.m_ReadStage;
+                }
+                else
+                {
+                    // read after write, for stages that have not waited for the write yet
+                    needsBarrier = needsBarrier || (current.m_WriteStage && (state.m_Stage & ~current.m_ReadStage));
+                }
+
+                if (needsBarrier)
+                {
+                    Barrier barrier;
+                    barrier.m_Resource = handle;
+                    barrier.m_OldLayout = current.m_Layout;
+                    barrier.m_NewLayout = state.m_Layout;
+                    barrier.m_SourceAccess = current.m_WriteAccess & WRITE_ACCESS;
+                    barrier.m_SourceStage = current.m_WriteStage | current.m_ReadStage;
+                    barrier.m_DestinationAccess = state.m_Access;
+                    barrier.m_DestinationStage = state.m_Stage;
+                    barrier.m_SubpassDependency =
+                        (compiledPass.m_RenderPass != INVALID_HANDLE) && (current.m_RenderPass == compiledPass.m_RenderPass);
+
+                    Resource const& resource = m_Resources[handle];
+                    if (!resource.m_Imported && (resource.m_FirstUse == scheduleIndex) &&
+                        (resource.m_Placement.m_Heap != INVALID_HANDLE))
+                    {
+                        barrier.m_AliasedResource = findAliasedResource(handle);
+                        if (barrier.m_AliasedResource != INVALID_HANDLE)
+                        {
+                            Tracking const& aliased = tracking[barrier.m_AliasedResource];
+                            barrier.m_SourceAccess = aliased.m_WriteAccess & WRITE_ACCESS;
+                            barrier.m_SourceStage = aliased.m_WriteStage | aliased.m_ReadStage;
+                        }
+                    }
+                    if (!barrier.m_SourceStage)
+                    {
+                        barrier.m_SourceStage = STAGE_TOP_OF_PIPE;
+                    }
+                    compiledPass.m_Barriers.push_back(barrier);
+                }
+
+                current.m_Layout = state.m_Layout;
+                current.m_RenderPass = compiledPass.m_RenderPass;
+                if (state.m_Write)
+                {
+                    current.m_WriteAccess = state.m_Access;
+                    current.m_WriteStage = state.m_Stage;
+                    current.m_ReadStage = STAGE_NONE;
+                }
+                else if (layoutChange)
+                {
+                    // the layout transition is a write, only the stages of this pass have waited for it
+                    current.m_ReadStage = state.m_Stage;
+                }
+                else
+                {
+                    current.m_ReadStage |= state.m_Stage;
+                }
+            }
+        }
+
+        for (ResourceHandle handle = 0; handle < m_Resources.size(); ++handle)
+        {
+            Resource const& resource = m_Resources[handle];
+            Tracking const& current = tracking[handle];
+            if (resource.m_Imported && (resource.m_FinalLayout != Layout::UNDEFINED) &&
+                (current.m_Layout != resource.m_FinalLayout))
+            {
+                Barrier barrier;
+                barrier.m_Resource = handle;
+                barrier.m_OldLayout = current.m_Layout;
+                barrier.m_NewLayout = resource.m_FinalLayout;
+                barrier.m_SourceAccess = current.m_WriteAccess & WRITE_ACCESS;
+                uint sourceStage = current.m_WriteStage | current.m_ReadStage;
+                barrier.m_SourceStage = sourceStage ? sourceStage : STAGE_TOP_OF_PIPE;
+                barrier.m_DestinationStage = STAGE_BOTTOM_OF_PIPE;
+                m_FinalBarriers.push_back(barrier);
+            }
+        }
+    }
+} // namespace GfxRenderEngine
@@ -0,0 +1,263 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "engine.h"
+
+namespace GfxRenderEngine
+{
+    // Render graph: passes declare the images they read and write, Compile() derives
+    // - the order of the passes and which passes can be culled because nothing uses their results
+    // - render passes: consecutive graphics passes with the same extent that read images of the
+    //   render pass only pixel-locally (input attachments, depth tests) become subpasses of one render pass
+    // - barriers: layout transitions and memory dependencies before each pass,
+    //   the ones between subpasses of a render pass are flagged as subpass dependencies
+    // - memory aliasing: transient images whose lifetimes do not overlap share memory
+    // The compiler is plain CPU code, the renderer maps the result to API objects.
+    class RenderGraph
+    {
+
+    public:
+        using ResourceHandle = uint;
+        using PassHandle = uint;
+        static constexpr uint INVALID_HANDLE = std::numeric_limits<uint>::max();
+
+        enum class PassType
+        {
+            GRAPHICS = 0,
+            COMPUTE,
+            TRANSFER
+        };
+
+        enum class Format
+        {
+            RGBA8 = 0,
+            RGBA16F,
+            RGBA32F,
+            DEPTH32
+        };
+
+        enum class Usage
+        {
+            COLOR_ATTACHMENT = 0,
+            DEPTH_ATTACHMENT,
+            DEPTH_READ, // depth test without depth writes
+            INPUT_ATTACHMENT,
+            SAMPLED,
+            STORAGE,
+            TRANSFER_SOURCE,
+            TRANSFER_DESTINATION
+        };
+
+        enum class Layout
+        {
+            UNDEFINED = 0,
+            GENERAL,
+            COLOR_ATTACHMENT,
+            DEPTH_ATTACHMENT,
+            DEPTH_READ_ONLY,
+            SHADER_READ_ONLY,
+            TRANSFER_SOURCE,
+            TRANSFER_DESTINATION,
+            PRESENT
+        };
+
+        enum Access : uint
+        {
+            ACCESS_NONE = 0,
+            ACCESS_COLOR_ATTACHMENT_READ = 1 << 0,
+            ACCESS_COLOR_ATTACHMENT_WRITE = 1 << 1,
+            ACCESS_DEPTH_ATTACHMENT_READ = 1 << 2,
+            ACCESS_DEPTH_ATTACHMENT_WRITE = 1 << 3,
+            ACCESS_INPUT_ATTACHMENT_READ = 1 << 4,
+            ACCESS_SHADER_READ = 1 << 5,
+            ACCESS_SHADER_WRITE = 1 << 6,
+            ACCESS_TRANSFER_READ = 1 << 7,
+            ACCESS_TRANSFER_WRITE = 1 << 8
+        };
+
+        enum Stage : uint
+        {
+            STAGE_NONE = 0,
+            STAGE_TOP_OF_PIPE = 1 << 0,
+            STAGE_FRAGMENT_SHADER = 1 << 1,
+            STAGE_FRAGMENT_TESTS = 1 << 2, // early and late
+            STAGE_COLOR_ATTACHMENT_OUTPUT = 1 << 3,
+            STAGE_COMPUTE_SHADER = 1 << 4,
+            STAGE_TRANSFER = 1 << 5,
+            STAGE_BOTTOM_OF_PIPE = 1 << 6
+        };
+
+        struct ImageDescription
+        {
+            uint m_Width{0};
+            uint m_Height{0};
+            uint m_MipLevels{1};
+            Format m_Format{Format::RGBA8};
+        };
+
+        struct Barrier
+        {
+            ResourceHandle m_Resource{INVALID_HANDLE};
+            Layout m_OldLayout{Layout::UNDEFINED};
+            Layout m_NewLayout{Layout::UNDEFINED};
+            uint m_SourceAccess{ACCESS_NONE};
+            uint m_DestinationAccess{ACCESS_NONE};
+            uint m_SourceStage{STAGE_NONE};
+            uint m_DestinationStage{STAGE_NONE};
+            bool m_SubpassDependency{false}; // between two subpasses of the same render pass
+            // first use of a transient image in memory that a previous image used
+            ResourceHandle m_AliasedResource{INVALID_HANDLE};
+        };
+
+        struct CompiledPass
+        {
+            PassHandle m_Pass{INVALID_HANDLE};
+            uint m_RenderPass{INVALID_HANDLE}; // index into GetRenderPasses(), invalid for compute and transfer passes
+            uint m_Subpass{0};
+            std::vector<Barrier> m_Barriers; // before the pass
+        };
+
+        struct CompiledRenderPass
+        {
+            std::vector<PassHandle> m_Subpasses;
+            std::vector<ResourceHandle> m_Attachments;
+            uint m_Width{0};
+            uint m_Height{0};
+        };
+
+        struct MemoryPlacement
+        {
+            uint m_Heap{INVALID_HANDLE}; // invalid for imported and unused images
+            uint64 m_Offset{0};
+            uint64 m_Size{0};
+        };
+
+    public:
+        RenderGraph() = default;
+
+        // transient images are created and owned by the graph and may alias
+        ResourceHandle CreateImage(std::string const& name, ImageDescription const& description);
+        // imported images live outside of the graph (swapchain, shadow maps), writing them keeps a pass alive
+        ResourceHandle ImportImage(std::string const& name, ImageDescription const& description, Layout initialLayout,
+                                   Layout finalLayout);
+        PassHandle AddPass(std::string const& name, PassType type = PassType::GRAPHICS);
+        void Read(PassHandle pass, ResourceHandle resource, Usage usage);
+        // writes keep the previous content, i.e. a pass writing an image depends on its previous writer
+        void Write(PassHandle pass, ResourceHandle resource, Usage usage);
+        void SetSideEffect(PassHandle pass); // never culled
+        // size and alignment of the image on the device, placed instead of the estimate of GetImageSize()
+        void SetMemoryRequirements(ResourceHandle resource, uint64 size, uint64 alignment);
+        void Clear();
+
+        // passes run in declaration order, they can only depend on earlier passes
+        bool Compile(uint64 alignment = DEFAULT_ALIGNMENT);
+
+        std::vector<CompiledPass> const& GetSchedule() const { return m_Schedule; }
+        std::vector<CompiledRenderPass> const& GetRenderPasses() const { return m_RenderPasses; }
+        std::vector<Barrier> const& GetFinalBarriers() const { return m_FinalBarriers; }
+        std::vector<uint64> const& GetHeapSizes() const { return m_HeapSizes; }
+        MemoryPlacement const& GetPlacement(ResourceHandle resource) const { return m_Resources[resource].m_Placement; }
+        bool IsCulled(PassHandle pass) const { return m_Passes[pass].m_Culled; }
+        uint GetNumberOfPasses() const { return static_cast<uint>(m_Passes.size()); }
+        uint GetNumberOfCulledPasses() const;
+        std::string const& GetPassName(PassHandle pass) const { return m_Passes[pass].m_Name; }
+        std::string const& GetResourceName(ResourceHandle resource) const { return m_Resources[resource].m_Name; }
+        ImageDescription const& GetDescription(ResourceHandle resource) const { return m_Resources[resource].m_Description; }
+        bool IsImported(ResourceHandle resource) const { return m_Resources[resource].m_Imported; }
+        uint GetNumberOfResources() const { return static_cast<uint>(m_Resources.size()); }
+        // memory of all transient images in use, with or without aliasing
+        uint64 GetTransientMemory(bool aliased) const;
+
+        static uint64 GetImageSize(ImageDescription const& description);
+
+    private:
+        static constexpr uint64 DEFAULT_ALIGNMENT = 65536;
+
+        struct ResourceUse
+        {
+            ResourceHandle m_Resource;
+            Usage m_Usage;
+            bool m_Write;
+        };
+
+        struct Resource
+        {
+            std::string m_Name;
+            ImageDescription m_Description;
+            bool m_Imported{false};
+            Layout m_InitialLayout{Layout::UNDEFINED};
+            Layout m_FinalLayout{Layout::UNDEFINED};
+            uint64 m_RequiredSize{0}; // 0: estimated
+            uint64 m_RequiredAlignment{1};
+            MemoryPlacement m_Placement;
+            uint m_FirstUse{INVALID_HANDLE}; // schedule indices
+            uint m_LastUse{INVALID_HANDLE};
+        };
+
+        struct Pass
+        {
+            std::string m_Name;
+            PassType m_Type{PassType::GRAPHICS};
+            std::vector<ResourceUse> m_Uses;
+            bool m_SideEffect{false};
+            bool m_Culled{false};
+        };
+
+        // layout, access and stages a pass needs for an image
+        struct State
+        {
+            Layout m_Layout{Layout::UNDEFINED};
+            uint m_Access{ACCESS_NONE};
+            uint m_Stage{STAGE_NONE};
+            bool m_Write{false};
+        };
+
+    private:
+        bool Validate() const;
+        void CullPasses();
+        void BuildRenderPasses();
+        void PlaceTransientImages(uint64 alignment);
+        void ComputeBarriers();
+        uint64 GetRequiredSize(Resource const& resource) const;
+        bool CanMerge(CompiledRenderPass const& renderPass, PassHandle pass) const;
+        bool UsesGeneralLayout(PassHandle pass) const;
+        State GetState(PassHandle pass, ResourceHandle resource) const;
+        static bool IsAttachment(Usage usage);
+        static bool IsDepth(Format format);
+
+    private:
+        std::vector<Resource> m_Resources;
+        std::vector<Pass> m_Passes;
+
+        std::vector<CompiledPass> m_Schedule;
+        std::vector<CompiledRenderPass> m_RenderPasses;
+        std::vector<Barrier> m_FinalBarriers;
+        std::vector<uint64> m_HeapSizes;
+        std::vector<bool> m_HeapIsDepth;
+    };
+} // namespace GfxRenderEngine
@@ -25,12 +25,14 @@
 #include <string>
 #include <memory>
 #include <bitset>
+#include <vector>
 
 #include "engine.h"
 #include "scene/sceneGraph.h"
 #include "scene/particleSystem.h"
 #include "renderer/camera.h"
 #include "renderer/resourceDescriptor.h"
+#include "renderer/frustumCuller.h"
 
 namespace GfxRenderEngine
 {
@@ -45,6 +47,13 @@ namespace GfxRenderEngine
             NUMBER_OF_WATER_PASSES
         };
 
+        // CPU time to record the draw calls of a render system, summed over all passes of a frame
+        struct RecordTime
+        {
+            char const* m_Name;
+            float m_Milliseconds;
+        };
+
     public:
         virtual ~Renderer() = default;
 
@@ -60,11 +69,13 @@ namespace GfxRenderEngine
                                      std::shared_ptr<ResourceDescriptor> const& resourceDescriptorIBL) = 0;
         virtual void LightingPassWater(bool reflection) = 0;
         virtual void PostProcessingRenderpass() = 0;
-        virtual void TransparencyPass(Registry& registry, ParticleSystem* particleSystem = nullptr) = 0;
+        virtual void TransparencyPass(Registry& registry, std::vector<ParticleSystem*> const& particleSystems = {}) = 0;
         virtual void TransparencyPassWater(Registry& registry, bool reflection) = 0;
         virtual void Submit2D(Camera* camera, Registry& registry) = 0;
         virtual void GUIRenderpass(Camera* camera) = 0;
         virtual uint GetFrameCounter() = 0;
+        virtual FrustumCuller::Statistics const& GetCullingStatistics(FrustumCuller::Pass pass) const = 0;
+        virtual std::vector<RecordTime> const& GetRecordTimes() const = 0;
 
         virtual bool BeginFrame(Camera* camera) = 0;
         virtual void RenderpassWater(Registry& registry, Camera& camera, bool reflection,
@@ -81,8 +92,7 @@ namespace GfxRenderEngine
         virtual float GetAmbientLightIntensity() = 0;
 
         virtual void ShowDebugShadowMap(bool showDebugShadowMap) = 0;
-        virtual void UpdateTransformCache(Scene& scene, uint const nodeIndex, glm::mat4 const& parentMat4,
-                                          bool parentDirtyFlag) = 0;
+        virtual void UpdateTransformCache(Scene& scene) = 0;
         virtual void UpdateAnimations(Registry& registry, const Timestep& timestep) = 0;
         virtual std::shared_ptr<Texture> GetTextureAtlas() = 0;
 
@@ -39,11 +39,14 @@ namespace GfxRenderEngine
         enum API
         {
             OPENGL = 0,
-            VULKAN
+            VULKAN,
+            HEADLESS // no window and no GPU, resources live in CPU memory
         };
 
     public:
         static API GetAPI() { return s_API; }
+        // select the API before the engine starts
+        static void SetAPI(API api) { s_API = api; }
 
     private:
         static API s_API;
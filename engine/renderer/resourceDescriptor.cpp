@@ -24,6 +24,7 @@
 #include "renderer/resourceDescriptor.h"
 
 #include "VKresourceDescriptor.h"
+#include "HLresourceDescriptor.h"
 
 namespace GfxRenderEngine
 {
@@ -36,6 +37,9 @@ namespace GfxRenderEngine
             case RendererAPI::VULKAN:
                 resourceDescriptor = std::make_shared<VK_ResourceDescriptor>(buffers);
                 break;
+            case RendererAPI::HEADLESS:
+                resourceDescriptor = std::make_shared<HL_ResourceDescriptor>(buffers);
+                break;
             default:
                 resourceDescriptor = nullptr;
                 break;
@@ -54,6 +58,9 @@ namespace GfxRenderEngine
             case RendererAPI::VULKAN:
                 resourceDescriptor = std::make_shared<VK_ResourceDescriptor>(resourceType, textures);
                 break;
+            case RendererAPI::HEADLESS:
+                resourceDescriptor = std::make_shared<HL_ResourceDescriptor>(resourceType, textures);
+                break;
             default:
                 resourceDescriptor = nullptr;
                 break;
@@ -39,7 +39,6 @@ namespace GfxRenderEngine
         enum ResourceType
         {
             RtInstance = 0, // instance buffer
-            RtInstanceSA,   // instance buffer + bone matrices
             RtGrass,        // grass shader
             RtIBL,
             NUM_TYPES
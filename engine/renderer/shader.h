@@ -61,7 +61,11 @@ namespace GfxRenderEngine
         Buffer::BufferDeviceAddress m_VertexBufferDeviceAddress{0};
         Buffer::BufferDeviceAddress m_IndexBufferDeviceAddress{0};
         Buffer::BufferDeviceAddress m_InstanceBufferDeviceAddress{0};
-        Buffer::BufferDeviceAddress m_SkeletalAnimationBufferDeviceAddress{0};
+        Buffer::BufferDeviceAddress m_PositionBufferDeviceAddress{0};
+
+        // byte 32 to 39
+        uint m_VertexFormat{0};
+        uint m_Reserve0{0};
     };
 #pragma pack(pop)
 
@@ -119,6 +123,9 @@ namespace GfxRenderEngine
 
         // byte 48 to 71
         Grass::GrassParameters m_GrassParameters;
+
+        // byte 72 to 75
+        uint m_InstanceBase; // slice of this frame in the instance buffer of the base model
     };
 #pragma pack(pop)
 } // namespace GfxRenderEngine
@@ -102,13 +102,6 @@ namespace GfxRenderEngine
                 LoadJoint(rootJoint, Armature::NO_PARENT);
             }
             // m_Skeleton->Traverse();
-
-            // create a buffer to be used in the shader for the joint matrices
-            // The gltf model has multiple animations, all applied to the same skeleton
-            int numberOfJoints = m_Skeleton->m_Joints.size();
-            int bufferSize = numberOfJoints * sizeof(glm::mat4); // in bytes
-            m_ShaderData = Buffer::Create(bufferSize);
-            m_ShaderData->MapBuffer();
         }
 
         size_t numberOfAnimations = m_GltfAsset.animations.size();
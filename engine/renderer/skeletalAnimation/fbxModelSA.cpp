@@ -134,10 +134,6 @@ namespace GfxRenderEngine
             uint jointIndex = 0;
             traverseNodeHierarchy(m_FbxScene->mRootNode, jointIndex, Armature::NO_PARENT);
             // m_Skeleton->Traverse();
-
-            int bufferSize = numberOfJoints * sizeof(glm::mat4); // in bytes
-            m_ShaderData = Buffer::Create(bufferSize);
-            m_ShaderData->MapBuffer();
         }
 
         size_t numberOfAnimations = m_FbxScene->mNumAnimations;
@@ -20,6 +20,8 @@
    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <algorithm>
+
 #include "core.h"
 
 #include "renderer/skeletalAnimation/skeletalAnimation.h"
@@ -40,6 +42,142 @@ namespace GfxRenderEngine
         return (!m_Repeat && ((m_CurrentKeyFrameTime + timestep) > m_LastKeyFrameTime));
     }
 
+    void SkeletalAnimation::PrepareForPlayback()
+    {
+        if (m_Samplers.empty()) // already prepared
+        {
+            return;
+        }
+        m_Tracks.resize(m_Samplers.size());
+        for (size_t samplerIndex = 0; samplerIndex < m_Samplers.size(); ++samplerIndex)
+        {
+            auto& sampler = m_Samplers[samplerIndex];
+            auto& track = m_Tracks[samplerIndex];
+            auto& values = sampler.m_TRSoutputValuesToBeInterpolated;
+            size_t numberOfKeys = sampler.m_Timestamps.size();
+
+            track.m_Interpolation = sampler.m_Interpolation;
+            track.m_Timestamps = std::move(sampler.m_Timestamps);
+
+            if (track.m_Interpolation == InterpolationMethod::CUBICSPLINE)
+            {
+                // glTF stores in-tangent, value, and out-tangent for each key
+                if (values.size() != 3 * numberOfKeys)
+                {
+                    LOG_CORE_ERROR("SkeletalAnimation::PrepareForPlayback(): bad CUBICSPLINE sampler ({0} values, {1} keys)",
+                                   values.size(), numberOfKeys);
+                    track.m_Timestamps.clear();
+                    continue;
+                }
+                track.m_InTangents.resize(numberOfKeys);
+                track.m_Values.resize(numberOfKeys);
+                track.m_OutTangents.resize(numberOfKeys);
+                for (size_t key = 0; key < numberOfKeys; ++key)
+                {
+                    track.m_InTangents[key] = values[3 * key + 0];
+                    track.m_Values[key] = values[3 * key + 1];
+                    track.m_OutTangents[key] = values[3 * key + 2];
+                }
+            }
+            else
+            {
+                track.m_Values = std::move(values);
+            }
+        }
+        m_Samplers.clear();
+        m_Samplers.shrink_to_fit();
+    }
+
+    // returns the segment [i, i + 1] that contains time
+    // playback moves forward, so the previous segment or the next one is checked first,
+    // seeks and loops fall back to a binary search
+    uint SkeletalAnimation::Track::FindSegment(float time)
+    {
+        uint numberOfKeys = static_cast<uint>(m_Timestamps.size());
+        if ((numberOfKeys < 2) || (time < m_Timestamps[0]) || (time > m_Timestamps[numberOfKeys - 1]))
+        {
+            return NO_SEGMENT;
+        }
+
+        uint cursor = m_Cursor;
+        if ((m_Timestamps[cursor] <= time) && (time <= m_Timestamps[cursor + 1]))
+        {
+            return cursor;
+        }
+        if ((cursor + 2 < numberOfKeys) && (m_Timestamps[cursor + 1] <= time) && (time <= m_Timestamps[cursor + 2]))
+        {
+            m_Cursor = cursor + 1;
+            return m_Cursor;
+        }
+
+        auto upperBound = std::upper_bound(m_Timestamps.begin(), m_Timestamps.end(), time);
+        uint segment = static_cast<uint>(std::distance(m_Timestamps.begin(), upperBound));
+        m_Cursor = std::clamp(segment, 1u, numberOfKeys - 1) - 1;
+        return m_Cursor;
+    }
+
+    // like the lookup before the cursor, all keys are visited and the last matching segment wins
+    uint SkeletalAnimation::Track::FindSegmentLinear(float time) const
+    {
+        uint segment = NO_SEGMENT;
+        for (size_t index = 0; index + 1 < m_Timestamps.size(); ++index)
+        {
+            if ((time >= m_Timestamps[index]) && (time <= m_Timestamps[index + 1]))
+            {
+                segment = static_cast<uint>(index);
+            }
+        }
+        return segment;
+    }
+
+    glm::vec4 SkeletalAnimation::Sample(Track const& track, uint segment, Path path) const
+    {
+        uint next = segment + 1;
+        switch (track.m_Interpolation)
+        {
+            case InterpolationMethod::LINEAR:
+            {
+                float a = (m_CurrentKeyFrameTime - track.m_Timestamps[segment]) /
+                          (track.m_Timestamps[next] - track.m_Timestamps[segment]);
+                if (path == Path::ROTATION)
+                {
+                    glm::vec4 const& value1 = track.m_Values[segment];
+                    glm::vec4 const& value2 = track.m_Values[next];
+                    glm::quat quaternion1(value1.w, value1.x, value1.y, value1.z);
+                    glm::quat quaternion2(value2.w, value2.x, value2.y, value2.z);
+                    glm::quat quaternion = glm::normalize(glm::slerp(quaternion1, quaternion2, a));
+                    return glm::vec4(quaternion.x, quaternion.y, quaternion.z, quaternion.w);
+                }
+                return glm::mix(track.m_Values[segment], track.m_Values[next], a);
+            }
+            case InterpolationMethod::STEP:
+            {
+                return track.m_Values[segment];
+            }
+            case InterpolationMethod::CUBICSPLINE:
+            {
+                // cubic Hermite spline as defined in the glTF 2.0 specification, appendix C
+                float deltaTime = track.m_Timestamps[next] - track.m_Timestamps[segment];
+                float t = (m_CurrentKeyFrameTime - track.m_Timestamps[segment]) / deltaTime;
+                float t2 = t * t;
+                float t3 = t2 * t;
+
+                glm::vec4 value = (2.0f * t3 - 3.0f * t2 + 1.0f) * track.m_Values[segment] +
+                                  (t3 - 2.0f * t2 + t) * deltaTime * track.m_OutTangents[segment] +
+                                  (-2.0f * t3 + 3.0f * t2) * track.m_Values[next] +
+                                  (t3 - t2) * deltaTime * track.m_InTangents[next];
+                if (path == Path::ROTATION)
+                {
+                    value = glm::normalize(value);
+                }
+                return value;
+            }
+            default:
+                LOG_CORE_WARN("SkeletalAnimation::Sample(...): interploation method not supported");
+                return track.m_Values[segment];
+        }
+    }
+
     void SkeletalAnimation::Update(const Timestep& timestep, Armature::Skeleton& skeleton)
     {
         if (!IsRunning())
@@ -55,97 +193,39 @@ namespace GfxRenderEngine
         }
         for (auto& channel : m_Channels)
         {
-            auto& sampler = m_Samplers[channel.m_SamplerIndex];
+            auto& track = m_Tracks[channel.m_SamplerIndex];
+            uint segment = track.FindSegment(m_CurrentKeyFrameTime);
+            if (segment == Track::NO_SEGMENT)
+            {
+                continue;
+            }
+
             int jointIndex = skeleton.m_GlobalNodeToJointIndex[channel.m_Node];
             auto& joint = skeleton.m_Joints[jointIndex]; // the joint to be animated
 
-            for (size_t i = 0; i < sampler.m_Timestamps.size() - 1; i++)
+            glm::vec4 value = Sample(track, segment, channel.m_Path);
+            switch (channel.m_Path)
             {
-                if ((m_CurrentKeyFrameTime >= sampler.m_Timestamps[i]) &&
-                    (m_CurrentKeyFrameTime <= sampler.m_Timestamps[i + 1]))
+                case Path::TRANSLATION:
+                {
+                    joint.m_DeformedNodeTranslation = glm::vec3(value);
+                    break;
+                }
+                case Path::ROTATION:
+                {
+                    joint.m_DeformedNodeRotation.x = value.x;
+                    joint.m_DeformedNodeRotation.y = value.y;
+                    joint.m_DeformedNodeRotation.z = value.z;
+                    joint.m_DeformedNodeRotation.w = value.w;
+                    break;
+                }
+                case Path::SCALE:
                 {
-                    switch (sampler.m_Interpolation)
-                    {
-                        case InterpolationMethod::LINEAR:
-                        {
-                            float a = (m_CurrentKeyFrameTime - sampler.m_Timestamps[i]) /
-                                      (sampler.m_Timestamps[i + 1] - sampler.m_Timestamps[i]);
-                            switch (channel.m_Path)
-                            {
-                                case Path::TRANSLATION:
-                                {
-                                    joint.m_DeformedNodeTranslation =
-                                        glm::mix(sampler.m_TRSoutputValuesToBeInterpolated[i],
-                                                 sampler.m_TRSoutputValuesToBeInterpolated[i + 1], a);
-                                    break;
-                                }
-                                case Path::ROTATION:
-                                {
-                                    glm::quat quaternion1;
-                                    quaternion1.x = sampler.m_TRSoutputValuesToBeInterpolated[i].x;
-                                    quaternion1.y = sampler.m_TRSoutputValuesToBeInterpolated[i].y;
-                                    quaternion1.z = sampler.m_TRSoutputValuesToBeInterpolated[i].z;
-                                    quaternion1.w = sampler.m_TRSoutputValuesToBeInterpolated[i].w;
-
-                                    glm::quat quaternion2;
-                                    quaternion2.x = sampler.m_TRSoutputValuesToBeInterpolated[i + 1].x;
-                                    quaternion2.y = sampler.m_TRSoutputValuesToBeInterpolated[i + 1].y;
-                                    quaternion2.z = sampler.m_TRSoutputValuesToBeInterpolated[i + 1].z;
-                                    quaternion2.w = sampler.m_TRSoutputValuesToBeInterpolated[i + 1].w;
-
-                                    joint.m_DeformedNodeRotation = glm::normalize(glm::slerp(quaternion1, quaternion2, a));
-                                    break;
-                                }
-                                case Path::SCALE:
-                                {
-                                    joint.m_DeformedNodeScale =
-                                        glm::mix(sampler.m_TRSoutputValuesToBeInterpolated[i],
-                                                 sampler.m_TRSoutputValuesToBeInterpolated[i + 1], a);
-                                    break;
-                                }
-                                default:
-                                    LOG_CORE_CRITICAL("path not found");
-                            }
-                            break;
-                        }
-                        case InterpolationMethod::STEP:
-                        {
-                            switch (channel.m_Path)
-                            {
-                                case Path::TRANSLATION:
-                                {
-                                    joint.m_DeformedNodeTranslation =
-                                        glm::vec3(sampler.m_TRSoutputValuesToBeInterpolated[i]);
-                                    break;
-                                }
-                                case Path::ROTATION:
-                                {
-                                    joint.m_DeformedNodeRotation.x = sampler.m_TRSoutputValuesToBeInterpolated[i].x;
-                                    joint.m_DeformedNodeRotation.y = sampler.m_TRSoutputValuesToBeInterpolated[i].y;
-                                    joint.m_DeformedNodeRotation.z = sampler.m_TRSoutputValuesToBeInterpolated[i].z;
-                                    joint.m_DeformedNodeRotation.w = sampler.m_TRSoutputValuesToBeInterpolated[i].w;
-                                    break;
-                                }
-                                case Path::SCALE:
-                                {
-                                    joint.m_DeformedNodeScale = glm::vec3(sampler.m_TRSoutputValuesToBeInterpolated[i]);
-                                    break;
-                                }
-                                default:
-                                    LOG_CORE_CRITICAL("path not found");
-                            }
-                            break;
-                        }
-                        case InterpolationMethod::CUBICSPLINE:
-                        {
-                            LOG_CORE_WARN("SkeletalAnimation::Update(...): interploation method CUBICSPLINE not supported");
-                            break;
-                        }
-                        default:
-                            LOG_CORE_WARN("SkeletalAnimation::Update(...): interploation method not supported");
-                            break;
-                    }
+                    joint.m_DeformedNodeScale = glm::vec3(value);
+                    break;
                 }
+                default:
+                    LOG_CORE_CRITICAL("path not found");
             }
         }
     }
@@ -62,6 +62,24 @@ namespace GfxRenderEngine
             InterpolationMethod m_Interpolation;
         };
 
+        // compact playback layout of a sampler, built from the loader data by PrepareForPlayback()
+        // CUBICSPLINE in-tangents, values, and out-tangents are split into separate streams
+        struct Track
+        {
+            static constexpr uint NO_SEGMENT = -1;
+
+            std::vector<float> m_Timestamps;
+            std::vector<glm::vec4> m_Values;
+            std::vector<glm::vec4> m_InTangents;  // CUBICSPLINE only
+            std::vector<glm::vec4> m_OutTangents; // CUBICSPLINE only
+            InterpolationMethod m_Interpolation;
+            uint m_Cursor{0}; // segment found in the previous update
+
+            uint FindSegment(float time);
+            // linear scan over all keys, reference for the key lookup benchmark
+            uint FindSegmentLinear(float time) const;
+        };
+
     public:
         SkeletalAnimation(std::string const& name);
 
@@ -74,6 +92,8 @@ namespace GfxRenderEngine
         void Update(const Timestep& timestep, Armature::Skeleton& skeleton);
         float GetDuration() const { return m_LastKeyFrameTime - m_FirstKeyFrameTime; }
         float GetCurrentTime() const { return m_CurrentKeyFrameTime - m_FirstKeyFrameTime; }
+        float GetFirstKeyFrameTime() const { return m_FirstKeyFrameTime; }
+        std::vector<Track>& GetTracks() { return m_Tracks; }
 
         std::vector<SkeletalAnimation::Sampler> m_Samplers;
         std::vector<SkeletalAnimation::Channel> m_Channels;
@@ -81,7 +101,14 @@ namespace GfxRenderEngine
         void SetFirstKeyFrameTime(float firstKeyFrameTime) { m_FirstKeyFrameTime = firstKeyFrameTime; }
         void SetLastKeyFrameTime(float lastKeyFrameTime) { m_LastKeyFrameTime = lastKeyFrameTime; }
 
+        // converts m_Samplers into tracks and releases the loader data
+        void PrepareForPlayback();
+
+    private:
+        glm::vec4 Sample(Track const& track, uint segment, Path path) const;
+
     private:
+        std::vector<Track> m_Tracks;
         std::string m_Name;
         bool m_Repeat;
 
@@ -0,0 +1,123 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include <chrono>
+#include <set>
+
+#include "core.h"
+#include "renderer/skeletalAnimation/skeletalAnimationBenchmark.h"
+#include "renderer/skeletalAnimation/skeletalAnimations.h"
+#include "scene/components.h"
+
+namespace GfxRenderEngine
+{
+    namespace
+    {
+        using Clock = std::chrono::high_resolution_clock;
+
+        constexpr float TIMESTEP = 1.0f / 60.0f;
+
+        // plays the clip loops times and returns the time of all key lookups in ms;
+        // segments counts the lookups that found a segment
+        template <typename FindSegment>
+        float TimeLookups(SkeletalAnimation& animation, uint loops, uint64& segments, FindSegment&& findSegment)
+        {
+            auto& tracks = animation.GetTracks();
+            float firstKeyFrameTime = animation.GetFirstKeyFrameTime();
+            float duration = animation.GetDuration();
+
+            auto start = Clock::now();
+            for (uint loop = 0; loop < loops; ++loop)
+            {
+                for (float time = 0.0f; time <= duration; time += TIMESTEP)
+                {
+                    for (auto& track : tracks)
+                    {
+                        if (findSegment(track, firstKeyFrameTime + time) != SkeletalAnimation::Track::NO_SEGMENT)
+                        {
+                            ++segments;
+                        }
+                    }
+                }
+            }
+            return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+        }
+    } // namespace
+
+    void RunSkeletalAnimationBenchmark(Registry& registry, std::string const& label, uint loops)
+    {
+        uint numberOfCharacters = 0;
+        uint numberOfClips = 0;
+        uint64 numberOfTracks = 0;
+        uint64 numberOfKeys = 0;
+        uint64 cursorSegments = 0;
+        uint64 linearSegments = 0;
+        float cursorMilliseconds = 0.0f;
+        float linearMilliseconds = 0.0f;
+
+        // characters that share a model share their animations
+        std::set<SkeletalAnimations*> visited;
+        auto view = registry.view<MeshComponent, SkeletalAnimationTag>();
+        for (auto entity : view)
+        {
+            auto& mesh = view.get<MeshComponent>(entity);
+            if (!mesh.m_Model)
+            {
+                continue;
+            }
+            SkeletalAnimations& animations = mesh.m_Model->GetAnimations();
+            if (!visited.insert(&animations).second)
+            {
+                continue;
+            }
+            ++numberOfCharacters;
+
+            for (auto& animation : animations)
+            {
+                ++numberOfClips;
+                for (auto const& track : animation.GetTracks())
+                {
+                    ++numberOfTracks;
+                    numberOfKeys += track.m_Timestamps.size();
+                }
+                cursorMilliseconds += TimeLookups(animation, loops, cursorSegments,
+                                                  [](SkeletalAnimation::Track& track, float time)
+                                                  { return track.FindSegment(time); });
+                linearMilliseconds += TimeLookups(animation, loops, linearSegments,
+                                                  [](SkeletalAnimation::Track& track, float time)
+                                                  { return track.FindSegmentLinear(time); });
+            }
+        }
+
+        if (!numberOfClips)
+        {
+            LOG_CORE_INFO("skeletal animation benchmark ({0}): no animated characters", label);
+            return;
+        }
+        LOG_CORE_INFO("skeletal animation benchmark ({0}): {1} character(s), {2} clip(s), {3} tracks, {4} keys, "
+                      "{5} lookups at 60 fps",
+                      label, numberOfCharacters, numberOfClips, numberOfTracks, numberOfKeys, cursorSegments);
+        LOG_CORE_INFO("skeletal animation benchmark ({0}): cursor {1:.3f} ms, linear scan {2:.3f} ms ({3} segments found)",
+                      label, cursorMilliseconds, linearMilliseconds, linearSegments);
+    }
+} // namespace GfxRenderEngine
@@ -1,4 +1,4 @@
-/* Engine Copyright (c) 2022 Engine Development Team 
+/* Engine Copyright (c) 2025 Engine Development Team
    https://github.com/beaumanvienna/vulkan
 
    Permission is hereby granted, free of charge, to any person
@@ -12,26 +12,25 @@
    The above copyright notice and this permission notice shall be
    included in all copies or substantial portions of the Software.
 
-   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS 
-   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
-   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
-   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY 
-   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
-   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
-   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
-#version 450
 
-// inputs: UVs + sammpler
-layout(location = 0)      in vec2  fragUV;
-layout(set = 0, binding = 1) uniform sampler2D tex1;
+#pragma once
 
-// outputs
-layout (location = 0) out vec4 outColor;
+#include <string>
 
-void main()
+#include "engine.h"
+#include "scene/registry.h"
+
+namespace GfxRenderEngine
 {
-    vec4 pixel = texture(tex1,fragUV);
-    if (pixel.w == 0.0) discard;
-    outColor = pixel;
-}
+    // CPU micro-benchmark of the key lookup of SkeletalAnimation::Update(): plays all clips of the animated
+    // characters in a registry at 60 fps and compares the segment cursor with a linear scan over all keys.
+    void RunSkeletalAnimationBenchmark(Registry& registry, std::string const& label, uint loops = 10);
+} // namespace GfxRenderEngine
@@ -38,6 +38,7 @@ namespace GfxRenderEngine
     {
         if (animation)
         {
+            animation->PrepareForPlayback();
             m_Animations[animation->GetName()] = animation;
             m_AnimationsVector.push_back(animation);
             m_NameToIndex[animation->GetName()] = static_cast<int>(m_AnimationsVector.size() - 1);
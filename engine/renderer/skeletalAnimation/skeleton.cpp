@@ -74,8 +74,22 @@ namespace GfxRenderEngine
                     m_ShaderData.m_FinalJointsMatrices[jointIndex] = m_Joints[jointIndex].GetDeformedBindMatrix();
                 }
 
-                // STEP 2: recursively update final joint matrices
-                UpdateJoint(ROOT_JOINT);
+                // STEP 2: update final joint matrices, parents are always updated before their children
+                if (m_FlatJoints.empty())
+                {
+                    Flatten();
+                }
+                glm::mat4* finalJointsMatrices = m_ShaderData.m_FinalJointsMatrices.data();
+                size_t numberOfFlatJoints = m_FlatJoints.size();
+                for (size_t flatIndex = 0; flatIndex < numberOfFlatJoints; ++flatIndex)
+                {
+                    int16_t parentJoint = m_FlatParents[flatIndex];
+                    if (parentJoint != Armature::NO_PARENT)
+                    {
+                        int16_t jointIndex = m_FlatJoints[flatIndex];
+                        finalJointsMatrices[jointIndex] = finalJointsMatrices[parentJoint] * finalJointsMatrices[jointIndex];
+                    }
+                }
 
                 // STEP 3: bring back into model space
                 for (int16_t jointIndex = 0; jointIndex < numberOfJoints; ++jointIndex)
@@ -86,26 +100,28 @@ namespace GfxRenderEngine
             }
         }
 
-        // Update the final joint matrices of all joints
-        // traverses entire skeleton from top (a.k.a root a.k.a hip bone)
-        // This way, it is guaranteed that the global parent transform is already updated
-        void Skeleton::UpdateJoint(int16_t jointIndex)
+        // traverses the skeleton breadth-first from the top (a.k.a root a.k.a hip bone)
+        // and stores the joints in that order, so Update() composes the matrices in one linear loop
+        void Skeleton::Flatten()
         {
-            auto& currentJoint = m_Joints[jointIndex]; // just a reference for easier code
-
-            int16_t parentJoint = currentJoint.m_ParentJoint;
-            if (parentJoint != Armature::NO_PARENT)
+            m_FlatJoints.clear();
+            m_FlatParents.clear();
+            if (m_Joints.empty())
             {
-                m_ShaderData.m_FinalJointsMatrices[jointIndex] =
-                    m_ShaderData.m_FinalJointsMatrices[parentJoint] * m_ShaderData.m_FinalJointsMatrices[jointIndex];
+                return;
             }
 
-            // update children
-            size_t numberOfChildren = currentJoint.m_Children.size();
-            for (size_t childIndex = 0; childIndex < numberOfChildren; ++childIndex)
+            m_FlatJoints.reserve(m_Joints.size());
+            m_FlatParents.reserve(m_Joints.size());
+            m_FlatJoints.push_back(ROOT_JOINT);
+            for (size_t flatIndex = 0; flatIndex < m_FlatJoints.size(); ++flatIndex)
             {
-                int childJoint = currentJoint.m_Children[childIndex];
-                UpdateJoint(childJoint);
+                auto& joint = m_Joints[m_FlatJoints[flatIndex]];
+                m_FlatParents.push_back(static_cast<int16_t>(joint.m_ParentJoint));
+                for (int childJoint : joint.m_Children)
+                {
+                    m_FlatJoints.push_back(static_cast<int16_t>(childJoint));
+                }
             }
         }
     } // namespace Armature
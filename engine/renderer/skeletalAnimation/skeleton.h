@@ -41,6 +41,7 @@ namespace GfxRenderEngine
         struct ShaderData
         {
             std::vector<glm::mat4> m_FinalJointsMatrices;
+            uint m_FirstJoint{0}; // in the joint matrices of the current frame, see FrameUpdate::UpdateAnimations()
         };
 
         struct Joint
@@ -75,13 +76,18 @@ namespace GfxRenderEngine
             void Traverse();
             void Traverse(Joint const& joint, uint indent = 0);
             void Update();
-            void UpdateJoint(int16_t joint); // signed because -1 maybe used for invalid joint
+            void Flatten();
 
             bool m_IsAnimated = true;
             std::string m_Name;
             std::vector<Joint> m_Joints;
             std::map<int, int> m_GlobalNodeToJointIndex;
             ShaderData m_ShaderData;
+
+            // joint hierarchy in parent-first order, built by Flatten()
+            // signed because -1 is used for NO_PARENT
+            std::vector<int16_t> m_FlatJoints;
+            std::vector<int16_t> m_FlatParents;
         };
     } // namespace Armature
 
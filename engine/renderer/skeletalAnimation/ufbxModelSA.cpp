@@ -130,10 +130,6 @@ namespace GfxRenderEngine
             };
             traverseNodeHierarchy(m_FbxScene->root_node, Armature::NO_PARENT);
             // m_Skeleton->Traverse();
-
-            int bufferSize = numberOfBones * sizeof(glm::mat4); // in bytes
-            m_ShaderData = Buffer::Create(bufferSize);
-            m_ShaderData->MapBuffer();
         }
 
         size_t numberOfAnimations = m_FbxScene->anim_stacks.count;
@@ -25,6 +25,7 @@
 #include "renderer/storageImage.h"
 
 #include "VKstorageImage.h"
+#include "HLstorageImage.h"
 
 namespace GfxRenderEngine
 {
@@ -37,6 +38,9 @@ namespace GfxRenderEngine
             case RendererAPI::VULKAN:
                 storageImage = std::make_shared<VK_StorageImage>();
                 break;
+            case RendererAPI::HEADLESS:
+                storageImage = std::make_shared<HL_StorageImage>();
+                break;
             default:
                 storageImage = nullptr;
                 break;
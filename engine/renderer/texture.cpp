@@ -25,6 +25,7 @@
 #include "renderer/texture.h"
 
 #include "VKtexture.h"
+#include "HLtexture.h"
 
 namespace GfxRenderEngine
 {
@@ -37,6 +38,9 @@ namespace GfxRenderEngine
             case RendererAPI::VULKAN:
                 texture = std::make_shared<VK_Texture>();
                 break;
+            case RendererAPI::HEADLESS:
+                texture = std::make_shared<HL_Texture>();
+                break;
             default:
                 texture = nullptr;
                 break;
@@ -48,8 +48,14 @@ namespace GfxRenderEngine
         virtual bool Init(const uint width, const uint height, bool sRGB, const void* data, int minFilter,
                           int magFilter) = 0;
         virtual bool Init(const std::string& fileName, bool sRGB, bool flip = true) = 0;
+        virtual bool Init(const std::string& fileName, bool sRGB, bool flip, int minFilter, int magFilter) = 0;
         virtual bool Init(const unsigned char* data, int length, bool sRGB) = 0;
         virtual bool Init(std::vector<HiResImage> const& hiResImages, bool linearFilter = true) = 0;
+        // cooked texture (see CookedTexture), sourceHash: if not 0, the cooked texture is ignored
+        // when it wasn't cooked from a source with this hash; returns false so that the caller can fall back
+        virtual bool InitCooked(const std::string& cookedFileName, bool sRGB, bool flip, uint64 sourceHash) = 0;
+        virtual bool InitCooked(const std::string& cookedFileName, bool sRGB, bool flip, uint64 sourceHash, int minFilter,
+                                int magFilter) = 0;
         virtual int GetWidth() const = 0;
         virtual int GetHeight() const = 0;
         virtual TextureID GetTextureID() const = 0;
@@ -0,0 +1,131 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <algorithm>
+#include <bit>
+
+#include "gtc/packing.hpp"
+
+#include "core.h"
+#include "renderer/vertexStreams.h"
+#include "renderer/shader.h"
+#include "renderer/skeletalAnimation/joints.h"
+
+namespace GfxRenderEngine
+{
+    VertexStreams::VertexStreams(std::vector<Vertex> const& vertices, bool skinned)
+        : m_VertexCount{static_cast<uint>(vertices.size())}
+    {
+        ZoneScopedN("VertexStreams::VertexStreams()");
+        m_VertexFormat = skinned ? GLSL_VERTEX_FORMAT_SKINNED : 0;
+        for (auto const& vertex : vertices)
+        {
+            if ((std::abs(vertex.m_UV.x) > HALF_FLOAT_UV_LIMIT) || (std::abs(vertex.m_UV.y) > HALF_FLOAT_UV_LIMIT))
+            {
+                m_VertexFormat |= GLSL_VERTEX_FORMAT_FLOAT_UV;
+                break;
+            }
+        }
+        bool const floatUV = m_VertexFormat & GLSL_VERTEX_FORMAT_FLOAT_UV;
+
+        if (skinned)
+        {
+            int maxJointId = 0;
+            for (auto const& vertex : vertices)
+            {
+                glm::ivec4 const& jointIds = vertex.m_JointIds;
+                maxJointId = std::max({maxJointId, jointIds.x, jointIds.y, jointIds.z, jointIds.w});
+            }
+            if (maxJointId >= MAX_JOINTS)
+            {
+                LOG_CORE_ERROR("VertexStreams: joint index {0} is out of range, the skinning shaders support {1} "
+                               "joints (MAX_JOINTS) and leave these vertices in the bind pose",
+                               maxJointId, MAX_JOINTS);
+            }
+        }
+
+        m_PositionStream.reserve(m_VertexCount * GetPositionStride() / sizeof(uint));
+        m_AttributeStream.reserve(m_VertexCount * GetAttributeStride() / sizeof(uint));
+        for (auto const& vertex : vertices)
+        {
+            m_PositionStream.push_back(std::bit_cast<uint>(vertex.m_Position.x));
+            m_PositionStream.push_back(std::bit_cast<uint>(vertex.m_Position.y));
+            m_PositionStream.push_back(std::bit_cast<uint>(vertex.m_Position.z));
+            if (skinned)
+            {
+                // ids >= MAX_JOINTS are reported above, clamping keeps them out of range for the shaders
+                glm::ivec4 jointIds = glm::clamp(vertex.m_JointIds, glm::ivec4(0), glm::ivec4(255));
+                m_PositionStream.push_back(jointIds.x | (jointIds.y << 8) | (jointIds.z << 16) | (jointIds.w << 24));
+                uint64 weights = glm::packUnorm4x16(vertex.m_Weights);
+                m_PositionStream.push_back(static_cast<uint>(weights));
+                m_PositionStream.push_back(static_cast<uint>(weights >> 32));
+            }
+
+            m_AttributeStream.push_back(PackOctahedral(vertex.m_Normal));
+            m_AttributeStream.push_back(PackOctahedral(vertex.m_Tangent));
+            m_AttributeStream.push_back(glm::packUnorm4x8(vertex.m_Color));
+            if (floatUV)
+            {
+                m_AttributeStream.push_back(std::bit_cast<uint>(vertex.m_UV.x));
+                m_AttributeStream.push_back(std::bit_cast<uint>(vertex.m_UV.y));
+            }
+            else
+            {
+                m_AttributeStream.push_back(glm::packHalf2x16(vertex.m_UV));
+            }
+        }
+    }
+
+    uint VertexStreams::GetPositionStride() const { return GetPositionStride(m_VertexFormat); }
+
+    uint VertexStreams::GetAttributeStride() const { return GetAttributeStride(m_VertexFormat); }
+
+    uint VertexStreams::GetPositionStride(uint vertexFormat)
+    {
+        uint words = POSITION_STREAM_WORDS + ((vertexFormat & GLSL_VERTEX_FORMAT_SKINNED) ? SKIN_WORDS : 0);
+        return words * sizeof(uint);
+    }
+
+    uint VertexStreams::GetAttributeStride(uint vertexFormat)
+    {
+        uint words = ATTRIBUTE_STREAM_WORDS + ((vertexFormat & GLSL_VERTEX_FORMAT_FLOAT_UV) ? FLOAT_UV_WORDS : 0);
+        return words * sizeof(uint);
+    }
+
+    // octahedral mapping: project onto the octahedron |x| + |y| + |z| = 1,
+    // fold the lower hemisphere over the diagonals, and store x and y as snorm16
+    uint VertexStreams::PackOctahedral(glm::vec3 const& direction)
+    {
+        float sum = std::abs(direction.x) + std::abs(direction.y) + std::abs(direction.z);
+        if (sum == 0.0f)
+        {
+            return glm::packSnorm2x16(glm::vec2(0.0f)); // decodes to (0, 0, 1)
+        }
+        glm::vec2 octahedral = glm::vec2(direction.x, direction.y) / sum;
+        if (direction.z < 0.0f)
+        {
+            glm::vec2 signNotZero{octahedral.x >= 0.0f ? 1.0f : -1.0f, octahedral.y >= 0.0f ? 1.0f : -1.0f};
+            octahedral = (glm::vec2(1.0f) - glm::abs(glm::vec2(octahedral.y, octahedral.x))) * signNotZero;
+        }
+        return glm::packSnorm2x16(octahedral);
+    }
+} // namespace GfxRenderEngine
@@ -0,0 +1,82 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <vector>
+
+#include "engine.h"
+#include "renderer/model.h"
+
+namespace GfxRenderEngine
+{
+    // Compact vertex streams for PBR meshes, see FetchVertex() in pbr.h.
+    // Both streams are arrays of 32-bit words so that any layout can be read with scalar alignment.
+    //
+    // position stream (bound as vertex buffer for the shadow passes, read via BDA by the PBR shaders)
+    //     word 0 to 2: position, float x, y, z
+    //     skinned only:
+    //     word 3:      joint ids, uint8 x 4
+    //     word 4 to 5: weights, unorm16 x 4
+    //
+    // attribute stream (read via BDA)
+    //     word 0:      normal, octahedral snorm16 x 2
+    //     word 1:      tangent, octahedral snorm16 x 2
+    //     word 2:      color, unorm8 x 4
+    //     word 3:      uv, half float x 2
+    //     word 4:      with GLSL_VERTEX_FORMAT_FLOAT_UV, uv is float x 2 in words 3 and 4
+    class VertexStreams
+    {
+
+    public:
+        static constexpr uint POSITION_STREAM_WORDS = 3;
+        static constexpr uint SKIN_WORDS = 3;
+        static constexpr uint ATTRIBUTE_STREAM_WORDS = 4;
+        static constexpr uint FLOAT_UV_WORDS = 1;
+
+        // beyond this magnitude half-float UVs are coarser than 1/1024,
+        // such meshes (e.g. tiled terrain) keep float UVs
+        static constexpr float HALF_FLOAT_UV_LIMIT = 2.0f;
+
+    public:
+        VertexStreams(std::vector<Vertex> const& vertices, bool skinned);
+
+        uint GetVertexFormat() const { return m_VertexFormat; }
+        uint GetVertexCount() const { return m_VertexCount; }
+        uint GetPositionStride() const; // in bytes
+        uint GetAttributeStride() const; // in bytes
+        std::vector<uint> const& GetPositionStream() const { return m_PositionStream; }
+        std::vector<uint> const& GetAttributeStream() const { return m_AttributeStream; }
+
+        static uint GetPositionStride(uint vertexFormat);
+        static uint GetAttributeStride(uint vertexFormat);
+
+    private:
+        static uint PackOctahedral(glm::vec3 const& direction);
+
+    private:
+        uint m_VertexFormat{0};
+        uint m_VertexCount{0};
+        std::vector<uint> m_PositionStream;
+        std::vector<uint> m_AttributeStream;
+    };
+} // namespace GfxRenderEngine
@@ -205,9 +205,8 @@ namespace GfxRenderEngine
     {
         if (m_InstanceBuffer)
         {
-            auto mat4Global = parent * GetMat4Local();
-            auto normalMatrix = glm::transpose(glm::inverse(glm::mat3(mat4Global)));
-            m_InstanceBuffer->SetInstanceData(m_InstanceIndex, mat4Global, normalMatrix);
+            // the normal matrix of instances is derived on the GPU
+            m_InstanceBuffer->SetInstanceData(m_InstanceIndex, parent * GetMat4Local());
         }
         else
         {
@@ -223,9 +222,7 @@ namespace GfxRenderEngine
     {
         if (m_InstanceBuffer)
         {
-            auto mat4Global = GetMat4Local();
-            auto normalMatrix = glm::transpose(glm::inverse(glm::mat3(mat4Global)));
-            m_InstanceBuffer->SetInstanceData(m_InstanceIndex, mat4Global, normalMatrix);
+            m_InstanceBuffer->SetInstanceData(m_InstanceIndex, GetMat4Local());
         }
         else
         {
@@ -257,12 +254,10 @@ namespace GfxRenderEngine
     {
         if (m_InstanceBuffer)
         {
-            return m_InstanceBuffer->GetNormalMatrix(m_InstanceIndex);
-        }
-        else
-        {
-            return m_NormalMatrix;
+            // instance buffers only store the model matrix
+            m_NormalMatrix = glm::transpose(glm::inverse(glm::mat3(m_InstanceBuffer->GetModelMatrix(m_InstanceIndex))));
         }
+        return m_NormalMatrix;
     }
 
     const glm::mat4& TransformComponent::GetParent() { return m_Parent; }
@@ -36,6 +36,8 @@ namespace GfxRenderEngine
     class Image;
     class Model;
     class InstanceBuffer;
+    class TerrainQuadtree;
+    class GrassField;
 
     class TransformComponent
     {
@@ -213,6 +215,10 @@ namespace GfxRenderEngine
     {
         std::vector<entt::entity> m_Instances;
         std::shared_ptr<InstanceBuffer> m_InstanceBuffer;
+
+        // one bit per render pass, written by the frustum culler
+        uint m_VisibilityMask{~0u};
+        bool IsVisible(uint pass) const { return m_VisibilityMask & (1u << pass); }
     };
 
     struct CubemapComponent
@@ -238,6 +244,7 @@ namespace GfxRenderEngine
     struct TerrainComponent
     {
         std::shared_ptr<Image> m_HeightMap;
+        std::shared_ptr<TerrainQuadtree> m_Quadtree; // only for chunked terrain
     };
 
     struct Grass1Tag
@@ -250,6 +257,7 @@ namespace GfxRenderEngine
     {
         uint m_InstanceCount{0};
         Grass::GrassParameters m_GrassParameters{};
+        std::shared_ptr<GrassField> m_GrassField; // culled and streamed instances
     };
 
     struct Water1Component
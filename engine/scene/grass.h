@@ -38,6 +38,9 @@ namespace GfxRenderEngine
             glm::vec3 m_Scale;
             float m_ScaleXZ;
             float m_ScaleY;
+            // density LOD in world units: full density up to the near distance, no grass beyond the far distance
+            float m_LodNearDistance{20.0f};
+            float m_LodFarDistance{100.0f};
         };
 
 #pragma pack(push, 1)
@@ -52,7 +55,7 @@ namespace GfxRenderEngine
         struct GrassShaderData2
         {
             glm::vec4 m_Translation;
-            glm::vec4 m_Rotation;
+            glm::vec4 m_Rotation; // w: rotation around the y-axis
         };
 #pragma pack(pop)
 
@@ -0,0 +1,238 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <algorithm>
+#include <bit>
+#include <random>
+
+#include "core.h"
+#include "renderer/camera.h"
+#include "renderer/model.h"
+#include "renderer/instanceBuffer.h"
+#include "scene/components.h"
+#include "scene/grassField.h"
+
+namespace GfxRenderEngine
+{
+    GrassField::GrassField(Grass::GrassSpec const& grassSpec, std::vector<glm::vec3> const& bladePositions)
+        : m_GrassSpec{grassSpec}, m_BladePositions{bladePositions}
+    {
+        if (m_BladePositions.empty())
+        {
+            return;
+        }
+
+        AABB bounds;
+        for (auto const& position : m_BladePositions)
+        {
+            bounds.Extend(position);
+        }
+
+        // square grid in the xz-plane of the model
+        uint numberOfBlades = static_cast<uint>(m_BladePositions.size());
+        uint tilesPerSide = std::max(1u, static_cast<uint>(std::ceil(std::sqrt(numberOfBlades / float(BLADES_PER_TILE)))));
+        glm::vec3 size = bounds.m_Max - bounds.m_Min;
+        float tileSizeX = std::max(size.x / tilesPerSide, std::numeric_limits<float>::epsilon());
+        float tileSizeZ = std::max(size.z / tilesPerSide, std::numeric_limits<float>::epsilon());
+
+        std::vector<Tile> tiles(tilesPerSide * tilesPerSide);
+        for (uint bladeIndex = 0; bladeIndex < numberOfBlades; ++bladeIndex)
+        {
+            glm::vec3 const& position = m_BladePositions[bladeIndex];
+            uint tileX = std::min(static_cast<uint>((position.x - bounds.m_Min.x) / tileSizeX), tilesPerSide - 1);
+            uint tileZ = std::min(static_cast<uint>((position.z - bounds.m_Min.z) / tileSizeZ), tilesPerSide - 1);
+            Tile& tile = tiles[tileZ * tilesPerSide + tileX];
+            tile.m_Blades.push_back(bladeIndex);
+            tile.m_Bounds.Extend(position);
+        }
+
+        // the first n blades of a tile are spread over the whole tile
+        for (uint tileIndex = 0; auto& tile : tiles)
+        {
+            if (!tile.m_Blades.empty())
+            {
+                std::mt19937 randomGenerator(tileIndex);
+                std::shuffle(tile.m_Blades.begin(), tile.m_Blades.end(), randomGenerator);
+                m_Tiles.push_back(std::move(tile));
+            }
+            ++tileIndex;
+        }
+        LOG_CORE_INFO("GrassField: {0} blades in {1} tiles", numberOfBlades, m_Tiles.size());
+    }
+
+    // the random values of a blade only depend on its index, so a tile looks the same when it is generated again
+    void GrassField::GenerateInstanceData(Tile& tile)
+    {
+        ZoneScopedN("GrassField::GenerateInstanceData");
+        tile.m_InstanceData.resize(tile.m_Blades.size());
+        for (uint index = 0; uint bladeIndex : tile.m_Blades)
+        {
+            std::minstd_rand randomGenerator(bladeIndex + 1);
+            std::uniform_real_distribution<float> random(0.0f, 1.0f);
+            Grass::GrassShaderData2& instanceData = tile.m_InstanceData[index];
+
+            glm::vec3 translation = m_BladePositions[bladeIndex];
+            translation.x += (random(randomGenerator) - 0.5f) * 0.01f;
+            translation.z += (random(randomGenerator) - 0.5f) * 0.01f;
+            instanceData.m_Translation = glm::vec4(translation, 0.0f);
+
+            // w: rotation around the y-axis, random but independent of the position of the blade in the buffer
+            float rotationY = random(randomGenerator) * 0.1f;
+            instanceData.m_Rotation = glm::vec4(0.0f, rotationY, 0.0f, std::sin(static_cast<float>(bladeIndex)));
+            ++index;
+        }
+    }
+
+    // full density up to the near distance, falling off linearly to zero at the far distance
+    float GrassField::Density(float distance) const
+    {
+        float nearDistance = m_GrassSpec.m_LodNearDistance;
+        float farDistance = m_GrassSpec.m_LodFarDistance;
+        if (distance <= nearDistance)
+        {
+            return 1.0f;
+        }
+        if (distance >= farDistance)
+        {
+            return 0.0f;
+        }
+        return (farDistance - distance) / (farDistance - nearDistance);
+    }
+
+    void GrassField::Update(Camera const& camera, glm::mat4 const& baseModelMatrix, AABB const& bladeBounds,
+                            uint frameIndex)
+    {
+        ZoneScopedN("GrassField::Update");
+        ++m_FrameCounter;
+        Frustum frustum{camera.GetProjectionMatrix() * camera.GetViewMatrix()};
+        glm::vec3 const& cameraPosition = camera.GetPosition();
+
+        // blades are scaled and rotated around the y-axis before they are moved to their position
+        glm::vec3 bladeMin{0.0f};
+        glm::vec3 bladeMax{0.0f};
+        if (bladeBounds.IsValid())
+        {
+            float radius = std::max({std::abs(bladeBounds.m_Min.x), std::abs(bladeBounds.m_Max.x),
+                                     std::abs(bladeBounds.m_Min.z), std::abs(bladeBounds.m_Max.z)}) *
+                           std::abs(m_GrassSpec.m_ScaleXZ);
+            float bottom = bladeBounds.m_Min.y * m_GrassSpec.m_ScaleY;
+            float top = bladeBounds.m_Max.y * m_GrassSpec.m_ScaleY;
+            bladeMin = glm::vec3(-radius, std::min(bottom, top), -radius);
+            bladeMax = glm::vec3(radius, std::max(bottom, top), radius);
+        }
+
+        m_Staging.clear();
+        uint tilesGenerated = 0;
+        for (auto& tile : m_Tiles)
+        {
+            AABB localBounds{tile.m_Bounds.m_Min + bladeMin, tile.m_Bounds.m_Max + bladeMax};
+            AABB worldBounds = localBounds.Transform(baseModelMatrix);
+            glm::vec3 closestPoint = glm::clamp(cameraPosition, worldBounds.m_Min, worldBounds.m_Max);
+            float density = Density(glm::length(cameraPosition - closestPoint));
+            if (density <= 0.0f)
+            {
+                continue;
+            }
+            // in range: keep the instance data, even if the tile is outside of the frustum
+            tile.m_LastUsedFrame = m_FrameCounter;
+            if (!frustum.Intersects(worldBounds))
+            {
+                continue;
+            }
+
+            if (tile.m_InstanceData.empty())
+            {
+                if (tilesGenerated == MAX_TILES_GENERATED_PER_FRAME)
+                {
+                    continue; // next frame
+                }
+                GenerateInstanceData(tile);
+                ++tilesGenerated;
+            }
+
+            size_t count = static_cast<size_t>(std::ceil(density * tile.m_InstanceData.size()));
+            m_Staging.insert(m_Staging.end(), tile.m_InstanceData.begin(), tile.m_InstanceData.begin() + count);
+        }
+        m_InstanceCount = static_cast<uint>(m_Staging.size());
+
+        for (auto& tile : m_Tiles)
+        {
+            if (!tile.m_InstanceData.empty() && (tile.m_LastUsedFrame + RELEASE_FRAMES < m_FrameCounter))
+            {
+                tile.m_InstanceData = std::vector<Grass::GrassShaderData2>();
+            }
+        }
+
+        WriteSlice(frameIndex);
+    }
+
+    std::shared_ptr<Buffer> const& GrassField::GetBuffer(uint frameIndex)
+    {
+        if (frameIndex >= m_Slices.size())
+        {
+            m_Slices.resize(frameIndex + 1);
+        }
+        Slice& slice = m_Slices[frameIndex];
+        uint requiredCapacity = std::max(m_InstanceCount, MIN_CAPACITY);
+        if (slice.m_Capacity < requiredCapacity)
+        {
+            // grow in powers of two, the slice of this frame is not in use by the GPU
+            slice.m_Capacity = std::bit_ceil(requiredCapacity);
+            slice.m_Buffer = Buffer::Create(slice.m_Capacity * sizeof(Grass::GrassShaderData2),
+                                            Buffer::BufferUsage::STORAGE_BUFFER_VISIBLE_TO_CPU);
+            slice.m_Buffer->MapBuffer();
+        }
+        return slice.m_Buffer;
+    }
+
+    void GrassField::WriteSlice(uint frameIndex)
+    {
+        auto& buffer = GetBuffer(frameIndex);
+        // the generic buffer interface writes the whole buffer
+        m_Staging.resize(m_Slices[frameIndex].m_Capacity);
+        buffer->WriteToBuffer(m_Staging.data());
+        buffer->Flush();
+    }
+
+    void GrassField::UpdateAll(Registry& registry, Camera const& camera, uint frameIndex)
+    {
+        ZoneScopedN("GrassField::UpdateAll");
+        auto view = registry.view<MeshComponent, InstanceTag, Grass2Tag>();
+        for (auto entity : view)
+        {
+            auto& grass2Tag = view.get<Grass2Tag>(entity);
+            if (!grass2Tag.m_GrassField)
+            {
+                continue;
+            }
+            auto& mesh = view.get<MeshComponent>(entity);
+            auto& instanceTag = view.get<InstanceTag>(entity);
+            GrassField& grassField = *grass2Tag.m_GrassField;
+
+            grassField.Update(camera, instanceTag.m_InstanceBuffer->GetModelMatrix(0), mesh.m_Model->GetLocalBounds(),
+                              frameIndex);
+            grass2Tag.m_InstanceCount = grassField.GetInstanceCount();
+            grass2Tag.m_GrassParameters.m_GrassBufferDeviceAddress =
+                grassField.GetBuffer(frameIndex)->GetBufferDeviceAddress();
+        }
+    }
+} // namespace GfxRenderEngine
@@ -0,0 +1,96 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "engine.h"
+#include "renderer/bounds.h"
+#include "renderer/buffer.h"
+#include "scene/grass.h"
+#include "scene/registry.h"
+
+namespace GfxRenderEngine
+{
+    class Camera;
+
+    // Grass blades of a mask (see GrassBuilder), binned into a grid of tiles in model space.
+    // Once per frame, the tiles are culled against the camera frustum and thinned out with the distance.
+    // The instance data of a tile is generated when the tile comes into range and released when it was
+    // out of range for a while. The selected blades are written into a buffer per frame in flight,
+    // the grass render system draws them with the instance count of the Grass2Tag.
+    class GrassField
+    {
+
+    public:
+        GrassField(Grass::GrassSpec const& grassSpec, std::vector<glm::vec3> const& bladePositions);
+
+        GrassField(const GrassField&) = delete;
+        GrassField& operator=(const GrassField&) = delete;
+
+        // baseModelMatrix: model to world, bladeBounds: bounds of the grass model before the blade transform
+        void Update(Camera const& camera, glm::mat4 const& baseModelMatrix, AABB const& bladeBounds, uint frameIndex);
+        uint GetInstanceCount() const { return m_InstanceCount; }
+        std::shared_ptr<Buffer> const& GetBuffer(uint frameIndex);
+        uint GetNumberOfBlades() const { return static_cast<uint>(m_BladePositions.size()); }
+
+        // updates all grass fields of a registry, call once per frame after the transform cache was updated
+        static void UpdateAll(Registry& registry, Camera const& camera, uint frameIndex);
+
+    private:
+        static constexpr uint BLADES_PER_TILE = 4096; // on average
+        static constexpr uint MAX_TILES_GENERATED_PER_FRAME = 8;
+        // generated tiles out of range for this many frames are released
+        static constexpr uint64 RELEASE_FRAMES = 240;
+        static constexpr uint MIN_CAPACITY = 1024;
+
+        struct Tile
+        {
+            AABB m_Bounds; // blade positions, model space
+            std::vector<uint> m_Blades; // indices into m_BladePositions, shuffled for density thinning
+            std::vector<Grass::GrassShaderData2> m_InstanceData;
+            uint64 m_LastUsedFrame{0};
+        };
+
+        struct Slice
+        {
+            std::shared_ptr<Buffer> m_Buffer;
+            uint m_Capacity{0};
+        };
+
+    private:
+        void GenerateInstanceData(Tile& tile);
+        float Density(float distance) const;
+        void WriteSlice(uint frameIndex);
+
+    private:
+        Grass::GrassSpec m_GrassSpec;
+        std::vector<glm::vec3> m_BladePositions;
+        std::vector<Tile> m_Tiles;
+        std::vector<Slice> m_Slices;
+        std::vector<Grass::GrassShaderData2> m_Staging; // sized to the capacity of the slice that is written
+        uint m_InstanceCount{0};
+        uint64 m_FrameCounter{0};
+    };
+} // namespace GfxRenderEngine
@@ -23,128 +23,199 @@
 #include "core.h"
 #include "auxiliary/random.h"
 #include "scene/particleSystem.h"
-#include "scene/components.h"
+#include "renderer/builder/builder.h"
 
 namespace GfxRenderEngine
 {
+    namespace
+    {
+        constexpr float SECONDS_PER_SPRITE_FRAME = 0.1f;
+    }
+
     ParticleSystem::ParticleSystem(uint poolSize, SpriteSheet* spritesheet, float amplification)
-        : m_ParticlePool{poolSize}, m_PoolIndex{0}, m_Spritesheet{spritesheet}
+        : m_Capacity{poolSize}, m_AliveCount{0}, m_PoolIndex{0}, m_Spritesheet{spritesheet}
     {
         CORE_ASSERT(poolSize, "pool size is zero");
+        for (auto& stream : m_Streams)
+        {
+            stream.resize(m_Capacity, 0.0f);
+        }
+        m_Instances.resize(m_Capacity);
+
         auto numberOfSprites = m_Spritesheet->GetNumberOfSprites();
-        m_AnimationSprites.resize(numberOfSprites);
+        CORE_ASSERT(numberOfSprites, "sprite sheet is empty");
+        m_SpriteUVs.resize(numberOfSprites);
         for (uint i = 0; i < numberOfSprites; i++)
         {
-            Builder builder{};
-
-            auto sprite = m_Spritesheet->GetSprite(i);
-            builder.LoadSprite(sprite, amplification);
-            auto model = Engine::m_Engine->LoadModel(builder);
-            MeshComponent mesh{"particle animation", model};
-            mesh.m_Enabled = false;
-
-            m_AnimationSprites[i] = m_Registry.Create();
-            m_Registry.emplace<MeshComponent>(m_AnimationSprites[i], mesh);
+            auto& sprite = m_Spritesheet->GetSprite(i);
+            m_SpriteUVs[i] = glm::vec4{sprite.m_Pos1X, sprite.m_Pos1Y, sprite.m_Pos2X, sprite.m_Pos2Y};
         }
+
+        // all particles share one quad, the sprite sheet frame is selected per instance
+        Builder builder{};
+        builder.LoadSprite(m_Spritesheet->GetSprite(0), amplification);
+        m_Quad = Engine::m_Engine->LoadModel(builder);
+        // the sprite sheet texture is bound as a material descriptor set with the instanced draw
+        m_SpritesheetDescriptor = MaterialDescriptor::Create(Material::MaterialType::MtDiffuse, m_Spritesheet->GetTexture());
+
+        m_InstanceBuffer = Buffer::Create(NUMBER_OF_SLICES * m_Capacity * sizeof(Instance),
+                                          Buffer::BufferUsage::STORAGE_BUFFER_VISIBLE_TO_CPU);
+        m_InstanceBuffer->MapBuffer();
     }
 
     void ParticleSystem::Emit(const ParticleSystem::Specification& spec, const ParticleSystem::Specification& variation)
     {
-        Particle& particle = m_ParticlePool[m_PoolIndex];
+        uint index;
+        if (m_AliveCount < m_Capacity)
+        {
+            index = m_AliveCount;
+            ++m_AliveCount;
+        }
+        else
+        {
+            index = m_PoolIndex;
+            m_PoolIndex = (m_PoolIndex + 1) % m_Capacity;
+        }
 
-        glm::vec3 variationVelocity = glm::vec3{
-            variation.m_Velocity.x * EngineCore::RandomPlusMinusOne(),
-            variation.m_Velocity.y * EngineCore::RandomPlusMinusOne(),
-            variation.m_Velocity.z * EngineCore::RandomPlusMinusOne(),
-        };
-        particle.m_Velocity = spec.m_Velocity + variationVelocity;
-        particle.m_Acceleration = spec.m_Acceleration;
+        m_Streams[VELOCITY_X][index] = spec.m_Velocity.x + variation.m_Velocity.x * EngineCore::RandomPlusMinusOne();
+        m_Streams[VELOCITY_Y][index] = spec.m_Velocity.y + variation.m_Velocity.y * EngineCore::RandomPlusMinusOne();
+        m_Streams[VELOCITY_Z][index] = spec.m_Velocity.z + variation.m_Velocity.z * EngineCore::RandomPlusMinusOne();
 
-        particle.m_RotationSpeed = spec.m_RotationSpeed;
+        m_Streams[POSITION_X][index] = spec.m_Position.x + variation.m_Position.x * EngineCore::RandomPlusMinusOne();
+        m_Streams[POSITION_Y][index] = spec.m_Position.y + variation.m_Position.y * EngineCore::RandomPlusMinusOne();
+        m_Streams[POSITION_Z][index] = spec.m_Position.z + variation.m_Position.z * EngineCore::RandomPlusMinusOne();
 
-        particle.m_StartColor = spec.m_StartColor;
-        particle.m_EndColor = spec.m_EndColor;
+        m_Streams[ROTATION_X][index] = spec.m_Rotation.x;
+        m_Streams[ROTATION_Y][index] = spec.m_Rotation.y;
+        m_Streams[ROTATION_Z][index] = spec.m_Rotation.z + variation.m_Rotation.z * EngineCore::RandomPlusMinusOne();
 
-        particle.m_StartSize = spec.m_StartSize;
-        particle.m_FinalSize = spec.m_FinalSize;
+        m_Streams[ACCELERATION_X][index] = spec.m_Acceleration.x;
+        m_Streams[ACCELERATION_Y][index] = spec.m_Acceleration.y;
+        m_Streams[ACCELERATION_Z][index] = spec.m_Acceleration.z;
 
-        particle.m_LifeTime = spec.m_LifeTime;
-        particle.m_RemainingLifeTime = particle.m_LifeTime;
+        m_Streams[ROTATION_SPEED_X][index] = spec.m_RotationSpeed.x;
+        m_Streams[ROTATION_SPEED_Y][index] = spec.m_RotationSpeed.y;
+        m_Streams[ROTATION_SPEED_Z][index] = spec.m_RotationSpeed.z;
 
-        particle.m_Enabled = true;
+        m_Streams[START_COLOR_R][index] = spec.m_StartColor.r;
+        m_Streams[START_COLOR_G][index] = spec.m_StartColor.g;
+        m_Streams[START_COLOR_B][index] = spec.m_StartColor.b;
+        m_Streams[START_COLOR_A][index] = spec.m_StartColor.a;
 
-        m_PoolIndex = (m_PoolIndex + 1) % m_ParticlePool.size();
+        m_Streams[END_COLOR_R][index] = spec.m_EndColor.r;
+        m_Streams[END_COLOR_G][index] = spec.m_EndColor.g;
+        m_Streams[END_COLOR_B][index] = spec.m_EndColor.b;
+        m_Streams[END_COLOR_A][index] = spec.m_EndColor.a;
 
-        Builder builder{};
-        particle.m_Entity = m_Registry.Create();
-
-        builder.LoadParticle(spec.m_StartColor);
-        auto model = Engine::m_Engine->LoadModel(builder);
-        MeshComponent mesh{"particle", model};
-        m_Registry.emplace<MeshComponent>(particle.m_Entity, mesh);
-
-        TransformComponent transform{};
-        transform.SetTranslation(glm::vec3{
-            spec.m_Position.x + variation.m_Position.x * EngineCore::RandomPlusMinusOne(),
-            spec.m_Position.y + variation.m_Position.y * EngineCore::RandomPlusMinusOne(),
-            spec.m_Position.z + variation.m_Position.z * EngineCore::RandomPlusMinusOne(),
-        });
-        transform.SetScale(glm::vec3{1.0f} * particle.m_StartSize);
-        transform.SetRotation(glm::vec3{spec.m_Rotation.x, spec.m_Rotation.y,
-                                        spec.m_Rotation.z + variation.m_Rotation.z * EngineCore::RandomPlusMinusOne()});
-        m_Registry.emplace<TransformComponent>(particle.m_Entity, transform);
-
-        particle.m_SmokeAnimation.Create(100ms /* per frame */, m_Spritesheet);
-        particle.m_SmokeAnimation.Start();
+        m_Streams[START_SIZE][index] = spec.m_StartSize;
+        m_Streams[FINAL_SIZE][index] = spec.m_FinalSize;
+
+        m_Streams[LIFE_TIME][index] = static_cast<float>(spec.m_LifeTime);
+        m_Streams[REMAINING_LIFE_TIME][index] = static_cast<float>(spec.m_LifeTime);
     }
 
     void ParticleSystem::OnUpdate(Timestep timestep)
     {
-        for (auto& particle : m_ParticlePool)
+        ZoneScopedN("ParticleSystem::OnUpdate");
+        Integrate(static_cast<float>(timestep));
+
+        // retire dead particles, the last alive particle takes their slot
+        uint index = 0;
+        while (index < m_AliveCount)
         {
-            if (!particle.m_Enabled)
+            if (m_Streams[REMAINING_LIFE_TIME][index] <= 0.0f)
+            {
+                Kill(index);
+            }
+            else
             {
-                continue;
+                ++index;
             }
+        }
+        if (m_PoolIndex >= m_AliveCount)
+        {
+            m_PoolIndex = 0;
+        }
+
+        UpdateInstances();
+    }
 
-            if (particle.m_RemainingLifeTime <= 0.0ms)
+    void ParticleSystem::SetRotationY(float rotationY)
+    {
+        float* __restrict rotation = m_Streams[ROTATION_Y].data();
+        for (uint i = 0; i < m_AliveCount; ++i)
+        {
+            rotation[i] = rotationY;
+        }
+    }
+
+    // branch-free loops over contiguous float streams, the compiler vectorizes these
+    void ParticleSystem::Integrate(float timestep)
+    {
+        uint const count = m_AliveCount;
+        auto integrate = [count, timestep](float* __restrict value, float const* __restrict derivative)
+        {
+            for (uint i = 0; i < count; ++i)
             {
-                particle.m_Enabled = false;
-                continue;
+                value[i] += derivative[i] * timestep;
             }
+        };
 
-            auto& transform = m_Registry.get<TransformComponent>(particle.m_Entity);
-            particle.m_Velocity += particle.m_Acceleration * static_cast<float>(timestep);
+        integrate(m_Streams[VELOCITY_X].data(), m_Streams[ACCELERATION_X].data());
+        integrate(m_Streams[VELOCITY_Y].data(), m_Streams[ACCELERATION_Y].data());
+        integrate(m_Streams[VELOCITY_Z].data(), m_Streams[ACCELERATION_Z].data());
 
-            transform.SetTranslationX(transform.GetTranslation().x + particle.m_Velocity.x * static_cast<float>(timestep));
-            transform.SetTranslationY(transform.GetTranslation().y + particle.m_Velocity.y * static_cast<float>(timestep));
-            transform.SetTranslationZ(transform.GetTranslation().z + particle.m_Velocity.z * static_cast<float>(timestep));
+        integrate(m_Streams[POSITION_X].data(), m_Streams[VELOCITY_X].data());
+        integrate(m_Streams[POSITION_Y].data(), m_Streams[VELOCITY_Y].data());
+        integrate(m_Streams[POSITION_Z].data(), m_Streams[VELOCITY_Z].data());
 
-            transform.SetRotationX(transform.GetRotation().x + particle.m_RotationSpeed.x * static_cast<float>(timestep));
-            transform.SetRotationY(transform.GetRotation().y + particle.m_RotationSpeed.y * static_cast<float>(timestep));
-            transform.SetRotationZ(transform.GetRotation().z + particle.m_RotationSpeed.z * static_cast<float>(timestep));
-            particle.m_RemainingLifeTime -= timestep;
+        integrate(m_Streams[ROTATION_X].data(), m_Streams[ROTATION_SPEED_X].data());
+        integrate(m_Streams[ROTATION_Y].data(), m_Streams[ROTATION_SPEED_Y].data());
+        integrate(m_Streams[ROTATION_Z].data(), m_Streams[ROTATION_SPEED_Z].data());
 
-            auto remainingLifeTime = static_cast<float>(particle.m_RemainingLifeTime);
-            auto lifeTime = static_cast<float>(particle.m_LifeTime);
-            auto normalizedRemainingLifeTime = remainingLifeTime / lifeTime;
+        float* __restrict remainingLifeTime = m_Streams[REMAINING_LIFE_TIME].data();
+        for (uint i = 0; i < count; ++i)
+        {
+            remainingLifeTime[i] -= timestep;
+        }
+    }
 
-            float size = glm::lerp(particle.m_FinalSize, particle.m_StartSize, normalizedRemainingLifeTime);
-            transform.SetScaleX(size);
-            transform.SetScaleY(size);
+    void ParticleSystem::Kill(uint index)
+    {
+        uint last = m_AliveCount - 1;
+        for (auto& stream : m_Streams)
+        {
+            stream[index] = stream[last];
+        }
+        --m_AliveCount;
+    }
 
-            {
-                if (!particle.m_SmokeAnimation.IsRunning())
-                {
-                    particle.m_SmokeAnimation.Start();
-                }
-
-                if (particle.m_SmokeAnimation.IsNewFrame())
-                {
-                    uint currentFrame = particle.m_SmokeAnimation.GetCurrentFrame();
-                    particle.m_SpriteEntity = m_AnimationSprites[currentFrame];
-                }
-            }
+    void ParticleSystem::UpdateInstances()
+    {
+        uint const numberOfSprites = static_cast<uint>(m_SpriteUVs.size());
+        for (uint index = 0; index < m_AliveCount; ++index)
+        {
+            float lifeTime = m_Streams[LIFE_TIME][index];
+            float remainingLifeTime = m_Streams[REMAINING_LIFE_TIME][index];
+            float normalizedRemainingLifeTime = lifeTime > 0.0f ? remainingLifeTime / lifeTime : 0.0f;
+
+            float size =
+                glm::lerp(m_Streams[FINAL_SIZE][index], m_Streams[START_SIZE][index], normalizedRemainingLifeTime);
+            glm::vec4 startColor{m_Streams[START_COLOR_R][index], m_Streams[START_COLOR_G][index],
+                                 m_Streams[START_COLOR_B][index], m_Streams[START_COLOR_A][index]};
+            glm::vec4 endColor{m_Streams[END_COLOR_R][index], m_Streams[END_COLOR_G][index],
+                               m_Streams[END_COLOR_B][index], m_Streams[END_COLOR_A][index]};
+
+            // the sprite animation loops at 100ms per frame
+            uint frame = static_cast<uint>((lifeTime - remainingLifeTime) / SECONDS_PER_SPRITE_FRAME) % numberOfSprites;
+
+            Instance& instance = m_Instances[index];
+            instance.m_PositionSize = glm::vec4{m_Streams[POSITION_X][index], m_Streams[POSITION_Y][index],
+                                                m_Streams[POSITION_Z][index], size};
+            instance.m_Rotation = glm::vec4{m_Streams[ROTATION_X][index], m_Streams[ROTATION_Y][index],
+                                            m_Streams[ROTATION_Z][index], 0.0f};
+            instance.m_Color = glm::mix(endColor, startColor, normalizedRemainingLifeTime);
+            instance.m_UV = m_SpriteUVs[frame];
         }
     }
 } // namespace GfxRenderEngine
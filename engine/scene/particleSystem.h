@@ -25,10 +25,15 @@
 #include "engine.h"
 #include "scene/scene.h"
 #include "auxiliary/timestep.h"
-#include "sprite/spriteAnimation.h"
+#include "renderer/buffer.h"
+#include "renderer/model.h"
+#include "renderer/materialDescriptor.h"
+#include "sprite/spritesheet.h"
 
 namespace GfxRenderEngine
 {
+    // particles are kept in structure-of-arrays streams and
+    // drawn with a single instanced draw call of a shared quad
     class ParticleSystem
     {
 
@@ -55,47 +60,90 @@ namespace GfxRenderEngine
             Timestep m_LifeTime{0ms};
         };
 
+        // per-instance data for the GPU, must match spriteRendererInstanced.vert
+        struct Instance
+        {
+            glm::vec4 m_PositionSize; // xyz: position, w: size
+            glm::vec4 m_Rotation;     // xyz: euler angles
+            glm::vec4 m_Color;
+            glm::vec4 m_UV; // sprite in sprite sheet: x1, y1, x2, y2
+        };
+
     public:
 
         ParticleSystem(uint poolSize /* = f(emitter rate, lifetime)*/, SpriteSheet* spritesheet, float amplification);
 
         void Emit(const ParticleSystem::Specification& spec, const ParticleSystem::Specification& variation);
         void OnUpdate(Timestep timestep);
+        // overrides the y rotation of all alive particles (e.g. to face the camera), applied by OnUpdate()
+        void SetRotationY(float rotationY);
+
+        uint GetAliveCount() const { return m_AliveCount; }
+        uint GetCapacity() const { return m_Capacity; }
+        std::shared_ptr<Model> const& GetQuad() const { return m_Quad; }
+        std::shared_ptr<Buffer> const& GetInstanceBuffer() const { return m_InstanceBuffer; }
+        std::shared_ptr<MaterialDescriptor> const& GetSpritesheetDescriptor() const { return m_SpritesheetDescriptor; }
+        std::vector<Instance> const& GetInstances() const { return m_Instances; }
+        // byte offset of the slice of frameIndex in the instance buffer
+        uint64 GetSliceOffset(int frameIndex) const { return frameIndex * m_Capacity * sizeof(Instance); }
 
     public:
+        // the instance buffer holds one slice per frame in flight, so the CPU
+        // never writes to a slice the GPU might still read from
+        static constexpr uint NUMBER_OF_SLICES = 2;
 
-        struct Particle
-        {
-            glm::vec3 m_Velocity;
-            glm::vec3 m_Acceleration;
-
-            glm::vec3 m_RotationSpeed;
-
-            glm::vec4 m_StartColor;
-            glm::vec4 m_EndColor;
-
-            float m_StartSize;
-            float m_FinalSize;
-
-            Timestep m_LifeTime{0ms};
-            Timestep m_RemainingLifeTime{0ms};
-
-            SpriteAnimation m_SmokeAnimation;
+    private:
 
-            bool m_Enabled;
-            entt::entity m_Entity;
-            entt::entity m_SpriteEntity;
+        enum Stream
+        {
+            POSITION_X = 0,
+            POSITION_Y,
+            POSITION_Z,
+            VELOCITY_X,
+            VELOCITY_Y,
+            VELOCITY_Z,
+            ACCELERATION_X,
+            ACCELERATION_Y,
+            ACCELERATION_Z,
+            ROTATION_X,
+            ROTATION_Y,
+            ROTATION_Z,
+            ROTATION_SPEED_X,
+            ROTATION_SPEED_Y,
+            ROTATION_SPEED_Z,
+            START_COLOR_R,
+            START_COLOR_G,
+            START_COLOR_B,
+            START_COLOR_A,
+            END_COLOR_R,
+            END_COLOR_G,
+            END_COLOR_B,
+            END_COLOR_A,
+            START_SIZE,
+            FINAL_SIZE,
+            LIFE_TIME,           // in seconds
+            REMAINING_LIFE_TIME, // in seconds
+            NUMBER_OF_STREAMS
         };
 
-        std::vector<Particle> m_ParticlePool;
-        Registry m_Registry;
+        void Integrate(float timestep);
+        void Kill(uint index);
+        void UpdateInstances();
 
     private:
 
-        uint m_PoolIndex;
+        // alive particles are packed into [0, m_AliveCount)
+        std::vector<float> m_Streams[NUMBER_OF_STREAMS];
+        uint m_Capacity;
+        uint m_AliveCount;
+        uint m_PoolIndex; // particle to overwrite when the pool is full
 
-        std::vector<entt::entity> m_AnimationSprites;
-        SpriteSheet* m_Spritesheet;
+        std::vector<Instance> m_Instances;
+        std::shared_ptr<Buffer> m_InstanceBuffer;
+        std::shared_ptr<Model> m_Quad;
+        std::shared_ptr<MaterialDescriptor> m_SpritesheetDescriptor;
 
+        std::vector<glm::vec4> m_SpriteUVs;
+        SpriteSheet* m_Spritesheet;
     };
-}
+} // namespace GfxRenderEngine
@@ -20,6 +20,8 @@
    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <thread>
+
 #include "scene/registry.h"
 
 namespace GfxRenderEngine
@@ -30,7 +32,64 @@ namespace GfxRenderEngine
 
     [[nodiscard]] entt::entity Registry::Create()
     {
-        std::lock_guard<std::mutex> guard(m_Mutex);
-        return m_Registry.create();
+        return Write([&]() { return m_Registry.create(); });
+    }
+
+    [[nodiscard]] bool Registry::valid(const entt::entity entity)
+    {
+        return Read([&]() { return m_Registry.valid(entity); });
+    }
+
+    void Registry::Defer(std::function<void(entt::registry&)>&& command)
+    {
+        std::lock_guard<std::mutex> guard(m_CommandQueueMutex);
+        m_CommandQueue.push_back(std::move(command));
+    }
+
+    void Registry::Sync()
+    {
+        std::vector<std::function<void(entt::registry&)>> commandQueue;
+        {
+            std::lock_guard<std::mutex> guard(m_CommandQueueMutex);
+            commandQueue.swap(m_CommandQueue);
+        }
+        if (commandQueue.empty())
+        {
+            return;
+        }
+
+        Write(
+            [&]()
+            {
+                for (auto& command : commandQueue)
+                {
+                    command(m_Registry);
+                }
+            });
+    }
+
+    void Registry::WaitForReaders()
+    {
+        bool contended = false;
+        for (auto& shard : m_ReaderShards)
+        {
+            while (shard.m_Readers.load() != 0)
+            {
+                contended = true;
+                std::this_thread::yield();
+            }
+        }
+        if (contended)
+        {
+            m_ContentionCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    uint Registry::GetReaderShardIndex()
+    {
+        // each thread gets its own cache line, readers on different threads don't share a counter
+        static std::atomic<uint> nextShardIndex{0};
+        thread_local uint shardIndex = nextShardIndex.fetch_add(1, std::memory_order_relaxed) % NUMBER_OF_READER_SHARDS;
+        return shardIndex;
     }
 } // namespace GfxRenderEngine
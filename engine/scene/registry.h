@@ -22,6 +22,13 @@
 
 #pragma once
 
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
 #include "entt.hpp"
 
 #include "engine.h"
@@ -29,6 +36,13 @@
 namespace GfxRenderEngine
 {
 
+    // Thread-safe wrapper around entt::registry
+    // Reads (get, try_get, view, valid, all_of) register with a per-thread reader shard and do not lock,
+    // unless a structural change (create, emplace, remove) is in progress. Reads on the thread making the change
+    // (e.g. from on_construct/on_destroy callbacks) go ahead without locking. Reads go through the const interface
+    // of entt::registry, the non-const one creates missing storage on first access. Structural changes take the mutex
+    // and wait until all readers have left. Hot loops can also queue structural changes with the Defer*
+    // functions; the queue is applied at the sync point (Sync()), once per frame.
     class Registry
     {
 
@@ -41,43 +55,176 @@ namespace GfxRenderEngine
 
         template <typename Component, typename... Args> decltype(auto) emplace(const entt::entity entity, Args&&... args)
         {
-            std::lock_guard<std::mutex> guard(m_Mutex);
-            return m_Registry.emplace<Component>(entity, std::forward<Args>(args)...);
+            return Write([&]() -> decltype(auto)
+                         { return m_Registry.emplace<Component>(entity, std::forward<Args>(args)...); });
         }
 
         template <typename Component> decltype(auto) remove(const entt::entity entity)
         {
-            std::lock_guard<std::mutex> guard(m_Mutex);
-            return m_Registry.remove<Component>(entity);
+            return Write([&]() { return m_Registry.remove<Component>(entity); });
         }
 
         template <typename Component> [[nodiscard]] decltype(auto) get([[maybe_unused]] const entt::entity entity)
         {
-            std::lock_guard<std::mutex> guard(m_Mutex);
-            return m_Registry.get<Component>(entity);
+            return Read([&]() -> decltype(auto) { return const_cast<Component&>(ConstRegistry().get<Component>(entity)); });
+        }
+
+        template <typename Component> [[nodiscard]] auto try_get([[maybe_unused]] const entt::entity entity)
+        {
+            return Read([&]() { return const_cast<Component*>(ConstRegistry().try_get<Component>(entity)); });
         }
 
         template <typename Component, typename... Other, typename... Exclude>
         [[nodiscard]] auto view(entt::exclude_t<Exclude...> = {})
         {
-            std::lock_guard<std::mutex> guard(m_Mutex);
-            return m_Registry.view<Component, Other...>();
+            return Read(
+                [&]()
+                {
+                    return entt::basic_view<entt::entity, entt::get_t<Component, Other...>, entt::exclude_t<Exclude...>>{
+                        Storage<Component>(), Storage<Other>()..., Storage<Exclude>()...};
+                });
         }
 
         template <typename... Component> [[nodiscard]] bool all_of(const entt::entity entity)
         {
-            std::lock_guard<std::mutex> guard(m_Mutex);
-            return m_Registry.all_of<Component...>(entity);
+            return Read([&]() { return ConstRegistry().all_of<Component...>(entity); });
+        }
+
+        [[nodiscard]] bool valid(const entt::entity entity);
+
+        // creates missing storage of component types up front; reads never create storage,
+        // a view of a component type without storage is empty
+        template <typename... Component> void Assure()
+        {
+            Write([&]() { (static_cast<void>(m_Registry.storage<Component>()), ...); });
+        }
+
+        // calls Candidate of instance whenever a Component is constructed or destroyed, including changes made
+        // through Get() and the command queue; entt moves components in memory when one of them is destroyed
+        // (swap and pop), so caches of component pointers use this to detect that they are stale;
+        // Candidate runs inside the structural change and may read through Registry, but must not change its structure
+        template <typename Component, auto Candidate, typename Type> void ConnectStorage(Type& instance)
+        {
+            Write(
+                [&]()
+                {
+                    m_Registry.on_construct<Component>().template connect<Candidate>(instance);
+                    m_Registry.on_destroy<Component>().template connect<Candidate>(instance);
+                });
+        }
+
+        template <typename Component, typename Type> void DisconnectStorage(Type& instance)
+        {
+            Write(
+                [&]()
+                {
+                    m_Registry.on_construct<Component>().disconnect(instance);
+                    m_Registry.on_destroy<Component>().disconnect(instance);
+                });
+        }
+
+        // command queue for structural changes, applied in Sync()
+        void Defer(std::function<void(entt::registry&)>&& command);
+
+        template <typename Component, typename... Args> void DeferEmplace(const entt::entity entity, Args&&... args)
+        {
+            Defer([entity, ... args = std::forward<Args>(args)](entt::registry& registry) mutable
+                  { registry.emplace_or_replace<Component>(entity, std::move(args)...); });
+        }
+
+        template <typename Component> void DeferRemove(const entt::entity entity)
+        {
+            Defer([entity](entt::registry& registry) { registry.remove<Component>(entity); });
         }
 
-        [[nodiscard]] bool valid(const entt::entity entity)
+        // sync point, applies all queued commands
+        void Sync();
+
+        // number of reads and writes that had to wait for another thread
+        uint64 GetContentionCount() const { return m_ContentionCount.load(std::memory_order_relaxed); }
+
+    private:
+        static constexpr uint NUMBER_OF_READER_SHARDS = 16;
+
+        struct alignas(64) ReaderShard
+        {
+            std::atomic<uint> m_Readers{0};
+        };
+
+        template <typename Function> decltype(auto) Read(Function&& function)
         {
+            ReaderShard& shard = m_ReaderShards[GetReaderShardIndex()];
+            shard.m_Readers.fetch_add(1);
+            if (!m_WriterActive.load())
+            {
+                struct ReaderExit
+                {
+                    ReaderShard& m_Shard;
+                    ~ReaderExit() { m_Shard.m_Readers.fetch_sub(1, std::memory_order_release); }
+                } readerExit{shard};
+                return function();
+            }
+
+            // a structural change is in progress, wait for it, unless this thread is making it
+            shard.m_Readers.fetch_sub(1, std::memory_order_release);
+            if (m_WriterThread.load() == std::this_thread::get_id())
+            {
+                return function();
+            }
+            m_ContentionCount.fetch_add(1, std::memory_order_relaxed);
             std::lock_guard<std::mutex> guard(m_Mutex);
-            return m_Registry.valid(entity);
+            return function();
         }
 
+        template <typename Function> decltype(auto) Write(Function&& function)
+        {
+            std::unique_lock<std::mutex> guard(m_Mutex, std::try_to_lock);
+            if (!guard.owns_lock())
+            {
+                m_ContentionCount.fetch_add(1, std::memory_order_relaxed);
+                guard.lock();
+            }
+
+            m_WriterThread.store(std::this_thread::get_id());
+            m_WriterActive.store(true);
+            WaitForReaders();
+            struct WriterExit
+            {
+                std::atomic<bool>& m_WriterActive;
+                std::atomic<std::thread::id>& m_WriterThread;
+                ~WriterExit()
+                {
+                    m_WriterActive.store(false, std::memory_order_release);
+                    m_WriterThread.store(std::thread::id{}, std::memory_order_release);
+                }
+            } writerExit{m_WriterActive, m_WriterThread};
+            return function();
+        }
+
+        // lookups of the const entt::registry never insert into its storage map,
+        // a missing storage is replaced by an empty placeholder
+        entt::registry const& ConstRegistry() const { return m_Registry; }
+
+        template <typename Component> auto& Storage()
+        {
+            auto const& storage = ConstRegistry().storage<std::remove_const_t<Component>>();
+            using StorageType = std::remove_const_t<std::remove_reference_t<decltype(storage)>>;
+            return const_cast<StorageType&>(storage);
+        }
+
+        void WaitForReaders();
+        static uint GetReaderShardIndex();
+
     private:
         std::mutex m_Mutex;
         entt::registry m_Registry;
+
+        ReaderShard m_ReaderShards[NUMBER_OF_READER_SHARDS];
+        std::atomic<bool> m_WriterActive{false};
+        std::atomic<std::thread::id> m_WriterThread{}; // owner of m_Mutex during a structural change
+        std::atomic<uint64> m_ContentionCount{0};
+
+        std::mutex m_CommandQueueMutex;
+        std::vector<std::function<void(entt::registry&)>> m_CommandQueue;
     };
 } // namespace GfxRenderEngine
@@ -37,7 +37,6 @@ namespace GfxRenderEngine
         enum BufferIndices
         {
             INSTANCE_BUFFER_INDEX = 0,
-            SKELETAL_ANIMATION_BUFFER_INDEX,
             HEIGHTMAP,
             MULTI_PURPOSE_BUFFER,
             NUM_BUFFERS
@@ -27,6 +27,8 @@
 #include "gtc/quaternion.hpp"
 #include "gtx/quaternion.hpp"
 
+#include "core.h"
+#include "coreSettings.h"
 #include "auxiliary/file.h"
 #include "scene/components.h"
 #include "scene/scene.h"
@@ -60,7 +62,36 @@ namespace GfxRenderEngine
         }
     }
 
-    Scene::~Scene() {}
+    Scene::~Scene() { FinishSimulation(); }
+
+    bool Scene::IsPipelined() const { return SupportsPipelining() && CoreSettings::m_EnablePipelinedFrameLoop; }
+
+    void Scene::StartSimulation(const Timestep& timestep)
+    {
+        FinishSimulation();
+        if (!IsPipelined())
+        {
+            OnSimulate(timestep);
+            return;
+        }
+
+        auto task = [this, timestep]()
+        {
+            ZoneScopedN("Scene::OnSimulate");
+            OnSimulate(timestep);
+            return true;
+        };
+        m_Simulation = Engine::m_Engine->m_PoolPrimary.SubmitTask(task);
+    }
+
+    void Scene::FinishSimulation()
+    {
+        if (m_Simulation.valid())
+        {
+            ZoneScopedN("Scene::FinishSimulation");
+            Engine::m_Engine->m_PoolPrimary.GetResult(m_Simulation);
+        }
+    }
 
     entt::entity Scene::CreatePointLight(const float intensity, const float radius, const glm::vec3& color)
     {
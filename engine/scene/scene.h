@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <future>
 #include <iostream>
 #include <unordered_map>
 
@@ -30,6 +31,7 @@
 #include "events/event.h"
 #include "scene/registry.h"
 #include "scene/sceneGraph.h"
+#include "scene/transformHierarchy.h"
 #include "scene/dictionary.h"
 #include "auxiliary/timestep.h"
 
@@ -57,6 +59,19 @@ namespace GfxRenderEngine
         virtual void StartScripts() = 0;
         virtual void ResetTimer() {}
 
+        // Optional two-stage frame (CoreSettings::m_EnablePipelinedFrameLoop): scenes that support it move their
+        // game update into OnSimulate(). OnUpdate() takes the render snapshot (UpdateTransformCache writes the global
+        // matrices and instance buffers, which OnSimulate() does not touch) and calls StartSimulation(), which runs
+        // OnSimulate() for the next frame on a worker thread while the current frame is recorded.
+        // OnSimulate() may only write local transforms and scene state that is not read by the renderer,
+        // anything else goes through the deferred command queue of the registry.
+        virtual bool SupportsPipelining() const { return false; }
+        virtual void OnSimulate(const Timestep&) {}
+        bool IsPipelined() const;
+        void StartSimulation(const Timestep& timestep);
+        // sync point, call once per frame after the frame was recorded and before the registry is synced
+        void FinishSimulation();
+
         entt::entity CreatePointLight(const float intensity = 1.0f, const float radius = 0.1f,
                                       const glm::vec3& color = glm::vec3{1.0f, 1.0f, 1.0f});
         entt::entity CreateDirectionalLight(const float intensity = 1.0f,
@@ -70,6 +85,7 @@ namespace GfxRenderEngine
         SceneGraph::TreeNode* GetTreeNode(entt::entity entity) { return &m_SceneGraph.GetNodeByGameObject(entity); }
         SceneGraph::TreeNode& GetTreeNode(uint nodeIndex) { return m_SceneGraph.GetNode(nodeIndex); }
         uint GetTreeNodeIndex(entt::entity entity) { return m_SceneGraph.GetTreeNodeIndex(entity); }
+        TransformHierarchy& GetTransformHierarchy() { return m_TransformHierarchy; }
 
     protected:
         std::string m_Name;
@@ -78,7 +94,9 @@ namespace GfxRenderEngine
         Registry m_Registry;
         Dictionary m_Dictionary;
         SceneGraph m_SceneGraph;
+        TransformHierarchy m_TransformHierarchy;
         bool m_IsRunning;
+        std::future<bool> m_Simulation;
 
         // scene lights
         uint m_SceneLightsGroupNode;
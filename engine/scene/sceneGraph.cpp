@@ -59,6 +59,7 @@ namespace GfxRenderEngine
         dictionary.Insert(name, gameObject);
         m_MapFromGameObjectToNode[gameObject] = nodeIndex;
         m_Nodes[parentNode].AddChild(nodeIndex);
+        ++m_Revision;
         return nodeIndex;
     }
 
@@ -69,6 +70,7 @@ namespace GfxRenderEngine
         m_Nodes.push_back({gameObject, name});
         dictionary.Insert(name, gameObject);
         m_MapFromGameObjectToNode[gameObject] = nodeIndex;
+        ++m_Revision;
         return nodeIndex;
     }
 
@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 
 #include "engine.h"
@@ -73,9 +74,15 @@ namespace GfxRenderEngine
         uint GetTreeNodeIndex(entt::entity const gameObject);
         void TraverseLog(uint nodeIndex, uint indent = 0);
 
+        // incremented whenever a node is added
+        uint64 GetRevision() const { return m_Revision; }
+
     private:
         std::mutex m_MutexSceneGraph;
         std::vector<TreeNode> m_Nodes;
         std::map<entt::entity, uint> m_MapFromGameObjectToNode;
+        std::atomic<uint64> m_Revision{0};
+
+        friend class TransformHierarchy;
     };
 } // namespace GfxRenderEngine
@@ -177,7 +177,7 @@ namespace GfxRenderEngine
                             continue;
                         }
                         auto& loadFuture = gltfInfo.m_LoadFuture.value();
-                        if (!loadFuture.get())
+                        if (!Engine::m_Engine->m_PoolSecondary.GetResult(loadFuture))
                         {
                             LOG_CORE_CRITICAL("gltf file did not load properly: {0}", gltfInfo.m_GltfFile.m_Filename);
                             continue;
@@ -271,7 +271,7 @@ namespace GfxRenderEngine
                             continue;
                         }
                         auto& loadFuture = gltfInfo.m_LoadFuture.value();
-                        if (!loadFuture.get())
+                        if (!Engine::m_Engine->m_PoolSecondary.GetResult(loadFuture))
                         {
                             LOG_CORE_CRITICAL("gltf file did not load properly: {0}", gltfInfo.m_GltfFile.m_Filename);
                             continue;
@@ -430,7 +430,7 @@ namespace GfxRenderEngine
                         builder.SetDictionaryPrefix("SL"); // scene loader
                         return builder.Load(instanceCount, sceneID);
                     };
-                    gltfInfo.m_LoadFuture = Engine::m_Engine->m_PoolPrimary.SubmitTask(loadGltf);
+                    gltfInfo.m_LoadFuture = Engine::m_Engine->m_PoolSecondary.SubmitTask(loadGltf);
                 }
                 else
                 {
@@ -440,7 +440,7 @@ namespace GfxRenderEngine
                         builder.SetDictionaryPrefix("SL"); // scene loader
                         return builder.Load(instanceCount, sceneID);
                     };
-                    gltfInfo.m_LoadFuture = Engine::m_Engine->m_PoolPrimary.SubmitTask(loadGltf);
+                    gltfInfo.m_LoadFuture = Engine::m_Engine->m_PoolSecondary.SubmitTask(loadGltf);
                 }
 
                 gltfInfo.m_GltfFile = Gltf::GltfFile{gltfFilename};
@@ -745,7 +745,7 @@ namespace GfxRenderEngine
                     return terrainLoaderJSON.Deserialize(filename, instanceCount);
                 };
 
-                terrainInfo.m_LoadFuture = Engine::m_Engine->m_PoolPrimary.SubmitTask(loadTerrain);
+                terrainInfo.m_LoadFuture = Engine::m_Engine->m_PoolSecondary.SubmitTask(loadTerrain);
                 terrainInfo.m_Filename = filename;
                 terrainInfo.m_InstanceCount = instanceCount;
                 terrainInfo.m_InstanceTransforms.resize(instanceCount);
@@ -824,7 +824,7 @@ namespace GfxRenderEngine
                     return terrainLoaderJSONMulti.Deserialize(filename, instanceCount, filepathMesh);
                 };
 
-                terrainInfo.m_LoadFuture = Engine::m_Engine->m_PoolPrimary.SubmitTask(loadTerrain);
+                terrainInfo.m_LoadFuture = Engine::m_Engine->m_PoolSecondary.SubmitTask(loadTerrain);
                 terrainInfo.m_Filename = filename;
                 terrainInfo.m_InstanceCount = instanceCount;
                 terrainInfo.m_InstanceTransforms.resize(instanceCount);
@@ -876,7 +876,7 @@ namespace GfxRenderEngine
                 continue;
             }
             auto& loadFuture = terrainInfo.m_LoadFuture.value();
-            if (!loadFuture.get())
+            if (!Engine::m_Engine->m_PoolSecondary.GetResult(loadFuture))
             {
                 continue;
             }
@@ -916,7 +916,7 @@ namespace GfxRenderEngine
                 continue;
             }
             auto& loadFuture = terrainInfo.m_LoadFuture.value();
-            if (!loadFuture.get())
+            if (!Engine::m_Engine->m_PoolSecondary.GetResult(loadFuture))
             {
                 continue;
             }
@@ -59,6 +59,26 @@ namespace GfxRenderEngine
             float m_ScaleY{1.0f};
         };
 
+        // chunked terrain: a quadtree of tiles with one level of detail per tree level,
+        // tiles are selected by screen-space error and streamed in and out as the camera moves
+        struct ChunkSpec
+        {
+            bool m_Enabled{false};
+            int m_TileSize{64};                // quads per tile side
+            float m_MaxScreenSpaceError{2.0f}; // in pixels
+            float m_SkirtDepth{0.005f};        // minimum depth of the skirts in height map units (0 to 1)
+        };
+
+        // area of the height map covered by one tile, in pixels
+        struct ChunkArea
+        {
+            int m_Col{0};
+            int m_Row{0};
+            int m_Stride{1}; // pixels per quad
+            int m_QuadsX{0};
+            int m_QuadsZ{0};
+        };
+
         struct TerrainSpec
         {
             std::string m_FilepathTerrainDescription;
@@ -67,6 +87,7 @@ namespace GfxRenderEngine
             PbrMaterial::PbrMaterialProperties m_PbrMaterialProperties{};
             GrassSpec m_GrassSpec;
             std::string m_FilepathMesh;
+            ChunkSpec m_ChunkSpec;
         };
 
     } // namespace Terrain
@@ -123,6 +123,12 @@ namespace GfxRenderEngine
                 ondemand::object grassSpec = terrainAttributes.value().get_object();
                 ParseGrassSpecification(grassSpec);
             }
+            else if (terrainAttributesKey == "chunks")
+            {
+                CORE_ASSERT((terrainAttributes.value().type() == ondemand::json_type::object), "chunks must be object");
+                ondemand::object chunkSpec = terrainAttributes.value().get_object();
+                ParseChunkSpecification(chunkSpec);
+            }
             else if (terrainAttributesKey == "mesh")
             {
                 CORE_ASSERT((terrainAttributes.value().type() == ondemand::json_type::string),
@@ -224,6 +230,39 @@ namespace GfxRenderEngine
         }
     }
 
+    void TerrainLoaderJSON::ParseChunkSpecification(ondemand::object chunkSpecification)
+    {
+        Terrain::ChunkSpec& chunkSpec = m_TerrainDescriptionFile.m_TerrainSpec.m_ChunkSpec;
+        chunkSpec.m_Enabled = true;
+
+        for (auto chunkAttribute : chunkSpecification)
+        {
+            std::string_view chunkAttributeKey = chunkAttribute.unescaped_key();
+
+            if (chunkAttributeKey == "tileSize")
+            {
+                CORE_ASSERT((chunkAttribute.value().type() == ondemand::json_type::number), "type must be number");
+                chunkSpec.m_TileSize = static_cast<int>(chunkAttribute.value().get_int64());
+            }
+            else if (chunkAttributeKey == "maxScreenSpaceError")
+            {
+                CORE_ASSERT((chunkAttribute.value().type() == ondemand::json_type::number), "type must be number");
+                chunkSpec.m_MaxScreenSpaceError = chunkAttribute.value().get_double();
+            }
+            else if (chunkAttributeKey == "skirtDepth")
+            {
+                CORE_ASSERT((chunkAttribute.value().type() == ondemand::json_type::number), "type must be number");
+                chunkSpec.m_SkirtDepth = chunkAttribute.value().get_double();
+            }
+            else
+            {
+                LOG_CORE_CRITICAL("unrecognized chunk attribute '" + std::string(chunkAttributeKey) + "'");
+            }
+        }
+        LOG_CORE_INFO("chunked terrain: tile size: {0}, max screen-space error: {1}", chunkSpec.m_TileSize,
+                      chunkSpec.m_MaxScreenSpaceError);
+    }
+
     void TerrainLoaderJSON::ParseTransform(ondemand::object transformJSON)
     {
         Terrain::TerrainSpec& terrainSpec = m_TerrainDescriptionFile.m_TerrainSpec;
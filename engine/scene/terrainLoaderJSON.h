@@ -54,6 +54,7 @@ namespace GfxRenderEngine
         };
 
         void ParseGrassSpecification(ondemand::object grassSpecification);
+        void ParseChunkSpecification(ondemand::object chunkSpecification);
         void ParseTransform(ondemand::object transformJSON);
         glm::vec3 ConvertToVec3(ondemand::array arrayJSON);
 
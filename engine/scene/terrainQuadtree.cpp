@@ -0,0 +1,377 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <algorithm>
+
+#include "core.h"
+#include "auxiliary/file.h"
+#include "renderer/camera.h"
+#include "renderer/image.h"
+#include "renderer/model.h"
+#include "renderer/instanceBuffer.h"
+#include "renderer/builder/terrainBuilder.h"
+#include "scene/components.h"
+#include "scene/terrainQuadtree.h"
+
+namespace GfxRenderEngine
+{
+    TerrainQuadtree::TerrainQuadtree(Registry& registry, Terrain::TerrainSpec const& terrainSpec,
+                                     std::shared_ptr<Image> const& heightMap,
+                                     std::shared_ptr<InstanceBuffer> const& instanceBuffer, int instanceCount)
+        : m_Registry{registry}, m_HeightMap{heightMap}, m_TerrainInstanceBuffer{instanceBuffer},
+          m_InstanceCount{instanceCount}, m_ChunkSpec{terrainSpec.m_ChunkSpec}
+    {
+        m_Name = EngineCore::GetFilenameWithoutPathAndExtension(terrainSpec.m_FilepathTerrainDescription);
+        m_ColorMap = TerrainBuilder::LoadColorMap(terrainSpec, *m_HeightMap);
+        m_Material = TerrainBuilder::CreateMaterial(terrainSpec);
+        m_ChunkSpec.m_TileSize = std::max(m_ChunkSpec.m_TileSize, 1);
+        m_InstanceMatrices.resize(m_InstanceCount, glm::mat4(1.0f));
+
+        // the root covers the whole height map with the smallest power-of-two stride
+        int quads = std::max(m_HeightMap->Width(), m_HeightMap->Height()) - 1;
+        int stride = 1;
+        while (stride * m_ChunkSpec.m_TileSize < quads)
+        {
+            stride *= 2;
+        }
+        m_Nodes.push_back(CreateNode(0, 0, stride));
+    }
+
+    TerrainQuadtree::~TerrainQuadtree()
+    {
+        // builds in flight reference the height map and the material
+        for (uint nodeIndex : m_PendingNodes)
+        {
+            if (m_Nodes[nodeIndex].m_Build.valid())
+            {
+                m_Nodes[nodeIndex].m_Build.wait();
+            }
+        }
+    }
+
+    TerrainQuadtree::Node TerrainQuadtree::CreateNode(int col, int row, int stride) const
+    {
+        int lastCol = m_HeightMap->Width() - 1;
+        int lastRow = m_HeightMap->Height() - 1;
+        int tileSize = m_ChunkSpec.m_TileSize;
+
+        Node node{};
+        node.m_Area.m_Col = col;
+        node.m_Area.m_Row = row;
+        node.m_Area.m_Stride = stride;
+        node.m_Area.m_QuadsX = std::min(tileSize, (lastCol - col + stride - 1) / stride);
+        node.m_Area.m_QuadsZ = std::min(tileSize, (lastRow - row + stride - 1) / stride);
+
+        // the height is refined when the tile was built
+        node.m_LocalBounds.m_Min = glm::vec3(col, -m_ChunkSpec.m_SkirtDepth, row);
+        node.m_LocalBounds.m_Max = glm::vec3(std::min(col + node.m_Area.m_QuadsX * stride, lastCol), 1.0f,
+                                             std::min(row + node.m_Area.m_QuadsZ * stride, lastRow));
+        return node;
+    }
+
+    void TerrainQuadtree::CreateChildren(uint nodeIndex)
+    {
+        Node& node = m_Nodes[nodeIndex];
+        node.m_ChildrenCreated = true;
+        if (node.m_Area.m_Stride == 1)
+        {
+            return; // full resolution
+        }
+
+        int lastCol = m_HeightMap->Width() - 1;
+        int lastRow = m_HeightMap->Height() - 1;
+        int childStride = node.m_Area.m_Stride / 2;
+        int childSpan = m_ChunkSpec.m_TileSize * childStride;
+        int col = node.m_Area.m_Col;
+        int row = node.m_Area.m_Row;
+        for (int childIndex = 0; childIndex < 4; ++childIndex)
+        {
+            int childCol = col + (childIndex & 1) * childSpan;
+            int childRow = row + (childIndex >> 1) * childSpan;
+            if ((childCol < lastCol) && (childRow < lastRow))
+            {
+                m_Nodes[nodeIndex].m_Children[childIndex] = static_cast<int>(m_Nodes.size());
+                m_Nodes.push_back(CreateNode(childCol, childRow, childStride));
+            }
+        }
+    }
+
+    void TerrainQuadtree::UpdateAll(Registry& registry, Camera const& camera)
+    {
+        ZoneScopedN("TerrainQuadtree::UpdateAll");
+        // all instances of a terrain share one quadtree
+        std::vector<TerrainQuadtree*> quadtrees;
+        auto view = registry.view<TerrainComponent>();
+        for (auto entity : view)
+        {
+            TerrainQuadtree* quadtree = view.get<TerrainComponent>(entity).m_Quadtree.get();
+            if (quadtree && (std::find(quadtrees.begin(), quadtrees.end(), quadtree) == quadtrees.end()))
+            {
+                quadtrees.push_back(quadtree);
+            }
+        }
+        for (auto quadtree : quadtrees)
+        {
+            quadtree->Update(camera);
+        }
+    }
+
+    void TerrainQuadtree::Update(Camera const& camera)
+    {
+        ZoneScopedN("TerrainQuadtree::Update");
+        ++m_FrameCounter;
+        m_CameraPosition = camera.GetPosition();
+        // distance at which one unit spans one pixel
+        m_ProjectionFactor = 0.5f * Engine::m_Engine->GetWindowHeight() * std::abs(camera.GetProjectionMatrix()[1][1]);
+        m_Orthographic = (camera.GetProjectionType() == Camera::ORTHOGRAPHIC_PROJECTION);
+
+        UpdateInstanceMatrices();
+        CollectBuilds();
+
+        m_SelectedNodes.clear();
+        Select(0);
+
+        for (uint nodeIndex : m_DrawnNodes)
+        {
+            SetDrawn(m_Nodes[nodeIndex], false);
+        }
+        for (uint nodeIndex : m_SelectedNodes)
+        {
+            SetDrawn(m_Nodes[nodeIndex], true);
+        }
+        m_DrawnNodes.swap(m_SelectedNodes);
+
+        StreamOut();
+
+        m_Statistics.m_DrawnTiles = static_cast<uint>(m_DrawnNodes.size());
+        m_Statistics.m_PendingTiles = static_cast<uint>(m_PendingNodes.size());
+    }
+
+    // the tiles are drawn with the instance matrices of the terrain game objects
+    void TerrainQuadtree::UpdateInstanceMatrices()
+    {
+        bool changed = false;
+        for (int instanceIndex = 0; instanceIndex < m_InstanceCount; ++instanceIndex)
+        {
+            glm::mat4 const& mat4 = m_TerrainInstanceBuffer->GetModelMatrix(instanceIndex);
+            if (mat4 != m_InstanceMatrices[instanceIndex])
+            {
+                m_InstanceMatrices[instanceIndex] = mat4;
+                changed = true;
+            }
+        }
+        if (!changed)
+        {
+            return;
+        }
+
+        for (auto& node : m_Nodes)
+        {
+            if (node.m_InstanceBuffer)
+            {
+                for (int instanceIndex = 0; instanceIndex < m_InstanceCount; ++instanceIndex)
+                {
+                    node.m_InstanceBuffer->SetInstanceData(instanceIndex, m_InstanceMatrices[instanceIndex]);
+                }
+            }
+        }
+    }
+
+    void TerrainQuadtree::CollectBuilds()
+    {
+        for (uint index = 0; index < m_PendingNodes.size();)
+        {
+            uint nodeIndex = m_PendingNodes[index];
+            Node& node = m_Nodes[nodeIndex];
+            if (node.m_Build.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            {
+                ++index;
+                continue;
+            }
+            m_PendingNodes[index] = m_PendingNodes.back();
+            m_PendingNodes.pop_back();
+            --m_BuildsInFlight;
+
+            BuildResult buildResult = node.m_Build.get();
+            if (!buildResult.m_Model)
+            {
+                continue;
+            }
+            node.m_Model = buildResult.m_Model;
+            node.m_InstanceBuffer = buildResult.m_InstanceBuffer;
+            node.m_GeometricError = buildResult.m_GeometricError;
+            node.m_LocalBounds = node.m_Model->GetLocalBounds();
+            for (int instanceIndex = 0; instanceIndex < m_InstanceCount; ++instanceIndex)
+            {
+                node.m_InstanceBuffer->SetInstanceData(instanceIndex, m_InstanceMatrices[instanceIndex]);
+            }
+
+            // tiles are not part of the scene graph, they are disabled until selected
+            node.m_Entity = m_Registry.Create();
+            auto name = m_Name + "::tile::" + std::to_string(node.m_Area.m_Stride) + "::" +
+                        std::to_string(node.m_Area.m_Col) + "::" + std::to_string(node.m_Area.m_Row);
+            MeshComponent mesh{name, node.m_Model, false};
+            m_Registry.emplace<MeshComponent>(node.m_Entity, mesh);
+            m_Registry.emplace<TransformComponent>(node.m_Entity);
+            InstanceTag instanceTag{};
+            instanceTag.m_Instances.push_back(node.m_Entity);
+            instanceTag.m_InstanceBuffer = node.m_InstanceBuffer;
+            m_Registry.emplace<InstanceTag>(node.m_Entity, instanceTag);
+            m_Registry.emplace<PbrMaterialTag>(node.m_Entity);
+            m_Registry.emplace<PlainPBRTag>(node.m_Entity);
+            ++m_Statistics.m_ResidentTiles;
+        }
+    }
+
+    void TerrainQuadtree::RequestBuild(uint nodeIndex)
+    {
+        Node& node = m_Nodes[nodeIndex];
+        if (node.m_Model || node.m_Build.valid() || (m_BuildsInFlight >= MAX_BUILDS_IN_FLIGHT))
+        {
+            return;
+        }
+
+        // the task must not access the quadtree
+        auto buildTile = [heightMap = m_HeightMap, colorMap = m_ColorMap, material = m_Material, area = node.m_Area,
+                          skirtDepth = m_ChunkSpec.m_SkirtDepth, instanceCount = m_InstanceCount]()
+        {
+            BuildResult buildResult{};
+            TerrainBuilder builder{};
+            if (builder.PopulateChunkData(*heightMap, colorMap.get(), area, skirtDepth))
+            {
+                buildResult.m_InstanceBuffer = InstanceBuffer::Create(instanceCount);
+                buildResult.m_Model = builder.CreateModel(buildResult.m_InstanceBuffer, material, instanceCount);
+                buildResult.m_GeometricError = builder.GetGeometricError();
+            }
+            return buildResult;
+        };
+        node.m_Build = Engine::m_Engine->m_PoolSecondary.SubmitTask(buildTile);
+        m_PendingNodes.push_back(nodeIndex);
+        ++m_BuildsInFlight;
+    }
+
+    // chunked LOD: refine while the screen-space error of a tile is too large and all its children are resident,
+    // otherwise draw the tile itself; a tile is only visited if its parent is resident, so there are no holes
+    void TerrainQuadtree::Select(uint nodeIndex)
+    {
+        Node& node = m_Nodes[nodeIndex];
+        node.m_LastUsedFrame = m_FrameCounter;
+        if (!node.m_Model)
+        {
+            RequestBuild(nodeIndex); // only the root can get here
+            return;
+        }
+
+        bool refine = (node.m_Area.m_Stride > 1) && (ScreenSpaceError(node) > m_ChunkSpec.m_MaxScreenSpaceError);
+        if (refine)
+        {
+            if (!node.m_ChildrenCreated)
+            {
+                CreateChildren(nodeIndex);
+            }
+
+            bool childrenResident = true;
+            for (int childIndex : m_Nodes[nodeIndex].m_Children)
+            {
+                if (childIndex != NO_CHILD)
+                {
+                    Node& child = m_Nodes[childIndex];
+                    child.m_LastUsedFrame = m_FrameCounter;
+                    if (!child.m_Model)
+                    {
+                        childrenResident = false;
+                        RequestBuild(childIndex);
+                    }
+                }
+            }
+
+            if (childrenResident)
+            {
+                for (int childIndex : m_Nodes[nodeIndex].m_Children)
+                {
+                    if (childIndex != NO_CHILD)
+                    {
+                        Select(childIndex);
+                    }
+                }
+                return;
+            }
+        }
+        m_SelectedNodes.push_back(nodeIndex);
+    }
+
+    // geometric error of the tile projected to the screen, in pixels, for the closest instance
+    float TerrainQuadtree::ScreenSpaceError(Node const& node) const
+    {
+        float maxScreenSpaceError = 0.0f;
+        for (auto const& mat4 : m_InstanceMatrices)
+        {
+            float distance = 1.0f; // the error does not depend on the distance for orthographic projections
+            if (!m_Orthographic)
+            {
+                AABB worldBounds = node.m_LocalBounds.Transform(mat4);
+                glm::vec3 closestPoint = glm::clamp(m_CameraPosition, worldBounds.m_Min, worldBounds.m_Max);
+                distance = std::max(glm::length(m_CameraPosition - closestPoint), 0.001f);
+            }
+            float worldError = node.m_GeometricError * glm::length(glm::vec3(mat4[1]));
+            maxScreenSpaceError = std::max(maxScreenSpaceError, worldError * m_ProjectionFactor / distance);
+        }
+        return maxScreenSpaceError;
+    }
+
+    void TerrainQuadtree::SetDrawn(Node& node, bool drawn)
+    {
+        if (node.m_Entity == entt::null)
+        {
+            return;
+        }
+        m_Registry.get<MeshComponent>(node.m_Entity).m_Enabled = drawn;
+    }
+
+    void TerrainQuadtree::Release(Node& node)
+    {
+        m_Registry.Defer([entity = node.m_Entity](entt::registry& registry) { registry.destroy(entity); });
+        m_RetiredModels.push_back({m_FrameCounter, node.m_Model, node.m_InstanceBuffer});
+        node.m_Entity = entt::null;
+        node.m_Model.reset();
+        node.m_InstanceBuffer.reset();
+        --m_Statistics.m_ResidentTiles;
+    }
+
+    void TerrainQuadtree::StreamOut()
+    {
+        // the root is never released
+        for (uint nodeIndex = 1; nodeIndex < m_Nodes.size(); ++nodeIndex)
+        {
+            Node& node = m_Nodes[nodeIndex];
+            if (node.m_Model && (node.m_LastUsedFrame + STREAM_OUT_FRAMES < m_FrameCounter))
+            {
+                Release(node);
+            }
+        }
+
+        while (!m_RetiredModels.empty() && (m_RetiredModels.front().m_Frame + RETIRE_FRAMES < m_FrameCounter))
+        {
+            m_RetiredModels.pop_front();
+        }
+    }
+} // namespace GfxRenderEngine
@@ -0,0 +1,151 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <deque>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "engine.h"
+#include "renderer/bounds.h"
+#include "scene/registry.h"
+#include "scene/terrain.h"
+
+namespace GfxRenderEngine
+{
+    class Camera;
+    class Image;
+    class InstanceBuffer;
+    class Model;
+    class PbrMaterial;
+
+    // Chunked terrain: the height map is covered by a quadtree of tiles. All tiles have the same number of quads,
+    // the root samples the whole height map with the largest stride, the leaves sample it at full resolution.
+    // Once per frame, the tiles to draw are selected by their screen-space error. Missing tiles are built on the
+    // thread pool (their parent is drawn in the meantime), tiles that were not needed for a while are released.
+    // Each resident tile is an entity with its own model and instance buffer, so it is frustum culled and drawn
+    // by the regular PBR render system.
+    class TerrainQuadtree
+    {
+
+    public:
+        struct Statistics
+        {
+            uint m_ResidentTiles{0};
+            uint m_DrawnTiles{0};
+            uint m_PendingTiles{0};
+        };
+
+    public:
+        TerrainQuadtree(Registry& registry, Terrain::TerrainSpec const& terrainSpec,
+                        std::shared_ptr<Image> const& heightMap, std::shared_ptr<InstanceBuffer> const& instanceBuffer,
+                        int instanceCount);
+        ~TerrainQuadtree();
+
+        TerrainQuadtree(const TerrainQuadtree&) = delete;
+        TerrainQuadtree& operator=(const TerrainQuadtree&) = delete;
+
+        // selects the tiles for this camera and streams tiles in and out,
+        // call once per frame after the transform cache was updated
+        void Update(Camera const& camera);
+        Statistics const& GetStatistics() const { return m_Statistics; }
+
+        // updates all chunked terrains of a registry
+        static void UpdateAll(Registry& registry, Camera const& camera);
+
+    private:
+        static constexpr int NO_CHILD = -1;
+        static constexpr uint MAX_BUILDS_IN_FLIGHT = 8;
+        // resident tiles not used for this many frames are released
+        static constexpr uint64 STREAM_OUT_FRAMES = 240;
+        // released models are kept alive until the GPU is done with them (more than the frames in flight)
+        static constexpr uint64 RETIRE_FRAMES = 4;
+
+        struct BuildResult
+        {
+            std::shared_ptr<Model> m_Model;
+            std::shared_ptr<InstanceBuffer> m_InstanceBuffer;
+            float m_GeometricError{0.0f};
+        };
+
+        struct Node
+        {
+            Terrain::ChunkArea m_Area;
+            int m_Children[4]{NO_CHILD, NO_CHILD, NO_CHILD, NO_CHILD};
+            bool m_ChildrenCreated{false};
+            AABB m_LocalBounds;
+            float m_GeometricError{0.0f};
+            uint64 m_LastUsedFrame{0};
+
+            // resident tile
+            std::shared_ptr<Model> m_Model;
+            std::shared_ptr<InstanceBuffer> m_InstanceBuffer;
+            entt::entity m_Entity{entt::null};
+            std::future<BuildResult> m_Build;
+        };
+
+        struct RetiredModel
+        {
+            uint64 m_Frame;
+            std::shared_ptr<Model> m_Model;
+            std::shared_ptr<InstanceBuffer> m_InstanceBuffer;
+        };
+
+    private:
+        Node CreateNode(int col, int row, int stride) const;
+        void CreateChildren(uint nodeIndex);
+        void UpdateInstanceMatrices();
+        void CollectBuilds();
+        void RequestBuild(uint nodeIndex);
+        void Select(uint nodeIndex);
+        float ScreenSpaceError(Node const& node) const;
+        void SetDrawn(Node& node, bool drawn);
+        void Release(Node& node);
+        void StreamOut();
+
+    private:
+        Registry& m_Registry;
+        std::shared_ptr<Image> m_HeightMap;
+        std::shared_ptr<Image> m_ColorMap;
+        std::shared_ptr<PbrMaterial> m_Material;
+        std::shared_ptr<InstanceBuffer> m_TerrainInstanceBuffer;
+        int m_InstanceCount;
+        Terrain::ChunkSpec m_ChunkSpec;
+        std::string m_Name;
+
+        std::deque<Node> m_Nodes; // stable references, index 0 is the root
+        std::vector<glm::mat4> m_InstanceMatrices;
+        std::vector<uint> m_SelectedNodes;
+        std::vector<uint> m_DrawnNodes;
+        std::vector<uint> m_PendingNodes;
+        std::deque<RetiredModel> m_RetiredModels;
+
+        uint64 m_FrameCounter{0};
+        uint m_BuildsInFlight{0};
+        glm::vec3 m_CameraPosition{0.0f};
+        bool m_Orthographic{false};
+        float m_ProjectionFactor{1.0f}; // viewport height / (2 * tan(fovy / 2))
+        Statistics m_Statistics;
+    };
+} // namespace GfxRenderEngine
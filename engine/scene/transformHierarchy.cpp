@@ -0,0 +1,226 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <future>
+#include <limits>
+
+#include "core.h"
+#include "scene/components.h"
+#include "scene/transformHierarchy.h"
+
+namespace GfxRenderEngine
+{
+    TransformHierarchy::TransformHierarchy()
+        : m_Revision{std::numeric_limits<uint64>::max()}, m_Registry{nullptr}, m_StorageChanged{true}, m_TrunkSize{0}
+    {
+    }
+
+    TransformHierarchy::~TransformHierarchy()
+    {
+        if (m_Registry)
+        {
+            m_Registry->DisconnectStorage<TransformComponent>(*this);
+        }
+    }
+
+    void TransformHierarchy::OnStorageChanged(entt::registry&, entt::entity) { m_StorageChanged.store(true); }
+
+    void TransformHierarchy::Update(SceneGraph& sceneGraph, Registry& registry)
+    {
+        if (m_Registry != &registry)
+        {
+            if (m_Registry)
+            {
+                m_Registry->DisconnectStorage<TransformComponent>(*this);
+            }
+            registry.ConnectStorage<TransformComponent, &TransformHierarchy::OnStorageChanged>(*this);
+            m_Registry = &registry;
+            m_StorageChanged.store(true);
+        }
+
+        // the flag is cleared before the rebuild, a change during the rebuild triggers another one
+        bool storageChanged = m_StorageChanged.exchange(false);
+        if ((sceneGraph.GetRevision() != m_Revision) || storageChanged)
+        {
+            Build(sceneGraph, registry);
+        }
+
+        if (m_Transforms.empty())
+        {
+            return;
+        }
+
+        UpdateRange(0, m_TrunkSize);
+
+        if (m_Ranges.size() == 1)
+        {
+            UpdateRange(m_Ranges[0].m_Begin, m_Ranges[0].m_End);
+            return;
+        }
+
+        ThreadPool& threadPool = Engine::m_Engine->m_PoolPrimary;
+        std::vector<std::future<bool>> futures;
+        futures.reserve(m_Ranges.size());
+        for (auto const& range : m_Ranges)
+        {
+            auto task = [this, range]()
+            {
+                UpdateRange(range.m_Begin, range.m_End);
+                return true;
+            };
+            futures.push_back(threadPool.SubmitTask(task));
+        }
+        for (auto& future : futures)
+        {
+            threadPool.GetResult(future);
+        }
+    }
+
+    void TransformHierarchy::UpdateRange(uint begin, uint end)
+    {
+        static glm::mat4 const identity{1.0f};
+
+        for (uint index = begin; index < end; ++index)
+        {
+            uint parent = m_Parents[index];
+            bool parentDirtyFlag = (parent != NO_PARENT) && m_DirtyFlags[parent];
+            glm::mat4 const& parentMat4 = (parent != NO_PARENT) ? m_Mat4Globals[parent] : identity;
+
+            TransformComponent* transform = m_Transforms[index];
+            if (!transform) // node without a transform (yet), pass the parent through
+            {
+                m_Mat4Globals[index] = parentMat4;
+                m_DirtyFlags[index] = parentDirtyFlag;
+                continue;
+            }
+
+            bool dirtyFlag = transform->GetDirtyFlag() || parentDirtyFlag;
+            if (dirtyFlag)
+            {
+                transform->SetMat4Global(parentMat4);
+            }
+            m_Mat4Globals[index] = transform->GetMat4Global();
+            m_DirtyFlags[index] = dirtyFlag;
+        }
+    }
+
+    void TransformHierarchy::Build(SceneGraph& sceneGraph, Registry& registry)
+    {
+        ZoneScopedN("TransformHierarchy::Build()");
+        std::lock_guard<std::mutex> guard(sceneGraph.m_MutexSceneGraph);
+
+        m_Revision = sceneGraph.m_Revision;
+        m_Parents.clear();
+        m_Transforms.clear();
+        m_Ranges.clear();
+        m_TrunkSize = 0;
+
+        auto& nodes = sceneGraph.m_Nodes;
+        uint numberOfNodes = static_cast<uint>(nodes.size());
+        if (!numberOfNodes)
+        {
+            m_Mat4Globals.clear();
+            m_DirtyFlags.clear();
+            return;
+        }
+
+        // a child is always created after its parent and has a higher node index,
+        // so one reverse sweep accumulates the subtree sizes
+        std::vector<uint> parentNodes(numberOfNodes, NO_PARENT);
+        for (uint nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex)
+        {
+            for (uint child : nodes[nodeIndex].GetChildren())
+            {
+                parentNodes[child] = nodeIndex;
+            }
+        }
+        std::vector<uint> subtreeSizes(numberOfNodes, 1);
+        for (uint nodeIndex = numberOfNodes - 1; nodeIndex > SceneGraph::ROOT_NODE; --nodeIndex)
+        {
+            if (parentNodes[nodeIndex] != NO_PARENT)
+            {
+                subtreeSizes[parentNodes[nodeIndex]] += subtreeSizes[nodeIndex];
+            }
+        }
+
+        m_Parents.reserve(subtreeSizes[SceneGraph::ROOT_NODE]);
+        m_Transforms.reserve(subtreeSizes[SceneGraph::ROOT_NODE]);
+        std::vector<uint> flatIndices(numberOfNodes, NO_PARENT);
+        auto append = [&](uint nodeIndex)
+        {
+            uint parentNode = parentNodes[nodeIndex];
+            flatIndices[nodeIndex] = static_cast<uint>(m_Transforms.size());
+            m_Parents.push_back((parentNode == NO_PARENT) ? NO_PARENT : flatIndices[parentNode]);
+            m_Transforms.push_back(registry.try_get<TransformComponent>(nodes[nodeIndex].GetGameObject()));
+        };
+
+        // trunk: nodes with subtrees too large for a single task, breadth-first
+        std::vector<uint> subtreeRoots;
+        std::vector<uint> queue{SceneGraph::ROOT_NODE};
+        for (size_t queueIndex = 0; queueIndex < queue.size(); ++queueIndex)
+        {
+            uint nodeIndex = queue[queueIndex];
+            append(nodeIndex);
+            for (uint child : nodes[nodeIndex].GetChildren())
+            {
+                if (subtreeSizes[child] > NODES_PER_TASK)
+                {
+                    queue.push_back(child);
+                }
+                else
+                {
+                    subtreeRoots.push_back(child);
+                }
+            }
+        }
+        m_TrunkSize = static_cast<uint>(m_Transforms.size());
+
+        // remaining subtrees, each breadth-first in a contiguous block,
+        // neighbouring blocks are grouped into ranges of about NODES_PER_TASK nodes
+        Range range{m_TrunkSize, m_TrunkSize};
+        for (uint subtreeRoot : subtreeRoots)
+        {
+            queue.clear();
+            queue.push_back(subtreeRoot);
+            for (size_t queueIndex = 0; queueIndex < queue.size(); ++queueIndex)
+            {
+                uint nodeIndex = queue[queueIndex];
+                append(nodeIndex);
+                queue.insert(queue.end(), nodes[nodeIndex].GetChildren().begin(), nodes[nodeIndex].GetChildren().end());
+            }
+
+            range.m_End = static_cast<uint>(m_Transforms.size());
+            if ((range.m_End - range.m_Begin) >= NODES_PER_TASK)
+            {
+                m_Ranges.push_back(range);
+                range.m_Begin = range.m_End;
+            }
+        }
+        if (range.m_End > range.m_Begin)
+        {
+            m_Ranges.push_back(range);
+        }
+
+        m_Mat4Globals.resize(m_Transforms.size());
+        m_DirtyFlags.resize(m_Transforms.size());
+    }
+} // namespace GfxRenderEngine
@@ -0,0 +1,87 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include "engine.h"
+#include "scene/registry.h"
+#include "scene/sceneGraph.h"
+
+namespace GfxRenderEngine
+{
+    class TransformComponent;
+
+    // Flattened copy of the scene graph for the per-frame transform update.
+    // Nodes are stored topologically sorted (every parent precedes its children),
+    // so the global matrices are computed in one linear pass without recursion or locking.
+    // Subtrees are laid out breadth-first in contiguous ranges that are updated in parallel.
+    class TransformHierarchy
+    {
+    public:
+        static constexpr uint NO_PARENT = -1;
+        static constexpr uint NODES_PER_TASK = 2048;
+
+    public:
+        TransformHierarchy();
+        ~TransformHierarchy();
+
+        TransformHierarchy(const TransformHierarchy&) = delete;
+        TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+
+        // rebuilds the flat arrays if the scene graph changed or transform components were
+        // constructed or destroyed, then updates all global matrices
+        void Update(SceneGraph& sceneGraph, Registry& registry);
+        uint Size() const { return static_cast<uint>(m_Transforms.size()); }
+
+    private:
+        struct Range
+        {
+            uint m_Begin;
+            uint m_End;
+        };
+
+    private:
+        void Build(SceneGraph& sceneGraph, Registry& registry);
+        void UpdateRange(uint begin, uint end);
+        void OnStorageChanged(entt::registry&, entt::entity);
+
+    private:
+        uint64 m_Revision;
+        Registry* m_Registry;
+        // set by the registry when a transform component is constructed or destroyed,
+        // destroying a component may move others, which invalidates m_Transforms
+        std::atomic<bool> m_StorageChanged;
+
+        // structure of arrays, indexed by flat node index
+        std::vector<uint> m_Parents;
+        std::vector<TransformComponent*> m_Transforms;
+        std::vector<glm::mat4> m_Mat4Globals;
+        std::vector<uchar> m_DirtyFlags;
+
+        // [0, m_TrunkSize) is updated serially, then m_Ranges in parallel
+        uint m_TrunkSize;
+        std::vector<Range> m_Ranges;
+    };
+} // namespace GfxRenderEngine
@@ -0,0 +1,177 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "core.h"
+#include "scene/components.h"
+#include "scene/dictionary.h"
+#include "scene/registry.h"
+#include "scene/sceneGraph.h"
+#include "scene/transformHierarchy.h"
+#include "scene/transformHierarchyBenchmark.h"
+
+namespace GfxRenderEngine
+{
+    namespace
+    {
+        using Clock = std::chrono::high_resolution_clock;
+
+        constexpr uint NODES_PER_GROUP = 1000;
+
+        // the update before TransformHierarchy: a recursive walk with a locked node and a registry lookup per node
+        void UpdateRecursive(SceneGraph& sceneGraph, Registry& registry, uint nodeIndex, glm::mat4 const& parentMat4,
+                             bool parentDirtyFlag)
+        {
+            auto& node = sceneGraph.GetNode(nodeIndex);
+            auto& transform = registry.get<TransformComponent>(node.GetGameObject());
+            bool dirtyFlag = transform.GetDirtyFlag() || parentDirtyFlag;
+            if (dirtyFlag)
+            {
+                transform.SetMat4Global(parentMat4);
+            }
+            glm::mat4 const& mat4Global = transform.GetMat4Global();
+            for (uint index = 0; index < node.Children(); ++index)
+            {
+                UpdateRecursive(sceneGraph, registry, node.GetChild(index), mat4Global, dirtyFlag);
+            }
+        }
+
+        // average time of one update in ms, prepare runs before each iteration
+        template <typename Update, typename Prepare> float TimeUpdate(uint iterations, Update&& update, Prepare&& prepare)
+        {
+            Clock::duration duration{0};
+            for (uint iteration = 0; iteration < iterations; ++iteration)
+            {
+                prepare(iteration);
+                auto start = Clock::now();
+                update();
+                duration += Clock::now() - start;
+            }
+            return std::chrono::duration<float, std::milli>(duration).count() / iterations;
+        }
+    } // namespace
+
+    void RunTransformHierarchyBenchmark(uint numberOfNodes, uint iterations)
+    {
+        iterations = std::max(iterations, 1u);
+        numberOfNodes = std::max(numberOfNodes, 2u);
+
+        Registry registry;
+        SceneGraph sceneGraph;
+        Dictionary dictionary;
+        std::vector<TransformComponent*> transforms;
+        transforms.reserve(numberOfNodes);
+
+        auto createEntity = [&](std::string const& name, uint parentNode) -> uint
+        {
+            entt::entity entity = registry.Create();
+            TransformComponent transform{};
+            transform.SetTranslation(glm::vec3{0.1f, 0.2f, 0.3f});
+            transform.SetRotation(glm::vec3{0.0f, 0.01f, 0.0f});
+            registry.emplace<TransformComponent>(entity, transform);
+            if (parentNode == SceneGraph::NODE_INVALID)
+            {
+                return sceneGraph.CreateRootNode(entity, name, dictionary);
+            }
+            return sceneGraph.CreateNode(parentNode, entity, name, dictionary);
+        };
+
+        // each group is a random tree: every node picks a parent among the nodes created before it in its group
+        std::mt19937 randomGenerator(0);
+        createEntity("root", SceneGraph::NODE_INVALID);
+        uint groupNode = SceneGraph::ROOT_NODE;
+        for (uint node = 1; node < numberOfNodes; ++node)
+        {
+            uint indexInGroup = (node - 1) % NODES_PER_GROUP;
+            uint parentNode = SceneGraph::ROOT_NODE;
+            if (indexInGroup)
+            {
+                std::uniform_int_distribution<uint> parentDistribution(groupNode, node - 1);
+                parentNode = parentDistribution(randomGenerator);
+            }
+            uint nodeIndex = createEntity("node" + std::to_string(node), parentNode);
+            if (!indexInGroup)
+            {
+                groupNode = nodeIndex;
+            }
+        }
+        for (uint node = 0; node < numberOfNodes; ++node)
+        {
+            transforms.push_back(&registry.get<TransformComponent>(sceneGraph.GetNode(node).GetGameObject()));
+        }
+
+        TransformHierarchy transformHierarchy;
+        auto flatUpdate = [&]() { transformHierarchy.Update(sceneGraph, registry); };
+        auto recursiveUpdate = [&]()
+        { UpdateRecursive(sceneGraph, registry, SceneGraph::ROOT_NODE, glm::mat4(1.0f), false); };
+        auto allDirty = [&](uint)
+        {
+            for (auto transform : transforms)
+            {
+                transform->SetDirtyFlag();
+            }
+        };
+        // one percent of the nodes, spread over the scene graph
+        auto someDirty = [&](uint iteration)
+        {
+            for (uint node = iteration % 100; node < numberOfNodes; node += 100)
+            {
+                transforms[node]->SetDirtyFlag();
+            }
+        };
+        auto noneDirty = [](uint) {};
+
+        // a transform component that is not in the scene graph comes and goes, the hierarchy rebuilds
+        auto start = Clock::now();
+        flatUpdate();
+        float firstUpdate = std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+        float rebuild = TimeUpdate(iterations, flatUpdate,
+                                   [&](uint)
+                                   {
+                                       entt::entity entity = registry.Create();
+                                       registry.emplace<TransformComponent>(entity);
+                                       registry.Get().destroy(entity);
+                                   });
+
+        float flatAll = TimeUpdate(iterations, flatUpdate, allDirty);
+        float flatSome = TimeUpdate(iterations, flatUpdate, someDirty);
+        float flatNone = TimeUpdate(iterations, flatUpdate, noneDirty);
+        float recursiveAll = TimeUpdate(iterations, recursiveUpdate, allDirty);
+        float recursiveSome = TimeUpdate(iterations, recursiveUpdate, someDirty);
+        float recursiveNone = TimeUpdate(iterations, recursiveUpdate, noneDirty);
+
+        LOG_CORE_INFO("transform hierarchy benchmark: {0} nodes, first update {1:.3f} ms, update with rebuild {2:.3f} ms",
+                      numberOfNodes, firstUpdate, rebuild);
+        LOG_CORE_INFO("transform hierarchy benchmark: flat: all dirty {0:.3f} ms, 1% dirty {1:.3f} ms, "
+                      "none dirty {2:.3f} ms",
+                      flatAll, flatSome, flatNone);
+        LOG_CORE_INFO("transform hierarchy benchmark: recursive: all dirty {0:.3f} ms, 1% dirty {1:.3f} ms, "
+                      "none dirty {2:.3f} ms (average of {3} updates)",
+                      recursiveAll, recursiveSome, recursiveNone, iterations);
+    }
+} // namespace GfxRenderEngine
@@ -306,3 +306,6 @@ project "lucre"
     end
 
     include "engine.lua"
+    include "tools/textureCooker.lua"
+    include "tools/unitTests.lua"
+    include "tools/terrainKernelBenchmark.lua"
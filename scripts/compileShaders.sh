@@ -25,11 +25,8 @@ glslc engine/platform/Vulkan/shaders/deferredRendering.frag                 -I.
 glslc engine/platform/Vulkan/shaders/spriteRenderer2D.vert                  -I. -o bin/spriteRenderer2D.vert.spv
 glslc engine/platform/Vulkan/shaders/spriteRenderer2D.frag                  -I. -o bin/spriteRenderer2D.frag.spv
 
-glslc engine/platform/Vulkan/shaders/guiShader.vert                         -I. -o bin/guiShader.vert.spv
-glslc engine/platform/Vulkan/shaders/guiShader.frag                         -I. -o bin/guiShader.frag.spv
-
-glslc engine/platform/Vulkan/shaders/guiShader2.vert                        -I. -o bin/guiShader2.vert.spv
-glslc engine/platform/Vulkan/shaders/guiShader2.frag                        -I. -o bin/guiShader2.frag.spv
+glslc engine/platform/Vulkan/shaders/guiBatch.vert                          -I. -o bin/guiBatch.vert.spv
+glslc engine/platform/Vulkan/shaders/guiBatch.frag                          -I. -o bin/guiBatch.frag.spv
 
 glslc engine/platform/Vulkan/shaders/skybox.vert                            -I. -o bin/skybox.vert.spv
 glslc engine/platform/Vulkan/shaders/skybox.frag                            -I. -o bin/skybox.frag.spv
@@ -0,0 +1,58 @@
+-- Team Engine 2025
+
+-- times the terrain kernels against the code they replaced, see tools/terrainKernelBenchmark/terrainKernelBenchmark.cpp
+-- run bin/<config>/terrainKernelBenchmark [size] [iterations]
+project "terrainKernelBenchmark"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++20"
+
+    targetdir "../bin/%{cfg.buildcfg}"
+    objdir ("../bin-int/%{cfg.buildcfg}/terrainKernelBenchmark")
+
+    defines
+    {
+        -- engine.h declares the profiler
+        "PROFILING"
+    }
+
+    files
+    {
+        "terrainKernelBenchmark/**.cpp",
+        "../engine/renderer/builder/terrainKernels.h",
+        "../engine/renderer/builder/terrainKernels.cpp"
+    }
+
+    includedirs
+    {
+        "../",
+        "../engine",
+        "../vendor",
+        "../vendor/glm",
+        "../vendor/spdlog/include",
+        "../vendor/tracy/include"
+    }
+
+    filter "system:linux"
+        links { "pthread" }
+
+    filter "configurations:Debug"
+        runtime "Debug"
+        symbols "on"
+
+    filter { "action:gmake*", "configurations:Debug"}
+        buildoptions { "-ggdb -Wall -Wextra -Wpedantic -Wshadow -Wno-unused-parameter" }
+
+    filter { "action:gmake*", "configurations:Release"}
+        buildoptions { "-Wall -Wextra -Wpedantic -Wshadow -Wno-unused-parameter" }
+
+    filter { "action:gmake*", "configurations:Dist"}
+        buildoptions { "-Wall -Wextra -Wpedantic -Wshadow -Wno-unused-parameter" }
+
+    filter "configurations:Release"
+        runtime "Release"
+        optimize "on"
+
+    filter { "configurations:Dist" }
+        defines { "NDEBUG" }
+        optimize "On"
@@ -0,0 +1,446 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+// Times the kernels of TerrainBuilder::PopulateTerrainData() and TerrainBuilder::ColorTerrain()
+// against the code they replaced, on synthetic height and color maps.
+// usage: terrainKernelBenchmark [size in pixels, default 4096] [iterations, default 5]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "renderer/builder/terrainKernels.h"
+
+using namespace GfxRenderEngine;
+using namespace GfxRenderEngine::TerrainKernels;
+
+namespace
+{
+    // same layout as GfxRenderEngine::Vertex (renderer/model.h), so that both paths write the same amount of memory
+    struct Vertex
+    {
+        glm::vec3 m_Position{0.0f};
+        glm::vec4 m_Color{0.0f};
+        glm::vec3 m_Normal{0.0f};
+        glm::vec2 m_UV{0.0f};
+        glm::vec3 m_Tangent{0.0f};
+        glm::ivec4 m_JointIds{0};
+        glm::vec4 m_Weights{0.0f};
+    };
+
+    struct Terrain
+    {
+        std::vector<Vertex> m_Vertices;
+        std::vector<uint> m_Indices;
+    };
+
+    float ByteToFloat(uchar byte) { return static_cast<uint>(byte) / 255.0f; }
+
+    // rolling hills with noise on top, covers the full range of slopes of an 8 bit height map
+    std::vector<uchar> CreateHeightMap(int size)
+    {
+        std::vector<uchar> heights(size * size);
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<int> noise(-8, 8);
+        for (int row = 0; row < size; ++row)
+        {
+            for (int col = 0; col < size; ++col)
+            {
+                float hills = std::sin(col * 0.011f) * std::cos(row * 0.007f) + 0.5f * std::sin((col + row) * 0.031f);
+                int height = static_cast<int>(128.0f + 80.0f * hills) + noise(generator);
+                heights[row * size + col] = static_cast<uchar>(std::clamp(height, 0, 255));
+            }
+        }
+        return heights;
+    }
+
+    std::vector<uchar> CreateColorMap(int size)
+    {
+        std::vector<uchar> rgba(size * size * 4);
+        std::mt19937 generator(7);
+        std::uniform_int_distribution<int> byte(0, 255);
+        for (auto& channel : rgba)
+        {
+            channel = static_cast<uchar>(byte(generator));
+        }
+        return rgba;
+    }
+
+    // the code before the kernels (condensed, same results), see the git history of renderer/builder/terrainBuilder.cpp
+    namespace Baseline
+    {
+        glm::vec3 CalculateNormal(uchar const* heights, int size, int col, int row)
+        {
+            if (!(col > 0 && row > 0 && col < size - 1 && row < size - 1))
+            {
+                return glm::vec3(0.0f, 1.0f, 0.0f);
+            }
+            int index = row * size + col;
+            float originY = ByteToFloat(heights[index]);
+            float leftY = ByteToFloat(heights[index - 1]);
+            float rightY = ByteToFloat(heights[index + 1]);
+            float upY = ByteToFloat(heights[index + size]);
+            float downY = ByteToFloat(heights[index - size]);
+
+            glm::vec3 left = glm::vec3(-1.0f, leftY - originY, 0.0f);
+            glm::vec3 right = glm::vec3(1.0f, rightY - originY, 0.0f);
+            glm::vec3 up = glm::vec3(0.0f, upY - originY, 1.0f);
+            glm::vec3 down = glm::vec3(0.0f, downY - originY, -1.0f);
+
+            glm::vec3 sumNormals = glm::cross(left, -down);
+            sumNormals += glm::cross(-down, right);
+            sumNormals += glm::cross(right, -up);
+            sumNormals += glm::cross(-up, left);
+            return glm::normalize(sumNormals);
+        }
+
+        void CalculateTangentsFromIndexBuffer(Terrain& terrain)
+        {
+            auto& vertices = terrain.m_Vertices;
+            auto& indices = terrain.m_Indices;
+            for (size_t index = 0; index + 2 < indices.size(); index += 3)
+            {
+                Vertex& vertex1 = vertices[indices[index]];
+                Vertex& vertex2 = vertices[indices[index + 1]];
+                Vertex& vertex3 = vertices[indices[index + 2]];
+                glm::vec3 edge1 = vertex2.m_Position - vertex1.m_Position;
+                glm::vec3 edge2 = vertex3.m_Position - vertex1.m_Position;
+                glm::vec2 deltaUV1 = vertex2.m_UV - vertex1.m_UV;
+                glm::vec2 deltaUV2 = vertex3.m_UV - vertex1.m_UV;
+
+                float determinant = deltaUV1.x * deltaUV2.y - deltaUV2.x * deltaUV1.y;
+                float factor = (determinant > std::numeric_limits<float>::epsilon()) ? 1.0f / determinant : 100000.0f;
+                glm::vec3 tangent = factor * (deltaUV2.y * edge1 - deltaUV1.y * edge2);
+                if (tangent.x == 0.0f && tangent.y == 0.0f && tangent.z == 0.0f)
+                {
+                    tangent = glm::vec3(1.0f, 0.0f, 0.0f);
+                }
+                vertex1.m_Tangent = tangent;
+                vertex2.m_Tangent = tangent;
+                vertex3.m_Tangent = tangent;
+            }
+        }
+
+        void PopulateTerrainData(uchar const* heights, int size, Terrain& terrain)
+        {
+            terrain.m_Vertices.resize(size * size);
+            int vertexCounter = 0;
+            for (int row = 0; row < size; ++row)
+            {
+                for (int col = 0; col < size; ++col)
+                {
+                    Vertex& vertex = terrain.m_Vertices[vertexCounter];
+                    float originY = ByteToFloat(heights[vertexCounter]);
+                    vertex.m_Position = glm::vec3(col, originY, row);
+                    vertex.m_Color = glm::vec4(0.f, 0.f, originY / 3.0f, 1.0f);
+                    vertex.m_Normal = CalculateNormal(heights, size, col, row);
+                    ++vertexCounter;
+                }
+            }
+
+            terrain.m_Indices.resize(size * size * 6);
+            int index = 0;
+            for (int row = 0; row < size - 1; ++row)
+            {
+                for (int col = 0; col < size - 1; ++col)
+                {
+                    uint topLeft = row * size + col;
+                    uint topRight = topLeft + 1;
+                    uint bottomLeft = (row + 1) * size + col;
+                    uint bottomRight = bottomLeft + 1;
+                    terrain.m_Indices[index++] = topLeft;
+                    terrain.m_Indices[index++] = bottomLeft;
+                    terrain.m_Indices[index++] = topRight;
+                    terrain.m_Indices[index++] = topRight;
+                    terrain.m_Indices[index++] = bottomLeft;
+                    terrain.m_Indices[index++] = bottomRight;
+                }
+            }
+            CalculateTangentsFromIndexBuffer(terrain);
+        }
+
+        void ColorTerrain(uchar const* rgba, int size, Terrain& terrain)
+        {
+            uint const* imageData = reinterpret_cast<uint const*>(rgba);
+            for (int pixel = 0; pixel < size * size; ++pixel)
+            {
+                uint abgr = imageData[pixel];
+                terrain.m_Vertices[pixel].m_Color =
+                    glm::vec4((0xff & (abgr >> 0)) / 255.0f, (0xff & (abgr >> 8)) / 255.0f, (0xff & (abgr >> 16)) / 255.0f,
+                              (0xff & (abgr >> 24)) / 255.0f);
+            }
+        }
+    } // namespace Baseline
+
+    // TerrainBuilder::PopulateTerrainData() and TerrainBuilder::ColorTerrain(), without the engine's thread pool
+    namespace Kernels
+    {
+        // ranges of 64 rows as in TerrainBuilder, taken from a shared counter by 'threads' workers
+        void ParallelForRows(int rows, int threads, std::function<void(int, int)> const& function)
+        {
+            constexpr int ROWS_PER_TASK = 64;
+            std::atomic<int> nextRow{0};
+            auto worker = [&]()
+            {
+                for (int begin = nextRow.fetch_add(ROWS_PER_TASK); begin < rows; begin = nextRow.fetch_add(ROWS_PER_TASK))
+                {
+                    function(begin, std::min(begin + ROWS_PER_TASK, rows));
+                }
+            };
+            std::vector<std::thread> workers;
+            for (int thread = 1; thread < threads; ++thread)
+            {
+                workers.emplace_back(worker);
+            }
+            worker();
+            for (auto& thread : workers)
+            {
+                thread.join();
+            }
+        }
+
+        void PopulateTerrainData(uchar const* heights, int size, Terrain& terrain, InstructionSet instructionSet,
+                                 int threads)
+        {
+            int cols = size;
+            int rows = size;
+            terrain.m_Vertices.resize(rows * cols);
+            terrain.m_Indices.resize((rows - 1) * (cols - 1) * 6);
+            auto populateRows = [&](int begin, int end)
+            {
+                RowScratch scratch;
+                scratch.Resize(cols);
+                for (int row = begin; row < end; ++row)
+                {
+                    uchar const* center = heights + row * cols;
+                    if ((row > 0) && (row < rows - 1) && (cols > 2))
+                    {
+                        NormalsAndTangentsOfRow(center - cols, center, center + cols, cols, scratch, instructionSet);
+                        FlatNormalsAndTangents(0, 1, scratch);
+                        FlatNormalsAndTangents(cols - 1, cols, scratch);
+                    }
+                    else
+                    {
+                        FlatNormalsAndTangents(0, cols, scratch);
+                    }
+
+                    Vertex* vertices = &terrain.m_Vertices[row * cols];
+                    for (int col = 0; col < cols; ++col)
+                    {
+                        Vertex& vertex = vertices[col];
+                        float originY = ByteToFloat(center[col]);
+                        vertex.m_Position = glm::vec3(col, originY, row);
+                        vertex.m_Color = glm::vec4(0.f, 0.f, originY / 3.0f, 1.0f);
+                        vertex.m_Normal = glm::vec3(scratch.m_NormalX[col], scratch.m_NormalY[col], scratch.m_NormalZ[col]);
+                        vertex.m_Tangent = glm::vec3(scratch.m_TangentX[col], scratch.m_TangentY[col], 0.0f);
+                    }
+
+                    if (row < rows - 1)
+                    {
+                        uint* indices = &terrain.m_Indices[row * (cols - 1) * 6];
+                        for (int col = 0; col < cols - 1; ++col)
+                        {
+                            uint topLeft = row * cols + col;
+                            uint topRight = topLeft + 1;
+                            uint bottomLeft = (row + 1) * cols + col;
+                            uint bottomRight = bottomLeft + 1;
+                            *indices++ = topLeft;
+                            *indices++ = bottomLeft;
+                            *indices++ = topRight;
+                            *indices++ = topRight;
+                            *indices++ = bottomLeft;
+                            *indices++ = bottomRight;
+                        }
+                    }
+                }
+            };
+            ParallelForRows(rows, threads, populateRows);
+        }
+
+        void ColorTerrain(uchar const* rgba, int size, Terrain& terrain, InstructionSet instructionSet, int threads)
+        {
+            auto colorRows = [&](int begin, int end)
+            {
+                for (int row = begin; row < end; ++row)
+                {
+                    float* colors = &terrain.m_Vertices[row * size].m_Color[0];
+                    UnpackColorsOfRow(rgba + row * size * 4, size, colors, sizeof(Vertex), instructionSet);
+                }
+            };
+            ParallelForRows(size, threads, colorRows);
+        }
+    } // namespace Kernels
+
+    // fastest of 'iterations' runs in milliseconds
+    double Time(int iterations, std::function<void()> const& function)
+    {
+        double best = std::numeric_limits<double>::max();
+        for (int iteration = 0; iteration < iterations; ++iteration)
+        {
+            auto start = std::chrono::steady_clock::now();
+            function();
+            std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+            best = std::min(best, duration.count());
+        }
+        return best;
+    }
+
+    void Print(std::string const& name, double milliseconds, double baseline)
+    {
+        std::cout << "  " << std::left << std::setw(40) << name << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(10) << milliseconds << " ms" << std::setw(9) << std::setprecision(1)
+                  << baseline / milliseconds << "x\n";
+    }
+
+    std::string Label(InstructionSet instructionSet, int threads)
+    {
+        return std::string("kernels, ") + GetInstructionSetName(instructionSet) + ", " + std::to_string(threads) +
+               ((threads == 1) ? " thread" : " threads");
+    }
+
+    template <typename VectorType>
+    float MaxDifference(Terrain const& terrain, Terrain const& reference, VectorType Vertex::* member)
+    {
+        float maxDifference = 0.0f;
+        for (size_t index = 0; index < terrain.m_Vertices.size(); ++index)
+        {
+            VectorType difference = glm::abs(terrain.m_Vertices[index].*member - reference.m_Vertices[index].*member);
+            for (int component = 0; component < VectorType::length(); ++component)
+            {
+                maxDifference = std::max(maxDifference, difference[component]);
+            }
+        }
+        return maxDifference;
+    }
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    int size = (argc > 1) ? std::stoi(argv[1]) : 4096;
+    int iterations = (argc > 2) ? std::stoi(argv[2]) : 5;
+    int threads = std::max(1u, std::thread::hardware_concurrency());
+    if (size < 3 || iterations < 1)
+    {
+        std::cout << "usage: terrainKernelBenchmark [size in pixels, default 4096] [iterations, default 5]\n";
+        return 1;
+    }
+
+    std::vector<uchar> heights = CreateHeightMap(size);
+    std::vector<uchar> rgba = CreateColorMap(size);
+    std::vector<InstructionSet> instructionSets{InstructionSet::Scalar};
+    if (GetInstructionSet() != InstructionSet::Scalar)
+    {
+        instructionSets.push_back(InstructionSet::SSE2);
+    }
+    if (GetInstructionSet() == InstructionSet::AVX2)
+    {
+        instructionSets.push_back(InstructionSet::AVX2);
+    }
+
+    std::cout << size << "x" << size << " height map, best of " << iterations << ", " << threads
+              << " thread(s), dispatched to " << GetInstructionSetName(GetInstructionSet()) << "\n";
+
+    { // the row kernel alone
+        std::cout << "normals and tangents of all rows:\n";
+        RowScratch scratch;
+        scratch.Resize(size);
+        auto allRows = [&](InstructionSet instructionSet)
+        {
+            for (int row = 1; row < size - 1; ++row)
+            {
+                uchar const* center = heights.data() + row * size;
+                NormalsAndTangentsOfRow(center - size, center, center + size, size, scratch, instructionSet);
+            }
+        };
+        double scalar = Time(iterations, [&]() { allRows(InstructionSet::Scalar); });
+        for (auto instructionSet : instructionSets)
+        {
+            Print(GetInstructionSetName(instructionSet), Time(iterations, [&]() { allRows(instructionSet); }), scalar);
+        }
+
+        std::cout << "color unpacking of all rows (into contiguous vec4):\n";
+        std::vector<float> color(size * 4);
+        auto allColors = [&](InstructionSet instructionSet)
+        {
+            for (int row = 0; row < size; ++row)
+            {
+                UnpackColorsOfRow(rgba.data() + row * size * 4, size, color.data(), sizeof(glm::vec4), instructionSet);
+            }
+        };
+        scalar = Time(iterations, [&]() { allColors(InstructionSet::Scalar); });
+        for (auto instructionSet : instructionSets)
+        {
+            Print(GetInstructionSetName(instructionSet), Time(iterations, [&]() { allColors(instructionSet); }), scalar);
+        }
+    }
+
+    Terrain reference;
+    Terrain terrain;
+    { // vertices and indices, as TerrainBuilder::PopulateTerrainData()
+        std::cout << "PopulateTerrainData:\n";
+        double baseline = Time(iterations, [&]() { Baseline::PopulateTerrainData(heights.data(), size, reference); });
+        Print("baseline (cross products, tangent pass)", baseline, baseline);
+        for (auto instructionSet : instructionSets)
+        {
+            auto populate = [&]() { Kernels::PopulateTerrainData(heights.data(), size, terrain, instructionSet, 1); };
+            Print(Label(instructionSet, 1), Time(iterations, populate), baseline);
+        }
+        auto populate = [&]()
+        { Kernels::PopulateTerrainData(heights.data(), size, terrain, GetInstructionSet(), threads); };
+        if (threads > 1)
+        {
+            Print(Label(GetInstructionSet(), threads), Time(iterations, populate), baseline);
+        }
+        std::cout << "  max normal difference to baseline: " << std::scientific << std::setprecision(2)
+                  << MaxDifference(terrain, reference, &Vertex::m_Normal) << "\n";
+    }
+
+    { // vertex colors, as TerrainBuilder::ColorTerrain()
+        std::cout << "ColorTerrain:\n";
+        double baseline = Time(iterations, [&]() { Baseline::ColorTerrain(rgba.data(), size, reference); });
+        Print("baseline (per pixel)", baseline, baseline);
+        for (auto instructionSet : instructionSets)
+        {
+            auto color = [&]() { Kernels::ColorTerrain(rgba.data(), size, terrain, instructionSet, 1); };
+            Print(Label(instructionSet, 1), Time(iterations, color), baseline);
+        }
+        auto color = [&]() { Kernels::ColorTerrain(rgba.data(), size, terrain, GetInstructionSet(), threads); };
+        if (threads > 1)
+        {
+            Print(Label(GetInstructionSet(), threads), Time(iterations, color), baseline);
+        }
+        std::cout << "  max color difference to baseline: " << std::scientific << std::setprecision(2)
+                  << MaxDifference(terrain, reference, &Vertex::m_Color) << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,62 @@
+
+-- Team Engine 2025
+
+-- offline texture cooker, see tools/textureCooker/textureCooker.cpp
+project "textureCooker"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++20"
+
+    targetdir "../bin/%{cfg.buildcfg}"
+    objdir ("../bin-int/%{cfg.buildcfg}/textureCooker")
+
+    defines
+    {
+        -- engine.h declares the profiler
+        "PROFILING"
+    }
+
+    files
+    {
+        "textureCooker/**.cpp",
+        "../engine/auxiliary/memoryMappedFile.h",
+        "../engine/auxiliary/memoryMappedFile.cpp",
+        "../engine/renderer/blockCompression.h",
+        "../engine/renderer/blockCompression.cpp",
+        "../engine/renderer/cookedTexture.h",
+        "../engine/renderer/cookedTexture.cpp",
+        "../vendor/stb/stb_image.cpp",
+        "../vendor/tinyexr/tinyexr.cpp"
+    }
+
+    includedirs
+    {
+        "../",
+        "../engine",
+        "../vendor",
+        "../vendor/stb",
+        "../vendor/glm",
+        "../vendor/spdlog/include",
+        "../vendor/tracy/include"
+    }
+
+    filter "configurations:Debug"
+        runtime "Debug"
+        symbols "on"
+
+    filter { "action:gmake*", "configurations:Debug"}
+        buildoptions { "-ggdb -Wall -Wextra -Wpedantic -Wshadow -Wno-unused-parameter" }
+
+    filter { "action:gmake*", "configurations:Release"}
+        buildoptions { "-Wall -Wextra -Wpedantic -Wshadow -Wno-unused-parameter" }
+
+    filter { "action:gmake*", "configurations:Dist"}
+        buildoptions { "-Wall -Wextra -Wpedantic -Wshadow -Wno-unused-parameter" }
+
+    filter "configurations:Release"
+        runtime "Release"
+        optimize "on"
+
+    filter { "configurations:Dist" }
+        defines { "NDEBUG" }
+        optimize "On"
@@ -0,0 +1,697 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+// textureCooker: converts images to cooked textures (see engine/renderer/cookedTexture.h)
+//
+// usage: textureCooker [--format auto|bc1|bc3|bc4|bc5|bc7|bc6h] [--linear] [--no-flip] [--output file] image...
+//        textureCooker --mip-chain [--output file] level0 level1 ...
+//        textureCooker --gltf [--format auto|bc1|bc3|bc7] model...
+//
+// PNG, JPEG, TGA, ... are block compressed, by default to BC1 if opaque and BC3 otherwise. The full mip chain
+// is generated with a box filter, in linear space unless --linear is passed for non-color data such as normal
+// or roughness maps. The output is written next to the input, "texture.png" becomes "texture.png.ctex".
+// VK_Texture picks it up in place of the source image when it is loaded with the same flip setting
+// and the source image has not changed since it was cooked. Images referenced by glTF files are
+// loaded without flipping, cook them with --no-flip.
+//
+// HDR and EXR images are compressed to BC6H with a single level and are never flipped, as IBLBuilder loads them.
+// --mip-chain packs pre-filtered HDR levels (e.g. the specular levels of an environment map) into one cooked
+// texture next to the first level. --gltf cooks the images embedded in .glb and .gltf files (buffer views and
+// data URIs), "model.glb" with image 2 becomes "model.glb.image2.ctex". Base color and emissive images are
+// filtered as sRGB, all others as linear.
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "stb_image.h"
+#include "tinyexr/tinyexr.h"
+#include "json/json.hpp"
+
+#include "renderer/blockCompression.h"
+#include "renderer/cookedTexture.h"
+
+namespace GfxRenderEngine
+{
+    namespace
+    {
+        struct Options
+        {
+            std::string m_Format{"auto"};
+            std::string m_Output;
+            bool m_Linear{false};
+            bool m_Flip{true};
+            bool m_MipChain{false};
+            bool m_Gltf{false};
+        };
+
+        template <typename T>
+        struct Image
+        {
+            uint m_Width{0};
+            uint m_Height{0};
+            std::vector<T> m_Texels; // RGBA
+        };
+
+        float SRGBToLinear(float value)
+        {
+            return (value <= 0.04045f) ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+        }
+
+        float LinearToSRGB(float value)
+        {
+            return (value <= 0.0031308f) ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+        }
+
+        // 2x2 box filter, odd edges are clamped
+        template <typename T, typename Decode, typename Encode>
+        Image<T> Downsample(Image<T> const& source, Decode decode, Encode encode)
+        {
+            Image<T> destination;
+            destination.m_Width = std::max(1u, source.m_Width / 2);
+            destination.m_Height = std::max(1u, source.m_Height / 2);
+            destination.m_Texels.resize(size_t(destination.m_Width) * destination.m_Height * 4);
+            for (uint y = 0; y < destination.m_Height; ++y)
+            {
+                uint y0 = std::min(y * 2, source.m_Height - 1);
+                uint y1 = std::min(y * 2 + 1, source.m_Height - 1);
+                for (uint x = 0; x < destination.m_Width; ++x)
+                {
+                    uint x0 = std::min(x * 2, source.m_Width - 1);
+                    uint x1 = std::min(x * 2 + 1, source.m_Width - 1);
+                    for (uint channel = 0; channel < 4; ++channel)
+                    {
+                        auto texel = [&](uint sourceX, uint sourceY)
+                        { return source.m_Texels[(size_t(sourceY) * source.m_Width + sourceX) * 4 + channel]; };
+                        // alpha is never gamma encoded
+                        bool color = channel < 3;
+                        float sum = decode(texel(x0, y0), color) + decode(texel(x1, y0), color) +
+                                    decode(texel(x0, y1), color) + decode(texel(x1, y1), color);
+                        destination.m_Texels[(size_t(y) * destination.m_Width + x) * 4 + channel] =
+                            encode(sum * 0.25f, color);
+                    }
+                }
+            }
+            return destination;
+        }
+
+        template <typename T>
+        void FlipVertically(Image<T>& image)
+        {
+            size_t rowSize = size_t(image.m_Width) * 4;
+            for (uint y = 0; y < image.m_Height / 2; ++y)
+            {
+                std::swap_ranges(image.m_Texels.begin() + y * rowSize, image.m_Texels.begin() + (y + 1) * rowSize,
+                                 image.m_Texels.begin() + (image.m_Height - 1 - y) * rowSize);
+            }
+        }
+
+        bool IsHighDynamicRange(std::string const& filename)
+        {
+            std::string extension = filename.substr(std::min(filename.size(), filename.find_last_of('.')));
+            std::transform(extension.begin(), extension.end(), extension.begin(),
+                           [](unsigned char c) { return tolower(c); });
+            return (extension == ".hdr") || (extension == ".exr");
+        }
+
+        // the same decoders as HiResImage
+        bool LoadHighDynamicRange(std::string const& filename, Image<float>& image)
+        {
+            float* buffer = nullptr;
+            int width = 0, height = 0;
+            if (filename.ends_with(".exr") || filename.ends_with(".EXR"))
+            {
+                const char* error = nullptr;
+                if ((LoadEXR(&buffer, &width, &height, filename.c_str(), &error) != TINYEXR_SUCCESS) || !buffer)
+                {
+                    std::cerr << "textureCooker: TinyEXR failed to load " << filename << ": " << (error ? error : "")
+                              << '\n';
+                    FreeEXRErrorMessage(error);
+                    return false;
+                }
+                image.m_Texels.assign(buffer, buffer + size_t(width) * height * 4);
+                free(buffer);
+            }
+            else
+            {
+                int channels = 0;
+                stbi_set_flip_vertically_on_load(false);
+                buffer = stbi_loadf(filename.c_str(), &width, &height, &channels, 4);
+                if (!buffer)
+                {
+                    std::cerr << "textureCooker: stb_image failed to load " << filename << ": " << stbi_failure_reason()
+                              << '\n';
+                    return false;
+                }
+                image.m_Texels.assign(buffer, buffer + size_t(width) * height * 4);
+                stbi_image_free(buffer);
+            }
+            image.m_Width = static_cast<uint>(width);
+            image.m_Height = static_cast<uint>(height);
+            return true;
+        }
+
+        // filenames: one image, or the pre-filtered levels of one texture, largest first
+        bool CookHighDynamicRange(std::vector<std::string> const& filenames, std::string const& output,
+                                  Options const& options)
+        {
+            if ((options.m_Format != "auto") && (options.m_Format != "bc6h"))
+            {
+                std::cerr << "textureCooker: format " << options.m_Format << " not supported for " << filenames[0]
+                          << '\n';
+                return false;
+            }
+            if (filenames.size() > CookedTexture::MAX_LEVELS)
+            {
+                std::cerr << "textureCooker: too many levels for " << filenames[0] << '\n';
+                return false;
+            }
+
+            uint width = 0, height = 0;
+            std::vector<std::vector<uchar>> levels;
+            for (auto const& filename : filenames)
+            {
+                Image<float> image;
+                if (!LoadHighDynamicRange(filename, image))
+                {
+                    return false;
+                }
+                if (levels.empty())
+                {
+                    width = image.m_Width;
+                    height = image.m_Height;
+                }
+                uint levelWidth = std::max(1u, width >> levels.size());
+                uint levelHeight = std::max(1u, height >> levels.size());
+                if ((image.m_Width != levelWidth) || (image.m_Height != levelHeight))
+                {
+                    std::cerr << "textureCooker: " << filename << " is " << image.m_Width << "x" << image.m_Height
+                              << ", expected " << levelWidth << "x" << levelHeight << " for level " << levels.size()
+                              << '\n';
+                    return false;
+                }
+                levels.push_back(BlockCompression::CompressBC6H(image.m_Texels.data(), image.m_Width, image.m_Height));
+            }
+
+            uint64 sourceHash = (filenames.size() == 1) ? CookedTexture::HashSource(filenames[0])
+                                                        : CookedTexture::HashSource(filenames);
+            CookedTexture::Format format = CookedTexture::Format::BC6H;
+            if (!CookedTexture::Write(output, format, width, height, 0 /*flags*/, sourceHash, levels))
+            {
+                return false;
+            }
+            std::cout << filenames[0] << ": " << width << "x" << height << ", " << levels.size() << " levels, "
+                      << CookedTexture::FormatToString(format) << '\n';
+            return true;
+        }
+
+        CookedTexture::Format SelectFormat(Image<uchar> const& image, std::string const& format)
+        {
+            if (format == "bc1")
+            {
+                return CookedTexture::Format::BC1;
+            }
+            if (format == "bc3")
+            {
+                return CookedTexture::Format::BC3;
+            }
+            if (format == "bc4")
+            {
+                return CookedTexture::Format::BC4;
+            }
+            if (format == "bc5")
+            {
+                return CookedTexture::Format::BC5;
+            }
+            if (format == "bc7")
+            {
+                return CookedTexture::Format::BC7;
+            }
+            if (format != "auto")
+            {
+                return CookedTexture::Format::UNDEFINED;
+            }
+            for (size_t index = 3; index < image.m_Texels.size(); index += 4)
+            {
+                if (image.m_Texels[index] != 255)
+                {
+                    return CookedTexture::Format::BC3;
+                }
+            }
+            return CookedTexture::Format::BC1;
+        }
+
+        // the image is expected to be flipped already if options.m_Flip is set
+        bool CookLowDynamicRange(Image<uchar> image, std::string const& name, std::string const& output,
+                                 Options const& options, uint64 sourceHash)
+        {
+            CookedTexture::Format format = SelectFormat(image, options.m_Format);
+            if (format == CookedTexture::Format::UNDEFINED)
+            {
+                std::cerr << "textureCooker: format " << options.m_Format << " not supported for " << name << '\n';
+                return false;
+            }
+            uint width = image.m_Width;
+            uint height = image.m_Height;
+
+            // a lookup table for the hot path, the mip chain of a 4k texture decodes about 90 million values
+            std::vector<float> toLinear(256);
+            for (uint value = 0; value < 256; ++value)
+            {
+                float normalized = value / 255.0f;
+                toLinear[value] = options.m_Linear ? normalized : SRGBToLinear(normalized);
+            }
+            bool linear = options.m_Linear;
+            auto decode = [&](uchar value, bool color) { return color ? toLinear[value] : value / 255.0f; };
+            auto encode = [linear](float value, bool color)
+            {
+                float encoded = (color && !linear) ? LinearToSRGB(value) : value;
+                return static_cast<uchar>(std::clamp(encoded * 255.0f + 0.5f, 0.0f, 255.0f));
+            };
+
+            std::vector<std::vector<uchar>> levels;
+            while (true)
+            {
+                levels.push_back(BlockCompression::Compress(format, image.m_Texels.data(), image.m_Width, image.m_Height));
+                if ((image.m_Width == 1) && (image.m_Height == 1))
+                {
+                    break;
+                }
+                image = Downsample(image, decode, encode);
+            }
+
+            uint flags = options.m_Flip ? CookedTexture::FLAG_FLIPPED : 0;
+            if (!CookedTexture::Write(output, format, width, height, flags, sourceHash, levels))
+            {
+                return false;
+            }
+            std::cout << name << ": " << width << "x" << height << ", " << levels.size() << " levels, "
+                      << CookedTexture::FormatToString(format) << '\n';
+            return true;
+        }
+
+        bool CookFile(std::string const& filename, std::string const& output, Options const& options)
+        {
+            if (options.m_Format == "bc6h")
+            {
+                std::cerr << "textureCooker: format bc6h requires an HDR or EXR image: " << filename << '\n';
+                return false;
+            }
+            stbi_set_flip_vertically_on_load(options.m_Flip);
+            int width = 0, height = 0, channels = 0;
+            uchar* buffer = stbi_load(filename.c_str(), &width, &height, &channels, 4);
+            if (!buffer)
+            {
+                std::cerr << "textureCooker: stb_image failed to load " << filename << ": " << stbi_failure_reason()
+                          << '\n';
+                return false;
+            }
+            Image<uchar> image;
+            image.m_Width = static_cast<uint>(width);
+            image.m_Height = static_cast<uint>(height);
+            image.m_Texels.assign(buffer, buffer + size_t(width) * height * 4);
+            stbi_image_free(buffer);
+
+            return CookLowDynamicRange(std::move(image), filename, output, options, CookedTexture::HashSource(filename));
+        }
+
+        bool ReadFile(std::filesystem::path const& filename, std::vector<uchar>& data)
+        {
+            std::ifstream file(filename, std::ios::binary);
+            if (!file)
+            {
+                return false;
+            }
+            data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            return true;
+        }
+
+        // "data:image/png;base64,..."
+        bool DecodeDataUri(std::string const& uri, std::vector<uchar>& data)
+        {
+            size_t separator = uri.find(";base64,");
+            if (!uri.starts_with("data:") || (separator == std::string::npos))
+            {
+                return false;
+            }
+            auto decodeCharacter = [](char character) -> int
+            {
+                if ((character >= 'A') && (character <= 'Z'))
+                {
+                    return character - 'A';
+                }
+                if ((character >= 'a') && (character <= 'z'))
+                {
+                    return character - 'a' + 26;
+                }
+                if ((character >= '0') && (character <= '9'))
+                {
+                    return character - '0' + 52;
+                }
+                if (character == '+')
+                {
+                    return 62;
+                }
+                if (character == '/')
+                {
+                    return 63;
+                }
+                return -1;
+            };
+            data.clear();
+            uint bits = 0, bitCount = 0;
+            for (size_t index = separator + 8; index < uri.size(); ++index)
+            {
+                int value = decodeCharacter(uri[index]);
+                if (value < 0)
+                {
+                    break; // padding
+                }
+                bits = (bits << 6) | static_cast<uint>(value);
+                bitCount += 6;
+                if (bitCount >= 8)
+                {
+                    bitCount -= 8;
+                    data.push_back(static_cast<uchar>((bits >> bitCount) & 0xff));
+                }
+            }
+            return true;
+        }
+
+        // cooks the images stored in a glTF file, external image files are cooked on their own with --no-flip
+        bool CookGltfImages(std::string const& filename, Options const& options)
+        {
+            std::vector<uchar> file;
+            if (!ReadFile(filename, file))
+            {
+                std::cerr << "textureCooker: couldn't read " << filename << '\n';
+                return false;
+            }
+
+            // a .glb is a header and chunks: the JSON and, optionally, the binary buffer 0
+            std::string json;
+            std::vector<uchar> binaryChunk;
+            constexpr uint GLB_MAGIC = 0x46546c67;       // "glTF"
+            constexpr uint GLB_CHUNK_JSON = 0x4e4f534a;  // "JSON"
+            constexpr uint GLB_CHUNK_BINARY = 0x004e4942; // "BIN"
+            auto readUint = [&](size_t offset)
+            {
+                uint value = 0;
+                memcpy(&value, file.data() + offset, sizeof(uint));
+                return value;
+            };
+            if ((file.size() >= 12) && (readUint(0) == GLB_MAGIC))
+            {
+                size_t offset = 12;
+                while (offset + 8 <= file.size())
+                {
+                    uint chunkLength = readUint(offset);
+                    uint chunkType = readUint(offset + 4);
+                    offset += 8;
+                    if (chunkLength > file.size() - offset)
+                    {
+                        std::cerr << "textureCooker: truncated chunk in " << filename << '\n';
+                        return false;
+                    }
+                    if (chunkType == GLB_CHUNK_JSON)
+                    {
+                        json.assign(reinterpret_cast<char const*>(file.data() + offset), chunkLength);
+                    }
+                    else if (chunkType == GLB_CHUNK_BINARY)
+                    {
+                        binaryChunk.assign(file.data() + offset, file.data() + offset + chunkLength);
+                    }
+                    offset += chunkLength;
+                }
+            }
+            else
+            {
+                json.assign(file.begin(), file.end());
+            }
+
+            nlohmann::json gltf = nlohmann::json::parse(json, nullptr, false);
+            if (gltf.is_discarded())
+            {
+                std::cerr << "textureCooker: couldn't parse " << filename << '\n';
+                return false;
+            }
+            if (!gltf.contains("images"))
+            {
+                std::cout << filename << ": no images\n";
+                return true;
+            }
+
+            // buffers are loaded on demand
+            std::filesystem::path directory = std::filesystem::path(filename).parent_path();
+            nlohmann::json const& buffers = gltf.value("buffers", nlohmann::json::array());
+            std::vector<std::vector<uchar>> bufferData(buffers.size());
+            std::vector<bool> bufferLoaded(buffers.size(), false);
+            auto getBuffer = [&](size_t bufferIndex) -> std::vector<uchar> const*
+            {
+                if (bufferIndex >= buffers.size())
+                {
+                    return nullptr;
+                }
+                if (!bufferLoaded[bufferIndex])
+                {
+                    bufferLoaded[bufferIndex] = true;
+                    std::string uri = buffers[bufferIndex].value("uri", "");
+                    if (uri.empty())
+                    {
+                        bufferData[bufferIndex] = binaryChunk;
+                    }
+                    else if (!DecodeDataUri(uri, bufferData[bufferIndex]) &&
+                             !ReadFile(directory / uri, bufferData[bufferIndex]))
+                    {
+                        std::cerr << "textureCooker: couldn't load buffer " << uri << '\n';
+                    }
+                }
+                return &bufferData[bufferIndex];
+            };
+
+            // base color and emissive images are color data, see FastgltfBuilder::GetImageFormat()
+            nlohmann::json const& textures = gltf.value("textures", nlohmann::json::array());
+            std::set<size_t> colorImages;
+            auto addColorImage = [&](nlohmann::json const& textureInfo)
+            {
+                size_t textureIndex = textureInfo.value("index", size_t(0));
+                if ((textureIndex < textures.size()) && textures[textureIndex].contains("source"))
+                {
+                    colorImages.insert(textures[textureIndex]["source"].get<size_t>());
+                }
+            };
+            for (auto const& material : gltf.value("materials", nlohmann::json::array()))
+            {
+                if (material.contains("pbrMetallicRoughness") &&
+                    material["pbrMetallicRoughness"].contains("baseColorTexture"))
+                {
+                    addColorImage(material["pbrMetallicRoughness"]["baseColorTexture"]);
+                }
+                if (material.contains("emissiveTexture"))
+                {
+                    addColorImage(material["emissiveTexture"]);
+                }
+            }
+
+            nlohmann::json const& bufferViews = gltf.value("bufferViews", nlohmann::json::array());
+            nlohmann::json const& images = gltf["images"];
+            bool ok = true;
+            for (uint imageIndex = 0; imageIndex < images.size(); ++imageIndex)
+            {
+                nlohmann::json const& gltfImage = images[imageIndex];
+                std::string name = filename + " image " + std::to_string(imageIndex);
+                std::vector<uchar> dataUri;
+                uchar const* data = nullptr;
+                size_t size = 0;
+                if (gltfImage.contains("bufferView"))
+                {
+                    size_t bufferViewIndex = gltfImage["bufferView"].get<size_t>();
+                    if (bufferViewIndex >= bufferViews.size())
+                    {
+                        std::cerr << "textureCooker: invalid buffer view for " << name << '\n';
+                        ok = false;
+                        continue;
+                    }
+                    nlohmann::json const& bufferView = bufferViews[bufferViewIndex];
+                    std::vector<uchar> const* buffer = getBuffer(bufferView.value("buffer", size_t(0)));
+                    size_t byteOffset = bufferView.value("byteOffset", size_t(0));
+                    size = bufferView.value("byteLength", size_t(0));
+                    if (!buffer || (byteOffset > buffer->size()) || (size > buffer->size() - byteOffset))
+                    {
+                        std::cerr << "textureCooker: invalid buffer view for " << name << '\n';
+                        ok = false;
+                        continue;
+                    }
+                    data = buffer->data() + byteOffset;
+                }
+                else if (DecodeDataUri(gltfImage.value("uri", ""), dataUri))
+                {
+                    data = dataUri.data();
+                    size = dataUri.size();
+                }
+                else
+                {
+                    std::cout << name << ": external file " << gltfImage.value("uri", "")
+                              << ", cook it with --no-flip\n";
+                    continue;
+                }
+
+                // embedded images are loaded without flipping
+                stbi_set_flip_vertically_on_load(false);
+                int width = 0, height = 0, channels = 0;
+                uchar* buffer = stbi_load_from_memory(data, static_cast<int>(size), &width, &height, &channels, 4);
+                if (!buffer)
+                {
+                    std::cerr << "textureCooker: stb_image failed to load " << name << ": " << stbi_failure_reason()
+                              << '\n';
+                    ok = false;
+                    continue;
+                }
+                Image<uchar> image;
+                image.m_Width = static_cast<uint>(width);
+                image.m_Height = static_cast<uint>(height);
+                image.m_Texels.assign(buffer, buffer + size_t(width) * height * 4);
+                stbi_image_free(buffer);
+
+                Options imageOptions = options;
+                imageOptions.m_Flip = false;
+                imageOptions.m_Linear = !colorImages.contains(imageIndex);
+                std::string output = CookedTexture::GetCookedFilename(filename, imageIndex);
+                if (!CookLowDynamicRange(std::move(image), name, output, imageOptions, CookedTexture::HashData(data, size)))
+                {
+                    ok = false;
+                }
+            }
+            return ok;
+        }
+
+        void PrintUsage()
+        {
+            std::cout << "usage: textureCooker [--format auto|bc1|bc3|bc4|bc5|bc7|bc6h] [--linear] [--no-flip] "
+                         "[--output file] image...\n"
+                         "       textureCooker --mip-chain [--output file] level0 level1 ...\n"
+                         "       textureCooker --gltf [--format auto|bc1|bc3|bc7] model...\n";
+        }
+    } // namespace
+} // namespace GfxRenderEngine
+
+int main(int argc, char* argv[])
+{
+    using namespace GfxRenderEngine;
+
+    Options options;
+    std::vector<std::string> inputs;
+    for (int index = 1; index < argc; ++index)
+    {
+        std::string argument{argv[index]};
+        if ((argument == "--format") && (index + 1 < argc))
+        {
+            options.m_Format = argv[++index];
+        }
+        else if ((argument == "--output") && (index + 1 < argc))
+        {
+            options.m_Output = argv[++index];
+        }
+        else if (argument == "--linear")
+        {
+            options.m_Linear = true;
+        }
+        else if (argument == "--no-flip")
+        {
+            options.m_Flip = false;
+        }
+        else if (argument == "--mip-chain")
+        {
+            options.m_MipChain = true;
+        }
+        else if (argument == "--gltf")
+        {
+            options.m_Gltf = true;
+        }
+        else if (argument.starts_with("--"))
+        {
+            PrintUsage();
+            return 1;
+        }
+        else
+        {
+            inputs.push_back(argument);
+        }
+    }
+    bool singleOutput = options.m_MipChain || (inputs.size() == 1);
+    if (inputs.empty() || (options.m_MipChain && options.m_Gltf) ||
+        (!options.m_Output.empty() && (!singleOutput || options.m_Gltf)))
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    if (options.m_MipChain)
+    {
+        for (auto const& input : inputs)
+        {
+            if (!IsHighDynamicRange(input))
+            {
+                std::cerr << "textureCooker: --mip-chain requires HDR or EXR images: " << input << '\n';
+                return 1;
+            }
+        }
+        std::string output = options.m_Output.empty() ? CookedTexture::GetCookedFilename(inputs[0]) : options.m_Output;
+        if (!CookHighDynamicRange(inputs, output, options))
+        {
+            std::cerr << "textureCooker: failed to cook " << inputs[0] << '\n';
+            return 1;
+        }
+        return 0;
+    }
+
+    int failed = 0;
+    for (auto const& input : inputs)
+    {
+        std::string output = options.m_Output.empty() ? CookedTexture::GetCookedFilename(input) : options.m_Output;
+        bool ok = false;
+        if (options.m_Gltf)
+        {
+            ok = CookGltfImages(input, options);
+        }
+        else if (IsHighDynamicRange(input))
+        {
+            ok = CookHighDynamicRange({input}, output, options);
+        }
+        else
+        {
+            ok = CookFile(input, output, options);
+        }
+        if (!ok)
+        {
+            std::cerr << "textureCooker: failed to cook " << input << '\n';
+            ++failed;
+        }
+    }
+    return failed ? 1 : 0;
+}
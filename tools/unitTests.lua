@@ -0,0 +1,71 @@
+
+-- Team Engine 2025
+
+-- CPU-side unit tests of engine code that does not need a device, see tools/unitTests/unitTests.h
+-- run bin/<config>/unitTests [filter]
+project "unitTests"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++20"
+
+    targetdir "../bin/%{cfg.buildcfg}"
+    objdir ("../bin-int/%{cfg.buildcfg}/unitTests")
+
+    defines
+    {
+        -- engine.h declares the profiler
+        "PROFILING"
+    }
+
+    files
+    {
+        "unitTests/**.h",
+        "unitTests/**.cpp",
+        "../engine/log/log.h",
+        "../engine/log/log.cpp",
+        "../engine/auxiliary/blockAllocator.h",
+        "../engine/auxiliary/blockAllocator.cpp",
+        "../engine/renderer/guiBatch.h",
+        "../engine/renderer/guiBatch.cpp",
+        "../engine/renderer/builder/terrainKernels.h",
+        "../engine/renderer/builder/terrainKernels.cpp",
+        "../engine/renderer/renderGraph.h",
+        "../engine/renderer/renderGraph.cpp",
+        "../engine/scene/registry.h",
+        "../engine/scene/registry.cpp"
+    }
+
+    includedirs
+    {
+        "../",
+        "../engine",
+        "../vendor",
+        "../vendor/entt/include",
+        "../vendor/glm",
+        "../vendor/spdlog/include",
+        "../vendor/tracy/include"
+    }
+
+    filter "system:linux"
+        links { "pthread" }
+
+    filter "configurations:Debug"
+        runtime "Debug"
+        symbols "on"
+
+    filter { "action:gmake*", "configurations:Debug"}
+        buildoptions { "-ggdb -Wall -Wextra -Wpedantic -Wshadow -Wno-unused-parameter" }
+
+    filter { "action:gmake*", "configurations:Release"}
+        buildoptions { "-Wall -Wextra -Wpedantic -Wshadow -Wno-unused-parameter" }
+
+    filter { "action:gmake*", "configurations:Dist"}
+        buildoptions { "-Wall -Wextra -Wpedantic -Wshadow -Wno-unused-parameter" }
+
+    filter "configurations:Release"
+        runtime "Release"
+        optimize "on"
+
+    filter { "configurations:Dist" }
+        defines { "NDEBUG" }
+        optimize "On"
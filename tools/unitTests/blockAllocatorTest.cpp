@@ -0,0 +1,158 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <algorithm>
+
+#include "auxiliary/blockAllocator.h"
+#include "unitTests.h"
+
+using namespace GfxRenderEngine;
+
+namespace
+{
+    constexpr uint64_t INVALID = BlockAllocator::INVALID_OFFSET;
+} // namespace
+
+TEST_CASE(LinearAlignment)
+{
+    LinearBlockAllocator allocator(4096);
+    uint64_t first = allocator.Allocate(10, 1);
+    uint64_t second = allocator.Allocate(100, 256);
+    uint64_t third = allocator.Allocate(1, 64);
+    CHECK(first == 0);
+    CHECK(second == 256);
+    CHECK(third == 384);
+
+    // the alignment padding is accounted to the allocation
+    CHECK(allocator.GetStats().m_Used == 385);
+    allocator.Free(second);
+    CHECK(allocator.GetStats().m_Used == 385 - 346);
+    CHECK(allocator.Allocate(5000, 1) == INVALID);
+    CHECK(allocator.Allocate(0, 1) == INVALID);
+}
+
+TEST_CASE(LinearFirstFitReuse)
+{
+    LinearBlockAllocator allocator(1024);
+    uint64_t a = allocator.Allocate(128, 1);
+    uint64_t b = allocator.Allocate(128, 1);
+    uint64_t c = allocator.Allocate(128, 1);
+    uint64_t d = allocator.Allocate(128, 1);
+    CHECK((a == 0) && (b == 128) && (c == 256) && (d == 384));
+
+    allocator.Free(b);
+    allocator.Free(d);
+    // the first free range that fits is taken, even if a later one fits as well
+    CHECK(allocator.Allocate(64, 1) == 128);
+    CHECK(allocator.Allocate(64, 1) == 192);
+    // d coalesced with the free tail of the block
+    CHECK(allocator.Allocate(64, 1) == 384);
+    CHECK(allocator.Allocate(256, 1) == 448);
+    CHECK(allocator.Allocate(512, 1) == INVALID);
+}
+
+TEST_CASE(LinearCoalescing)
+{
+    LinearBlockAllocator allocator(1024);
+    uint64_t a = allocator.Allocate(256, 1);
+    uint64_t b = allocator.Allocate(256, 1);
+    uint64_t c = allocator.Allocate(256, 1);
+    uint64_t d = allocator.Allocate(256, 1);
+    CHECK(allocator.GetStats().m_FreeRangeCount == 0);
+
+    allocator.Free(a);
+    allocator.Free(c);
+    CHECK(allocator.GetStats().m_FreeRangeCount == 2);
+    CHECK(allocator.GetFragmentation() > 0.0f);
+
+    // b joins its predecessor and its successor
+    allocator.Free(b);
+    BlockAllocator::Stats stats = allocator.GetStats();
+    CHECK(stats.m_FreeRangeCount == 1);
+    CHECK(stats.m_LargestFreeRange == 768);
+    CHECK(allocator.GetFragmentation() == 0.0f);
+
+    allocator.Free(d);
+    CHECK(allocator.IsEmpty());
+    CHECK(allocator.GetStats().m_LargestFreeRange == 1024);
+    CHECK(allocator.Allocate(1024, 1) == 0);
+}
+
+TEST_CASE(BuddySplitAndMerge)
+{
+    BuddyBlockAllocator allocator(4096 + 100); // rounded down to 4096
+    CHECK(allocator.GetSize() == 4096);
+
+    // 300 bytes need a 512 byte node, the 4096 byte root splits three times
+    uint64_t a = allocator.Allocate(300, 1);
+    CHECK(a == 0);
+    BlockAllocator::Stats stats = allocator.GetStats();
+    CHECK(stats.m_Used == 512);
+    CHECK(stats.m_FreeRangeCount == 3); // 512, 1024 and 2048
+    CHECK(stats.m_LargestFreeRange == 2048);
+
+    // the free buddy of a is taken next
+    uint64_t b = allocator.Allocate(BuddyBlockAllocator::MIN_NODE_SIZE, 1);
+    CHECK(b == 512);
+    uint64_t c = allocator.Allocate(256, 1);
+    CHECK(c == 768);
+
+    // alignment larger than the size selects a larger node
+    uint64_t d = allocator.Allocate(16, 2048);
+    CHECK(d == 2048);
+    CHECK(allocator.Allocate(2048, 1) == INVALID);
+
+    // the nodes merge back into the root once all buddies are free
+    // a cannot merge while c, the buddy of b, is allocated
+    allocator.Free(b);
+    allocator.Free(a);
+    CHECK(allocator.GetStats().m_FreeRangeCount == 3);
+    allocator.Free(c);
+    allocator.Free(d);
+    stats = allocator.GetStats();
+    CHECK(stats.m_FreeRangeCount == 1);
+    CHECK(stats.m_LargestFreeRange == 4096);
+    CHECK(allocator.Allocate(4096, 1) == 0);
+}
+
+TEST_CASE(AllocationOffsets)
+{
+    for (auto strategy : {BlockAllocator::Strategy::Linear, BlockAllocator::Strategy::Buddy})
+    {
+        auto allocator = BlockAllocator::Create(strategy, 4096);
+        CHECK(allocator->GetAllocationOffsets().empty());
+        uint64_t a = allocator->Allocate(512, 1);
+        uint64_t b = allocator->Allocate(1024, 1);
+        uint64_t c = allocator->Allocate(256, 1);
+        allocator->Free(b);
+        uint64_t d = allocator->Allocate(2048, 1);
+        CHECK((a != INVALID) && (c != INVALID) && (d != INVALID));
+
+        std::vector<uint64_t> offsets = allocator->GetAllocationOffsets();
+        CHECK(offsets.size() == 3);
+        CHECK(std::is_sorted(offsets.begin(), offsets.end()));
+        for (uint64_t offset : {a, c, d})
+        {
+            CHECK(std::find(offsets.begin(), offsets.end(), offset) != offsets.end());
+        }
+    }
+}
@@ -0,0 +1,133 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include <cmath>
+
+#include "renderer/guiBatch.h"
+#include "unitTests.h"
+
+using namespace GfxRenderEngine;
+
+namespace
+{
+    bool Near(float a, float b) { return std::abs(a - b) < 1e-5f; }
+
+    bool Near(glm::vec4 const& a, glm::vec4 const& b)
+    {
+        return Near(a.x, b.x) && Near(a.y, b.y) && Near(a.z, b.z) && Near(a.w, b.w);
+    }
+} // namespace
+
+TEST_CASE(GUIBatchPixelsToNDC)
+{
+    GUIBatch batch;
+    batch.Begin(800.0f, 600.0f);
+
+    // column 0: x, column 1: y of the corners 0 - 1, 3 - 2 (clockwise from the top left)
+    glm::mat4 position{0.0f};
+    position[0] = glm::vec4{0.0f, 800.0f, 800.0f, 0.0f};
+    position[1] = glm::vec4{0.0f, 0.0f, 600.0f, 600.0f};
+    glm::vec4 uv{0.1f, 0.2f, 0.3f, 0.4f};
+    batch.AddQuad(uv, position, glm::vec4{1.0f}, 1.0f);
+
+    // the center of a quarter of the screen
+    position[0] = glm::vec4{200.0f, 400.0f, 400.0f, 200.0f};
+    position[1] = glm::vec4{150.0f, 150.0f, 300.0f, 300.0f};
+    batch.AddQuad(uv, position, glm::vec4{1.0f}, 2.0f);
+
+    auto const& instances = batch.GetInstances();
+    CHECK(batch.GetInstanceCount() == 2);
+    CHECK(Near(instances[0].m_Corners01, glm::vec4{-1.0f, -1.0f, 1.0f, -1.0f}));
+    CHECK(Near(instances[0].m_Corners23, glm::vec4{1.0f, 1.0f, -1.0f, 1.0f}));
+    CHECK(Near(instances[0].m_UV, uv));
+    CHECK(instances[0].m_Flags == GUIBatch::REMOVE_GAMMA);
+
+    CHECK(Near(instances[1].m_Corners01, glm::vec4{-0.5f, -0.5f, 0.0f, -0.5f}));
+    CHECK(Near(instances[1].m_Corners23, glm::vec4{0.0f, 0.0f, -0.5f, 0.0f}));
+    CHECK(instances[1].m_Flags == (GUIBatch::REMOVE_GAMMA | GUIBatch::USE_TEXTURE2));
+}
+
+TEST_CASE(GUIBatchTransformToNDC)
+{
+    GUIBatch batch;
+    batch.Begin(800.0f, 600.0f);
+
+    // the [-1, 1] quad scaled by 0.5, moved right by 0.25 and projected with w = 2
+    glm::mat4 matrix = glm::translate(glm::mat4(1.0f), glm::vec3{0.25f, 0.0f, 0.0f}) *
+                       glm::scale(glm::mat4(1.0f), glm::vec3{0.5f, 0.5f, 1.0f});
+    matrix[3][3] = 2.0f;
+    batch.AddQuad(glm::vec4{0.0f, 0.0f, 1.0f, 1.0f}, matrix);
+
+    auto const& instance = batch.GetInstances()[0];
+    // corner 0 (-1, 1) -> (-0.25, 0.5) / 2
+    CHECK(Near(instance.m_Corners01, glm::vec4{-0.125f, 0.25f, 0.375f, 0.25f}));
+    CHECK(Near(instance.m_Corners23, glm::vec4{0.375f, -0.25f, -0.125f, -0.25f}));
+    CHECK(instance.m_Color == 0xffffffff);
+    CHECK(instance.m_Flags == 0);
+}
+
+TEST_CASE(GUIBatchPackColor)
+{
+    CHECK(GUIBatch::PackColor(glm::vec4{1.0f, 0.0f, 0.0f, 0.0f}) == 0x000000ff);
+    CHECK(GUIBatch::PackColor(glm::vec4{0.0f, 1.0f, 0.0f, 0.0f}) == 0x0000ff00);
+    CHECK(GUIBatch::PackColor(glm::vec4{0.0f, 0.0f, 1.0f, 0.0f}) == 0x00ff0000);
+    CHECK(GUIBatch::PackColor(glm::vec4{0.0f, 0.0f, 0.0f, 1.0f}) == 0xff000000);
+    // rounded to nearest, clamped to [0, 1]
+    CHECK(GUIBatch::PackColor(glm::vec4{0.5f, 0.25f, -1.0f, 2.0f}) == 0xff004080);
+
+    GUIBatch batch;
+    batch.Begin(2.0f, 2.0f);
+    batch.AddQuad(glm::vec4{0.0f}, glm::mat4{0.0f}, glm::vec4{0.0f, 0.0f, 1.0f, 0.5f}, 1.0f);
+    CHECK(batch.GetInstances()[0].m_Color == 0x80ff0000);
+}
+
+TEST_CASE(GUIBatchFlush)
+{
+    GUIBatch batch;
+    batch.Begin(800.0f, 600.0f);
+    GUIBatch::DrawRange range = batch.Flush();
+    CHECK(range.m_InstanceCount == 0);
+
+    for (int quad = 0; quad < 3; ++quad)
+    {
+        batch.AddQuad(glm::vec4{0.0f}, glm::mat4{1.0f});
+    }
+    range = batch.Flush();
+    CHECK((range.m_FirstInstance == 0) && (range.m_InstanceCount == 3));
+
+    // quads after a flush go into the next range, the instances of the frame are kept
+    batch.AddQuad(glm::vec4{0.0f}, glm::mat4{1.0f});
+    batch.AddQuad(glm::vec4{0.0f}, glm::mat4{1.0f});
+    range = batch.Flush();
+    CHECK((range.m_FirstInstance == 3) && (range.m_InstanceCount == 2));
+    CHECK(batch.GetInstanceCount() == 5);
+    range = batch.Flush();
+    CHECK((range.m_FirstInstance == 5) && (range.m_InstanceCount == 0));
+
+    // a new frame starts over
+    batch.Begin(800.0f, 600.0f);
+    batch.AddQuad(glm::vec4{0.0f}, glm::mat4{1.0f});
+    range = batch.Flush();
+    CHECK((range.m_FirstInstance == 0) && (range.m_InstanceCount == 1));
+    CHECK(sizeof(GUIBatch::QuadInstance) == 56);
+}
@@ -0,0 +1,164 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#include <atomic>
+#include <iterator>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "scene/registry.h"
+#include "unitTests.h"
+
+using namespace GfxRenderEngine;
+
+namespace
+{
+    struct Emplaced
+    {
+        int m_Value;
+    };
+
+    // no entity ever gets this component
+    struct NeverEmplaced
+    {
+        int m_Value;
+    };
+
+    struct WrittenConcurrently
+    {
+        int m_Value;
+    };
+
+    // reads through the registry from inside a structural change
+    struct StorageObserver
+    {
+        Registry* m_Registry;
+        int m_Valid{0};
+        void OnChange(entt::registry&, entt::entity entity)
+        {
+            if (m_Registry->valid(entity))
+            {
+                ++m_Valid;
+            }
+        }
+    };
+
+    size_t StorageCount(Registry& registry)
+    {
+        auto storage = std::as_const(registry.Get()).storage();
+        return static_cast<size_t>(std::distance(storage.begin(), storage.end()));
+    }
+} // namespace
+
+TEST_CASE(RegistryReadsDoNotCreateStorage)
+{
+    Registry registry;
+    entt::entity entity = registry.Create();
+    registry.emplace<Emplaced>(entity, 1);
+    size_t storageCount = StorageCount(registry);
+
+    CHECK(registry.try_get<NeverEmplaced>(entity) == nullptr);
+    CHECK(!registry.all_of<NeverEmplaced>(entity));
+    CHECK(registry.view<NeverEmplaced>().empty());
+    int viewed = 0;
+    for ([[maybe_unused]] auto viewEntity : registry.view<Emplaced>(entt::exclude<NeverEmplaced>))
+    {
+        ++viewed;
+    }
+    CHECK(viewed == 1);
+    CHECK(StorageCount(registry) == storageCount);
+
+    // writable through the lock-free path
+    registry.get<Emplaced>(entity).m_Value = 2;
+    for (auto viewEntity : registry.view<Emplaced>())
+    {
+        registry.view<Emplaced>().get<Emplaced>(viewEntity).m_Value += 1;
+    }
+    CHECK(registry.get<Emplaced>(entity).m_Value == 3);
+}
+
+TEST_CASE(RegistryConcurrentReadsOfMissingStorage)
+{
+    constexpr int NUMBER_OF_ENTITIES = 64;
+    constexpr int NUMBER_OF_READERS = 8;
+    constexpr int ITERATIONS = 2000;
+
+    Registry registry;
+    std::vector<entt::entity> entities;
+    for (int index = 0; index < NUMBER_OF_ENTITIES; ++index)
+    {
+        entities.push_back(registry.Create());
+        registry.emplace<Emplaced>(entities.back(), index);
+    }
+    size_t storageCount = StorageCount(registry);
+
+    std::atomic<int> errors{0};
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < NUMBER_OF_READERS; ++reader)
+    {
+        readers.emplace_back(
+            [&]()
+            {
+                for (int iteration = 0; iteration < ITERATIONS; ++iteration)
+                {
+                    entt::entity entity = entities[iteration % NUMBER_OF_ENTITIES];
+                    if (registry.try_get<NeverEmplaced>(entity) || registry.all_of<NeverEmplaced>(entity) ||
+                        !registry.view<NeverEmplaced>().empty() ||
+                        (registry.get<Emplaced>(entity).m_Value != iteration % NUMBER_OF_ENTITIES))
+                    {
+                        errors.fetch_add(1);
+                    }
+                }
+            });
+    }
+
+    // structural changes of another component type while the readers run
+    for (int index = 0; index < NUMBER_OF_ENTITIES; ++index)
+    {
+        registry.emplace<WrittenConcurrently>(entities[index], index);
+    }
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    CHECK(errors.load() == 0);
+    CHECK(registry.view<WrittenConcurrently>().size() == NUMBER_OF_ENTITIES);
+    // the writer created one storage, the readers none
+    CHECK(StorageCount(registry) == storageCount + 1);
+}
+
+TEST_CASE(RegistryReadsFromStorageCallbacks)
+{
+    Registry registry;
+    StorageObserver observer{&registry};
+    registry.ConnectStorage<Emplaced, &StorageObserver::OnChange>(observer);
+
+    entt::entity entity = registry.Create();
+    registry.emplace<Emplaced>(entity, 1);
+    registry.remove<Emplaced>(entity);
+    CHECK(observer.m_Valid == 2);
+
+    registry.DisconnectStorage<Emplaced>(observer);
+    registry.emplace<Emplaced>(entity, 2);
+    CHECK(observer.m_Valid == 2);
+}
@@ -0,0 +1,307 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include "renderer/renderGraph.h"
+#include "unitTests.h"
+
+using namespace GfxRenderEngine;
+
+namespace
+{
+    using Usage = RenderGraph::Usage;
+    using Layout = RenderGraph::Layout;
+
+    RenderGraph::ImageDescription Image(uint width, uint height, RenderGraph::Format format = RenderGraph::Format::RGBA8)
+    {
+        RenderGraph::ImageDescription description;
+        description.m_Width = width;
+        description.m_Height = height;
+        description.m_Format = format;
+        return description;
+    }
+
+    RenderGraph::CompiledPass const* FindCompiledPass(RenderGraph const& graph, RenderGraph::PassHandle pass)
+    {
+        for (auto const& compiledPass : graph.GetSchedule())
+        {
+            if (compiledPass.m_Pass == pass)
+            {
+                return &compiledPass;
+            }
+        }
+        return nullptr;
+    }
+
+    RenderGraph::Barrier const* FindBarrier(RenderGraph const& graph, RenderGraph::PassHandle pass,
+                                            RenderGraph::ResourceHandle resource)
+    {
+        RenderGraph::CompiledPass const* compiledPass = FindCompiledPass(graph, pass);
+        if (compiledPass)
+        {
+            for (auto const& barrier : compiledPass->m_Barriers)
+            {
+                if (barrier.m_Resource == resource)
+                {
+                    return &barrier;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    // deferred shading into a half-resolution bloom and post processing into the swapchain image
+    struct DeferredGraph
+    {
+        RenderGraph m_Graph;
+        RenderGraph::ResourceHandle m_SwapchainImage;
+        RenderGraph::ResourceHandle m_Depth;
+        RenderGraph::ResourceHandle m_Normal;
+        RenderGraph::ResourceHandle m_Color;
+        RenderGraph::ResourceHandle m_Bloom;
+        RenderGraph::PassHandle m_Geometry;
+        RenderGraph::PassHandle m_Lighting;
+        RenderGraph::PassHandle m_Transparency;
+        RenderGraph::PassHandle m_BloomPass;
+        RenderGraph::PassHandle m_PostProcessing;
+
+        DeferredGraph()
+        {
+            m_SwapchainImage =
+                m_Graph.ImportImage("swapchain image", Image(1280, 720), Layout::UNDEFINED, Layout::PRESENT);
+            m_Depth = m_Graph.CreateImage("depth", Image(1280, 720, RenderGraph::Format::DEPTH32));
+            m_Normal = m_Graph.CreateImage("normal", Image(1280, 720, RenderGraph::Format::RGBA16F));
+            m_Color = m_Graph.CreateImage("color", Image(1280, 720));
+            m_Bloom = m_Graph.CreateImage("bloom", Image(640, 360));
+
+            m_Geometry = m_Graph.AddPass("geometry");
+            m_Graph.Write(m_Geometry, m_Depth, Usage::DEPTH_ATTACHMENT);
+            m_Graph.Write(m_Geometry, m_Normal, Usage::COLOR_ATTACHMENT);
+
+            m_Lighting = m_Graph.AddPass("lighting");
+            m_Graph.Read(m_Lighting, m_Normal, Usage::INPUT_ATTACHMENT);
+            m_Graph.Write(m_Lighting, m_Color, Usage::COLOR_ATTACHMENT);
+
+            m_Transparency = m_Graph.AddPass("transparency");
+            m_Graph.Read(m_Transparency, m_Depth, Usage::DEPTH_READ);
+            m_Graph.Write(m_Transparency, m_Color, Usage::COLOR_ATTACHMENT);
+
+            m_BloomPass = m_Graph.AddPass("bloom");
+            m_Graph.Read(m_BloomPass, m_Color, Usage::SAMPLED);
+            m_Graph.Write(m_BloomPass, m_Bloom, Usage::COLOR_ATTACHMENT);
+
+            m_PostProcessing = m_Graph.AddPass("post processing");
+            m_Graph.Read(m_PostProcessing, m_Color, Usage::SAMPLED);
+            m_Graph.Read(m_PostProcessing, m_Bloom, Usage::SAMPLED);
+            m_Graph.Write(m_PostProcessing, m_SwapchainImage, Usage::COLOR_ATTACHMENT);
+        }
+    };
+} // namespace
+
+TEST_CASE(RenderGraphCulling)
+{
+    RenderGraph graph;
+    auto swapchainImage = graph.ImportImage("swapchain image", Image(64, 64), Layout::UNDEFINED, Layout::PRESENT);
+    auto unused = graph.CreateImage("unused", Image(64, 64));
+    auto color = graph.CreateImage("color", Image(64, 64));
+    auto readback = graph.CreateImage("readback", Image(64, 64));
+
+    auto debugPass = graph.AddPass("debug"); // nothing reads its result
+    graph.Write(debugPass, unused, Usage::COLOR_ATTACHMENT);
+    auto scenePass = graph.AddPass("scene");
+    graph.Write(scenePass, color, Usage::COLOR_ATTACHMENT);
+    auto compositePass = graph.AddPass("composite");
+    graph.Read(compositePass, color, Usage::SAMPLED);
+    graph.Write(compositePass, swapchainImage, Usage::COLOR_ATTACHMENT);
+    auto readbackPass = graph.AddPass("readback", RenderGraph::PassType::TRANSFER);
+    graph.Write(readbackPass, readback, Usage::TRANSFER_DESTINATION);
+    graph.SetSideEffect(readbackPass);
+
+    CHECK(graph.Compile());
+    CHECK(graph.IsCulled(debugPass));
+    CHECK(!graph.IsCulled(scenePass));
+    CHECK(!graph.IsCulled(compositePass));
+    CHECK(!graph.IsCulled(readbackPass));
+    CHECK(graph.GetNumberOfCulledPasses() == 1);
+    CHECK(graph.GetSchedule().size() == 3);
+    CHECK(FindCompiledPass(graph, debugPass) == nullptr);
+    // images of culled passes get no memory
+    CHECK(graph.GetPlacement(unused).m_Heap == RenderGraph::INVALID_HANDLE);
+    CHECK(graph.GetPlacement(swapchainImage).m_Heap == RenderGraph::INVALID_HANDLE);
+}
+
+TEST_CASE(RenderGraphReadBeforeWrite)
+{
+    RenderGraph graph;
+    auto color = graph.CreateImage("color", Image(64, 64));
+    auto pass = graph.AddPass("pass");
+    graph.Read(pass, color, Usage::SAMPLED);
+    graph.SetSideEffect(pass);
+    CHECK(!graph.Compile());
+}
+
+TEST_CASE(RenderGraphSubpassMerging)
+{
+    DeferredGraph deferred;
+    RenderGraph& graph = deferred.m_Graph;
+    CHECK(graph.Compile());
+
+    // geometry, lighting and transparency are pixel-local, bloom has a different extent,
+    // post processing samples an image written in the previous render pass
+    auto const& renderPasses = graph.GetRenderPasses();
+    CHECK(renderPasses.size() == 3);
+    if (renderPasses.size() != 3)
+    {
+        return;
+    }
+    CHECK(renderPasses[0].m_Subpasses.size() == 3);
+    CHECK(renderPasses[0].m_Width == 1280);
+    CHECK(renderPasses[0].m_Attachments.size() == 3);
+    CHECK(renderPasses[1].m_Subpasses.size() == 1);
+    CHECK(renderPasses[1].m_Width == 640);
+    CHECK(renderPasses[2].m_Subpasses.size() == 1);
+
+    auto const* transparency = FindCompiledPass(graph, deferred.m_Transparency);
+    CHECK(transparency && (transparency->m_RenderPass == 0) && (transparency->m_Subpass == 2));
+    auto const* postProcessing = FindCompiledPass(graph, deferred.m_PostProcessing);
+    CHECK(postProcessing && (postProcessing->m_RenderPass == 2) && (postProcessing->m_Subpass == 0));
+}
+
+TEST_CASE(RenderGraphBarrierLayouts)
+{
+    DeferredGraph deferred;
+    RenderGraph& graph = deferred.m_Graph;
+    CHECK(graph.Compile());
+
+    auto const* normalWrite = FindBarrier(graph, deferred.m_Geometry, deferred.m_Normal);
+    CHECK(normalWrite && (normalWrite->m_OldLayout == Layout::UNDEFINED) &&
+          (normalWrite->m_NewLayout == Layout::COLOR_ATTACHMENT) && !normalWrite->m_SubpassDependency);
+
+    // input attachment of the next subpass
+    auto const* normalRead = FindBarrier(graph, deferred.m_Lighting, deferred.m_Normal);
+    CHECK(normalRead && (normalRead->m_OldLayout == Layout::COLOR_ATTACHMENT) &&
+          (normalRead->m_NewLayout == Layout::SHADER_READ_ONLY) && normalRead->m_SubpassDependency);
+    CHECK(normalRead && (normalRead->m_SourceAccess == RenderGraph::ACCESS_COLOR_ATTACHMENT_WRITE) &&
+          (normalRead->m_DestinationAccess == RenderGraph::ACCESS_INPUT_ATTACHMENT_READ) &&
+          (normalRead->m_SourceStage == RenderGraph::STAGE_COLOR_ATTACHMENT_OUTPUT) &&
+          (normalRead->m_DestinationStage == RenderGraph::STAGE_FRAGMENT_SHADER));
+
+    auto const* depthRead = FindBarrier(graph, deferred.m_Transparency, deferred.m_Depth);
+    CHECK(depthRead && (depthRead->m_OldLayout == Layout::DEPTH_ATTACHMENT) &&
+          (depthRead->m_NewLayout == Layout::DEPTH_READ_ONLY) && depthRead->m_SubpassDependency);
+
+    // blending into the same color attachment needs no layout change but a write after write dependency
+    auto const* colorBlend = FindBarrier(graph, deferred.m_Transparency, deferred.m_Color);
+    CHECK(colorBlend && (colorBlend->m_OldLayout == Layout::COLOR_ATTACHMENT) &&
+          (colorBlend->m_NewLayout == Layout::COLOR_ATTACHMENT) && colorBlend->m_SubpassDependency);
+
+    auto const* colorSampled = FindBarrier(graph, deferred.m_BloomPass, deferred.m_Color);
+    CHECK(colorSampled && (colorSampled->m_NewLayout == Layout::SHADER_READ_ONLY) &&
+          !colorSampled->m_SubpassDependency);
+    // already in the right layout and seen by the fragment shader
+    CHECK(FindBarrier(graph, deferred.m_PostProcessing, deferred.m_Color) == nullptr);
+
+    auto const& finalBarriers = graph.GetFinalBarriers();
+    CHECK(finalBarriers.size() == 1);
+    CHECK(!finalBarriers.empty() && (finalBarriers[0].m_Resource == deferred.m_SwapchainImage) &&
+          (finalBarriers[0].m_OldLayout == Layout::COLOR_ATTACHMENT) && (finalBarriers[0].m_NewLayout == Layout::PRESENT));
+}
+
+TEST_CASE(RenderGraphHeapAliasing)
+{
+    // a chain of render passes, each one samples the image of the previous one
+    RenderGraph graph;
+    auto swapchainImage = graph.ImportImage("swapchain image", Image(256, 256), Layout::UNDEFINED, Layout::PRESENT);
+    auto depth = graph.CreateImage("depth", Image(256, 256, RenderGraph::Format::DEPTH32));
+    auto first = graph.CreateImage("first", Image(256, 256));
+    auto second = graph.CreateImage("second", Image(256, 256));
+    auto third = graph.CreateImage("third", Image(256, 256));
+
+    auto firstPass = graph.AddPass("first");
+    graph.Write(firstPass, depth, Usage::DEPTH_ATTACHMENT);
+    graph.Write(firstPass, first, Usage::COLOR_ATTACHMENT);
+    auto secondPass = graph.AddPass("second");
+    graph.Read(secondPass, first, Usage::SAMPLED);
+    graph.Write(secondPass, second, Usage::COLOR_ATTACHMENT);
+    auto thirdPass = graph.AddPass("third");
+    graph.Read(thirdPass, second, Usage::SAMPLED);
+    graph.Write(thirdPass, third, Usage::COLOR_ATTACHMENT);
+    auto presentPass = graph.AddPass("present");
+    graph.Read(presentPass, third, Usage::SAMPLED);
+    graph.Write(presentPass, swapchainImage, Usage::COLOR_ATTACHMENT);
+
+    CHECK(graph.Compile());
+
+    auto const& firstPlacement = graph.GetPlacement(first);
+    auto const& secondPlacement = graph.GetPlacement(second);
+    auto const& thirdPlacement = graph.GetPlacement(third);
+    auto const& depthPlacement = graph.GetPlacement(depth);
+    // first and third are never alive at the same time
+    CHECK((thirdPlacement.m_Heap == firstPlacement.m_Heap) && (thirdPlacement.m_Offset == firstPlacement.m_Offset));
+    // second overlaps both
+    bool secondSeparate = (secondPlacement.m_Heap != firstPlacement.m_Heap) ||
+                          (secondPlacement.m_Offset >= firstPlacement.m_Offset + firstPlacement.m_Size) ||
+                          (firstPlacement.m_Offset >= secondPlacement.m_Offset + secondPlacement.m_Size);
+    CHECK(secondSeparate);
+    // depth images have heaps of their own
+    CHECK((depthPlacement.m_Heap != firstPlacement.m_Heap) && (depthPlacement.m_Heap != secondPlacement.m_Heap));
+    CHECK(graph.GetHeapSizes().size() == 3);
+
+    // the first use of the aliasing image waits for the last write and reads of the aliased one
+    auto const* aliasing = FindBarrier(graph, thirdPass, third);
+    CHECK(aliasing && (aliasing->m_AliasedResource == first) && (aliasing->m_OldLayout == Layout::UNDEFINED) &&
+          (aliasing->m_SourceStage == (RenderGraph::STAGE_COLOR_ATTACHMENT_OUTPUT | RenderGraph::STAGE_FRAGMENT_SHADER)));
+    auto const* notAliasing = FindBarrier(graph, secondPass, second);
+    CHECK(notAliasing && (notAliasing->m_AliasedResource == RenderGraph::INVALID_HANDLE));
+
+    CHECK(graph.GetTransientMemory(false) == 4 * RenderGraph::GetImageSize(Image(256, 256)));
+    CHECK(graph.GetTransientMemory(true) == 3 * RenderGraph::GetImageSize(Image(256, 256)));
+}
+
+TEST_CASE(RenderGraphMemoryRequirements)
+{
+    // the large image is dead when the small ones are used, they share its memory
+    RenderGraph graph;
+    auto large = graph.CreateImage("large", Image(16, 16));
+    auto small = graph.CreateImage("small", Image(16, 16));
+    auto aligned = graph.CreateImage("aligned", Image(16, 16));
+    graph.SetMemoryRequirements(large, 3 * 65536, 65536);
+    graph.SetMemoryRequirements(small, 1000, 256);
+    graph.SetMemoryRequirements(aligned, 1000, 131072);
+
+    auto firstPass = graph.AddPass("first");
+    graph.Write(firstPass, large, Usage::COLOR_ATTACHMENT);
+    graph.SetSideEffect(firstPass);
+    auto secondPass = graph.AddPass("second");
+    graph.Write(secondPass, small, Usage::COLOR_ATTACHMENT);
+    graph.Write(secondPass, aligned, Usage::COLOR_ATTACHMENT);
+    graph.SetSideEffect(secondPass);
+
+    CHECK(graph.Compile(65536));
+    CHECK(graph.GetHeapSizes().size() == 1);
+    CHECK(!graph.GetHeapSizes().empty() && (graph.GetHeapSizes()[0] == 3 * 65536));
+    CHECK(graph.GetPlacement(large).m_Size == 3 * 65536);
+    CHECK(graph.GetPlacement(small).m_Offset == 0);
+    CHECK(graph.GetPlacement(small).m_Size == 65536);
+    // the next free offset is 65536, the image needs 131072
+    CHECK(graph.GetPlacement(aligned).m_Offset == 131072);
+}
@@ -0,0 +1,128 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include <random>
+
+#include "renderer/builder/terrainKernels.h"
+#include "unitTests.h"
+
+using namespace GfxRenderEngine;
+using namespace GfxRenderEngine::TerrainKernels;
+
+namespace
+{
+    // three rows of random heights, wide enough for the vector loops and their scalar tails
+    constexpr int COLS = 37;
+
+    std::vector<uchar> RandomBytes(size_t count)
+    {
+        std::vector<uchar> bytes(count);
+        std::mt19937 generator(1);
+        std::uniform_int_distribution<int> byte(0, 255);
+        for (auto& value : bytes)
+        {
+            value = static_cast<uchar>(byte(generator));
+        }
+        return bytes;
+    }
+
+    std::vector<InstructionSet> AvailableInstructionSets()
+    {
+        std::vector<InstructionSet> instructionSets{InstructionSet::Scalar};
+        if (GetInstructionSet() != InstructionSet::Scalar)
+        {
+            instructionSets.push_back(InstructionSet::SSE2);
+        }
+        if (GetInstructionSet() == InstructionSet::AVX2)
+        {
+            instructionSets.push_back(InstructionSet::AVX2);
+        }
+        return instructionSets;
+    }
+} // namespace
+
+TEST_CASE(TerrainKernelsNormalsAndTangents)
+{
+    std::vector<uchar> heights = RandomBytes(3 * COLS);
+    uchar const* down = heights.data();
+    uchar const* center = down + COLS;
+    uchar const* up = center + COLS;
+
+    RowScratch reference;
+    reference.Resize(COLS);
+    NormalsAndTangentsOfRow(down, center, up, COLS, reference, InstructionSet::Scalar);
+
+    // the sum of the four face normals around a pixel, normalized
+    for (int col = 1; col < COLS - 1; ++col)
+    {
+        glm::vec3 normal = glm::normalize(glm::vec3(static_cast<float>(center[col - 1]) - center[col + 1], 2.0f * 255.0f,
+                                                    static_cast<float>(down[col]) - up[col]));
+        glm::vec3 tangent = glm::vec3(reference.m_TangentX[col], reference.m_TangentY[col], 0.0f);
+        CHECK(glm::length(normal - glm::vec3(reference.m_NormalX[col], reference.m_NormalY[col], reference.m_NormalZ[col])) <
+              1e-6f);
+        CHECK(std::abs(glm::dot(normal, tangent)) < 1e-6f);
+        CHECK(std::abs(glm::length(tangent) - 1.0f) < 1e-6f);
+    }
+
+    // all paths return the same bits
+    for (auto instructionSet : AvailableInstructionSets())
+    {
+        RowScratch scratch;
+        scratch.Resize(COLS);
+        NormalsAndTangentsOfRow(down, center, up, COLS, scratch, instructionSet);
+        for (int col = 1; col < COLS - 1; ++col)
+        {
+            CHECK(scratch.m_NormalX[col] == reference.m_NormalX[col]);
+            CHECK(scratch.m_NormalY[col] == reference.m_NormalY[col]);
+            CHECK(scratch.m_NormalZ[col] == reference.m_NormalZ[col]);
+            CHECK(scratch.m_TangentX[col] == reference.m_TangentX[col]);
+            CHECK(scratch.m_TangentY[col] == reference.m_TangentY[col]);
+        }
+    }
+}
+
+TEST_CASE(TerrainKernelsUnpackColors)
+{
+    std::vector<uchar> rgba = RandomBytes(COLS * 4);
+
+    // into a strided array, the gaps are left alone
+    struct StridedColor
+    {
+        glm::vec4 m_Color;
+        float m_Other;
+    };
+
+    for (auto instructionSet : AvailableInstructionSets())
+    {
+        std::vector<StridedColor> colors(COLS, StridedColor{glm::vec4{-1.0f}, 7.0f});
+        UnpackColorsOfRow(rgba.data(), COLS, &colors[0].m_Color[0], sizeof(StridedColor), instructionSet);
+        for (int col = 0; col < COLS; ++col)
+        {
+            for (int channel = 0; channel < 4; ++channel)
+            {
+                CHECK(colors[col].m_Color[channel] == rgba[col * 4 + channel] / 255.0f);
+            }
+            CHECK(colors[col].m_Other == 7.0f);
+        }
+    }
+}
@@ -0,0 +1,87 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+// unitTests: runs the CPU-side tests of engine code that does not need a device
+//
+// usage: unitTests [filter]
+//
+// Returns 0 if all checks passed, 1 otherwise.
+
+#include <cstring>
+#include <iostream>
+
+#include "engine.h"
+#include "unitTests.h"
+
+// engine code under test logs errors
+std::unique_ptr<GfxRenderEngine::Log> g_Logger;
+
+namespace GfxRenderEngine
+{
+    namespace UnitTests
+    {
+        namespace
+        {
+            int g_Failures = 0;
+        }
+
+        std::vector<TestCase>& GetTestCases()
+        {
+            static std::vector<TestCase> testCases;
+            return testCases;
+        }
+
+        void ReportFailure(char const* file, int line, char const* expression)
+        {
+            std::cerr << file << ":" << line << ": check failed: " << expression << std::endl;
+            ++g_Failures;
+        }
+    } // namespace UnitTests
+} // namespace GfxRenderEngine
+
+int main(int argc, char* argv[])
+{
+    using namespace GfxRenderEngine::UnitTests;
+    char const* filter = (argc > 1) ? argv[1] : nullptr;
+    g_Logger = std::make_unique<GfxRenderEngine::Log>();
+
+    int testsRun = 0;
+    int testsFailed = 0;
+    for (auto const& testCase : GetTestCases())
+    {
+        if (filter && !std::strstr(testCase.m_Name, filter))
+        {
+            continue;
+        }
+        int failuresBefore = g_Failures;
+        testCase.m_Function();
+        ++testsRun;
+        if (g_Failures != failuresBefore)
+        {
+            ++testsFailed;
+            std::cerr << "FAILED: " << testCase.m_Name << std::endl;
+        }
+    }
+    std::cout << testsRun << " test(s) run, " << testsFailed << " failed" << std::endl;
+    return (testsFailed == 0) ? 0 : 1;
+}
@@ -0,0 +1,69 @@
+/* Engine Copyright (c) 2025 Engine Development Team
+   https://github.com/beaumanvienna/vulkan
+
+   Permission is hereby granted, free of charge, to any person
+   obtaining a copy of this software and associated documentation files
+   (the "Software"), to deal in the Software without restriction,
+   including without limitation the rights to use, copy, modify, merge,
+   publish, distribute, sublicense, and/or sell copies of the Software,
+   and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include <vector>
+
+// minimal test registry for CPU-only engine code, see tools/unitTests.lua
+//
+// TEST_CASE(name) { CHECK(expression); ... }
+//
+// Test cases register themselves at static initialization, unitTests runs all of them or the ones
+// whose name contains the first command line argument. CHECK reports a failure and keeps going.
+
+namespace GfxRenderEngine
+{
+    namespace UnitTests
+    {
+        using TestFunction = void (*)();
+
+        struct TestCase
+        {
+            char const* m_Name;
+            TestFunction m_Function;
+        };
+
+        std::vector<TestCase>& GetTestCases();
+        void ReportFailure(char const* file, int line, char const* expression);
+
+        struct TestRegistrar
+        {
+            TestRegistrar(char const* name, TestFunction function) { GetTestCases().push_back({name, function}); }
+        };
+    } // namespace UnitTests
+} // namespace GfxRenderEngine
+
+#define TEST_CASE(name)                                                                                                     \
+    static void name();                                                                                                     \
+    static GfxRenderEngine::UnitTests::TestRegistrar name##Registrar{#name, name};                                          \
+    static void name()
+
+#define CHECK(expression)                                                                                                   \
+    do                                                                                                                      \
+    {                                                                                                                       \
+        if (!(expression))                                                                                                  \
+        {                                                                                                                   \
+            GfxRenderEngine::UnitTests::ReportFailure(__FILE__, __LINE__, #expression);                                     \
+        }                                                                                                                   \
+    } while (false)